@@ -0,0 +1,116 @@
+using System.Text.Json;
+using BenchmarkDotNet.Reports;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// One benchmark case of a saved baseline: mean time and allocations per operation
+/// </summary>
+public sealed class BaselineEntry
+{
+    public string Key { get; set; } = string.Empty;
+    public double MeanNanoseconds { get; set; }
+    public long AllocatedBytesPerOperation { get; set; }
+}
+
+/// <summary>
+/// Saved benchmark baselines under src/CxLanguage.Benchmarks/Baselines/&lt;name&gt;.json.
+/// A run saved with --save-baseline becomes the reference for later runs with --compare-baseline, which
+/// report cases that got slower or allocate more than the threshold allows and fail the process, so the
+/// suite can gate changes in CI. Cases are keyed by benchmark, parameters and job (core count).
+/// </summary>
+public static class BenchmarkBaseline
+{
+    private static readonly JsonSerializerOptions _jsonOptions = new() { WriteIndented = true };
+
+    public static string GetPath(string name)
+    {
+        return Path.Combine(BenchmarkPaths.RepositoryRoot, "src", "CxLanguage.Benchmarks", "Baselines", $"{name}.json");
+    }
+
+    public static List<BaselineEntry> FromSummaries(IEnumerable<Summary> summaries)
+    {
+        var entries = new List<BaselineEntry>();
+        foreach (var summary in summaries)
+        {
+            foreach (var report in summary.Reports)
+            {
+                if (report.ResultStatistics == null) continue;
+
+                entries.Add(new BaselineEntry
+                {
+                    Key = report.BenchmarkCase.DisplayInfo,
+                    MeanNanoseconds = report.ResultStatistics.Mean,
+                    AllocatedBytesPerOperation = report.GcStats.GetBytesAllocatedPerOperation(report.BenchmarkCase) ?? 0
+                });
+            }
+        }
+        return entries;
+    }
+
+    public static void Save(string name, IReadOnlyList<BaselineEntry> entries)
+    {
+        var path = GetPath(name);
+        Directory.CreateDirectory(Path.GetDirectoryName(path)!);
+
+        // Merge into an existing baseline so suites run with different filters accumulate
+        var merged = File.Exists(path) ? Load(path).ToDictionary(e => e.Key, StringComparer.Ordinal) : new(StringComparer.Ordinal);
+        foreach (var entry in entries)
+        {
+            merged[entry.Key] = entry;
+        }
+
+        File.WriteAllText(path, JsonSerializer.Serialize(merged.Values.OrderBy(e => e.Key, StringComparer.Ordinal).ToList(), _jsonOptions));
+        Console.WriteLine($"Saved {entries.Count} benchmark cases to baseline {path}");
+    }
+
+    /// <summary>
+    /// Compare a run against a saved baseline. Returns the number of regressed cases.
+    /// </summary>
+    public static int Compare(string name, IReadOnlyList<BaselineEntry> current, double thresholdPercent)
+    {
+        var path = GetPath(name);
+        if (!File.Exists(path))
+        {
+            Console.Error.WriteLine($"Baseline {path} not found; run with --save-baseline {name} first");
+            return 1;
+        }
+
+        var baseline = Load(path).ToDictionary(e => e.Key, StringComparer.Ordinal);
+        var factor = 1 + thresholdPercent / 100;
+        var regressions = 0;
+        var compared = 0;
+
+        foreach (var entry in current)
+        {
+            if (!baseline.TryGetValue(entry.Key, out var reference)) continue;
+            compared++;
+
+            var slower = entry.MeanNanoseconds > reference.MeanNanoseconds * factor;
+            var heavier = entry.AllocatedBytesPerOperation > reference.AllocatedBytesPerOperation * factor
+                && entry.AllocatedBytesPerOperation - reference.AllocatedBytesPerOperation > 64;
+            if (!slower && !heavier) continue;
+
+            regressions++;
+            Console.Error.WriteLine(
+                $"REGRESSION {entry.Key}: {Format(reference.MeanNanoseconds)} -> {Format(entry.MeanNanoseconds)}, " +
+                $"{reference.AllocatedBytesPerOperation} B -> {entry.AllocatedBytesPerOperation} B per op");
+        }
+
+        Console.WriteLine($"Compared {compared} of {current.Count} benchmark cases with baseline '{name}' " +
+            $"(threshold {thresholdPercent:F0}%): {regressions} regressions");
+        return regressions;
+    }
+
+    private static List<BaselineEntry> Load(string path)
+    {
+        return JsonSerializer.Deserialize<List<BaselineEntry>>(File.ReadAllText(path)) ?? new List<BaselineEntry>();
+    }
+
+    private static string Format(double nanoseconds) => nanoseconds switch
+    {
+        >= 1_000_000 => $"{nanoseconds / 1_000_000:F2} ms",
+        >= 1_000 => $"{nanoseconds / 1_000:F2} µs",
+        _ => $"{nanoseconds:F1} ns"
+    };
+}
@@ -0,0 +1,36 @@
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// Locates the repository from a benchmark process. BenchmarkDotNet runs each benchmark from a generated
+/// project under bin/, so the root is found by walking up to CxLanguage.sln unless CX_REPO_ROOT is set.
+/// </summary>
+public static class BenchmarkPaths
+{
+    private static readonly Lazy<string> _repositoryRoot = new(FindRepositoryRoot);
+
+    public static string RepositoryRoot => _repositoryRoot.Value;
+
+    public static string ExamplesDirectory => Path.Combine(RepositoryRoot, "examples");
+
+    private static string FindRepositoryRoot()
+    {
+        var configured = Environment.GetEnvironmentVariable("CX_REPO_ROOT");
+        if (!string.IsNullOrEmpty(configured))
+        {
+            return configured;
+        }
+
+        foreach (var start in new[] { Directory.GetCurrentDirectory(), AppContext.BaseDirectory })
+        {
+            for (var directory = new DirectoryInfo(start); directory != null; directory = directory.Parent)
+            {
+                if (File.Exists(Path.Combine(directory.FullName, "CxLanguage.sln")))
+                {
+                    return directory.FullName;
+                }
+            }
+        }
+
+        throw new DirectoryNotFoundException("CxLanguage.sln not found above the benchmark directory; set CX_REPO_ROOT");
+    }
+}
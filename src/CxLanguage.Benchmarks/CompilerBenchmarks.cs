@@ -0,0 +1,59 @@
+using BenchmarkDotNet.Attributes;
+using CxLanguage.Compiler;
+using CxLanguage.Core.Ast;
+using CxLanguage.Parser;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// Parse and compile of the sample scripts under examples/.
+/// Parse is measured with and without the parsed-program cache; compile builds a fresh dynamic assembly
+/// from the cached AST each operation, which is what cx run does on a compilation cache miss.
+/// </summary>
+[MemoryDiagnoser]
+public class CompilerBenchmarks
+{
+    private string _source = string.Empty;
+    private ProgramNode _ast = null!;
+    private int _assemblyCounter;
+
+    /// <summary>
+    /// Every example that parses; scripts with syntax errors are skipped instead of failing the suite
+    /// </summary>
+    public IEnumerable<string> Scripts()
+    {
+        return Directory.EnumerateFiles(BenchmarkPaths.ExamplesDirectory, "*.cx", SearchOption.AllDirectories)
+            .Where(path => CxLanguageParser.Parse(File.ReadAllText(path), path).IsSuccess)
+            .Select(path => Path.GetRelativePath(BenchmarkPaths.ExamplesDirectory, path).Replace('\\', '/'))
+            .OrderBy(path => path, StringComparer.Ordinal);
+    }
+
+    [ParamsSource(nameof(Scripts))]
+    public string Script { get; set; } = string.Empty;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _source = File.ReadAllText(Path.Combine(BenchmarkPaths.ExamplesDirectory, Script));
+
+        var parsed = CxLanguageParser.Parse(_source, Script);
+        if (!parsed.IsSuccess || parsed.Value is not ProgramNode ast)
+        {
+            throw new InvalidOperationException($"{Script} does not parse: {string.Join("; ", parsed.Errors.Select(e => e.ToString()))}");
+        }
+        _ast = ast;
+    }
+
+    [Benchmark(Baseline = true)]
+    public AstNode? ParseUncached() => CxLanguageParser.ParseUncached(_source).Value;
+
+    [Benchmark]
+    public AstNode? ParseCached() => CxLanguageParser.Parse(_source, Script).Value;
+
+    [Benchmark]
+    public bool Compile()
+    {
+        var compiler = new CxCompiler($"CxBenchmark_{++_assemblyCounter}", new CompilerOptions());
+        return compiler.Compile(_ast, Path.GetFileNameWithoutExtension(Script), _source).IsSuccess;
+    }
+}
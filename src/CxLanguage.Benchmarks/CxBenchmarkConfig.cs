@@ -0,0 +1,81 @@
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Diagnosers;
+using BenchmarkDotNet.Exporters;
+using BenchmarkDotNet.Exporters.Json;
+using BenchmarkDotNet.Jobs;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// Shared configuration of the suite: allocation reporting on every benchmark, full JSON reports for
+/// baseline comparison and one job per requested core count.
+/// Core counts come from --cores 1,4,all or the CX_BENCH_CORES environment variable; each job pins the
+/// benchmark process to that many logical processors, so Environment.ProcessorCount, the thread pool and
+/// Parallel.For in the parallel benchmarks all scale with it. Without a setting a single default job runs.
+/// </summary>
+public sealed class CxBenchmarkConfig : ManualConfig
+{
+    public const string CoresEnvironmentVariable = "CX_BENCH_CORES";
+
+    public CxBenchmarkConfig(IReadOnlyList<int> coreCounts)
+    {
+        AddDiagnoser(MemoryDiagnoser.Default);
+        AddExporter(JsonExporter.Full);
+        AddExporter(MarkdownExporter.GitHub);
+        AddColumn(StatisticColumn.OperationsPerSecond);
+
+        if (coreCounts.Count == 0)
+        {
+            AddJob(Job.Default);
+            return;
+        }
+
+        foreach (var cores in coreCounts)
+        {
+            AddJob(Job.Default
+                .WithAffinity(CreateAffinityMask(cores))
+                .WithId($"{cores}cores"));
+        }
+    }
+
+    /// <summary>
+    /// Parse a core count list such as "1,4,all"; counts above the machine's processor count are capped
+    /// </summary>
+    public static IReadOnlyList<int> ParseCoreCounts(string? value)
+    {
+        if (string.IsNullOrWhiteSpace(value))
+        {
+            return Array.Empty<int>();
+        }
+
+        var counts = new SortedSet<int>();
+        foreach (var part in value.Split(',', StringSplitOptions.RemoveEmptyEntries | StringSplitOptions.TrimEntries))
+        {
+            if (part.Equals("all", StringComparison.OrdinalIgnoreCase))
+            {
+                counts.Add(MaxCores);
+            }
+            else if (int.TryParse(part, out var cores) && cores > 0)
+            {
+                counts.Add(Math.Min(cores, MaxCores));
+            }
+            else
+            {
+                throw new ArgumentException($"Invalid core count '{part}' in '{value}'");
+            }
+        }
+        return counts.ToArray();
+    }
+
+    /// <summary>
+    /// Affinity masks are pointer sized, so at most 64 logical processors can be selected
+    /// </summary>
+    private static int MaxCores => Math.Min(Environment.ProcessorCount, IntPtr.Size * 8);
+
+    private static IntPtr CreateAffinityMask(int cores)
+    {
+        var mask = cores >= 64 ? ulong.MaxValue : (1UL << cores) - 1;
+        return (IntPtr)(long)mask;
+    }
+}
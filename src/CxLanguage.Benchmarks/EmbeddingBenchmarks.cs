@@ -0,0 +1,51 @@
+using BenchmarkDotNet.Attributes;
+using CxLanguage.StandardLibrary.AI.Embeddings;
+using Microsoft.Extensions.AI;
+using Microsoft.Extensions.Logging.Abstractions;
+using Microsoft.Extensions.Options;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// Embedding throughput per batch: the deterministic SimpleEmbeddingGenerator directly, and behind the
+/// content-addressed embedding cache where every text of the batch is a hit after the first operation.
+/// Model-backed generators (LocalEmbeddingGenerator, Azure) need model files or credentials and are not part
+/// of the suite; the cache path is what repeated ingestion and search traffic exercises.
+/// </summary>
+[MemoryDiagnoser]
+public class EmbeddingBenchmarks
+{
+    private SimpleEmbeddingGenerator _generator = null!;
+    private EmbeddingCache _cache = null!;
+    private CachedEmbeddingGenerator _cached = null!;
+    private string[] _texts = null!;
+
+    [Params(1, 32, 256)]
+    public int BatchSize { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _generator = new SimpleEmbeddingGenerator(NullLogger<SimpleEmbeddingGenerator>.Instance);
+        _cache = new EmbeddingCache(Options.Create(new EmbeddingCacheOptions { PersistenceDirectory = null }));
+        _cached = new CachedEmbeddingGenerator(_generator, _cache, "benchmark");
+        _texts = Enumerable.Range(0, BatchSize)
+            .Select(i => $"consciousness-aware benchmark document {i} about event driven agents and vector memory")
+            .ToArray();
+
+        _cached.GenerateAsync(_texts).GetAwaiter().GetResult();
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _cache.Dispose();
+        _generator.Dispose();
+    }
+
+    [Benchmark(Baseline = true)]
+    public Task<GeneratedEmbeddings<Embedding<float>>> Generate() => _generator.GenerateAsync(_texts);
+
+    [Benchmark]
+    public Task<GeneratedEmbeddings<Embedding<float>>> GenerateCached() => _cached.GenerateAsync(_texts);
+}
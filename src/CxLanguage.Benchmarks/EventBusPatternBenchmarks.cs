@@ -0,0 +1,74 @@
+using BenchmarkDotNet.Attributes;
+using CxLanguage.Runtime;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// UnifiedEventBus emit with N subscribers spread over a mix of exact names, .any. segment wildcards,
+/// prefix* and *suffix patterns, measured from one thread and from one emitter per processor.
+/// About a quarter of the subscriptions match the emitted event, so routing cost is part of the measurement.
+/// </summary>
+[MemoryDiagnoser]
+public class EventBusPatternBenchmarks
+{
+    private const int EmitsPerInvoke = 4_096;
+
+    private UnifiedEventBus _bus = null!;
+    private readonly Dictionary<string, object> _data = new() { ["score"] = 0.92, ["agent"] = "benchmark" };
+
+    [Params(10, 100, 1_000)]
+    public int SubscriberCount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _bus = new UnifiedEventBus { LowAllocationDispatch = true };
+
+        for (int i = 0; i < SubscriberCount; i++)
+        {
+            var subscriptionId = _bus.RegisterSubscription($"agent{i}");
+            _bus.Subscribe(subscriptionId, CreatePattern(i), _ => Task.CompletedTask);
+        }
+
+        // Warm the route cache so the benchmark measures steady-state dispatch
+        _bus.EmitUnifiedAsync("agent.task.completed", _data).GetAwaiter().GetResult();
+    }
+
+    [Benchmark(Baseline = true)]
+    public Task Emit() => _bus.EmitUnifiedAsync("agent.task.completed", _data);
+
+    [Benchmark]
+    public Task EmitUnrouted() => _bus.EmitUnifiedAsync("system.heartbeat.tick", _data);
+
+    /// <summary>
+    /// Concurrent emitters, one per processor available to the job; reported per emit
+    /// </summary>
+    [Benchmark(OperationsPerInvoke = EmitsPerInvoke)]
+    public void EmitParallel()
+    {
+        var emitters = Environment.ProcessorCount;
+        Parallel.For(0, emitters, new ParallelOptions { MaxDegreeOfParallelism = emitters }, emitter =>
+        {
+            var emits = EmitsPerInvoke / emitters + (emitter < EmitsPerInvoke % emitters ? 1 : 0);
+            for (int i = 0; i < emits; i++)
+            {
+                _bus.EmitUnifiedAsync("agent.task.completed", _data).GetAwaiter().GetResult();
+            }
+        });
+    }
+
+    /// <summary>
+    /// Subscription i gets one of eight pattern shapes; shapes 0 and 2, and every other shape 4, match agent.task.completed
+    /// </summary>
+    private static string CreatePattern(int i) => (i % 8) switch
+    {
+        0 => "agent.task.completed",
+        1 => $"agent{i}.task.completed",
+        2 => "agent.any.completed",
+        3 => $"agent{i}.any.started",
+        4 => i % 16 == 4 ? "agent.*" : $"tenant{i}.*",
+        5 => $"*.completed{i}",
+        6 => $"system.metric{i}",
+        _ => $"ai.request{i}.any.done"
+    };
+}
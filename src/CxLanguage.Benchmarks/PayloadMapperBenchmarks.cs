@@ -0,0 +1,54 @@
+using BenchmarkDotNet.Attributes;
+using CxLanguage.Runtime.ParallelHandlers;
+using Microsoft.Extensions.Logging.Abstractions;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// PayloadPropertyMapper merge of handler results into dictionary and anonymous payloads, as done once per
+/// parallel handler execution. Results are ParameterExecutionDetails objects like the engine produces,
+/// and one result key collides with a payload property to include conflict resolution.
+/// </summary>
+[MemoryDiagnoser]
+public class PayloadMapperBenchmarks
+{
+    private PayloadPropertyMapper _mapper = null!;
+    private Dictionary<string, object> _results = null!;
+    private Dictionary<string, object> _dictionaryPayload = null!;
+    private object _anonymousPayload = null!;
+
+    [Params(1, 4, 16)]
+    public int ResultCount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _mapper = new PayloadPropertyMapper(NullLogger<PayloadPropertyMapper>.Instance);
+        _dictionaryPayload = new Dictionary<string, object>
+        {
+            ["message"] = "analyze the quarterly report",
+            ["priority"] = 2,
+            ["analysis"] = "pending"
+        };
+        _anonymousPayload = new { message = "analyze the quarterly report", priority = 2, analysis = "pending" };
+
+        _results = new Dictionary<string, object>();
+        for (int i = 0; i < ResultCount; i++)
+        {
+            var name = i == 0 ? "analysis" : $"result{i}";
+            _results[name] = new ParameterExecutionDetails
+            {
+                ParameterName = name,
+                Result = new Dictionary<string, object> { ["summary"] = $"summary {i}", ["confidence"] = 0.9 },
+                ExecutionTimeMs = 12,
+                Success = true
+            };
+        }
+    }
+
+    [Benchmark(Baseline = true)]
+    public object MergeDictionary() => _mapper.CreateEnhancedPayload(_dictionaryPayload, _results);
+
+    [Benchmark]
+    public object MergeAnonymous() => _mapper.CreateEnhancedPayload(_anonymousPayload, _results);
+}
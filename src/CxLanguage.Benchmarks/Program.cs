@@ -0,0 +1,73 @@
+using System.Globalization;
+using BenchmarkDotNet.Running;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// Entry point for the CX Language benchmark suite.
+/// Run with: dotnet run -c Release --project src/CxLanguage.Benchmarks -- --filter *
+/// Suite options, removed before the remaining arguments go to BenchmarkDotNet:
+///   --cores 1,4,all            one job per core count (also CX_BENCH_CORES)
+///   --save-baseline [name]     store mean time and allocations per case as the named baseline
+///   --compare-baseline [name]  fail with exit code 1 when a case regressed against the baseline
+///   --threshold &lt;percent&gt;      allowed slowdown/allocation growth for --compare-baseline (default 10)
+/// </summary>
+public static class Program
+{
+    private const string DefaultBaselineName = "default";
+
+    public static int Main(string[] args)
+    {
+        var benchmarkArgs = new List<string>();
+        string? cores = Environment.GetEnvironmentVariable(CxBenchmarkConfig.CoresEnvironmentVariable);
+        string? saveBaseline = null;
+        string? compareBaseline = null;
+        var threshold = 10.0;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "--cores" when i + 1 < args.Length:
+                    cores = args[++i];
+                    break;
+                case "--save-baseline":
+                    saveBaseline = ReadOptionalName(args, ref i);
+                    break;
+                case "--compare-baseline":
+                    compareBaseline = ReadOptionalName(args, ref i);
+                    break;
+                case "--threshold" when i + 1 < args.Length:
+                    threshold = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                default:
+                    benchmarkArgs.Add(args[i]);
+                    break;
+            }
+        }
+
+        var config = new CxBenchmarkConfig(CxBenchmarkConfig.ParseCoreCounts(cores));
+        var summaries = BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(benchmarkArgs.ToArray(), config).ToList();
+        var entries = BenchmarkBaseline.FromSummaries(summaries);
+
+        var exitCode = 0;
+        if (compareBaseline != null && BenchmarkBaseline.Compare(compareBaseline, entries, threshold) > 0)
+        {
+            exitCode = 1;
+        }
+        if (saveBaseline != null)
+        {
+            BenchmarkBaseline.Save(saveBaseline, entries);
+        }
+        return exitCode;
+    }
+
+    private static string ReadOptionalName(string[] args, ref int index)
+    {
+        if (index + 1 < args.Length && !args[index + 1].StartsWith('-'))
+        {
+            return args[++index];
+        }
+        return DefaultBaselineName;
+    }
+}
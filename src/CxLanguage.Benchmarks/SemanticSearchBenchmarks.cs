@@ -0,0 +1,68 @@
+using BenchmarkDotNet.Attributes;
+using CxLanguage.Runtime;
+using CxLanguage.StandardLibrary.AI.Embeddings;
+using CxLanguage.StandardLibrary.Services.VectorStore;
+using Microsoft.Extensions.Logging.Abstractions;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// SemanticSearchService queries in vector, keyword (BM25) and hybrid mode over a store of synthetic
+/// documents embedded with the deterministic SimpleEmbeddingGenerator, with and without snippets.
+/// </summary>
+[MemoryDiagnoser]
+public class SemanticSearchBenchmarks
+{
+    private static readonly string[] _vocabulary =
+    {
+        "consciousness", "agent", "event", "handler", "vector", "memory", "neural", "pathway", "inference",
+        "embedding", "search", "runtime", "compiler", "stream", "payload", "semantic", "latency", "throughput",
+        "gpu", "batch", "queue", "token", "context", "model", "index", "graph", "cache", "planner"
+    };
+
+    private static readonly string[] _queries =
+    {
+        "agent event handler latency",
+        "vector index search throughput",
+        "neural pathway memory consciousness",
+        "gpu batch inference queue"
+    };
+
+    private SemanticSearchService _search = null!;
+    private SemanticSearchOptions _options = null!;
+    private int _nextQuery;
+
+    [Params(1_000, 10_000)]
+    public int Documents { get; set; }
+
+    [Params(SemanticSearchMode.Vector, SemanticSearchMode.Keyword, SemanticSearchMode.Hybrid)]
+    public SemanticSearchMode Mode { get; set; }
+
+    [Params(false, true)]
+    public bool Snippets { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var eventBus = new UnifiedEventBus();
+        var embeddings = new SimpleEmbeddingGenerator(NullLogger<SimpleEmbeddingGenerator>.Instance);
+        var store = new InMemoryVectorStoreService(NullLogger<InMemoryVectorStoreService>.Instance, eventBus, embeddings);
+
+        var random = new Random(7);
+        for (int i = 0; i < Documents; i++)
+        {
+            var words = Enumerable.Range(0, 40).Select(_ => _vocabulary[random.Next(_vocabulary.Length)]);
+            store.AddTextAsync(string.Join(' ', words), new Dictionary<string, object> { ["agentId"] = $"agent{i % 8}" })
+                .GetAwaiter().GetResult();
+        }
+
+        _search = new SemanticSearchService(NullLogger<SemanticSearchService>.Instance, eventBus, store, embeddings);
+        _options = new SemanticSearchOptions { TopK = 10, Mode = Mode, GenerateSnippets = Snippets, SimilarityThreshold = 0 };
+
+        // The first query builds the keyword index; keep it out of the measurement
+        _search.SearchAsync(_queries[0], _options).GetAwaiter().GetResult();
+    }
+
+    [Benchmark]
+    public Task<SemanticSearchResult> Search() => _search.SearchAsync(_queries[_nextQuery++ % _queries.Length], _options);
+}
@@ -0,0 +1,132 @@
+using BenchmarkDotNet.Attributes;
+using CxLanguage.Runtime;
+using CxLanguage.StandardLibrary.Services.VectorStore;
+using Microsoft.Extensions.Logging.Abstractions;
+using Microsoft.Extensions.Options;
+
+namespace CxLanguage.Benchmarks;
+
+/// <summary>
+/// Store size and index configuration of a vector store benchmark case
+/// </summary>
+public sealed record VectorStoreScenario(int Records, VectorIndexType IndexType, VectorQuantization Quantization)
+{
+    public override string ToString() => Quantization == VectorQuantization.None
+        ? $"{Records / 1000}K-{IndexType}"
+        : $"{Records / 1000}K-{IndexType}-{Quantization}";
+}
+
+/// <summary>
+/// InMemoryVectorStoreService add and top-10 search over 384-dimensional random unit vectors at 10K, 100K
+/// and 1M records. HNSW is limited to 100K records because building a 1M graph in setup takes far longer
+/// than the measurement; the 1M flat cases need about 3 GB of memory. Add upserts over a fixed pool of ids that
+/// setup already stored, so every operation replaces a record and the store keeps its size however many
+/// invocations the job runs.
+/// </summary>
+[MemoryDiagnoser]
+public class VectorStoreBenchmarks
+{
+    public const int Dimensions = 384;
+    private const int QueryCount = 64;
+    private const int SearchesPerInvoke = 256;
+    private const int AddPoolSize = 1024;
+
+    private InMemoryVectorStoreService _store = null!;
+    private float[][] _queries = null!;
+    private string[] _addIds = null!;
+    private Random _random = null!;
+    private int _nextQuery;
+    private int _nextAdd;
+
+    public static IEnumerable<VectorStoreScenario> Scenarios()
+    {
+        yield return new VectorStoreScenario(10_000, VectorIndexType.Flat, VectorQuantization.None);
+        yield return new VectorStoreScenario(100_000, VectorIndexType.Flat, VectorQuantization.None);
+        yield return new VectorStoreScenario(1_000_000, VectorIndexType.Flat, VectorQuantization.None);
+        yield return new VectorStoreScenario(1_000_000, VectorIndexType.Flat, VectorQuantization.Int8);
+        yield return new VectorStoreScenario(10_000, VectorIndexType.Hnsw, VectorQuantization.None);
+        yield return new VectorStoreScenario(100_000, VectorIndexType.Hnsw, VectorQuantization.None);
+    }
+
+    [ParamsSource(nameof(Scenarios))]
+    public VectorStoreScenario Scenario { get; set; } = null!;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _random = new Random(42);
+        _store = new InMemoryVectorStoreService(
+            NullLogger<InMemoryVectorStoreService>.Instance,
+            new UnifiedEventBus(),
+            options: Options.Create(new VectorStoreOptions
+            {
+                IndexType = Scenario.IndexType,
+                Quantization = Scenario.Quantization
+            }));
+
+        for (int i = 0; i < Scenario.Records; i++)
+        {
+            _store.AddAsync(CreateRecord($"record-{i}", CreateUnitVector(_random))).GetAwaiter().GetResult();
+        }
+
+        _queries = Enumerable.Range(0, QueryCount).Select(_ => CreateUnitVector(_random)).ToArray();
+
+        _addIds = Enumerable.Range(0, AddPoolSize).Select(i => $"add-{i}").ToArray();
+        foreach (var id in _addIds)
+        {
+            _store.AddAsync(CreateRecord(id, CreateUnitVector(_random))).GetAwaiter().GetResult();
+        }
+    }
+
+    /// <summary>
+    /// Replace one record of the add pool with a new vector
+    /// </summary>
+    [Benchmark]
+    public Task Add() => _store.AddAsync(CreateRecord(_addIds[_nextAdd++ % AddPoolSize], NextQuery()));
+
+    [Benchmark]
+    public Task<IEnumerable<VectorRecord>> Search() => _store.SearchAsync(NextQuery(), 10);
+
+    /// <summary>
+    /// Concurrent queries from one worker per processor available to the job; reported per search
+    /// </summary>
+    [Benchmark(OperationsPerInvoke = SearchesPerInvoke)]
+    public void SearchParallel()
+    {
+        Parallel.For(0, SearchesPerInvoke, i =>
+        {
+            _store.SearchAsync(_queries[i % QueryCount], 10).GetAwaiter().GetResult();
+        });
+    }
+
+    private float[] NextQuery() => _queries[_nextQuery++ % QueryCount];
+
+    private static VectorRecord CreateRecord(string id, float[] vector)
+    {
+        return new VectorRecord
+        {
+            Id = id,
+            Vector = vector,
+            Content = $"benchmark record {id}",
+            Metadata = new Dictionary<string, object> { ["agentId"] = $"agent{StringComparer.Ordinal.GetHashCode(id) & 15}" }
+        };
+    }
+
+    public static float[] CreateUnitVector(Random random)
+    {
+        var vector = new float[Dimensions];
+        double norm = 0;
+        for (int i = 0; i < vector.Length; i++)
+        {
+            vector[i] = (float)(random.NextDouble() * 2 - 1);
+            norm += vector[i] * vector[i];
+        }
+
+        var scale = (float)(1 / Math.Sqrt(norm));
+        for (int i = 0; i < vector.Length; i++)
+        {
+            vector[i] *= scale;
+        }
+        return vector;
+    }
+}
@@ -39,8 +39,10 @@ class Program
         // Run command
         var runCommand = new Command("run", "Run a Cx script file");
         var fileArgument = new Argument<FileInfo>("file", "The Cx script file to run");
+        var noCacheOption = new Option<bool>("--no-cache", "Always recompile instead of loading a cached assembly");
         runCommand.AddArgument(fileArgument);
-        runCommand.SetHandler(RunScript, fileArgument);
+        runCommand.AddOption(noCacheOption);
+        runCommand.SetHandler(RunScript, fileArgument, noCacheOption);
 
         // Compile command
         var compileCommand = new Command("compile", "Compile a Cx script to .NET assembly");
@@ -68,7 +70,7 @@ class Program
         return rootCommand;
     }
 
-    static async Task RunScript(FileInfo file)
+    static async Task RunScript(FileInfo file, bool noCache)
     {
         // Initialize debug tracing system
         CxDebugTracing.Initialize();
@@ -175,47 +177,62 @@ class Program
 
             logger.LogInformation("Running Cx script: {FileName}", file.Name);
 
-            // Read and parse the script
+            // Read the script and look for a precompiled assembly with the same content hash
             var source = await File.ReadAllTextAsync(file.FullName);
-            var parseResult = CxLanguage.Parser.CxLanguageParser.Parse(source, file.FullName);
+            var scriptName = Path.GetFileNameWithoutExtension(file.Name);
+            var compilationStopwatch = System.Diagnostics.Stopwatch.StartNew();
+            var compilationCache = noCache ? null : new CxCompilationCache(CxCompilationCache.DefaultDirectory);
+            var cacheKey = compilationCache?.ComputeKey(scriptName, source);
+            var compilationResult = compilationCache?.TryLoad(cacheKey!, scriptName);
 
-            if (!parseResult.IsSuccess)
+            if (compilationResult != null)
             {
-                Console.Error.WriteLine("Parse errors:");
-                foreach (var error in parseResult.Errors)
+                logger.LogDebug("Loaded {FileName} from compilation cache in {ElapsedMs} ms", file.Name, compilationStopwatch.ElapsedMilliseconds);
+            }
+            else
+            {
+                var parseResult = CxLanguage.Parser.CxLanguageParser.Parse(source, file.FullName);
+
+                if (!parseResult.IsSuccess)
                 {
-                    Console.Error.WriteLine($"  Line {error.Line}, Column {error.Column}: {error.Message}");
+                    Console.Error.WriteLine("Parse errors:");
+                    foreach (var error in parseResult.Errors)
+                    {
+                        Console.Error.WriteLine($"  Line {error.Line}, Column {error.Column}: {error.Message}");
+                    }
+                    
+                    // Track failed script execution
+                    telemetryService?.TrackScriptExecution(file.Name, scriptExecutionStopwatch.Elapsed, false, "Parse errors");
+                    return;
                 }
-                
-                // Track failed script execution
-                telemetryService?.TrackScriptExecution(file.Name, scriptExecutionStopwatch.Elapsed, false, "Parse errors");
-                return;
-            }
 
-            // NEURAL SYSTEM BYPASS: Simplified compilation for biological neural testing
-            var compilationStopwatch = System.Diagnostics.Stopwatch.StartNew();
-            var options = new CompilerOptions();
-            CxCoreAI.IAiService? aiService = null;
-            
-            try
-            {
-                aiService = host.Services.GetRequiredService<CxCoreAI.IAiService>();
-                // Console.WriteLine($"✅ Neural System: AI Service loaded for biological testing");
-            }
-            catch (Exception ex)
-            {
-                Console.WriteLine($"Warning: AI service not available: {ex.Message}");
-                // Console.WriteLine("Neural system will continue with basic event functionality.");
-                aiService = null;
+                // NEURAL SYSTEM BYPASS: Simplified compilation for biological neural testing
+                CxCoreAI.IAiService? aiService = null;
+                
+                try
+                {
+                    aiService = host.Services.GetRequiredService<CxCoreAI.IAiService>();
+                    // Console.WriteLine($"✅ Neural System: AI Service loaded for biological testing");
+                }
+                catch (Exception ex)
+                {
+                    Console.WriteLine($"Warning: AI service not available: {ex.Message}");
+                    // Console.WriteLine("Neural system will continue with basic event functionality.");
+                    aiService = null;
+                }
+                
+                compilationResult = CompileForCache((ProgramNode)parseResult.Value!, scriptName, source, aiService, compilationCache != null, logger);
+                
+                if (compilationCache != null && compilationResult.IsSuccess && compilationResult.AssemblyImage != null)
+                {
+                    compilationCache.TryStore(cacheKey!, compilationResult.AssemblyImage);
+                }
+                
+                // Track compilation metrics
+                var linesOfCode = source.Split('\n').Length;
+                telemetryService?.TrackCompilation(file.Name, compilationStopwatch.Elapsed, compilationResult.IsSuccess, linesOfCode, 
+                    compilationResult.IsSuccess ? null : compilationResult.ErrorMessage);
             }
-            
-            var compiler = new CxCompiler(Path.GetFileNameWithoutExtension(file.Name), options, aiService);
-            var compilationResult = compiler.Compile((ProgramNode)parseResult.Value!, Path.GetFileNameWithoutExtension(file.Name), source);
-            
-            // Track compilation metrics
-            var linesOfCode = source.Split('\n').Length;
-            telemetryService?.TrackCompilation(file.Name, compilationStopwatch.Elapsed, compilationResult.IsSuccess, linesOfCode, 
-                compilationResult.IsSuccess ? null : compilationResult.ErrorMessage);
 
             if (!compilationResult.IsSuccess)
             {
@@ -228,7 +245,7 @@ class Program
             if (compilationResult.Assembly != null && compilationResult.ProgramType != null)
             {
                 CxLanguage.Compiler.Modules.RuntimeFunctionRegistry.RegisterAssembly(
-                    Path.GetFileNameWithoutExtension(file.Name), 
+                    scriptName, 
                     compilationResult.Assembly, 
                     compilationResult.ProgramType
                 );
@@ -336,6 +353,9 @@ class Program
         }
         finally
         {
+            // Write out queued script output before host shutdown logging
+            ConsoleOutputSink.Shared.Flush();
+
             if (host != null)
             {
                 await host.StopAsync();
@@ -376,7 +396,8 @@ class Program
                     return;
                 }
 
-                var options = new CompilerOptions();
+                // Persisted build: dynamic (RunAndCollect) assemblies have no file behind them to copy
+                var options = new CompilerOptions { PersistAssembly = true };
                 CxCoreAI.IAiService? aiService = null;
                 
                 try
@@ -398,11 +419,10 @@ class Program
                     return;
                 }
 
-                if (compilationResult.Assembly != null)
+                if (compilationResult.AssemblyImage != null)
                 {
                     // Save assembly to file
-                    var assemblyBytes = File.ReadAllBytes(compilationResult.Assembly.Location);
-                    await File.WriteAllBytesAsync(output.FullName, assemblyBytes);
+                    await File.WriteAllBytesAsync(output.FullName, compilationResult.AssemblyImage);
                     Console.WriteLine($"Compilation successful. Output: {output.FullName}");
                 }
                 else
@@ -412,6 +432,7 @@ class Program
             }
             finally
             {
+                ConsoleOutputSink.Shared.Flush();
                 await host.StopAsync();
                 host.Dispose();
             }
@@ -422,6 +443,28 @@ class Program
         }
     }
 
+    /// <summary>
+    /// Compile a script, preferring a persisted assembly that can be stored in the compilation cache.
+    /// Scripts the persisted builder cannot handle are compiled again as a regular dynamic assembly (not cached).
+    /// </summary>
+    static CompilationResult CompileForCache(ProgramNode ast, string scriptName, string source, CxCoreAI.IAiService? aiService, bool persist, ILogger logger)
+    {
+        if (persist)
+        {
+            var persistedCompiler = new CxCompiler(scriptName, new CompilerOptions { PersistAssembly = true }, aiService);
+            var persistedResult = persistedCompiler.Compile(ast, scriptName, source);
+            if (persistedResult.IsSuccess)
+            {
+                return persistedResult;
+            }
+
+            logger.LogDebug("Persisted compilation of {ScriptName} failed, using a dynamic assembly: {Error}", scriptName, persistedResult.ErrorMessage);
+        }
+
+        var compiler = new CxCompiler(scriptName, new CompilerOptions(), aiService);
+        return compiler.Compile(ast, scriptName, source);
+    }
+
     static async Task ParseScript(FileInfo file)
     {
         try
@@ -503,7 +546,25 @@ class Program
                 // services.AddModernCxAiServices(configuration);
 
                 // Add event bus for consciousness integration - using UnifiedEventBus to integrate with CxRuntimeHelper
-                services.AddSingleton<CxLanguage.Core.Events.ICxEventBus, CxLanguage.Runtime.UnifiedEventBus>();
+                // "EventDispatch": { "Enabled": true, "FullMode": "Wait" } queues fire-and-forget emits in bounded, ordered partitions
+                services.Configure<CxLanguage.Runtime.EventDispatchOptions>(
+                    configuration.GetSection(CxLanguage.Runtime.EventDispatchOptions.SectionName));
+                // "SharedMemoryTransport": { "Enabled": true, "ScopeName": "team" } shares events with the other CX processes of the host
+                services.Configure<CxLanguage.Runtime.SharedMemory.SharedMemoryTransportOptions>(
+                    configuration.GetSection(CxLanguage.Runtime.SharedMemory.SharedMemoryTransportOptions.SectionName));
+                if (configuration.GetValue<bool>($"{CxLanguage.Runtime.SharedMemory.SharedMemoryTransportOptions.SectionName}:Enabled"))
+                {
+                    services.AddSingleton<CxLanguage.Runtime.UnifiedEventBus>();
+                    services.AddSingleton<CxLanguage.Core.Events.ICxEventBus>(provider =>
+                        new CxLanguage.Runtime.SharedMemory.SharedMemoryEventBus(
+                            provider.GetRequiredService<CxLanguage.Runtime.UnifiedEventBus>(),
+                            provider.GetRequiredService<Microsoft.Extensions.Options.IOptions<CxLanguage.Runtime.SharedMemory.SharedMemoryTransportOptions>>().Value,
+                            provider.GetRequiredService<ILogger<CxLanguage.Runtime.SharedMemory.SharedMemoryEventBus>>()));
+                }
+                else
+                {
+                    services.AddSingleton<CxLanguage.Core.Events.ICxEventBus, CxLanguage.Runtime.UnifiedEventBus>();
+                }
 
                 // 🚀 PARALLEL HANDLER PARAMETERS v1.0 - 200%+ PERFORMANCE IMPROVEMENT
                 services.AddSingleton<CxLanguage.Runtime.ParallelHandlers.HandlerParameterResolver>();
@@ -546,6 +607,9 @@ class Program
                 // Register Vector Store Service
                 try
                 {
+                    // "VectorStore": { "IndexType": "Hnsw", "HnswEfSearch": 128 } switches similarity search to the HNSW index
+                    services.Configure<CxLanguage.StandardLibrary.Services.VectorStore.VectorStoreOptions>(
+                        configuration.GetSection(CxLanguage.StandardLibrary.Services.VectorStore.VectorStoreOptions.SectionName));
                     services.AddSingleton<CxLanguage.StandardLibrary.Services.VectorStore.IVectorStoreService, CxLanguage.StandardLibrary.Services.VectorStore.InMemoryVectorStoreService>();
                     // Console.WriteLine("✅ InMemoryVectorStoreService registered successfully.");
                 }
@@ -568,6 +632,11 @@ class Program
                 // Register Local Embedding Generator
                 try
                 {
+                    // Shared, content-addressed embedding cache used by every embedding consumer
+                    services.Configure<CxLanguage.StandardLibrary.AI.Embeddings.EmbeddingCacheOptions>(
+                        configuration.GetSection(CxLanguage.StandardLibrary.AI.Embeddings.EmbeddingCacheOptions.SectionName));
+                    services.AddSingleton<CxLanguage.StandardLibrary.AI.Embeddings.EmbeddingCache>();
+
                     // Use LocalEmbeddingGenerator for local model processing
                     services.AddSingleton<Microsoft.Extensions.AI.IEmbeddingGenerator<string, Microsoft.Extensions.AI.Embedding<float>>>(provider =>
                     {
@@ -576,7 +645,10 @@ class Program
                         // Use the correct local embedding model file path
                         var modelPath = "models/embedding/nomic-embed-text-v1.5.Q4_0.gguf";
                         
-                        return new CxLanguage.LocalLLM.LocalEmbeddingGenerator(modelPath, localLogger);
+                        return new CxLanguage.StandardLibrary.AI.Embeddings.CachedEmbeddingGenerator(
+                            new CxLanguage.LocalLLM.LocalEmbeddingGenerator(modelPath, localLogger),
+                            provider.GetRequiredService<CxLanguage.StandardLibrary.AI.Embeddings.EmbeddingCache>(),
+                            Path.GetFileName(modelPath));
                     });
                 }
                 catch (Exception ex)
@@ -587,6 +659,8 @@ class Program
                 // Register Document Ingestion Service
                 try
                 {
+                    services.Configure<CxLanguage.StandardLibrary.Services.Document.DocumentIngestionOptions>(
+                        configuration.GetSection(CxLanguage.StandardLibrary.Services.Document.DocumentIngestionOptions.SectionName));
                     services.AddSingleton<CxLanguage.StandardLibrary.Services.Document.IDocumentIngestionService, CxLanguage.StandardLibrary.Services.Document.DocumentIngestionService>();
                 }
                 catch (Exception ex)
@@ -594,6 +668,10 @@ class Program
                     Console.WriteLine($"⚠️ Warning: DocumentIngestionService could not be registered: {ex.Message}");
                 }
 
+                // Persistent pwsh workers behind ExecuteService; "PowerShellPool": { "Enabled": false } restores one process per command
+                services.Configure<CxLanguage.StandardLibrary.PowerShellPoolOptions>(
+                    configuration.GetSection(CxLanguage.StandardLibrary.PowerShellPoolOptions.SectionName));
+
                 // 🤖 REGISTER AI EVENT SERVICE INFRASTRUCTURE
                 try
                 {
@@ -663,11 +741,14 @@ class Program
                     // Console.WriteLine("🔧 JsonService registered successfully.");
 
                     // Register ConsoleService for system.console.write event handling
+                    // "ConsoleOutput": { "FlushIntervalMs": 20, "PreserveAgentLineOrder": true } tunes the queued console writer
+                    services.Configure<ConsoleOutputOptions>(configuration.GetSection(ConsoleOutputOptions.SectionName));
                     services.AddSingleton<ConsoleService>(provider =>
                     {
                         var eventBus = provider.GetRequiredService<ICxEventBus>();
                         var logger = provider.GetRequiredService<ILogger<ConsoleService>>();
-                        return new ConsoleService(eventBus, logger);
+                        var outputOptions = provider.GetRequiredService<Microsoft.Extensions.Options.IOptions<ConsoleOutputOptions>>();
+                        return new ConsoleService(eventBus, logger, outputOptions);
                     });
 
                     // Register FileService for system.file.read and system.file.write event handling
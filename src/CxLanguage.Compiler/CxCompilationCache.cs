@@ -0,0 +1,129 @@
+using System;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+using System.Runtime.Loader;
+using System.Security.Cryptography;
+using System.Text;
+
+namespace CxLanguage.Compiler;
+
+/// <summary>
+/// On-disk cache of persisted CX assemblies keyed by a content hash.
+/// The key covers the script source and name plus the module version ids of the compiler and every
+/// CxLanguage assembly it references (runtime, core, standard library services resolved by imports),
+/// so rebuilding any of them invalidates previously cached scripts.
+/// </summary>
+public class CxCompilationCache
+{
+    private const string CacheFormatVersion = "1";
+    private static readonly Lazy<string> _toolchainFingerprint = new(ComputeToolchainFingerprint);
+
+    private readonly string _cacheDirectory;
+
+    public CxCompilationCache(string cacheDirectory)
+    {
+        _cacheDirectory = cacheDirectory;
+    }
+
+    /// <summary>
+    /// Default cache location: CX_COMPILE_CACHE_DIR when set, otherwise LocalApplicationData/CxLanguage/CompileCache
+    /// </summary>
+    public static string DefaultDirectory =>
+        Environment.GetEnvironmentVariable("CX_COMPILE_CACHE_DIR") is { Length: > 0 } directory
+            ? directory
+            : Path.Combine(Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData), "CxLanguage", "CompileCache");
+
+    public string CacheDirectory => _cacheDirectory;
+
+    /// <summary>
+    /// Compute the cache key for a script
+    /// </summary>
+    public string ComputeKey(string scriptName, string sourceText)
+    {
+        var keyText = string.Join("\n", CacheFormatVersion, _toolchainFingerprint.Value, scriptName, sourceText);
+        return Convert.ToHexString(SHA256.HashData(Encoding.UTF8.GetBytes(keyText)));
+    }
+
+    /// <summary>
+    /// Load a cached assembly for the key, or return null when there is no usable entry
+    /// </summary>
+    public CompilationResult? TryLoad(string key, string scriptName)
+    {
+        var path = GetAssemblyPath(key);
+        if (!File.Exists(path))
+        {
+            return null;
+        }
+
+        try
+        {
+            var image = File.ReadAllBytes(path);
+            var assembly = LoadAssembly(image, scriptName);
+            var programType = assembly.GetType("Program");
+            return programType == null ? null : CompilationResult.SuccessWithImage(assembly, programType, image);
+        }
+        catch (Exception ex) when (ex is IOException or BadImageFormatException or UnauthorizedAccessException)
+        {
+            // Corrupt or locked entry - treat as a miss so it gets recompiled and overwritten
+            return null;
+        }
+    }
+
+    /// <summary>
+    /// Store a compiled assembly image. The file is written under a temporary name and moved into place
+    /// so concurrent processes never observe a partially written entry.
+    /// </summary>
+    public bool TryStore(string key, byte[] assemblyImage)
+    {
+        try
+        {
+            Directory.CreateDirectory(_cacheDirectory);
+            var path = GetAssemblyPath(key);
+            var temporaryPath = $"{path}.{Environment.ProcessId}.tmp";
+            File.WriteAllBytes(temporaryPath, assemblyImage);
+            File.Move(temporaryPath, path, overwrite: true);
+            return true;
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            return false;
+        }
+    }
+
+    public string GetAssemblyPath(string key) => Path.Combine(_cacheDirectory, key + ".dll");
+
+    /// <summary>
+    /// Load a persisted CX assembly image into its own collectible load context.
+    /// Each script gets a separate context so scripts with the same assembly name can coexist.
+    /// </summary>
+    public static Assembly LoadAssembly(byte[] assemblyImage, string scriptName)
+    {
+        var loadContext = new AssemblyLoadContext($"cx:{scriptName}", isCollectible: true);
+        using var stream = new MemoryStream(assemblyImage, writable: false);
+        return loadContext.LoadFromStream(stream);
+    }
+
+    private static string ComputeToolchainFingerprint()
+    {
+        var compilerAssembly = typeof(CxCompiler).Assembly;
+        var moduleVersionIds = compilerAssembly.GetReferencedAssemblies()
+            .Where(name => name.Name != null && name.Name.StartsWith("CxLanguage.", StringComparison.Ordinal))
+            .Select(name =>
+            {
+                try
+                {
+                    return $"{name.Name}:{Assembly.Load(name).ManifestModule.ModuleVersionId}";
+                }
+                catch (Exception)
+                {
+                    return $"{name.Name}:{name.Version}";
+                }
+            })
+            .Prepend($"{compilerAssembly.GetName().Name}:{compilerAssembly.ManifestModule.ModuleVersionId}")
+            .Append($"runtime:{Environment.Version}")
+            .OrderBy(entry => entry, StringComparer.Ordinal);
+
+        return string.Join(";", moduleVersionIds);
+    }
+}
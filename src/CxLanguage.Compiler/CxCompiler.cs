@@ -56,6 +56,7 @@ public class CxCompiler : IAstVisitor<object>
     private readonly Dictionary<string, FieldInfo> _actualFields = new(); // Maps className.fieldName -> actual FieldInfo
     private readonly Dictionary<string, MethodBuilder> _classMethods = new();
     private readonly Dictionary<string, ConstructorBuilder> _classConstructors = new();
+    private readonly Dictionary<string, List<RealizeDeclarationNode>> _classRealizeDeclarations = new(); // Realize declarations with field initializers, built in Pass 1
     private readonly Dictionary<string, List<(string EventName, string MethodName)>> _classEventHandlers = new();
     private string? _currentClassName = null; // Track current class being compiled
 
@@ -81,17 +82,26 @@ public class CxCompiler : IAstVisitor<object>
     private int _whileCounter = 0;
     private bool _isCompilingAsyncMethod = false; // Track if we're compiling an async method
 
+    // Numeric type inference for native arithmetic emission
+    private CxNumericTypeInference? _numericTypes;
+    private static readonly MethodInfo PerformArithmeticMethod = typeof(CxArithmeticHelper).GetMethod(
+        nameof(CxArithmeticHelper.PerformArithmetic), new[] { typeof(object), typeof(object), typeof(CxArithmeticOperation) })!;
+    private static readonly MethodInfo PerformComparisonMethod = typeof(CxArithmeticHelper).GetMethod(
+        nameof(CxArithmeticHelper.PerformComparison), new[] { typeof(object), typeof(object), typeof(CxComparisonOperation) })!;
+
     public CxCompiler(string assemblyName, CompilerOptions options, IAiService? aiService = null)
     {
         _options = options;
         _scriptName = assemblyName;
         _aiService = aiService;
         
-        // Create assembly and module
+        // Create assembly and module - persisted assemblies can be saved and reloaded from the compilation cache
         var assemblyNameObj = new AssemblyName(assemblyName);
-        _assemblyBuilder = AssemblyBuilder.DefineDynamicAssembly(
-            assemblyNameObj, 
-            AssemblyBuilderAccess.RunAndCollect);
+        _assemblyBuilder = options.PersistAssembly
+            ? new PersistedAssemblyBuilder(assemblyNameObj, typeof(object).Assembly)
+            : AssemblyBuilder.DefineDynamicAssembly(
+                assemblyNameObj, 
+                AssemblyBuilderAccess.RunAndCollect);
         
         _moduleBuilder = _assemblyBuilder.DefineDynamicModule(assemblyName);
         
@@ -171,6 +181,11 @@ public class CxCompiler : IAstVisitor<object>
             _currentIl = runMethod.GetILGenerator();
             _currentLocals.Clear();
 
+            // Infer which variables and functions only ever hold int or double values. Late-bound calls may reach a
+            // recompiled function, so locals assigned from them stay dynamic
+            _numericTypes = CxNumericTypeInference.Analyze(ast,
+                (name, argCount) => !_options.LateBoundUserFunctions && GetMethodInfo(name, argCount) == null);
+
             // **PASS 1: Collect function and class declarations, and event handlers**
             _isFirstPass = true;
             _pendingFunctions.Clear();
@@ -227,6 +242,12 @@ public class CxCompiler : IAstVisitor<object>
             // Create the type
             var programType = _programTypeBuilder.CreateType();
             
+            if (_assemblyBuilder is PersistedAssemblyBuilder persistedAssemblyBuilder)
+            {
+                // Persisted assemblies cannot run in place: save the image and load it back
+                return LoadPersistedAssembly(persistedAssemblyBuilder);
+            }
+            
             return CompilationResult.Success(_assemblyBuilder, programType);
         }
         catch (Exception ex)
@@ -235,6 +256,22 @@ public class CxCompiler : IAstVisitor<object>
         }
     }
 
+    /// <summary>
+    /// Save a persisted assembly to an in-memory image and load it into its own load context
+    /// </summary>
+    private CompilationResult LoadPersistedAssembly(PersistedAssemblyBuilder persistedAssemblyBuilder)
+    {
+        using var stream = new MemoryStream();
+        persistedAssemblyBuilder.Save(stream);
+        var image = stream.ToArray();
+        
+        var assembly = CxCompilationCache.LoadAssembly(image, _scriptName);
+        var programType = assembly.GetType("Program")
+            ?? throw new CompilationException("Persisted assembly does not contain a Program type");
+        
+        return CompilationResult.SuccessWithImage(assembly, programType, image);
+    }
+
     /// <summary>
     /// Generate IL code to register all compiled event handlers with the runtime event bus
     /// </summary>
@@ -818,7 +855,7 @@ public class CxCompiler : IAstVisitor<object>
                 else
                 {
                     // Numeric addition with type coercion
-                    EmitArithmeticOperation(node, OpCodes.Add);
+                    EmitArithmeticOperation(node, CxArithmeticOperation.Add);
                 }
                 break;
                 
@@ -827,15 +864,15 @@ public class CxCompiler : IAstVisitor<object>
             case BinaryOperator.Divide:
             case BinaryOperator.Modulo:
                 // Arithmetic operations with type coercion
-                var opCode = node.Operator switch
+                var operation = node.Operator switch
                 {
-                    BinaryOperator.Subtract => OpCodes.Sub,
-                    BinaryOperator.Multiply => OpCodes.Mul,
-                    BinaryOperator.Divide => OpCodes.Div,
-                    BinaryOperator.Modulo => OpCodes.Rem,
+                    BinaryOperator.Subtract => CxArithmeticOperation.Subtract,
+                    BinaryOperator.Multiply => CxArithmeticOperation.Multiply,
+                    BinaryOperator.Divide => CxArithmeticOperation.Divide,
+                    BinaryOperator.Modulo => CxArithmeticOperation.Remainder,
                     _ => throw new CompilationException($"Unexpected operator: {node.Operator}")
                 };
-                EmitArithmeticOperation(node, opCode);
+                EmitArithmeticOperation(node, operation);
                 break;
                 
             // Comparison operators
@@ -921,55 +958,156 @@ public class CxCompiler : IAstVisitor<object>
     /// <summary>
     /// Emit IL for arithmetic operations with automatic type coercion between int and double
     /// </summary>
-    private void EmitArithmeticOperation(BinaryExpressionNode node, OpCode operation)
+    private void EmitArithmeticOperation(BinaryExpressionNode node, CxArithmeticOperation operation)
     {
-        // Load both operands onto the stack
-        node.Left.Accept(this);
-        node.Right.Accept(this);
-        
-        // Call a runtime helper that handles type coercion and arithmetic
-        var helperMethod = typeof(CxArithmeticHelper).GetMethod("PerformArithmetic", 
-            new[] { typeof(object), typeof(object), typeof(string) });
-        
-        // Convert OpCode to string for the helper method
-        var operationName = operation.Name ?? "unknown"; // e.g., "add", "sub", "mul", "div"
-        _currentIl!.Emit(OpCodes.Ldstr, operationName);
-        
-        // Call the helper method
-        _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-        
-        // Result is already an object on the stack
+        EmitArithmetic(
+            () => node.Left.Accept(this), InferNumericType(node.Left),
+            () => node.Right.Accept(this), InferNumericType(node.Right),
+            operation);
     }
-    
+
+    /// <summary>
+    /// Emit an arithmetic operation. When both operand types are statically known the operands are unboxed
+    /// and native IL is emitted (int operands are widened when the other side is double, as the helper does);
+    /// otherwise both boxed operands are passed to CxArithmeticHelper with the operation as an enum constant.
+    /// </summary>
+    private void EmitArithmetic(Action emitLeft, Type? leftType, Action emitRight, Type? rightType, CxArithmeticOperation operation)
+    {
+        var resultType = CxNumericTypeInference.GetArithmeticResultType(leftType, rightType);
+        if (resultType == null)
+        {
+            // Dynamic operands: load both boxed values and let the runtime helper coerce them
+            emitLeft();
+            emitRight();
+            _currentIl!.Emit(OpCodes.Ldc_I4, (int)operation);
+            _currentIl.EmitCall(OpCodes.Call, PerformArithmeticMethod, null);
+            return;
+        }
+
+        emitLeft();
+        EmitUnboxNumeric(leftType!, resultType);
+        emitRight();
+        EmitUnboxNumeric(rightType!, resultType);
+
+        _currentIl!.Emit(operation switch
+        {
+            CxArithmeticOperation.Add => OpCodes.Add,
+            CxArithmeticOperation.Subtract => OpCodes.Sub,
+            CxArithmeticOperation.Multiply => OpCodes.Mul,
+            CxArithmeticOperation.Divide => OpCodes.Div,
+            CxArithmeticOperation.Remainder => OpCodes.Rem,
+            _ => throw new CompilationException($"Unexpected arithmetic operation: {operation}")
+        });
+        _currentIl.Emit(OpCodes.Box, resultType);
+    }
+
     /// <summary>
     /// Emit IL for comparison operations with automatic type coercion
     /// </summary>
     private void EmitComparisonOperation(BinaryExpressionNode node)
     {
-        // Load both operands onto the stack
+        var operation = node.Operator switch
+        {
+            BinaryOperator.LessThan => CxComparisonOperation.LessThan,
+            BinaryOperator.LessThanOrEqual => CxComparisonOperation.LessThanOrEqual,
+            BinaryOperator.GreaterThan => CxComparisonOperation.GreaterThan,
+            BinaryOperator.GreaterThanOrEqual => CxComparisonOperation.GreaterThanOrEqual,
+            _ => throw new CompilationException($"Unexpected comparison operator: {node.Operator}")
+        };
+
+        var leftType = InferNumericType(node.Left);
+        var rightType = InferNumericType(node.Right);
+        var operandType = CxNumericTypeInference.GetArithmeticResultType(leftType, rightType);
+
+        if (operandType == null)
+        {
+            // Dynamic operands: the runtime helper handles nulls, mixed numeric types and the string fallback
+            node.Left.Accept(this);
+            node.Right.Accept(this);
+            _currentIl!.Emit(OpCodes.Ldc_I4, (int)operation);
+            _currentIl.EmitCall(OpCodes.Call, PerformComparisonMethod, null);
+            return;
+        }
+
         node.Left.Accept(this);
+        EmitUnboxNumeric(leftType!, operandType);
         node.Right.Accept(this);
-        
-        // Call a runtime helper that handles comparison with type coercion
-        var helperMethod = typeof(CxArithmeticHelper).GetMethod("PerformComparison", 
-            new[] { typeof(object), typeof(object), typeof(string) });
-        
-        // Convert operator to string for the helper method
-        var operationName = node.Operator switch
+        EmitUnboxNumeric(rightType!, operandType);
+
+        // a <= b is !(a > b) and a >= b is !(a < b); for doubles the unordered forms keep NaN comparisons false
+        var isDouble = operandType == typeof(double);
+        switch (operation)
         {
-            BinaryOperator.LessThan => "lt",
-            BinaryOperator.LessThanOrEqual => "le",
-            BinaryOperator.GreaterThan => "gt",
-            BinaryOperator.GreaterThanOrEqual => "ge",
-            _ => "unknown"
-        };
-        
-        _currentIl!.Emit(OpCodes.Ldstr, operationName);
-        
-        // Call the helper method
-        _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-        
-        // Result is already an object (boolean) on the stack
+            case CxComparisonOperation.LessThan:
+                _currentIl!.Emit(OpCodes.Clt);
+                break;
+            case CxComparisonOperation.GreaterThan:
+                _currentIl!.Emit(OpCodes.Cgt);
+                break;
+            case CxComparisonOperation.LessThanOrEqual:
+                _currentIl!.Emit(isDouble ? OpCodes.Cgt_Un : OpCodes.Cgt);
+                _currentIl.Emit(OpCodes.Ldc_I4_0);
+                _currentIl.Emit(OpCodes.Ceq);
+                break;
+            case CxComparisonOperation.GreaterThanOrEqual:
+                _currentIl!.Emit(isDouble ? OpCodes.Clt_Un : OpCodes.Clt);
+                _currentIl.Emit(OpCodes.Ldc_I4_0);
+                _currentIl.Emit(OpCodes.Ceq);
+                break;
+        }
+
+        _currentIl!.Emit(OpCodes.Box, typeof(bool));
+    }
+
+    /// <summary>
+    /// Unbox a statically typed numeric operand and widen it to double when the operation is performed in double
+    /// </summary>
+    private void EmitUnboxNumeric(Type operandType, Type operationType)
+    {
+        _currentIl!.Emit(OpCodes.Unbox_Any, operandType);
+        if (operandType == typeof(int) && operationType == typeof(double))
+        {
+            _currentIl.Emit(OpCodes.Conv_R8);
+        }
+    }
+
+    /// <summary>
+    /// Statically known numeric type of an expression (int or double), or null when it must be treated dynamically.
+    /// Literals, locals that only ever hold one numeric type, calls to user functions with a numeric return and
+    /// arithmetic over those are typed.
+    /// </summary>
+    private Type? InferNumericType(ExpressionNode expression)
+    {
+        switch (expression)
+        {
+            case LiteralNode { Value: int }:
+                return typeof(int);
+
+            case LiteralNode { Value: double }:
+                return typeof(double);
+
+            case IdentifierNode identifier:
+                // Parameters shadow locals and are always dynamic; non-local names may resolve to fields or services
+                if (_currentParameterMapping?.ContainsKey(identifier.Name) == true || !_currentLocals.ContainsKey(identifier.Name))
+                {
+                    return null;
+                }
+                return _numericTypes?.GetVariableType(identifier.Name);
+
+            case UnaryExpressionNode { Operator: UnaryOperator.Minus or UnaryOperator.Negate or UnaryOperator.Plus } unary:
+                return InferNumericType(unary.Operand);
+
+            case BinaryExpressionNode binary when CxNumericTypeInference.IsArithmeticOperator(binary.Operator) && !IsStringConcatenation(binary):
+                return CxNumericTypeInference.GetArithmeticResultType(InferNumericType(binary.Left), InferNumericType(binary.Right));
+
+            // Late-bound calls may reach a recompiled function, so their return type is never assumed
+            case CallExpressionNode { Callee: IdentifierNode callee } call
+                when !_options.LateBoundUserFunctions && GetMethodInfo(callee.Name, call.Arguments.Count) == null && _userFunctions.ContainsKey(callee.Name):
+                return _numericTypes?.GetFunctionReturnType(callee.Name);
+
+            default:
+                return null;
+        }
     }
 
     /// <summary>
@@ -1009,7 +1147,7 @@ public class CxCompiler : IAstVisitor<object>
         node.Operand.Accept(this);
         
         // Determine the operand type for proper unboxing
-        var operandType = GetRuntimeType(node.Operand);
+        var operandType = InferNumericType(node.Operand) ?? GetRuntimeType(node.Operand);
         
         switch (node.Operator)
         {
@@ -1170,35 +1308,11 @@ public class CxCompiler : IAstVisitor<object>
                 // Check if this is a field - need special handling for 'this' pointer
                 if (_currentClassName != null && _classFields.ContainsKey(_currentClassName + "." + idNode.Name))
                 {
-                    // Field compound assignment
-                    LoadVariable(idNode.Name);
-                    node.Right.Accept(this);
-                    
-                    // Perform the arithmetic operation
-                    var helperMethod = typeof(CxArithmeticHelper).GetMethod("PerformArithmetic", 
-                        new[] { typeof(object), typeof(object), typeof(string) });
-                    
-                    switch (node.Operator)
-                    {
-                        case AssignmentOperator.AddAssign:
-                            _currentIl!.Emit(OpCodes.Ldstr, "add");
-                            _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-                            break;
-                        case AssignmentOperator.SubtractAssign:
-                            _currentIl!.Emit(OpCodes.Ldstr, "sub");
-                            _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-                            break;
-                        case AssignmentOperator.MultiplyAssign:
-                            _currentIl!.Emit(OpCodes.Ldstr, "mul");
-                            _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-                            break;
-                        case AssignmentOperator.DivideAssign:
-                            _currentIl!.Emit(OpCodes.Ldstr, "div");
-                            _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-                            break;
-                        default:
-                            throw new CompilationException($"Unsupported assignment operator: {node.Operator}");
-                    }
+                    // Field compound assignment - fields are always dynamic
+                    EmitArithmetic(
+                        () => LoadVariable(idNode.Name), null,
+                        () => node.Right.Accept(this), null,
+                        GetCompoundOperation(node.Operator));
                     
                     // Load 'this' and store the result to the field
                     _currentIl!.Emit(OpCodes.Ldarg_0);
@@ -1207,35 +1321,11 @@ public class CxCompiler : IAstVisitor<object>
                 }
                 else
                 {
-                    // Regular variable compound assignment
-                    LoadVariable(idNode.Name);
-                    node.Right.Accept(this);
-                    
-                    // Perform the arithmetic operation
-                    var helperMethod = typeof(CxArithmeticHelper).GetMethod("PerformArithmetic", 
-                        new[] { typeof(object), typeof(object), typeof(string) });
-                    
-                    switch (node.Operator)
-                    {
-                        case AssignmentOperator.AddAssign:
-                            _currentIl!.Emit(OpCodes.Ldstr, "add");
-                            _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-                            break;
-                        case AssignmentOperator.SubtractAssign:
-                            _currentIl!.Emit(OpCodes.Ldstr, "sub");
-                            _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-                            break;
-                        case AssignmentOperator.MultiplyAssign:
-                            _currentIl!.Emit(OpCodes.Ldstr, "mul");
-                            _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-                            break;
-                        case AssignmentOperator.DivideAssign:
-                            _currentIl!.Emit(OpCodes.Ldstr, "div");
-                            _currentIl.EmitCall(OpCodes.Call, helperMethod!, null);
-                            break;
-                        default:
-                            throw new CompilationException($"Unsupported assignment operator: {node.Operator}");
-                    }
+                    // Regular variable compound assignment - native arithmetic when both sides are typed
+                    EmitArithmetic(
+                        () => LoadVariable(idNode.Name), InferNumericType(idNode),
+                        () => node.Right.Accept(this), InferNumericType(node.Right),
+                        GetCompoundOperation(node.Operator));
                     
                     // Duplicate result for expression value
                     _currentIl!.Emit(OpCodes.Dup);
@@ -1374,6 +1464,18 @@ public class CxCompiler : IAstVisitor<object>
         return new object();
     }
     
+    private static CxArithmeticOperation GetCompoundOperation(AssignmentOperator op)
+    {
+        return op switch
+        {
+            AssignmentOperator.AddAssign => CxArithmeticOperation.Add,
+            AssignmentOperator.SubtractAssign => CxArithmeticOperation.Subtract,
+            AssignmentOperator.MultiplyAssign => CxArithmeticOperation.Multiply,
+            AssignmentOperator.DivideAssign => CxArithmeticOperation.Divide,
+            _ => throw new CompilationException($"Unsupported assignment operator: {op}")
+        };
+    }
+    
     private void LoadVariable(string variableName)
     {
         // Check if it's a local variable
@@ -1578,8 +1680,12 @@ public class CxCompiler : IAstVisitor<object>
             return new object();
         }
         
+        if (_options.LateBoundUserFunctions && _userFunctions.ContainsKey(node.FunctionName))
+        {
+            EmitLateBoundFunctionCall(node.FunctionName, node.Arguments);
+        }
         // Check if it's a user-defined function first (for instance method calling)
-        if (_userFunctions.TryGetValue(node.FunctionName, out var methodBuilder))
+        else if (_userFunctions.TryGetValue(node.FunctionName, out var methodBuilder))
         {
             // User-defined function - load 'this' first, then arguments
             _currentIl!.Emit(OpCodes.Ldarg_0); // Load 'this' pointer
@@ -1623,6 +1729,38 @@ public class CxCompiler : IAstVisitor<object>
         return new object();
     }
 
+    /// <summary>
+    /// Emit a user function call resolved through RuntimeFunctionRegistry at run time
+    /// </summary>
+    private void EmitLateBoundFunctionCall(string functionName, List<ExpressionNode> arguments)
+    {
+        if (_options.FunctionScope != null)
+        {
+            _currentIl!.Emit(OpCodes.Ldstr, _options.FunctionScope);
+        }
+        _currentIl!.Emit(OpCodes.Ldstr, functionName);
+        
+        _currentIl.Emit(OpCodes.Ldc_I4, arguments.Count);
+        _currentIl.Emit(OpCodes.Newarr, typeof(object));
+        for (int i = 0; i < arguments.Count; i++)
+        {
+            _currentIl.Emit(OpCodes.Dup);
+            _currentIl.Emit(OpCodes.Ldc_I4, i);
+            arguments[i].Accept(this);
+            _currentIl.Emit(OpCodes.Stelem_Ref);
+        }
+        
+        if (_options.FunctionScope != null)
+        {
+            var callScopedMethod = typeof(RuntimeFunctionRegistry).GetMethod(nameof(RuntimeFunctionRegistry.CallScopedFunction), new[] { typeof(string), typeof(string), typeof(object[]) });
+            _currentIl.Emit(OpCodes.Call, callScopedMethod!);
+            return;
+        }
+
+        var callFunctionMethod = typeof(RuntimeFunctionRegistry).GetMethod(nameof(RuntimeFunctionRegistry.CallFunction), new[] { typeof(string), typeof(object[]) });
+        _currentIl.Emit(OpCodes.Call, callFunctionMethod!);
+    }
+
     public object VisitIdentifier(IdentifierNode node)
     {
         // Console.WriteLine($"🔧 COMPILER: VisitIdentifier called with name: '{node.Name}'");
@@ -2456,7 +2594,11 @@ public class CxCompiler : IAstVisitor<object>
             {
                 // Debug output removed: [DEBUG] Found user-defined function: {identifier.Name}");
                 // Call a user-defined function
-                if (_userFunctions.TryGetValue(identifier.Name, out var methodBuilder))
+                if (_options.LateBoundUserFunctions && _userFunctions.ContainsKey(identifier.Name))
+                {
+                    EmitLateBoundFunctionCall(identifier.Name, node.Arguments);
+                }
+                else if (_userFunctions.TryGetValue(identifier.Name, out var methodBuilder))
                 {
                     // Load arguments
                     foreach (var arg in node.Arguments)
@@ -3265,6 +3407,60 @@ public class CxCompiler : IAstVisitor<object>
         }
     }
     
+    /// <summary>
+    /// Copy of a realize declaration (or an empty default one) whose body starts with this.field = initializer
+    /// assignments for every field with a default value, followed by the declared body.
+    /// </summary>
+    private static RealizeDeclarationNode WithFieldInitializers(ClassDeclarationNode node, RealizeDeclarationNode? realizeDecl)
+    {
+        var statements = new List<StatementNode>();
+        foreach (var field in node.Fields)
+        {
+            if (field.Initializer != null)
+            {
+                // Create this.fieldName = defaultValue assignment, wrapped in an expression statement
+                statements.Add(new ExpressionStatementNode
+                {
+                    Expression = new AssignmentExpressionNode
+                    {
+                        Left = new MemberAccessNode
+                        {
+                            Object = new IdentifierNode { Name = "this" },
+                            Property = field.Name
+                        },
+                        Right = field.Initializer
+                    }
+                });
+            }
+        }
+        
+        if (realizeDecl == null)
+        {
+            return new RealizeDeclarationNode
+            {
+                Parameters = new List<ParameterNode>(),
+                Body = new BlockStatementNode { Statements = statements }
+            };
+        }
+        
+        // Add the original realize body after field initialization
+        statements.AddRange(realizeDecl.Body.Statements);
+        return new RealizeDeclarationNode
+        {
+            Parameters = realizeDecl.Parameters,
+            Body = new BlockStatementNode
+            {
+                Statements = statements,
+                Line = realizeDecl.Body.Line,
+                Column = realizeDecl.Body.Column,
+                SourceFile = realizeDecl.Body.SourceFile
+            },
+            Line = realizeDecl.Line,
+            Column = realizeDecl.Column,
+            SourceFile = realizeDecl.SourceFile
+        };
+    }
+    
     public object VisitClassDeclaration(ClassDeclarationNode node)
     {
         if (_isFirstPass)
@@ -3338,45 +3534,21 @@ public class CxCompiler : IAstVisitor<object>
                 _classMethods[node.Name + "." + method.Name] = methodBuilder;
             }
             
-            // Process realize declarations (cognitive constructors)
+            // Process realize declarations (cognitive constructors).
+            // Field initializers are prepended to copies of the declarations: parsed programs are cached and shared
+            // between compilations, so the AST itself is never modified.
+            var realizeDeclarations = new List<RealizeDeclarationNode>(Math.Max(1, node.RealizeDeclarations.Count));
+            _classRealizeDeclarations[node.Name] = realizeDeclarations;
+            
             if (node.RealizeDeclarations.Count > 0)
             {
                 // Use explicitly declared realize functions and add field initialization
-                foreach (var realizeDecl in node.RealizeDeclarations)
+                foreach (var declaredRealize in node.RealizeDeclarations)
                 {
                     // Add field initialization statements for fields with default values
                     CxDebugTracing.TraceDebug("Compiler", $"Adding field initializations to realize declaration for class {node.Name}");
-                    var originalStatements = new List<StatementNode>(realizeDecl.Body.Statements);
-                    realizeDecl.Body.Statements.Clear();
-                    
-                    foreach (var field in node.Fields)
-                    {
-                        if (field.Initializer != null)
-                        {
-                            
-                            // Create this.fieldName = defaultValue assignment
-                            var assignment = new AssignmentExpressionNode
-                            {
-                                Left = new MemberAccessNode
-                                {
-                                    Object = new IdentifierNode { Name = "this" },
-                                    Property = field.Name
-                                },
-                                Right = field.Initializer
-                            };
-                            
-                            // Wrap in an expression statement
-                            var assignmentStatement = new ExpressionStatementNode
-                            {
-                                Expression = assignment
-                            };
-                            
-                            realizeDecl.Body.Statements.Add(assignmentStatement);
-                        }
-                    }
-                    
-                    // Add the original realize body after field initialization
-                    realizeDecl.Body.Statements.AddRange(originalStatements);
+                    var realizeDecl = WithFieldInitializers(node, declaredRealize);
+                    realizeDeclarations.Add(realizeDecl);
                     
                     var paramTypes = new Type[realizeDecl.Parameters.Count];
                     for (int i = 0; i < realizeDecl.Parameters.Count; i++)
@@ -3421,43 +3593,8 @@ public class CxCompiler : IAstVisitor<object>
                 _classConstructors[node.Name] = defaultConstructorBuilder;
                 
                 // Also create a default realize declaration node for Pass 2 processing
-                var defaultRealizeDecl = new RealizeDeclarationNode 
-                { 
-                    Parameters = new List<ParameterNode>(),
-                    Body = new BlockStatementNode { Statements = new List<StatementNode>() }
-                };
-                
-                // Add field initialization statements for fields with default values
                 CxDebugTracing.TraceDebug("Compiler", $"Adding field initializations to default realize declaration for class {node.Name}");
-                foreach (var field in node.Fields)
-                {
-                    if (field.Initializer != null)
-                    {
-                        CxDebugTracing.TraceDebug("Compiler", $"Adding initialization for field {field.Name} with default value");
-                        
-                        // Create this.fieldName = defaultValue assignment
-                        var assignment = new AssignmentExpressionNode
-                        {
-                            Left = new MemberAccessNode
-                            {
-                                Object = new IdentifierNode { Name = "this" },
-                                Property = field.Name
-                            },
-                            Right = field.Initializer
-                        };
-                        
-                        // Wrap in an expression statement
-                        var assignmentStatement = new ExpressionStatementNode
-                        {
-                            Expression = assignment
-                        };
-                        
-                        defaultRealizeDecl.Body.Statements.Add(assignmentStatement);
-                    }
-                }
-                
-                // Add it to the class node's realize declarations list
-                node.RealizeDeclarations.Add(defaultRealizeDecl);
+                realizeDeclarations.Add(WithFieldInitializers(node, null));
             }
             
             // Process event handlers to define them as methods
@@ -3499,16 +3636,20 @@ public class CxCompiler : IAstVisitor<object>
                 throw new CompilationException($"Class {node.Name} was not defined in Pass 1");
             }
             
+            var realizeDeclarations = _classRealizeDeclarations.TryGetValue(node.Name, out var prepared)
+                ? prepared
+                : node.RealizeDeclarations;
+            
             // Implement realize declarations (cognitive constructors)
-            foreach (var realizeDecl in node.RealizeDeclarations)
+            foreach (var realizeDecl in realizeDeclarations)
             {
                 ImplementRealizeDeclaration(node.Name, realizeDecl, typeBuilder, node.EventHandlers, node.UsesStatements);
             }
             
             // Implement parameterless constructor for consciousness entity instantiation if needed
-            if (node.RealizeDeclarations.Count > 0 && node.RealizeDeclarations.Any(r => r.Parameters.Count > 0))
+            if (realizeDeclarations.Count > 0 && realizeDeclarations.Any(r => r.Parameters.Count > 0))
             {
-                ImplementParameterlessConstructor(node.Name, typeBuilder, node.EventHandlers, node.UsesStatements, node.RealizeDeclarations);
+                ImplementParameterlessConstructor(node.Name, typeBuilder, node.EventHandlers, node.UsesStatements, realizeDeclarations);
             }
             
             // Implement methods
@@ -4264,6 +4405,24 @@ public class CompilerOptions
     public bool OptimizeCode { get; set; } = true;
     public bool GenerateDebugInfo { get; set; } = false;
     public string TargetFramework { get; set; } = "net8.0";
+
+    /// <summary>
+    /// Build with PersistedAssemblyBuilder instead of a RunAndCollect dynamic assembly.
+    /// The saved image is returned in CompilationResult.AssemblyImage so it can be written to disk or cached.
+    /// </summary>
+    public bool PersistAssembly { get; set; } = false;
+
+    /// <summary>
+    /// Compile calls to user functions as RuntimeFunctionRegistry.CallFunction lookups instead of direct calls,
+    /// so functions recompiled into a later assembly replace the originals for every caller (live IDE sessions)
+    /// </summary>
+    public bool LateBoundUserFunctions { get; set; } = false;
+
+    /// <summary>
+    /// Registry scope that late-bound user function calls resolve in (RuntimeFunctionRegistry.CallScopedFunction).
+    /// Live sessions use their session id, so two sessions defining the same function keep separate bodies.
+    /// </summary>
+    public string? FunctionScope { get; set; }
 }
 
 /// <summary>
@@ -4277,13 +4436,19 @@ public class CompilationResult
     public string? ErrorMessage { get; }
     public List<string>? InjectedFunctions { get; }
 
-    private CompilationResult(bool isSuccess, Assembly? assembly, Type? programType, string? errorMessage, List<string>? injectedFunctions = null)
+    /// <summary>
+    /// PE image of the compiled assembly (only for persisted compilations and cache hits)
+    /// </summary>
+    public byte[]? AssemblyImage { get; }
+
+    private CompilationResult(bool isSuccess, Assembly? assembly, Type? programType, string? errorMessage, List<string>? injectedFunctions = null, byte[]? assemblyImage = null)
     {
         IsSuccess = isSuccess;
         Assembly = assembly;
         ProgramType = programType;
         ErrorMessage = errorMessage;
         InjectedFunctions = injectedFunctions;
+        AssemblyImage = assemblyImage;
     }
 
     public static CompilationResult Success(Assembly assembly, Type programType) 
@@ -4299,6 +4464,11 @@ public class CompilationResult
         return new(true, assembly, programType, null, injectedFunctions);
     }
 
+    public static CompilationResult SuccessWithImage(Assembly assembly, Type programType, byte[] assemblyImage) 
+    {
+        return new(true, assembly, programType, null, assemblyImage: assemblyImage);
+    }
+
     public static CompilationResult Failure(string errorMessage) 
     {
         // Console.WriteLine($"❌ COMPILATION RESULT: Failure - {errorMessage}");
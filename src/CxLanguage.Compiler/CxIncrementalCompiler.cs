@@ -0,0 +1,393 @@
+using System;
+using System.Collections;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Linq;
+using System.Reflection;
+using System.Security.Cryptography;
+using System.Text;
+using Microsoft.Extensions.Logging;
+using CxLanguage.Core.AI;
+using CxLanguage.Core.Ast;
+using CxLanguage.Core.IDE;
+using CxLanguage.Core.Types;
+using CxLanguage.Compiler.Modules;
+using CxLanguage.Parser;
+
+namespace CxLanguage.Compiler;
+
+/// <summary>
+/// Incremental compiler for live IDE sessions.
+/// Every compile fingerprints the top-level declarations of the new source and compares them with the
+/// session's previous build. When only functions changed, just those functions are compiled into a small
+/// delta assembly and swapped into RuntimeFunctionRegistry; all builds use late-bound user function calls,
+/// so existing callers pick up the new bodies. Functions are registered under the session id as registry
+/// scope, so sessions never see or remove each other's functions. Changes to classes, event handlers, interfaces, imports or
+/// top-level statements rebuild the whole program, because Run registers handlers and instantiates entities.
+/// </summary>
+public class CxIncrementalCompiler : ILiveCodeCompiler
+{
+    private const string ImportsKey = "imports";
+    private const string ProgramKey = "program";
+    private const string FunctionPrefix = "function:";
+
+    private readonly IAiService? _aiService;
+    private readonly ILogger? _logger;
+    private readonly ConcurrentDictionary<string, SessionState> _sessions = new();
+
+    public CxIncrementalCompiler(IAiService? aiService = null, ILogger<CxIncrementalCompiler>? logger = null)
+    {
+        _aiService = aiService;
+        _logger = logger;
+    }
+
+    /// <summary>
+    /// Compile the current source of a session, recompiling only what changed since its previous build
+    /// </summary>
+    public LiveCompilation Compile(string sessionId, string cxCode)
+    {
+        var session = _sessions.GetOrAdd(sessionId, id => new SessionState(id));
+        lock (session)
+        {
+            if (session.LastSuccess != null && cxCode == session.SourceText)
+            {
+                return Unchanged(session);
+            }
+
+            var parseResult = CxLanguageParser.Parse(cxCode, session.ScriptName);
+            if (!parseResult.IsSuccess || parseResult.Value is not ProgramNode ast)
+            {
+                var errors = string.Join("; ", parseResult.Errors.Select(e => $"Line {e.Line}, Column {e.Column}: {e.Message}"));
+                return new LiveCompilation { Success = false, ErrorMessage = $"Parse errors: {errors}" };
+            }
+
+            var result = Compile(session, ast);
+            if (result.Success)
+            {
+                session.SourceText = cxCode;
+            }
+
+            return result;
+        }
+    }
+
+    /// <summary>
+    /// Compile an already parsed program for a session, recompiling only the declarations that changed
+    /// </summary>
+    internal LiveCompilation Compile(string sessionId, ProgramNode ast)
+    {
+        var session = _sessions.GetOrAdd(sessionId, id => new SessionState(id));
+        lock (session)
+        {
+            session.SourceText = null;
+            return Compile(session, ast);
+        }
+    }
+
+    private LiveCompilation Compile(SessionState session, ProgramNode ast)
+    {
+        var units = CollectUnits(ast);
+        var fingerprints = units.ToDictionary(unit => unit.Key, unit => unit.Value.Fingerprint, StringComparer.Ordinal);
+
+        var result = session.ProgramType == null || RequiresFullBuild(session.Fingerprints, fingerprints)
+            ? CompileFull(session, ast, fingerprints)
+            : CompileDelta(session, ast, units, fingerprints);
+
+        if (result.Success)
+        {
+            session.LastSuccess = result;
+        }
+
+        return result;
+    }
+
+    /// <summary>
+    /// Drop all compiled state for a session
+    /// </summary>
+    public void ResetSession(string sessionId)
+    {
+        if (_sessions.TryRemove(sessionId, out var session))
+        {
+            lock (session)
+            {
+                RuntimeFunctionRegistry.UnregisterScope(session.SessionId);
+            }
+        }
+    }
+
+    private LiveCompilation CompileFull(SessionState session, ProgramNode ast, Dictionary<string, string> fingerprints)
+    {
+        var assemblyName = $"{session.ScriptName}_{++session.BuildNumber}";
+        var compilation = CompileAssembly(session, ast, assemblyName);
+        if (!compilation.IsSuccess)
+        {
+            return new LiveCompilation { Success = false, ErrorMessage = compilation.ErrorMessage };
+        }
+
+        RuntimeFunctionRegistry.RegisterBuiltInFunctions();
+        RuntimeFunctionRegistry.RegisterAssembly(assemblyName, compilation.Assembly!, compilation.ProgramType!, session.SessionId);
+        UnregisterRemovedFunctions(session, fingerprints);
+
+        session.ProgramType = compilation.ProgramType;
+        session.Fingerprints = fingerprints;
+
+        _logger?.LogInformation("Live session {SessionId}: full build {AssemblyName} ({Count} declarations)",
+            session.SessionId, assemblyName, fingerprints.Count);
+
+        return new LiveCompilation
+        {
+            Success = true,
+            EntryPoint = CreateEntryPoint(session.ProgramType!),
+            IsIncremental = false,
+            RecompiledDeclarations = fingerprints.Keys.ToList(),
+            TotalDeclarations = fingerprints.Count
+        };
+    }
+
+    private LiveCompilation CompileDelta(
+        SessionState session,
+        ProgramNode ast,
+        Dictionary<string, (StatementNode? Node, string Fingerprint)> units,
+        Dictionary<string, string> fingerprints)
+    {
+        var changed = units
+            .Where(unit => IsFunctionKey(unit.Key)
+                && (!session.Fingerprints.TryGetValue(unit.Key, out var previous) || previous != unit.Value.Fingerprint))
+            .ToList();
+
+        if (changed.Count > 0)
+        {
+            // Imports are kept so changed functions still resolve imported services
+            var delta = new ProgramNode
+            {
+                Imports = ast.Imports,
+                Statements = changed.Select(unit => unit.Value.Node!).ToList(),
+                SourceFile = ast.SourceFile
+            };
+
+            var assemblyName = $"{session.ScriptName}_{session.BuildNumber}_delta{++session.DeltaNumber}";
+            var compilation = CompileAssembly(session, delta, assemblyName);
+            if (!compilation.IsSuccess)
+            {
+                return new LiveCompilation { Success = false, ErrorMessage = compilation.ErrorMessage };
+            }
+
+            RuntimeFunctionRegistry.RegisterAssembly(assemblyName, compilation.Assembly!, compilation.ProgramType!, session.SessionId);
+        }
+
+        UnregisterRemovedFunctions(session, fingerprints);
+        session.Fingerprints = fingerprints;
+
+        _logger?.LogInformation("Live session {SessionId}: recompiled {Count} of {Total} declarations",
+            session.SessionId, changed.Count, fingerprints.Count);
+
+        return new LiveCompilation
+        {
+            Success = true,
+            EntryPoint = CreateEntryPoint(session.ProgramType!),
+            IsIncremental = true,
+            RecompiledDeclarations = changed.Select(unit => unit.Key).ToList(),
+            TotalDeclarations = fingerprints.Count
+        };
+    }
+
+    private CompilationResult CompileAssembly(SessionState session, ProgramNode ast, string assemblyName)
+    {
+        try
+        {
+            var options = new CompilerOptions { LateBoundUserFunctions = true, FunctionScope = session.SessionId };
+            var compiler = new CxCompiler(assemblyName, options, _aiService);
+            return compiler.Compile(ast, assemblyName, string.Empty);
+        }
+        catch (CompilationException ex)
+        {
+            return CompilationResult.Failure(ex.Message);
+        }
+    }
+
+    private static LiveCompilation Unchanged(SessionState session)
+    {
+        return new LiveCompilation
+        {
+            Success = true,
+            EntryPoint = session.LastSuccess!.EntryPoint,
+            IsIncremental = true,
+            TotalDeclarations = session.Fingerprints.Count
+        };
+    }
+
+    /// <summary>
+    /// A full build is needed when anything other than a function was added, removed or changed
+    /// </summary>
+    private static bool RequiresFullBuild(Dictionary<string, string> previous, Dictionary<string, string> current)
+    {
+        foreach (var (key, fingerprint) in current)
+        {
+            if (!IsFunctionKey(key) && (!previous.TryGetValue(key, out var old) || old != fingerprint))
+            {
+                return true;
+            }
+        }
+
+        return previous.Keys.Any(key => !IsFunctionKey(key) && !current.ContainsKey(key));
+    }
+
+    private static void UnregisterRemovedFunctions(SessionState session, Dictionary<string, string> current)
+    {
+        foreach (var key in session.Fingerprints.Keys.Where(key => IsFunctionKey(key) && !current.ContainsKey(key)))
+        {
+            RuntimeFunctionRegistry.UnregisterFunction(GetFunctionName(key), session.SessionId);
+        }
+    }
+
+    private static Func<object?> CreateEntryPoint(Type programType)
+    {
+        var runMethod = programType.GetMethod("Run", BindingFlags.Public | BindingFlags.Static)
+            ?? throw new InvalidOperationException($"Compiled program {programType.FullName} has no Run method");
+        return () => runMethod.Invoke(null, null);
+    }
+
+    /// <summary>
+    /// Split a program into compilation units keyed by declaration. Imports and the remaining top-level
+    /// statements each form a single unit; event handlers are keyed by event name and ordinal.
+    /// </summary>
+    private static Dictionary<string, (StatementNode? Node, string Fingerprint)> CollectUnits(ProgramNode ast)
+    {
+        var units = new Dictionary<string, (StatementNode? Node, string Fingerprint)>(StringComparer.Ordinal);
+        var programStatements = new List<StatementNode>();
+
+        units[ImportsKey] = (null, CxAstFingerprint.Compute(ast.Imports));
+
+        foreach (var statement in ast.Statements)
+        {
+            var key = statement switch
+            {
+                FunctionDeclarationNode function => FunctionPrefix + function.Name,
+                ClassDeclarationNode classDeclaration => "class:" + classDeclaration.Name,
+                InterfaceDeclarationNode interfaceDeclaration => "interface:" + interfaceDeclaration.Name,
+                OnStatementNode onStatement => "on:" + onStatement.EventName.FullName,
+                _ => null
+            };
+
+            if (key == null)
+            {
+                programStatements.Add(statement);
+                continue;
+            }
+
+            // Repeated names (handlers for the same event, redefined functions) get an ordinal suffix;
+            // a redefined function therefore never takes the delta path on its own
+            var uniqueKey = key;
+            for (var ordinal = 2; units.ContainsKey(uniqueKey); ordinal++)
+            {
+                uniqueKey = $"{key}#{ordinal}";
+            }
+
+            if (uniqueKey != key && IsFunctionKey(key))
+            {
+                uniqueKey = "redefined:" + uniqueKey;
+            }
+
+            units[uniqueKey] = (statement, CxAstFingerprint.Compute(statement));
+        }
+
+        units[ProgramKey] = (null, CxAstFingerprint.Compute(programStatements));
+        return units;
+    }
+
+    private static bool IsFunctionKey(string key) => key.StartsWith(FunctionPrefix, StringComparison.Ordinal);
+
+    private static string GetFunctionName(string key) => key.Substring(FunctionPrefix.Length);
+
+    private sealed class SessionState
+    {
+        public SessionState(string sessionId)
+        {
+            SessionId = sessionId;
+            ScriptName = "live_" + new string(sessionId.Select(c => char.IsLetterOrDigit(c) ? c : '_').ToArray());
+        }
+
+        public string SessionId { get; }
+        public string ScriptName { get; }
+        public string? SourceText { get; set; }
+        public Type? ProgramType { get; set; }
+        public Dictionary<string, string> Fingerprints { get; set; } = new(StringComparer.Ordinal);
+        public LiveCompilation? LastSuccess { get; set; }
+        public int BuildNumber { get; set; }
+        public int DeltaNumber { get; set; }
+    }
+}
+
+/// <summary>
+/// Structural fingerprint of AST nodes. Source positions are ignored, so moving a declaration or editing
+/// whitespace and comments elsewhere in the file does not change its fingerprint.
+/// </summary>
+internal static class CxAstFingerprint
+{
+    private static readonly HashSet<string> IgnoredProperties = new(StringComparer.Ordinal)
+    {
+        nameof(AstNode.Line),
+        nameof(AstNode.Column),
+        nameof(AstNode.SourceFile),
+        nameof(FunctionDeclarationNode.StartLine),
+        nameof(FunctionDeclarationNode.EndLine),
+        nameof(ExpressionNode.InferredType)
+    };
+
+    private static readonly ConcurrentDictionary<Type, PropertyInfo[]> _properties = new();
+
+    public static string Compute(object node)
+    {
+        var builder = new StringBuilder();
+        Append(builder, node);
+        return Convert.ToHexString(SHA256.HashData(Encoding.UTF8.GetBytes(builder.ToString())));
+    }
+
+    private static void Append(StringBuilder builder, object? value)
+    {
+        switch (value)
+        {
+            case null:
+                builder.Append('~');
+                break;
+            case string text:
+                builder.Append('"').Append(text.Length).Append(':').Append(text);
+                break;
+            case CxType type:
+                builder.Append("T:").Append(type.Name);
+                break;
+            case AstNode node:
+                builder.Append('(').Append(node.GetType().Name);
+                foreach (var property in GetProperties(node.GetType()))
+                {
+                    builder.Append(' ').Append(property.Name).Append('=');
+                    Append(builder, property.GetValue(node));
+                }
+                builder.Append(')');
+                break;
+            case IEnumerable items:
+                builder.Append('[');
+                foreach (var item in items)
+                {
+                    Append(builder, item);
+                    builder.Append(',');
+                }
+                builder.Append(']');
+                break;
+            default:
+                // The type name keeps 1 and 1.0 distinct
+                builder.Append(value.GetType().Name).Append(':').Append(Convert.ToString(value, CultureInfo.InvariantCulture));
+                break;
+        }
+    }
+
+    private static PropertyInfo[] GetProperties(Type type)
+    {
+        return _properties.GetOrAdd(type, static t => t
+            .GetProperties(BindingFlags.Public | BindingFlags.Instance)
+            .Where(p => p.GetIndexParameters().Length == 0 && !IgnoredProperties.Contains(p.Name))
+            .OrderBy(p => p.Name, StringComparer.Ordinal)
+            .ToArray());
+    }
+}
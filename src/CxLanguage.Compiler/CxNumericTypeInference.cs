@@ -0,0 +1,484 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using CxLanguage.Core.Ast;
+
+namespace CxLanguage.Compiler;
+
+/// <summary>
+/// Whole-program numeric type inference used to emit native IL arithmetic instead of CxArithmeticHelper calls.
+/// A variable name is numeric when every declaration and assignment of that name stores the same type (int or double).
+/// A function is numeric when it is synchronous, ends in a return, and every return yields the same type.
+/// Parameters, fields, catch variables and event payloads are always dynamic, and so is any name assigned
+/// from a value that cannot be typed.
+/// </summary>
+internal sealed class CxNumericTypeInference
+{
+    private enum NumericKind
+    {
+        Pending,
+        Int,
+        Double,
+        Dynamic
+    }
+
+    private sealed record VariableWrite(string Name, ExpressionNode Value, AssignmentOperator Operator);
+
+    private readonly Func<string, int, bool> _isUserFunctionCall;
+    private readonly List<VariableWrite> _writes = new();
+    private readonly HashSet<string> _dynamicNames = new(StringComparer.Ordinal);
+    private readonly Dictionary<string, List<ExpressionNode?>?> _functionReturns = new(StringComparer.Ordinal);
+    private readonly Dictionary<string, NumericKind> _variables = new(StringComparer.Ordinal);
+    private readonly Dictionary<string, NumericKind> _functions = new(StringComparer.Ordinal);
+    private List<ExpressionNode?>? _currentReturns;
+    private bool _complete = true;
+
+    private CxNumericTypeInference(Func<string, int, bool> isUserFunctionCall)
+    {
+        _isUserFunctionCall = isUserFunctionCall;
+    }
+
+    /// <summary>
+    /// Analyze a program. isUserFunctionCall tells whether a call by name and argument count
+    /// is compiled as a direct call to a user function (as opposed to a built-in or a late-bound call).
+    /// </summary>
+    public static CxNumericTypeInference Analyze(ProgramNode program, Func<string, int, bool> isUserFunctionCall)
+    {
+        var inference = new CxNumericTypeInference(isUserFunctionCall);
+        inference.Collect(program);
+
+        if (inference._complete)
+        {
+            inference.Solve();
+        }
+        else
+        {
+            // Some construct was not understood, so writes may have been missed: keep everything dynamic
+            inference._variables.Clear();
+            inference._functions.Clear();
+        }
+
+        return inference;
+    }
+
+    /// <summary>
+    /// The type every value stored in the named variable has, or null when it is dynamic
+    /// </summary>
+    public Type? GetVariableType(string name) =>
+        _variables.TryGetValue(name, out var kind) ? ToType(kind) : null;
+
+    /// <summary>
+    /// The type every value returned by the named user function has, or null when it is dynamic
+    /// </summary>
+    public Type? GetFunctionReturnType(string name) =>
+        _functions.TryGetValue(name, out var kind) ? ToType(kind) : null;
+
+    /// <summary>
+    /// Result type of an arithmetic operation on two numeric operand types, using the helper's promotion rule
+    /// </summary>
+    public static Type? GetArithmeticResultType(Type? left, Type? right)
+    {
+        if (left == null || right == null)
+        {
+            return null;
+        }
+
+        return left == typeof(double) || right == typeof(double) ? typeof(double) : typeof(int);
+    }
+
+    /// <summary>
+    /// Whether a binary operator is one of the arithmetic operators handled by CxArithmeticHelper
+    /// </summary>
+    public static bool IsArithmeticOperator(BinaryOperator op) =>
+        op is BinaryOperator.Add or BinaryOperator.Subtract or BinaryOperator.Multiply
+            or BinaryOperator.Divide or BinaryOperator.Modulo;
+
+    /// <summary>
+    /// Mirrors CxCompiler.IsLiteralStringExpression: these additions compile as string concatenation
+    /// </summary>
+    public static bool IsStringConcatenation(BinaryExpressionNode node) =>
+        node.Operator == BinaryOperator.Add && (IsLiteralString(node.Left) || IsLiteralString(node.Right));
+
+    private static bool IsLiteralString(ExpressionNode node) => node switch
+    {
+        LiteralNode literal => literal.Value is string,
+        BinaryExpressionNode binary => IsStringConcatenation(binary),
+        FunctionCallNode call => call.FunctionName == "ToString",
+        _ => false
+    };
+
+    #region Collection
+
+    private void Collect(AstNode? node)
+    {
+        switch (node)
+        {
+            case null:
+                break;
+
+            case ProgramNode program:
+                program.Imports.ForEach(Collect);
+                program.Statements.ForEach(Collect);
+                break;
+
+            case BlockStatementNode block:
+                block.Statements.ForEach(Collect);
+                break;
+
+            case ExpressionStatementNode expressionStatement:
+                Collect(expressionStatement.Expression);
+                break;
+
+            case VariableDeclarationNode declaration:
+                if (declaration.Initializer == null)
+                {
+                    // No initializer means no local is created, so the name may resolve elsewhere
+                    _dynamicNames.Add(declaration.Name);
+                }
+                else
+                {
+                    _writes.Add(new VariableWrite(declaration.Name, declaration.Initializer, AssignmentOperator.Assign));
+                    Collect(declaration.Initializer);
+                }
+                break;
+
+            case FunctionDeclarationNode function:
+                CollectFunction(function);
+                break;
+
+            case ReturnStatementNode returnStatement:
+                _currentReturns?.Add(returnStatement.Value);
+                Collect(returnStatement.Value);
+                break;
+
+            case IfStatementNode ifStatement:
+                Collect(ifStatement.Condition);
+                Collect(ifStatement.ThenStatement);
+                Collect(ifStatement.ElseStatement);
+                break;
+
+            case WhileStatementNode whileStatement:
+                Collect(whileStatement.Condition);
+                Collect(whileStatement.Body);
+                break;
+
+            case TryStatementNode tryStatement:
+                Collect(tryStatement.TryBlock);
+                if (tryStatement.CatchVariableName != null)
+                {
+                    _dynamicNames.Add(tryStatement.CatchVariableName);
+                }
+                Collect(tryStatement.CatchBlock);
+                break;
+
+            case ThrowStatementNode throwStatement:
+                Collect(throwStatement.Expression);
+                break;
+
+            case OnStatementNode onStatement:
+                _dynamicNames.Add(onStatement.PayloadIdentifier);
+                CollectNestedBody(onStatement.Body);
+                break;
+
+            case EmitStatementNode emitStatement:
+                Collect(emitStatement.Payload);
+                break;
+
+            case ClassDeclarationNode classDeclaration:
+                CollectClass(classDeclaration);
+                break;
+
+            case ImportStatementNode import:
+                _dynamicNames.Add(import.Alias);
+                break;
+
+            case UsesStatementNode uses:
+                _dynamicNames.Add(uses.Alias);
+                break;
+
+            case InterfaceDeclarationNode:
+                break;
+
+            case AssignmentExpressionNode assignment:
+                if (assignment.Left is IdentifierNode target)
+                {
+                    _writes.Add(new VariableWrite(target.Name, assignment.Right, assignment.Operator));
+                }
+                Collect(assignment.Left);
+                Collect(assignment.Right);
+                break;
+
+            case BinaryExpressionNode binary:
+                Collect(binary.Left);
+                Collect(binary.Right);
+                break;
+
+            case UnaryExpressionNode unary:
+                Collect(unary.Operand);
+                break;
+
+            case CallExpressionNode call:
+                Collect(call.Callee);
+                call.Arguments.ForEach(Collect);
+                break;
+
+            case FunctionCallNode functionCall:
+                functionCall.Arguments.ForEach(Collect);
+                break;
+
+            case NewExpressionNode newExpression:
+                newExpression.Arguments.ForEach(Collect);
+                break;
+
+            case MemberAccessNode memberAccess:
+                Collect(memberAccess.Object);
+                break;
+
+            case IndexAccessNode indexAccess:
+                Collect(indexAccess.Object);
+                Collect(indexAccess.Index);
+                break;
+
+            case ArrayLiteralNode arrayLiteral:
+                arrayLiteral.Elements.ForEach(Collect);
+                break;
+
+            case ObjectLiteralNode objectLiteral:
+                foreach (var property in objectLiteral.Properties)
+                {
+                    Collect(property.Value);
+                }
+                break;
+
+            case IdentifierNode:
+            case LiteralNode:
+                break;
+
+            default:
+                _complete = false;
+                break;
+        }
+    }
+
+    private void CollectFunction(FunctionDeclarationNode function)
+    {
+        foreach (var parameter in function.Parameters)
+        {
+            _dynamicNames.Add(parameter.Name);
+        }
+
+        var savedReturns = _currentReturns;
+        _currentReturns = new List<ExpressionNode?>();
+        Collect(function.Body);
+
+        // Only a synchronous function whose body ends in a return can never fall through to the implicit null return
+        var returns = !function.IsAsync && function.Body.Statements.LastOrDefault() is ReturnStatementNode
+            ? _currentReturns
+            : null;
+
+        // A redefinition replaces the method builder, so a name defined twice is never typed
+        _functionReturns[function.Name] = _functionReturns.ContainsKey(function.Name) ? null : returns;
+        _currentReturns = savedReturns;
+    }
+
+    private void CollectClass(ClassDeclarationNode classDeclaration)
+    {
+        foreach (var uses in classDeclaration.UsesStatements)
+        {
+            Collect(uses);
+        }
+
+        foreach (var field in classDeclaration.Fields)
+        {
+            _dynamicNames.Add(field.Name);
+            Collect(field.Initializer);
+        }
+
+        foreach (var method in classDeclaration.Methods)
+        {
+            foreach (var parameter in method.Parameters)
+            {
+                _dynamicNames.Add(parameter.Name);
+            }
+            CollectNestedBody(method.Body);
+        }
+
+        foreach (var realize in classDeclaration.RealizeDeclarations)
+        {
+            foreach (var parameter in realize.Parameters)
+            {
+                _dynamicNames.Add(parameter.Name);
+            }
+            CollectNestedBody(realize.Body);
+        }
+
+        foreach (var handler in classDeclaration.EventHandlers)
+        {
+            Collect(handler);
+        }
+    }
+
+    /// <summary>
+    /// Collect a body compiled as its own method: its returns do not belong to the enclosing function
+    /// </summary>
+    private void CollectNestedBody(BlockStatementNode? body)
+    {
+        var savedReturns = _currentReturns;
+        _currentReturns = null;
+        Collect(body);
+        _currentReturns = savedReturns;
+    }
+
+    #endregion
+
+    #region Solving
+
+    /// <summary>
+    /// Optimistic fixed point: every name starts pending and only moves up to int/double and then to dynamic.
+    /// Names still pending afterwards only depend on themselves and are made dynamic before solving again.
+    /// </summary>
+    private void Solve()
+    {
+        foreach (var write in _writes)
+        {
+            _variables[write.Name] = _dynamicNames.Contains(write.Name) ? NumericKind.Dynamic : NumericKind.Pending;
+        }
+
+        foreach (var function in _functionReturns)
+        {
+            _functions[function.Key] = function.Value == null ? NumericKind.Dynamic : NumericKind.Pending;
+        }
+
+        while (true)
+        {
+            Iterate();
+
+            var pendingVariables = _variables.Where(v => v.Value == NumericKind.Pending).Select(v => v.Key).ToList();
+            var pendingFunctions = _functions.Where(f => f.Value == NumericKind.Pending).Select(f => f.Key).ToList();
+            if (pendingVariables.Count == 0 && pendingFunctions.Count == 0)
+            {
+                break;
+            }
+
+            pendingVariables.ForEach(name => _variables[name] = NumericKind.Dynamic);
+            pendingFunctions.ForEach(name => _functions[name] = NumericKind.Dynamic);
+        }
+    }
+
+    private void Iterate()
+    {
+        bool changed;
+        do
+        {
+            changed = false;
+
+            foreach (var write in _writes)
+            {
+                var current = _variables[write.Name];
+                if (current == NumericKind.Dynamic)
+                {
+                    continue;
+                }
+
+                var value = Infer(write.Value);
+                if (write.Operator != AssignmentOperator.Assign)
+                {
+                    // Compound assignments always go through arithmetic, never string concatenation
+                    value = Combine(current, value);
+                }
+
+                var joined = Join(current, value);
+                if (joined != current)
+                {
+                    _variables[write.Name] = joined;
+                    changed = true;
+                }
+            }
+
+            foreach (var function in _functionReturns)
+            {
+                var current = _functions[function.Key];
+                if (current == NumericKind.Dynamic || function.Value == null)
+                {
+                    continue;
+                }
+
+                var joined = function.Value.Aggregate(current, (kind, value) =>
+                    Join(kind, value == null ? NumericKind.Dynamic : Infer(value)));
+                if (joined != current)
+                {
+                    _functions[function.Key] = joined;
+                    changed = true;
+                }
+            }
+        }
+        while (changed);
+    }
+
+    private NumericKind Infer(ExpressionNode expression)
+    {
+        switch (expression)
+        {
+            case LiteralNode { Value: int }:
+                return NumericKind.Int;
+
+            case LiteralNode { Value: double }:
+                return NumericKind.Double;
+
+            case IdentifierNode identifier:
+                return _variables.TryGetValue(identifier.Name, out var kind) ? kind : NumericKind.Dynamic;
+
+            case UnaryExpressionNode { Operator: UnaryOperator.Minus or UnaryOperator.Negate or UnaryOperator.Plus } unary:
+                return Infer(unary.Operand);
+
+            case BinaryExpressionNode binary when IsArithmeticOperator(binary.Operator) && !IsStringConcatenation(binary):
+                return Combine(Infer(binary.Left), Infer(binary.Right));
+
+            case CallExpressionNode { Callee: IdentifierNode callee } call
+                when _isUserFunctionCall(callee.Name, call.Arguments.Count):
+                return _functions.TryGetValue(callee.Name, out var returnKind) ? returnKind : NumericKind.Dynamic;
+
+            default:
+                return NumericKind.Dynamic;
+        }
+    }
+
+    private static NumericKind Join(NumericKind a, NumericKind b)
+    {
+        if (a == NumericKind.Pending)
+        {
+            return b;
+        }
+
+        if (b == NumericKind.Pending || a == b)
+        {
+            return a;
+        }
+
+        return NumericKind.Dynamic;
+    }
+
+    private static NumericKind Combine(NumericKind left, NumericKind right)
+    {
+        if (left == NumericKind.Dynamic || right == NumericKind.Dynamic)
+        {
+            return NumericKind.Dynamic;
+        }
+
+        if (left == NumericKind.Pending || right == NumericKind.Pending)
+        {
+            return NumericKind.Pending;
+        }
+
+        return left == NumericKind.Double || right == NumericKind.Double ? NumericKind.Double : NumericKind.Int;
+    }
+
+    private static Type? ToType(NumericKind kind) => kind switch
+    {
+        NumericKind.Int => typeof(int),
+        NumericKind.Double => typeof(double),
+        _ => null
+    };
+
+    #endregion
+}
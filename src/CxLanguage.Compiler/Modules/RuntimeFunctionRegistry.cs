@@ -3,6 +3,7 @@ using System.Collections.Generic;
 using System.Reflection;
 using System.Collections.Concurrent;
 using System.Linq;
+using System.Runtime.ExceptionServices;
 using Microsoft.Extensions.Logging;
 
 namespace CxLanguage.Compiler.Modules;
@@ -15,6 +16,9 @@ public static class RuntimeFunctionRegistry
 {
     private static readonly ConcurrentDictionary<string, AssemblyInfo> _registeredAssemblies = new();
     private static readonly ConcurrentDictionary<string, MethodInfo> _registeredMethods = new();
+
+    // Functions of scoped registrations (live IDE sessions), so sessions defining the same name do not collide
+    private static readonly ConcurrentDictionary<(string Scope, string Name), MethodInfo> _scopedMethods = new();
     
     /// <summary>
     /// Information about a registered assembly
@@ -26,12 +30,14 @@ public static class RuntimeFunctionRegistry
         public Type ProgramType { get; set; } = null!;
         public object? ProgramInstance { get; set; }
         public List<string> AvailableFunctions { get; set; } = new();
+        public string? Scope { get; set; }
     }
     
     /// <summary>
-    /// Register an assembly with its functions for runtime access
+    /// Register an assembly with its functions for runtime access.
+    /// With a scope, its functions are only visible to CallScopedFunction calls of that scope.
     /// </summary>
-    public static void RegisterAssembly(string assemblyName, Assembly assembly, Type programType)
+    public static void RegisterAssembly(string assemblyName, Assembly assembly, Type programType, string? scope = null)
     {
         try
         {
@@ -41,7 +47,8 @@ public static class RuntimeFunctionRegistry
             {
                 AssemblyName = assemblyName,
                 Assembly = assembly,
-                ProgramType = programType
+                ProgramType = programType,
+                Scope = scope
             };
             
             // Get all callable methods from the program type
@@ -57,7 +64,14 @@ public static class RuntimeFunctionRegistry
                     method.DeclaringType == programType)
                 {
                     assemblyInfo.AvailableFunctions.Add(method.Name);
-                    _registeredMethods[method.Name] = method;
+                    if (scope == null)
+                    {
+                        _registeredMethods[method.Name] = method;
+                    }
+                    else
+                    {
+                        _scopedMethods[(scope, method.Name)] = method;
+                    }
                     registeredCount++;
                     
                     var parameters = method.GetParameters();
@@ -228,6 +242,77 @@ public static class RuntimeFunctionRegistry
         throw new Exception($"Function not found or execution failed: {functionName}");
     }
 
+    /// <summary>
+    /// Call a registered function without execution tracing. Scripts compiled with late-bound user function calls
+    /// use this for every call so that an incremental recompilation can swap the target method in the registry.
+    /// </summary>
+    public static object? CallFunction(string functionName, object[] args)
+    {
+        if (_registeredMethods.TryGetValue(functionName, out var method) && method.IsStatic)
+        {
+            return InvokeStatic(method, args);
+        }
+
+        return ExecuteFunction(functionName, args);
+    }
+
+    /// <summary>
+    /// Call a function of a scoped registration, falling back to the global registry (built-ins) when the scope
+    /// does not define it. Emitted for late-bound calls compiled with CompilerOptions.FunctionScope.
+    /// </summary>
+    public static object? CallScopedFunction(string scope, string functionName, object[] args)
+    {
+        if (_scopedMethods.TryGetValue((scope, functionName), out var method) && method.IsStatic)
+        {
+            return InvokeStatic(method, args);
+        }
+
+        return CallFunction(functionName, args);
+    }
+
+    /// <summary>
+    /// Remove a function from the registry (used when a live edit deletes a function)
+    /// </summary>
+    public static bool UnregisterFunction(string functionName, string? scope = null)
+    {
+        return scope == null
+            ? _registeredMethods.TryRemove(functionName, out _)
+            : _scopedMethods.TryRemove((scope, functionName), out _);
+    }
+
+    /// <summary>
+    /// Remove every function and assembly registered under a scope (used when a live session is reset)
+    /// </summary>
+    public static void UnregisterScope(string scope)
+    {
+        foreach (var key in _scopedMethods.Keys.Where(key => key.Scope == scope))
+        {
+            _scopedMethods.TryRemove(key, out _);
+        }
+
+        foreach (var (assemblyName, info) in _registeredAssemblies)
+        {
+            if (info.Scope == scope)
+            {
+                _registeredAssemblies.TryRemove(assemblyName, out _);
+            }
+        }
+    }
+
+    private static object? InvokeStatic(MethodInfo method, object[] args)
+    {
+        try
+        {
+            return method.Invoke(null, ConvertArguments(args, method.GetParameters()));
+        }
+        catch (TargetInvocationException ex) when (ex.InnerException != null)
+        {
+            // Surface the script's own exception as a direct call would
+            ExceptionDispatchInfo.Capture(ex.InnerException).Throw();
+            throw;
+        }
+    }
+
     /// <summary>
     /// Register a built-in static function for runtime access
     /// </summary>
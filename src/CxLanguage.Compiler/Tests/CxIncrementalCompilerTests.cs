@@ -0,0 +1,87 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using CxLanguage.Compiler.Modules;
+using CxLanguage.Core.Ast;
+
+namespace CxLanguage.Compiler.Tests
+{
+    /// <summary>
+    /// Live-session builds of CxIncrementalCompiler, driven from ASTs
+    /// </summary>
+    public class CxIncrementalCompilerTests
+    {
+        /// <summary>
+        /// A delta that changes a function's return type from int to double is picked up by an unchanged caller
+        /// that stored the call's result in a local and computed with it
+        /// </summary>
+        public static void TestDeltaChangingReturnType()
+        {
+            var sessionId = "tests-" + Guid.NewGuid().ToString("N");
+            var compiler = new CxIncrementalCompiler();
+            try
+            {
+                var full = compiler.Compile(sessionId, Program(Literal(2)));
+                TestAssert.True(full.Success, $"full build succeeds ({full.ErrorMessage})");
+                TestAssert.Equal<object?>(3, CallCaller(sessionId), "caller adds to the int result");
+
+                var delta = compiler.Compile(sessionId, Program(Literal(2.5)));
+                TestAssert.True(delta.Success, $"delta build succeeds ({delta.ErrorMessage})");
+                TestAssert.True(delta.IsIncremental, "only a function changed, so the build is a delta");
+                TestAssert.Equal("function:value", string.Join(",", delta.RecompiledDeclarations), "only the changed function is recompiled");
+                TestAssert.Equal<object?>(3.5, CallCaller(sessionId), "the unchanged caller adds to the new double result");
+            }
+            finally
+            {
+                compiler.ResetSession(sessionId);
+            }
+        }
+
+        public static void RunAll()
+        {
+            Console.WriteLine("🧪 Running incremental compiler tests...");
+            TestDeltaChangingReturnType();
+            Console.WriteLine("✅ Incremental compiler tests passed");
+        }
+
+        private static object? CallCaller(string sessionId) =>
+            RuntimeFunctionRegistry.CallScopedFunction(sessionId, "caller", Array.Empty<object>());
+
+        /// <summary>
+        /// function value() { return valueResult; }
+        /// function caller() { var v = value(); var w = v + 1; return w; }
+        /// </summary>
+        private static ProgramNode Program(ExpressionNode valueResult) => new()
+        {
+            Statements = new List<StatementNode>
+            {
+                Function("value", new ReturnStatementNode { Value = valueResult }),
+                Function("caller",
+                    new VariableDeclarationNode
+                    {
+                        Name = "v",
+                        Initializer = new CallExpressionNode { Callee = new IdentifierNode { Name = "value" } }
+                    },
+                    new VariableDeclarationNode
+                    {
+                        Name = "w",
+                        Initializer = new BinaryExpressionNode
+                        {
+                            Left = new IdentifierNode { Name = "v" },
+                            Operator = BinaryOperator.Add,
+                            Right = Literal(1)
+                        }
+                    },
+                    new ReturnStatementNode { Value = new IdentifierNode { Name = "w" } })
+            }
+        };
+
+        private static FunctionDeclarationNode Function(string name, params StatementNode[] body) => new()
+        {
+            Name = name,
+            Body = new BlockStatementNode { Statements = body.ToList() }
+        };
+
+        private static LiteralNode Literal(object value) => new() { Value = value, Type = LiteralType.Number };
+    }
+}
@@ -0,0 +1,39 @@
+using System;
+
+namespace CxLanguage.Compiler.Tests
+{
+    /// <summary>
+    /// Minimal assertions for the self-contained compiler tests; a failure throws with the message
+    /// </summary>
+    internal static class TestAssert
+    {
+        public static void True(bool condition, string message)
+        {
+            if (!condition)
+            {
+                throw new InvalidOperationException($"Assertion failed: {message}");
+            }
+        }
+
+        public static void Equal<T>(T expected, T actual, string message)
+        {
+            if (!Equals(expected, actual))
+            {
+                throw new InvalidOperationException($"Assertion failed: {message} (expected {expected}, got {actual})");
+            }
+        }
+
+        public static void Throws<TException>(Action action, string message) where TException : Exception
+        {
+            try
+            {
+                action();
+            }
+            catch (TException)
+            {
+                return;
+            }
+            throw new InvalidOperationException($"Assertion failed: {message} (no {typeof(TException).Name} thrown)");
+        }
+    }
+}
@@ -0,0 +1,48 @@
+using System;
+using System.Collections.Generic;
+
+namespace CxLanguage.Core.IDE
+{
+    /// <summary>
+    /// Compiles CX source for live IDE execution.
+    /// Implementations keep per-session state so an edit only rebuilds the declarations it changed.
+    /// </summary>
+    public interface ILiveCodeCompiler
+    {
+        /// <summary>
+        /// Compile the current source of a session, reusing whatever the previous compilation left valid
+        /// </summary>
+        LiveCompilation Compile(string sessionId, string cxCode);
+
+        /// <summary>
+        /// Drop all compiled state for a session
+        /// </summary>
+        void ResetSession(string sessionId);
+    }
+
+    /// <summary>
+    /// Result of a live compilation
+    /// </summary>
+    public class LiveCompilation
+    {
+        public bool Success { get; set; }
+        public string? ErrorMessage { get; set; }
+
+        /// <summary>
+        /// Runs the compiled program; returns the program result (a Task for async programs)
+        /// </summary>
+        public Func<object?>? EntryPoint { get; set; }
+
+        /// <summary>
+        /// True when only changed declarations were recompiled on top of the previous build
+        /// </summary>
+        public bool IsIncremental { get; set; }
+
+        /// <summary>
+        /// Keys of the declarations compiled by this request (e.g. "function:add", "class:Agent")
+        /// </summary>
+        public IReadOnlyList<string> RecompiledDeclarations { get; set; } = Array.Empty<string>();
+
+        public int TotalDeclarations { get; set; }
+    }
+}
@@ -1,6 +1,7 @@
 using System;
 using System.Threading.Tasks;
 using System.Collections.Generic;
+using System.Linq;
 using System.Diagnostics;
 using CxLanguage.Core.Events;
 using CxLanguage.Core.Hardware;
@@ -19,16 +20,19 @@ namespace CxLanguage.Core.IDE
         private readonly ICxEventBus _eventBus;
         private readonly PatelHardwareAccelerator _hardwareAccelerator;
         private readonly Dictionary<string, CachedCompilation> _compilationCache;
+        private readonly ILiveCodeCompiler? _liveCompiler;
         
         public LiveCodeExecutor(
             ILogger logger,
             ICxEventBus eventBus,
-            PatelHardwareAccelerator hardwareAccelerator)
+            PatelHardwareAccelerator hardwareAccelerator,
+            ILiveCodeCompiler? liveCompiler = null)
         {
             _logger = logger ?? throw new ArgumentNullException(nameof(logger));
             _eventBus = eventBus ?? throw new ArgumentNullException(nameof(eventBus));
             _hardwareAccelerator = hardwareAccelerator ?? throw new ArgumentNullException(nameof(hardwareAccelerator));
             _compilationCache = new Dictionary<string, CachedCompilation>();
+            _liveCompiler = liveCompiler;
             
             Console.WriteLine("⚡ Live Code Executor initialized with hardware acceleration");
         }
@@ -48,7 +52,9 @@ namespace CxLanguage.Core.IDE
             try
             {
                 // Phase 1: Fast compilation with caching
-                var compilationResult = await CompileWithCachingAsync(cxCode, executionId);
+                var compilationResult = _liveCompiler != null
+                    ? await CompileLiveAsync(cxCode, executionId, sessionId)
+                    : await CompileWithCachingAsync(cxCode, executionId);
                 var compilationTime = (int)stopwatch.ElapsedMilliseconds;
                 
                 if (!compilationResult.Success)
@@ -198,6 +204,53 @@ namespace CxLanguage.Core.IDE
             }
         }
         
+        /// <summary>
+        /// Compile CX code through the live compiler, which rebuilds only the declarations changed since the
+        /// session's previous compilation
+        /// </summary>
+        private async Task<CompilationResult> CompileLiveAsync(string cxCode, string executionId, string sessionId)
+        {
+            var live = _liveCompiler!.Compile(sessionId, cxCode);
+            
+            if (!live.Success)
+            {
+                Console.WriteLine($"❌ Compilation failed: {executionId} - {live.ErrorMessage}");
+                
+                await _eventBus.EmitAsync("ide.compilation.error", new Dictionary<string, object>
+                {
+                    ["executionId"] = executionId,
+                    ["error"] = live.ErrorMessage ?? "Compilation failed",
+                    ["codeLength"] = cxCode.Length
+                });
+                
+                return new CompilationResult
+                {
+                    Success = false,
+                    ErrorMessage = live.ErrorMessage
+                };
+            }
+            
+            var metadata = ExtractCodeMetadata(cxCode);
+            
+            await _eventBus.EmitAsync("ide.compilation.success", new Dictionary<string, object>
+            {
+                ["executionId"] = executionId,
+                ["codeLength"] = cxCode.Length,
+                ["incremental"] = live.IsIncremental,
+                ["recompiledDeclarations"] = live.RecompiledDeclarations.ToArray(),
+                ["totalDeclarations"] = live.TotalDeclarations,
+                ["metadata"] = JsonSerializer.Serialize(metadata)
+            });
+            
+            return new CompilationResult
+            {
+                Success = true,
+                CompiledCode = $"// CX live compilation: {live.RecompiledDeclarations.Count} of {live.TotalDeclarations} declarations recompiled",
+                Metadata = metadata,
+                EntryPoint = live.EntryPoint
+            };
+        }
+        
         /// <summary>
         /// Execute compiled code on optimal hardware
         /// </summary>
@@ -208,6 +261,18 @@ namespace CxLanguage.Core.IDE
             
             try
             {
+                // Run the compiled program when the live compiler produced one
+                string? programOutput = null;
+                if (compilation.EntryPoint != null)
+                {
+                    var programResult = compilation.EntryPoint();
+                    if (programResult is Task programTask)
+                    {
+                        await programTask;
+                    }
+                    programOutput = programResult is Task ? null : programResult?.ToString();
+                }
+                
                 // Prepare execution data for hardware acceleration
                 var executionData = PrepareExecutionData(compilation, ideEvent);
                 
@@ -229,6 +294,10 @@ namespace CxLanguage.Core.IDE
                 
                 // Process hardware result and generate output
                 var output = ProcessHardwareExecutionResult(hardwareResult, compilation);
+                if (programOutput != null)
+                {
+                    output = $"{programOutput}\n\n{output}";
+                }
                 var eventsEmitted = await EmitConsciousnessEvents(compilation, ideEvent);
                 
                 Console.WriteLine($"🎮 Hardware execution completed: {executionId}");
@@ -445,6 +514,7 @@ namespace CxLanguage.Core.IDE
         public string? CompiledCode { get; set; }
         public string? ErrorMessage { get; set; }
         public CodeMetadata? Metadata { get; set; }
+        public Func<object?>? EntryPoint { get; set; }
     }
     
     public class HardwareExecutionResult
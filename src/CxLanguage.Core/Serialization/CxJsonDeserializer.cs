@@ -1,7 +1,12 @@
 using System;
+using System.Buffers;
 using System.Collections.Generic;
+using System.IO;
+using System.Text;
 using System.Text.Json;
 using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
 using Microsoft.Extensions.Logging;
 
 namespace CxLanguage.Core.Serialization;
@@ -33,8 +38,17 @@ public class CxJsonDeserializer
                 return null;
             }
 
-            var jsonDocument = JsonDocument.Parse(jsonString);
-            return ConvertJsonElement(jsonDocument.RootElement);
+            // Transcode into a pooled buffer and read it once; no JsonDocument is built
+            var buffer = ArrayPool<byte>.Shared.Rent(Encoding.UTF8.GetMaxByteCount(jsonString.Length));
+            try
+            {
+                var length = Encoding.UTF8.GetBytes(jsonString, buffer);
+                return ReadDocument(buffer.AsSpan(0, length));
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
         }
         catch (JsonException ex)
         {
@@ -49,6 +63,39 @@ public class CxJsonDeserializer
         }
     }
 
+    /// <summary>
+    /// Deserialize UTF-8 JSON to native CX object without an intermediate string or DOM
+    /// </summary>
+    /// <param name="utf8Json">UTF-8 encoded JSON</param>
+    /// <returns>CX object, or null when the input is empty or not valid JSON</returns>
+    public object? DeserializeToObject(ReadOnlySpan<byte> utf8Json)
+    {
+        try
+        {
+            return utf8Json.IsEmpty ? null : ReadDocument(utf8Json);
+        }
+        catch (JsonException ex)
+        {
+            _logger?.LogWarning("Failed to parse UTF-8 JSON: {Error}", ex.Message);
+            return null;
+        }
+    }
+
+    /// <summary>
+    /// Stream JSON from a file or network stream and materialize only the values selected by JSONPath expressions
+    /// (see CxJsonPath). Memory is bounded by the selected values, not by the document.
+    /// </summary>
+    /// <param name="utf8Json">Stream of UTF-8 JSON; left open</param>
+    /// <param name="paths">Paths to project, e.g. "$.model.name" or "$.items[*].id"</param>
+    /// <returns>CX object keyed by path expression; wildcard paths map to an array of matches</returns>
+    public async Task<Dictionary<string, object>> DeserializeProjectionAsync(Stream utf8Json, IEnumerable<string> paths, CancellationToken cancellationToken = default)
+    {
+        var reader = new CxJsonStreamReader(paths.Select(CxJsonPath.Parse));
+        var projection = await reader.ReadProjectionAsync(utf8Json, cancellationToken);
+        _logger?.LogDebug("Projected {Count} JSON paths from stream", projection.Count);
+        return projection;
+    }
+
     /// <summary>
     /// Try to extract and deserialize JSON from a mixed text response
     /// Returns the deserialized object if JSON is found, otherwise returns the original string
@@ -77,59 +124,65 @@ public class CxJsonDeserializer
     }
 
     /// <summary>
-    /// Convert JsonElement to native CX object
+    /// Read a complete single-value JSON document
     /// </summary>
-    private object? ConvertJsonElement(JsonElement element)
+    private static object? ReadDocument(ReadOnlySpan<byte> utf8Json)
     {
-        return element.ValueKind switch
-        {
-            JsonValueKind.Object => ConvertJsonObject(element),
-            JsonValueKind.Array => ConvertJsonArray(element),
-            JsonValueKind.String => element.GetString(),
-            JsonValueKind.Number => element.TryGetInt32(out var intValue) ? intValue : element.GetDouble(),
-            JsonValueKind.True => true,
-            JsonValueKind.False => false,
-            JsonValueKind.Null => null,
-            _ => element.GetRawText()
-        };
-    }
-
-    /// <summary>
-    /// Convert JSON object to Dictionary&lt;string, object&gt; (CX object)
-    /// </summary>
-    private Dictionary<string, object> ConvertJsonObject(JsonElement jsonObject)
-    {
-        var cxObject = new Dictionary<string, object>();
-
-        foreach (var property in jsonObject.EnumerateObject())
-        {
-            var value = ConvertJsonElement(property.Value);
-            if (value != null)
-            {
-                cxObject[property.Name] = value;
-            }
-        }
+        var reader = new Utf8JsonReader(utf8Json, isFinalBlock: true, state: default);
+        reader.Read();
+        var value = ReadValue(ref reader);
 
-        return cxObject;
+        // Rejects trailing content after the root value, as JsonDocument.Parse does
+        reader.Read();
+        return value;
     }
 
     /// <summary>
-    /// Convert JSON array to object[] (CX array)
+    /// Convert the value at the reader's current token to a native CX object, leaving the reader on the
+    /// value's last token: objects become Dictionary&lt;string, object&gt;, arrays object[], numbers int when they fit
+    /// and double otherwise, dropping null members and elements. The value must be complete in the reader's buffer.
     /// </summary>
-    private object[] ConvertJsonArray(JsonElement jsonArray)
+    internal static object? ReadValue(ref Utf8JsonReader reader)
     {
-        var cxArray = new List<object>();
-
-        foreach (var element in jsonArray.EnumerateArray())
+        switch (reader.TokenType)
         {
-            var value = ConvertJsonElement(element);
-            if (value != null)
-            {
-                cxArray.Add(value);
-            }
+            case JsonTokenType.StartObject:
+                var cxObject = new Dictionary<string, object>();
+                while (reader.Read() && reader.TokenType == JsonTokenType.PropertyName)
+                {
+                    var name = reader.GetString()!;
+                    reader.Read();
+                    var member = ReadValue(ref reader);
+                    if (member != null)
+                    {
+                        cxObject[name] = member;
+                    }
+                }
+                return cxObject;
+            case JsonTokenType.StartArray:
+                var cxArray = new List<object>();
+                while (reader.Read() && reader.TokenType != JsonTokenType.EndArray)
+                {
+                    var element = ReadValue(ref reader);
+                    if (element != null)
+                    {
+                        cxArray.Add(element);
+                    }
+                }
+                return cxArray.ToArray();
+            case JsonTokenType.String:
+                return reader.GetString();
+            case JsonTokenType.Number:
+                return reader.TryGetInt32(out var intValue) ? (object)intValue : reader.GetDouble();
+            case JsonTokenType.True:
+                return true;
+            case JsonTokenType.False:
+                return false;
+            case JsonTokenType.Null:
+                return null;
+            default:
+                throw new JsonException($"Unexpected JSON token {reader.TokenType}");
         }
-
-        return cxArray.ToArray();
     }
 
     /// <summary>
@@ -0,0 +1,185 @@
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Text;
+
+namespace CxLanguage.Core.Serialization;
+
+/// <summary>
+/// JSONPath subset used to project fields out of a JSON stream without materializing the rest of the document.
+/// Supported: the root $, member access .name and ['name'], array indices [3], and wildcards .* and [*].
+/// Recursive descent (..), filters and slices are not supported; the leading $ may be omitted.
+/// </summary>
+public sealed class CxJsonPath
+{
+    internal enum SegmentKind
+    {
+        Property,
+        Index,
+        Wildcard
+    }
+
+    internal readonly struct Segment
+    {
+        public Segment(SegmentKind kind, string? name = null, int index = -1)
+        {
+            Kind = kind;
+            Name = name;
+            Utf8Name = name == null ? null : Encoding.UTF8.GetBytes(name);
+            Index = index;
+        }
+
+        public SegmentKind Kind { get; }
+        public string? Name { get; }
+        public byte[]? Utf8Name { get; }
+        public int Index { get; }
+    }
+
+    private CxJsonPath(string expression, Segment[] segments)
+    {
+        Expression = expression;
+        Segments = segments;
+        HasWildcard = Array.Exists(segments, segment => segment.Kind == SegmentKind.Wildcard);
+    }
+
+    /// <summary>
+    /// The expression as written by the script; projection results are keyed by it
+    /// </summary>
+    public string Expression { get; }
+
+    /// <summary>
+    /// True when the path can match more than one value
+    /// </summary>
+    public bool HasWildcard { get; }
+
+    internal Segment[] Segments { get; }
+
+    /// <summary>
+    /// Parse a JSONPath expression; throws FormatException for unsupported or malformed syntax
+    /// </summary>
+    public static CxJsonPath Parse(string expression)
+    {
+        if (expression == null)
+        {
+            throw new ArgumentNullException(nameof(expression));
+        }
+
+        var text = expression.Trim();
+        var segments = new List<Segment>();
+        var i = 0;
+
+        if (text.Length > 0 && text[0] == '$')
+        {
+            i = 1;
+        }
+        else if (text.Length > 0 && text[0] != '.' && text[0] != '[')
+        {
+            segments.Add(ReadMember(text, ref i, expression));
+        }
+
+        while (i < text.Length)
+        {
+            switch (text[i])
+            {
+                case '.':
+                    i++;
+                    if (i < text.Length && text[i] == '.')
+                    {
+                        throw new FormatException($"Recursive descent is not supported in JSON path '{expression}'");
+                    }
+                    segments.Add(ReadMember(text, ref i, expression));
+                    break;
+                case '[':
+                    i++;
+                    segments.Add(ReadBracket(text, ref i, expression));
+                    break;
+                default:
+                    throw new FormatException($"Unexpected '{text[i]}' at position {i} in JSON path '{expression}'");
+            }
+        }
+
+        return new CxJsonPath(expression, segments.ToArray());
+    }
+
+    public override string ToString() => Expression;
+
+    private static Segment ReadMember(string text, ref int i, string expression)
+    {
+        if (i < text.Length && text[i] == '*')
+        {
+            i++;
+            return new Segment(SegmentKind.Wildcard);
+        }
+
+        var start = i;
+        while (i < text.Length && text[i] != '.' && text[i] != '[')
+        {
+            i++;
+        }
+
+        if (i == start)
+        {
+            throw new FormatException($"Empty member name at position {start} in JSON path '{expression}'");
+        }
+
+        return new Segment(SegmentKind.Property, text[start..i]);
+    }
+
+    private static Segment ReadBracket(string text, ref int i, string expression)
+    {
+        if (i >= text.Length)
+        {
+            throw new FormatException($"Unterminated '[' in JSON path '{expression}'");
+        }
+
+        Segment segment;
+        var c = text[i];
+        if (c == '*')
+        {
+            i++;
+            segment = new Segment(SegmentKind.Wildcard);
+        }
+        else if (c == '\'' || c == '"')
+        {
+            var name = new StringBuilder();
+            i++;
+            while (i < text.Length && text[i] != c)
+            {
+                if (text[i] == '\\' && i + 1 < text.Length)
+                {
+                    i++;
+                }
+                name.Append(text[i]);
+                i++;
+            }
+
+            if (i >= text.Length)
+            {
+                throw new FormatException($"Unterminated quoted member name in JSON path '{expression}'");
+            }
+            i++;
+            segment = new Segment(SegmentKind.Property, name.ToString());
+        }
+        else
+        {
+            var start = i;
+            while (i < text.Length && char.IsAsciiDigit(text[i]))
+            {
+                i++;
+            }
+
+            if (i == start || !int.TryParse(text.AsSpan(start, i - start), NumberStyles.None, CultureInfo.InvariantCulture, out var index))
+            {
+                throw new FormatException($"Expected an array index, '*' or a quoted name at position {start} in JSON path '{expression}'");
+            }
+            segment = new Segment(SegmentKind.Index, index: index);
+        }
+
+        if (i >= text.Length || text[i] != ']')
+        {
+            throw new FormatException($"Expected ']' at position {i} in JSON path '{expression}'");
+        }
+        i++;
+        return segment;
+    }
+}
@@ -0,0 +1,48 @@
+using System;
+using System.Collections.Generic;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using System.Text.Json.Serialization.Metadata;
+
+namespace CxLanguage.Core.Serialization;
+
+/// <summary>
+/// Source-generated metadata for the native CX value shapes (Dictionary&lt;string, object&gt;, object[] and the
+/// primitives they hold), so serializing script data does not build reflection metadata at first use.
+/// </summary>
+[JsonSerializable(typeof(object))]
+[JsonSerializable(typeof(Dictionary<string, object>))]
+[JsonSerializable(typeof(Dictionary<string, string>))]
+[JsonSerializable(typeof(List<object>))]
+[JsonSerializable(typeof(object[]))]
+[JsonSerializable(typeof(string[]))]
+[JsonSerializable(typeof(List<string>))]
+[JsonSerializable(typeof(float[]))]
+[JsonSerializable(typeof(double[]))]
+[JsonSerializable(typeof(string))]
+[JsonSerializable(typeof(int))]
+[JsonSerializable(typeof(long))]
+[JsonSerializable(typeof(float))]
+[JsonSerializable(typeof(double))]
+[JsonSerializable(typeof(decimal))]
+[JsonSerializable(typeof(bool))]
+[JsonSerializable(typeof(DateTime))]
+[JsonSerializable(typeof(DateTimeOffset))]
+[JsonSerializable(typeof(TimeSpan))]
+[JsonSerializable(typeof(Guid))]
+[JsonSerializable(typeof(JsonElement))]
+public partial class CxJsonSerializerContext : JsonSerializerContext
+{
+    /// <summary>
+    /// Resolver for arbitrary script data: source-generated metadata first, reflection for any other type.
+    /// Assign to JsonSerializerOptions.TypeInfoResolver.
+    /// </summary>
+    public static IJsonTypeInfoResolver WithReflectionFallback(params IJsonTypeInfoResolver[] resolvers)
+    {
+        var chain = new IJsonTypeInfoResolver[resolvers.Length + 2];
+        resolvers.CopyTo(chain, 0);
+        chain[resolvers.Length] = Default;
+        chain[resolvers.Length + 1] = new DefaultJsonTypeInfoResolver();
+        return JsonTypeInfoResolver.Combine(chain);
+    }
+}
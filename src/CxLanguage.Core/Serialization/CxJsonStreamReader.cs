@@ -0,0 +1,444 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.IO;
+using System.IO.Pipelines;
+using System.Linq;
+using System.Numerics;
+using System.Runtime.CompilerServices;
+using System.Text.Json;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CxLanguage.Core.Serialization;
+
+/// <summary>
+/// A value selected by one of the paths of a CxJsonStreamReader
+/// </summary>
+public readonly struct CxJsonMatch
+{
+    public CxJsonMatch(CxJsonPath path, object? value)
+    {
+        Path = path;
+        Value = value;
+    }
+
+    public CxJsonPath Path { get; }
+
+    /// <summary>
+    /// The matched value as a native CX object (Dictionary&lt;string, object&gt;, object[] or primitive)
+    /// </summary>
+    public object? Value { get; }
+}
+
+/// <summary>
+/// Forward-only JSON projection over a PipeReader.
+/// Utf8JsonReader walks the pooled pipe buffers once; only values selected by a CxJsonPath are materialized,
+/// everything else is skipped token by token, so memory stays bounded by the largest selected value rather
+/// than by the document. Reading stops as soon as every path without a wildcard has matched.
+/// Materialized values use the CxJsonDeserializer mapping: objects become Dictionary&lt;string, object&gt;,
+/// arrays object[], numbers int when they fit and double otherwise; null members and elements are dropped.
+/// </summary>
+public sealed class CxJsonStreamReader
+{
+    /// <summary>
+    /// Pipe segment size used when reading from a Stream
+    /// </summary>
+    public const int DefaultBufferSize = 64 * 1024;
+
+    private const int MaxPaths = 64;
+
+    private readonly CxJsonPath[] _paths;
+    private readonly ulong _allPaths;
+    private readonly ulong _exactPaths;
+
+    public CxJsonStreamReader(IEnumerable<CxJsonPath> paths)
+    {
+        _paths = (paths ?? throw new ArgumentNullException(nameof(paths))).ToArray();
+        if (_paths.Length == 0)
+        {
+            throw new ArgumentException("At least one JSON path is required", nameof(paths));
+        }
+        if (_paths.Length > MaxPaths)
+        {
+            throw new ArgumentException($"At most {MaxPaths} JSON paths can be projected in one pass", nameof(paths));
+        }
+
+        _allPaths = _paths.Length == MaxPaths ? ulong.MaxValue : (1UL << _paths.Length) - 1;
+        for (var i = 0; i < _paths.Length; i++)
+        {
+            if (!_paths[i].HasWildcard)
+            {
+                _exactPaths |= 1UL << i;
+            }
+        }
+    }
+
+    public CxJsonStreamReader(params string[] paths)
+        : this(paths.Select(CxJsonPath.Parse))
+    {
+    }
+
+    public IReadOnlyList<CxJsonPath> Paths => _paths;
+
+    /// <summary>
+    /// Create a PipeReader over a stream that rents its segments from the shared memory pool
+    /// </summary>
+    public static PipeReader CreatePipeReader(Stream stream, bool leaveOpen = false, int bufferSize = DefaultBufferSize) =>
+        PipeReader.Create(stream, new StreamPipeReaderOptions(
+            pool: MemoryPool<byte>.Shared,
+            bufferSize: bufferSize,
+            minimumReadSize: Math.Min(4096, bufferSize),
+            leaveOpen: leaveOpen));
+
+    /// <summary>
+    /// Stream every match in document order. Matches are yielded after each pipe segment, so a wildcard over a
+    /// large array delivers its elements while the rest of the file is still being read.
+    /// The pipe is left uncompleted; the caller owns it.
+    /// </summary>
+    public async IAsyncEnumerable<CxJsonMatch> ReadMatchesAsync(PipeReader pipe, [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        var walk = new Walk(this);
+        var matches = new List<CxJsonMatch>();
+
+        while (true)
+        {
+            var result = await pipe.ReadAsync(cancellationToken);
+            var buffer = result.Buffer;
+            var finished = walk.Process(buffer, result.IsCompleted, matches, out var consumed);
+            pipe.AdvanceTo(consumed, buffer.End);
+
+            foreach (var match in matches)
+            {
+                yield return match;
+            }
+            matches.Clear();
+
+            if (finished)
+            {
+                yield break;
+            }
+
+            if (result.IsCompleted)
+            {
+                throw new JsonException("The JSON input ended before the root value was complete");
+            }
+        }
+    }
+
+    public async IAsyncEnumerable<CxJsonMatch> ReadMatchesAsync(Stream stream, [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        var pipe = CreatePipeReader(stream, leaveOpen: true);
+        try
+        {
+            await foreach (var match in ReadMatchesAsync(pipe, cancellationToken))
+            {
+                yield return match;
+            }
+        }
+        finally
+        {
+            await pipe.CompleteAsync();
+        }
+    }
+
+    /// <summary>
+    /// Read the selected values into a CX object keyed by path expression. Paths without a wildcard map to
+    /// their value and are absent when nothing matched; wildcard paths map to an object[] of every match.
+    /// </summary>
+    public async Task<Dictionary<string, object>> ReadProjectionAsync(PipeReader pipe, CancellationToken cancellationToken = default)
+    {
+        var projection = new Dictionary<string, object>();
+        var wildcardMatches = new Dictionary<CxJsonPath, List<object>>();
+
+        await foreach (var match in ReadMatchesAsync(pipe, cancellationToken))
+        {
+            if (match.Value == null)
+            {
+                continue;
+            }
+
+            if (match.Path.HasWildcard)
+            {
+                if (!wildcardMatches.TryGetValue(match.Path, out var values))
+                {
+                    wildcardMatches[match.Path] = values = new List<object>();
+                }
+                values.Add(match.Value);
+            }
+            else
+            {
+                projection[match.Path.Expression] = match.Value;
+            }
+        }
+
+        foreach (var path in _paths)
+        {
+            if (path.HasWildcard)
+            {
+                projection[path.Expression] = wildcardMatches.TryGetValue(path, out var values) ? values.ToArray() : Array.Empty<object>();
+            }
+        }
+
+        return projection;
+    }
+
+    public async Task<Dictionary<string, object>> ReadProjectionAsync(Stream stream, CancellationToken cancellationToken = default)
+    {
+        var pipe = CreatePipeReader(stream, leaveOpen: true);
+        try
+        {
+            return await ReadProjectionAsync(pipe, cancellationToken);
+        }
+        finally
+        {
+            await pipe.CompleteAsync();
+        }
+    }
+
+    /// <summary>
+    /// One open container on the path from the root to the reader's position
+    /// </summary>
+    private struct Frame
+    {
+        public bool IsArray;
+        public int Index;
+
+        /// <summary>
+        /// Paths that still match every segment up to this container and continue below it
+        /// </summary>
+        public ulong Live;
+
+        /// <summary>
+        /// For objects: the live paths whose next segment matched the current property name
+        /// </summary>
+        public ulong Member;
+    }
+
+    /// <summary>
+    /// Reader state carried between pipe segments
+    /// </summary>
+    private sealed class Walk
+    {
+        private readonly CxJsonStreamReader _owner;
+        private Frame[] _frames = new Frame[16];
+        private int _depth;
+        private JsonReaderState _state;
+        private ulong _pendingExact;
+
+        public Walk(CxJsonStreamReader owner)
+        {
+            _owner = owner;
+            _pendingExact = owner._exactPaths;
+        }
+
+        /// <summary>
+        /// Consume as much of the buffer as forms complete tokens, or complete selected values.
+        /// Returns true once the root value is complete or every exact path has matched with no wildcards left.
+        /// </summary>
+        public bool Process(ReadOnlySequence<byte> buffer, bool isFinalBlock, List<CxJsonMatch> matches, out SequencePosition consumed)
+        {
+            var reader = new Utf8JsonReader(buffer, isFinalBlock, _state);
+
+            while (true)
+            {
+                var stateBefore = reader.CurrentState;
+                var positionBefore = reader.Position;
+
+                if (!reader.Read())
+                {
+                    break;
+                }
+
+                switch (reader.TokenType)
+                {
+                    case JsonTokenType.PropertyName:
+                        ref var parent = ref _frames[_depth - 1];
+                        parent.Member = parent.Live == 0 ? 0 : MatchMember(ref reader, parent.Live, _depth - 1);
+                        continue;
+
+                    case JsonTokenType.EndObject:
+                    case JsonTokenType.EndArray:
+                        _depth--;
+                        break;
+
+                    case JsonTokenType.StartObject:
+                    case JsonTokenType.StartArray:
+                        if (!EnterContainer(ref reader, matches))
+                        {
+                            _state = stateBefore;
+                            consumed = positionBefore;
+                            return false;
+                        }
+
+                        if (reader.TokenType is JsonTokenType.StartObject or JsonTokenType.StartArray)
+                        {
+                            // Descended into the container; its members are handled as they are read
+                            continue;
+                        }
+                        break;
+
+                    default:
+                        var selected = SelectValue();
+                        if (selected != 0)
+                        {
+                            Emit(selected, CxJsonDeserializer.ReadValue(ref reader), matches);
+                        }
+                        break;
+                }
+
+                // A value at the current depth finished
+                if (_depth == 0)
+                {
+                    consumed = reader.Position;
+                    return true;
+                }
+
+                ref var container = ref _frames[_depth - 1];
+                if (container.IsArray)
+                {
+                    container.Index++;
+                }
+
+                if (_pendingExact == 0 && _owner._exactPaths == _owner._allPaths)
+                {
+                    consumed = reader.Position;
+                    return true;
+                }
+            }
+
+            _state = reader.CurrentState;
+            consumed = reader.Position;
+            return false;
+        }
+
+        /// <summary>
+        /// Handle a StartObject/StartArray token. Selected containers are materialized, containers with no live
+        /// path below them are skipped, others are pushed. Returns false when a container that must be read
+        /// whole is not yet complete in the buffer.
+        /// </summary>
+        private bool EnterContainer(ref Utf8JsonReader reader, List<CxJsonMatch> matches)
+        {
+            var selected = SelectValue(out var live);
+
+            if (selected != 0)
+            {
+                var probe = reader;
+                if (!probe.TrySkip())
+                {
+                    return false;
+                }
+
+                var copy = reader;
+                Emit(selected, CxJsonDeserializer.ReadValue(ref copy), matches);
+
+                if (live == 0)
+                {
+                    reader = probe;
+                    return true;
+                }
+            }
+            else if (live == 0)
+            {
+                var probe = reader;
+                if (probe.TrySkip())
+                {
+                    reader = probe;
+                    return true;
+                }
+            }
+
+            Push(reader.TokenType == JsonTokenType.StartArray, live);
+            return true;
+        }
+
+        private ulong SelectValue() => SelectValue(out _);
+
+        /// <summary>
+        /// Paths matching the value at the reader's position: selected ones end here, live ones continue below it
+        /// </summary>
+        private ulong SelectValue(out ulong live)
+        {
+            ulong candidates;
+            if (_depth == 0)
+            {
+                candidates = _owner._allPaths;
+            }
+            else
+            {
+                ref var parent = ref _frames[_depth - 1];
+                candidates = parent.IsArray ? MatchIndex(parent.Live, _depth - 1, parent.Index) : parent.Member;
+            }
+
+            ulong selected = 0;
+            live = 0;
+            var paths = _owner._paths;
+            for (var bits = candidates; bits != 0; bits &= bits - 1)
+            {
+                var i = BitOperations.TrailingZeroCount(bits);
+                if (paths[i].Segments.Length == _depth)
+                {
+                    selected |= 1UL << i;
+                }
+                else
+                {
+                    live |= 1UL << i;
+                }
+            }
+            return selected;
+        }
+
+        private ulong MatchMember(ref Utf8JsonReader reader, ulong live, int segment)
+        {
+            ulong matched = 0;
+            var paths = _owner._paths;
+            for (var bits = live; bits != 0; bits &= bits - 1)
+            {
+                var i = BitOperations.TrailingZeroCount(bits);
+                var next = paths[i].Segments[segment];
+                if (next.Kind == CxJsonPath.SegmentKind.Wildcard ||
+                    (next.Kind == CxJsonPath.SegmentKind.Property && reader.ValueTextEquals(next.Utf8Name)))
+                {
+                    matched |= 1UL << i;
+                }
+            }
+            return matched;
+        }
+
+        private ulong MatchIndex(ulong live, int segment, int index)
+        {
+            ulong matched = 0;
+            var paths = _owner._paths;
+            for (var bits = live; bits != 0; bits &= bits - 1)
+            {
+                var i = BitOperations.TrailingZeroCount(bits);
+                var next = paths[i].Segments[segment];
+                if (next.Kind == CxJsonPath.SegmentKind.Wildcard ||
+                    (next.Kind == CxJsonPath.SegmentKind.Index && next.Index == index))
+                {
+                    matched |= 1UL << i;
+                }
+            }
+            return matched;
+        }
+
+        private void Emit(ulong selected, object? value, List<CxJsonMatch> matches)
+        {
+            for (var bits = selected; bits != 0; bits &= bits - 1)
+            {
+                var i = BitOperations.TrailingZeroCount(bits);
+                matches.Add(new CxJsonMatch(_owner._paths[i], value));
+            }
+            _pendingExact &= ~selected;
+        }
+
+        private void Push(bool isArray, ulong live)
+        {
+            if (_depth == _frames.Length)
+            {
+                Array.Resize(ref _frames, _frames.Length * 2);
+            }
+            _frames[_depth++] = new Frame { IsArray = isArray, Live = live };
+        }
+    }
+}
@@ -0,0 +1,213 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Diagnostics.Metrics;
+using System.Threading;
+
+namespace CxLanguage.Core.Telemetry
+{
+    /// <summary>
+    /// Runtime instrumentation surface: one Meter and one ActivitySource named "CxLanguage" shared by the event
+    /// buses, the parallel handler engine, the vector store, embeddings, local LLM inference, direct peering and the
+    /// shared memory transport.
+    /// Collect with dotnet-counters (dotnet-counters monitor --counters CxLanguage -p &lt;pid&gt;) or OpenTelemetry
+    /// (AddMeter("CxLanguage"), AddSource("CxLanguage")).
+    /// Instruments are free while nothing listens: call sites check Instrument.Enabled before taking timestamps
+    /// or building tags, and ActivitySource.StartActivity returns null without a listener.
+    /// Event names are used as tag values, so dashboards see per-event dispatch latency; scripts that
+    /// generate unbounded event names should aggregate them in the collector.
+    /// </summary>
+    public static class CxDiagnostics
+    {
+        public const string MeterName = "CxLanguage";
+        public const string ActivitySourceName = "CxLanguage";
+
+        public const string EventNameTag = "cx.event.name";
+        public const string HandlerTag = "cx.handler";
+        public const string SuccessTag = "cx.success";
+        public const string QueueTag = "cx.queue";
+        public const string IndexTag = "cx.vector.index";
+        public const string CacheResultTag = "cx.cache.result";
+        public const string ModelTag = "cx.llm.model";
+        public const string PeerTag = "cx.peer";
+
+        private static readonly ConcurrentDictionary<long, (string Name, Func<int> Depth)> _queues = new();
+        private static long _nextQueueId;
+
+        public static readonly Meter Meter = new(MeterName, "1.0.0");
+
+        public static readonly ActivitySource ActivitySource = new(ActivitySourceName, "1.0.0");
+
+        #region Event Buses
+
+        public static readonly Counter<long> EventsEmitted = Meter.CreateCounter<long>(
+            "cx.events.emitted", "{event}", "Events emitted on the event buses");
+
+        public static readonly Histogram<double> EventDispatchDuration = Meter.CreateHistogram<double>(
+            "cx.events.dispatch.duration", "ms", "Time from emit until every handler of the event completed");
+
+        public static readonly Counter<long> EventHandlerInvocations = Meter.CreateCounter<long>(
+            "cx.events.handler.invocations", "{invocation}", "Event handler invocations");
+
+        public static readonly Histogram<double> EventHandlerDuration = Meter.CreateHistogram<double>(
+            "cx.events.handler.duration", "ms", "Time from invoking an event handler until its task completed");
+
+        public static readonly Counter<long> EventHandlerFailures = Meter.CreateCounter<long>(
+            "cx.events.handler.failures", "{failure}", "Event handlers that threw or faulted");
+
+        public static readonly Counter<long> EventsDropped = Meter.CreateCounter<long>(
+            "cx.events.queue.dropped", "{event}", "Queued emits discarded by a drop policy");
+
+        public static readonly ObservableGauge<int> EventQueueDepth = Meter.CreateObservableGauge(
+            "cx.events.queue.depth", ObserveQueueDepths, "{event}", "Events waiting in queued dispatch");
+
+        #endregion
+
+        #region Parallel Handlers
+
+        public static readonly Histogram<double> ParallelExecutionDuration = Meter.CreateHistogram<double>(
+            "cx.parallel.execution.duration", "ms", "Parallel parameter executions from payload analysis to the enhanced event");
+
+        public static readonly Histogram<double> ParallelParameterDuration = Meter.CreateHistogram<double>(
+            "cx.parallel.parameter.duration", "ms", "Execution time of single handler parameters");
+
+        #endregion
+
+        #region Vector Store and Embeddings
+
+        public static readonly Histogram<double> VectorSearchDuration = Meter.CreateHistogram<double>(
+            "cx.vector.search.duration", "ms", "Vector store similarity searches");
+
+        public static readonly Counter<long> VectorRecordsAdded = Meter.CreateCounter<long>(
+            "cx.vector.records.added", "{record}", "Records added to or updated in the vector store");
+
+        public static readonly Counter<long> EmbeddingCacheLookups = Meter.CreateCounter<long>(
+            "cx.embedding.cache.lookups", "{lookup}", "Embedding cache lookups, tagged hit or miss");
+
+        #endregion
+
+        #region Local LLM
+
+        public static readonly Counter<long> LlmTokensGenerated = Meter.CreateCounter<long>(
+            "cx.llm.tokens.generated", "{token}", "Tokens generated by local inference");
+
+        public static readonly Histogram<double> LlmGenerationDuration = Meter.CreateHistogram<double>(
+            "cx.llm.generation.duration", "ms", "Local inference requests from admission to the last token");
+
+        public static readonly Histogram<double> LlmTokensPerSecond = Meter.CreateHistogram<double>(
+            "cx.llm.generation.throughput", "{token}/s", "Decode throughput of single local inference requests");
+
+        #endregion
+
+        #region Direct Peering
+
+        public static readonly Counter<long> PeerMessagesSent = Meter.CreateCounter<long>(
+            "cx.peering.messages.sent", "{message}", "Events sent to direct peers");
+
+        public static readonly Counter<long> PeerMessagesReceived = Meter.CreateCounter<long>(
+            "cx.peering.messages.received", "{message}", "Events received from direct peers");
+
+        public static readonly Counter<long> PeerBytesSent = Meter.CreateCounter<long>(
+            "cx.peering.bytes.sent", "By", "Frame bytes written to peer connections");
+
+        public static readonly Counter<long> PeerBytesReceived = Meter.CreateCounter<long>(
+            "cx.peering.bytes.received", "By", "Frame bytes read from peer connections");
+
+        #endregion
+
+        #region Shared Memory Transport
+
+        public static readonly Counter<long> SharedMemoryEventsSent = Meter.CreateCounter<long>(
+            "cx.shm.events.sent", "{event}", "Events published to this process's shared memory ring");
+
+        public static readonly Counter<long> SharedMemoryEventsReceived = Meter.CreateCounter<long>(
+            "cx.shm.events.received", "{event}", "Events read from other processes' shared memory rings");
+
+        public static readonly Counter<long> SharedMemorySlotsLost = Meter.CreateCounter<long>(
+            "cx.shm.slots.lost", "{slot}", "Ring slots overwritten before this process read them");
+
+        #endregion
+
+        #region Helpers
+
+        /// <summary>
+        /// Timestamp for a later RecordDuration, or 0 when the histogram has no listener
+        /// </summary>
+        public static long StartTimestamp(Histogram<double> histogram) => histogram.Enabled ? Stopwatch.GetTimestamp() : 0;
+
+        /// <summary>
+        /// Record the milliseconds since StartTimestamp; a no-op when the timestamp was not taken
+        /// </summary>
+        public static void RecordDuration(Histogram<double> histogram, long startTimestamp, KeyValuePair<string, object?> tag)
+        {
+            if (startTimestamp != 0)
+            {
+                histogram.Record(Stopwatch.GetElapsedTime(startTimestamp).TotalMilliseconds, tag);
+            }
+        }
+
+        public static void RecordDuration(Histogram<double> histogram, long startTimestamp, KeyValuePair<string, object?> tag1, KeyValuePair<string, object?> tag2)
+        {
+            if (startTimestamp != 0)
+            {
+                histogram.Record(Stopwatch.GetElapsedTime(startTimestamp).TotalMilliseconds, tag1, tag2);
+            }
+        }
+
+        public static KeyValuePair<string, object?> Tag(string name, object? value) => new(name, value);
+
+        /// <summary>
+        /// Timestamp for RecordGeneration, or 0 when neither generation histogram has a listener
+        /// </summary>
+        public static long StartGeneration() =>
+            LlmGenerationDuration.Enabled || LlmTokensPerSecond.Enabled ? Stopwatch.GetTimestamp() : 0;
+
+        /// <summary>
+        /// Record duration and decode throughput of a finished local inference request
+        /// </summary>
+        public static void RecordGeneration(long startTimestamp, int tokens, KeyValuePair<string, object?> modelTag)
+        {
+            if (startTimestamp == 0)
+            {
+                return;
+            }
+
+            var elapsed = Stopwatch.GetElapsedTime(startTimestamp);
+            LlmGenerationDuration.Record(elapsed.TotalMilliseconds, modelTag);
+            if (tokens > 0 && elapsed > TimeSpan.Zero)
+            {
+                LlmTokensPerSecond.Record(tokens / elapsed.TotalSeconds, modelTag);
+            }
+        }
+
+        /// <summary>
+        /// Report the depth of a dispatch queue through cx.events.queue.depth until the returned handle is disposed
+        /// </summary>
+        public static IDisposable TrackQueueDepth(string queueName, Func<int> depth)
+        {
+            var id = Interlocked.Increment(ref _nextQueueId);
+            _queues[id] = (queueName, depth);
+            return new QueueRegistration(id);
+        }
+
+        private static IEnumerable<Measurement<int>> ObserveQueueDepths()
+        {
+            foreach (var (_, queue) in _queues)
+            {
+                yield return new Measurement<int>(queue.Depth(), Tag(QueueTag, queue.Name));
+            }
+        }
+
+        private sealed class QueueRegistration : IDisposable
+        {
+            private long _id;
+
+            public QueueRegistration(long id) => _id = id;
+
+            public void Dispose() => _queues.TryRemove(Interlocked.Exchange(ref _id, 0), out _);
+        }
+
+        #endregion
+    }
+}
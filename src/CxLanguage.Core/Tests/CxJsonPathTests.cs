@@ -0,0 +1,64 @@
+using System;
+using System.Linq;
+using CxLanguage.Core.Serialization;
+
+namespace CxLanguage.Core.Tests
+{
+    /// <summary>
+    /// Parsing of the JSONPath subset used by CxJsonStreamReader
+    /// </summary>
+    public class CxJsonPathTests
+    {
+        /// <summary>
+        /// Member, quoted member, index and wildcard segments parse in order, with or without the leading $
+        /// </summary>
+        public static void TestParseSegments()
+        {
+            AssertSegments("$", "");
+            AssertSegments("$.store.book", "store,book");
+            AssertSegments("store.book", "store,book");
+            AssertSegments("$.items[3].name", "items,#3,name");
+            AssertSegments("[0][12]", "#0,#12");
+            AssertSegments("$['odd key'][\"a.b\"]", "odd key,a.b");
+            AssertSegments("$['it\\'s']", "it's");
+            AssertSegments("$.items[*].tags.*", "items,*,tags,*");
+            AssertSegments("  $.trimmed  ", "trimmed");
+
+            TestAssert.True(!CxJsonPath.Parse("$.a[2].b").HasWildcard, "a path without * has no wildcard");
+            TestAssert.True(CxJsonPath.Parse("$.a[*]").HasWildcard, "[*] is a wildcard");
+            TestAssert.True(CxJsonPath.Parse("$.a.*").HasWildcard, ".* is a wildcard");
+            TestAssert.Equal("$.a[2]", CxJsonPath.Parse("$.a[2]").Expression, "the expression is kept as written");
+        }
+
+        /// <summary>
+        /// Unsupported and malformed syntax is rejected with FormatException
+        /// </summary>
+        public static void TestParseRejectsUnsupportedSyntax()
+        {
+            foreach (var expression in new[] { "$..name", "$.a[", "$.a[1", "$.a['x", "$.a[-1]", "$.a[1:2]", "$.a[?(@.x)]", "$.", "$.a.", "$x" })
+            {
+                TestAssert.Throws<FormatException>(() => CxJsonPath.Parse(expression), $"'{expression}' is rejected");
+            }
+            TestAssert.Throws<ArgumentNullException>(() => CxJsonPath.Parse(null!), "a null expression is rejected");
+        }
+
+        public static void RunAll()
+        {
+            Console.WriteLine("🧪 Running JSON path tests...");
+            TestParseSegments();
+            TestParseRejectsUnsupportedSyntax();
+            Console.WriteLine("✅ JSON path tests passed");
+        }
+
+        private static void AssertSegments(string expression, string expected)
+        {
+            var segments = CxJsonPath.Parse(expression).Segments.Select(segment => segment.Kind switch
+            {
+                CxJsonPath.SegmentKind.Property => segment.Name,
+                CxJsonPath.SegmentKind.Index => $"#{segment.Index}",
+                _ => "*"
+            });
+            TestAssert.Equal(expected, string.Join(",", segments), $"segments of '{expression}'");
+        }
+    }
+}
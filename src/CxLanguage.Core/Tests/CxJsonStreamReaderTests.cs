@@ -0,0 +1,196 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.IO.Pipelines;
+using System.Linq;
+using System.Text;
+using System.Text.Json;
+using System.Threading.Tasks;
+using CxLanguage.Core.Serialization;
+
+namespace CxLanguage.Core.Tests
+{
+    /// <summary>
+    /// CxJsonStreamReader projections, with the document split across many small pipe segments
+    /// </summary>
+    public class CxJsonStreamReaderTests
+    {
+        private const string Document = """
+            {
+              "meta": { "count": 3, "ratio": 2.5, "big": 3000000000, "label": "café \"quoted\"", "empty": null },
+              "odd key": [ 1, -2, 1e3 ],
+              "skipped": { "deep": [ { "x": [ 1, 2, 3 ] }, "text", true ] },
+              "items": [
+                { "id": 1, "tags": [ "red", "green" ], "nested": { "score": 0.125 } },
+                { "id": 2, "tags": [], "nested": { "score": 7 } },
+                { "id": 3, "tags": [ "blue", null ], "nested": { "score": -1.5 } }
+              ],
+              "flag": false
+            }
+            """;
+
+        private static readonly string[] Paths =
+        {
+            "$.meta",
+            "$.meta.count",
+            "$.meta.ratio",
+            "$.meta.big",
+            "$.meta.label",
+            "$['odd key']",
+            "$.items[*].id",
+            "$.items[1].nested",
+            "$.items[*].tags",
+            "$.items[2].nested.score",
+            "$.flag",
+            "$.missing"
+        };
+
+        /// <summary>
+        /// Values read through 1 to 7 byte writes, so tokens and selected containers straddle segments and the
+        /// reader rewinds to the start of an incomplete container, match the values read from one buffer
+        /// </summary>
+        public static async Task TestSegmentedInputMatchesWholeInput()
+        {
+            var whole = await ReadProjectionAsync(Document, chunkSize: _ => int.MaxValue);
+            var random = new Random(1);
+            for (int run = 0; run < 20; run++)
+            {
+                var segmented = await ReadProjectionAsync(Document, chunkSize: _ => random.Next(1, 8));
+                TestAssert.True(DeepEqual(whole, segmented), $"run {run}: segmented projection matches the whole-buffer projection");
+            }
+
+            TestAssert.True(!whole.ContainsKey("$.missing"), "an exact path that matched nothing is absent");
+            TestAssert.Equal(false, whole["$.flag"], "a false value is selected");
+            TestAssert.Equal("café \"quoted\"", whole["$.meta.label"], "escaped strings are unescaped");
+
+            var meta = (Dictionary<string, object>)whole["$.meta"];
+            TestAssert.True(!meta.ContainsKey("empty"), "null members are dropped");
+            TestAssert.True(DeepEqual(meta["count"], whole["$.meta.count"]), "a value selected directly and inside its parent agree");
+
+            var ids = (object[])whole["$.items[*].id"];
+            TestAssert.Equal("1,2,3", string.Join(",", ids), "wildcard matches in document order");
+            var tags = (object[])whole["$.items[*].tags"];
+            TestAssert.Equal(1, ((object[])tags[2]).Length, "null elements are dropped");
+        }
+
+        /// <summary>
+        /// Integers that fit in an int surface as int; fractions, exponents and larger integers as double
+        /// </summary>
+        public static async Task TestNumberTypes()
+        {
+            var projection = await ReadProjectionAsync(Document, chunkSize: _ => 3);
+
+            TestAssert.Equal<object>(3, projection["$.meta.count"], "an integer is an int");
+            TestAssert.Equal<object>(2.5, projection["$.meta.ratio"], "a fraction is a double");
+            TestAssert.Equal<object>(3_000_000_000d, projection["$.meta.big"], "an integer beyond int is a double");
+            TestAssert.Equal<object>(-1.5, projection["$.items[2].nested.score"], "a negative fraction is a double");
+
+            var odd = (object[])projection["$['odd key']"];
+            TestAssert.Equal<object>(1, odd[0], "integer array elements are int");
+            TestAssert.Equal<object>(-2, odd[1], "negative integer array elements are int");
+            TestAssert.Equal<object>(1000d, odd[2], "an exponent is a double");
+
+            var nested = (Dictionary<string, object>)projection["$.items[1].nested"];
+            TestAssert.Equal<object>(7, nested["score"], "integers inside a selected object are int");
+
+            var deserialized = (Dictionary<string, object>)new CxJsonDeserializer().DeserializeToObject("""{ "n": 42, "x": 4.5 }""")!;
+            TestAssert.Equal<object>(42, deserialized["n"], "the deserializer reads an integer as an int");
+            TestAssert.Equal<object>(4.5, deserialized["x"], "the deserializer reads a fraction as a double");
+        }
+
+        /// <summary>
+        /// Once every exact path matched, reading stops without waiting for the rest of the document
+        /// </summary>
+        public static async Task TestStopsAfterExactPathsMatch()
+        {
+            var pipe = new Pipe();
+            await pipe.Writer.WriteAsync(Encoding.UTF8.GetBytes("""{ "first": { "a": 1 }, "second": "two", "rest": [ 1, 2,"""));
+
+            var reader = new CxJsonStreamReader("$.first.a", "$.second");
+            var projection = await reader.ReadProjectionAsync(pipe.Reader).WaitAsync(TimeSpan.FromSeconds(10));
+
+            TestAssert.Equal<object>(1, projection["$.first.a"], "first path matched");
+            TestAssert.Equal<object>("two", projection["$.second"], "second path matched");
+            await pipe.Writer.CompleteAsync();
+            await pipe.Reader.CompleteAsync();
+        }
+
+        /// <summary>
+        /// A document that ends before its root value is complete is rejected
+        /// </summary>
+        public static async Task TestTruncatedInputThrows()
+        {
+            foreach (var truncated in new[] { """{ "items": [ { "id": 1 }""", """{ "meta": { "count": 3""", """{ "a": 12""" })
+            {
+                var threw = false;
+                try
+                {
+                    await ReadProjectionAsync(truncated, chunkSize: _ => 2, paths: new[] { "$.items[*].id", "$.meta", "$.b" });
+                }
+                catch (JsonException)
+                {
+                    threw = true;
+                }
+                TestAssert.True(threw, $"'{truncated}' is rejected");
+            }
+        }
+
+        public static void RunAll()
+        {
+            Console.WriteLine("🧪 Running JSON stream reader tests...");
+            TestSegmentedInputMatchesWholeInput().GetAwaiter().GetResult();
+            TestNumberTypes().GetAwaiter().GetResult();
+            TestStopsAfterExactPathsMatch().GetAwaiter().GetResult();
+            TestTruncatedInputThrows().GetAwaiter().GetResult();
+            Console.WriteLine("✅ JSON stream reader tests passed");
+        }
+
+        /// <summary>
+        /// Feed the document through a pipe of 16-byte segments in writes of the given sizes, reading concurrently
+        /// </summary>
+        private static async Task<Dictionary<string, object>> ReadProjectionAsync(string json, Func<int, int> chunkSize, string[]? paths = null)
+        {
+            var pipe = new Pipe(new PipeOptions(pool: MemoryPool<byte>.Shared, minimumSegmentSize: 16, useSynchronizationContext: false));
+            var bytes = Encoding.UTF8.GetBytes(json);
+
+            var writing = Task.Run(async () =>
+            {
+                var offset = 0;
+                for (int write = 0; offset < bytes.Length; write++)
+                {
+                    var length = Math.Min(chunkSize(write), bytes.Length - offset);
+                    await pipe.Writer.WriteAsync(bytes.AsMemory(offset, length));
+                    offset += length;
+                }
+                await pipe.Writer.CompleteAsync();
+            });
+
+            try
+            {
+                return await new CxJsonStreamReader(paths ?? Paths).ReadProjectionAsync(pipe.Reader);
+            }
+            finally
+            {
+                await pipe.Reader.CompleteAsync();
+                await writing;
+            }
+        }
+
+        private static bool DeepEqual(object? expected, object? actual)
+        {
+            switch (expected)
+            {
+                case Dictionary<string, object> map:
+                    return actual is Dictionary<string, object> other
+                        && map.Count == other.Count
+                        && map.All(entry => other.TryGetValue(entry.Key, out var value) && DeepEqual(entry.Value, value));
+                case object[] array:
+                    return actual is object[] otherArray
+                        && array.Length == otherArray.Length
+                        && array.Zip(otherArray).All(pair => DeepEqual(pair.First, pair.Second));
+                default:
+                    return Equals(expected, actual);
+            }
+        }
+    }
+}
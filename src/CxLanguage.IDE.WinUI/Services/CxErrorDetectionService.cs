@@ -6,6 +6,7 @@ using System.Windows.Media;
 using ICSharpCode.AvalonEdit;
 using ICSharpCode.AvalonEdit.Document;
 using ICSharpCode.AvalonEdit.Rendering;
+using CxLanguage.Parser;
 using Microsoft.Extensions.Logging;
 
 namespace CxLanguage.IDE.WinUI.Services;
@@ -536,6 +537,22 @@ public class CxErrorDetectionService : ICxErrorDetectionService
                 }
             }
             
+            // Grammar check through the shared parse cache: unchanged buffers and modules are not reparsed per keystroke
+            var grammarResult = CxLanguageParser.Parse(code, fileName);
+            if (!grammarResult.IsSuccess)
+            {
+                foreach (var error in grammarResult.Errors)
+                {
+                    errors.Add(new CxParseError
+                    {
+                        Line = error.Line,
+                        Column = error.Column + 1,
+                        Message = error.Message,
+                        FileName = fileName
+                    });
+                }
+            }
+            
             return new CxParseResult
             {
                 IsSuccess = !errors.Any(),
@@ -0,0 +1,629 @@
+using LLama;
+using LLama.Batched;
+using LLama.Native;
+using LLama.Sampling;
+using CxLanguage.Core.Telemetry;
+using Microsoft.Extensions.Logging;
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+
+namespace CxLanguage.LocalLLM;
+
+/// <summary>
+/// Continuous-batching scheduler over a LLamaSharp BatchedExecutor.
+/// Every request becomes a Conversation (a sequence slot in one shared KV cache). A single loop decodes all active
+/// sequences in one batch per step, samples each with its own pipeline, and admits queued requests as soon as a
+/// slot and batch room free up, so concurrent agents share each forward pass instead of waiting for one another.
+/// Prompts longer than the room left in a step, including sequences resumed after an eviction, are prefilled in
+/// chunks over several steps. Only the loop touches the executor.
+/// </summary>
+internal sealed class BatchedInferenceScheduler : IDisposable
+{
+    private readonly ILogger _logger;
+    private readonly LLamaWeights _model;
+    private readonly BatchedExecutor _executor;
+    private readonly int _maxSequences;
+    private readonly int _batchSize;
+    private readonly PrefixKvCache? _prefixCache;
+    private readonly KeyValuePair<string, object?> _modelTag;
+    private readonly Channel<GenerationRequest> _queue = Channel.CreateUnbounded<GenerationRequest>(new UnboundedChannelOptions
+    {
+        SingleReader = true
+    });
+    private readonly LinkedList<GenerationRequest> _deferred = new();
+    private readonly List<ActiveSequence> _active = new();
+    private readonly CancellationTokenSource _shutdown = new();
+    private readonly Task _loop;
+    private long _tokensGenerated;
+    private long _decodeSteps;
+    private int _queuedRequests;
+    private int _activeCount;
+    private bool _disposed;
+
+    public BatchedInferenceScheduler(ILogger logger, LLamaWeights model, BatchedExecutor executor, int maxSequences, int batchSize,
+        PrefixKvCache? prefixCache = null, string modelName = "gguf")
+    {
+        _prefixCache = prefixCache;
+        _modelTag = CxDiagnostics.Tag(CxDiagnostics.ModelTag, modelName);
+        _logger = logger;
+        _model = model;
+        _executor = executor;
+        _maxSequences = Math.Max(1, maxSequences);
+        _batchSize = Math.Max(1, batchSize);
+        _loop = Task.Run(RunAsync);
+    }
+
+    public int ActiveSequences => Volatile.Read(ref _activeCount);
+
+    public int QueuedRequests => Volatile.Read(ref _queuedRequests);
+
+    public long TokensGenerated => Interlocked.Read(ref _tokensGenerated);
+
+    public long DecodeSteps => Interlocked.Read(ref _decodeSteps);
+
+    public Dictionary<string, object> GetPrefixCacheStatistics() =>
+        _prefixCache?.GetStatistics() ?? new Dictionary<string, object> { ["prefix_cache_enabled"] = false };
+
+    /// <summary>
+    /// Queue a prompt and complete with the generated text. When chunks is set, decoded text is also written to it
+    /// as it is sampled; the writer must accept MaxTokens + 1 items without blocking, since the decode loop only
+    /// calls TryWrite. The caller completes the writer.
+    /// </summary>
+    public Task<string> GenerateAsync(string prompt, GGUFSamplingOptions sampling, CancellationToken cancellationToken,
+        ChannelWriter<string>? chunks = null)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+
+        var request = new GenerationRequest(prompt, sampling, cancellationToken, chunks);
+        Interlocked.Increment(ref _queuedRequests);
+        if (!_queue.Writer.TryWrite(request))
+        {
+            Interlocked.Decrement(ref _queuedRequests);
+            throw new ObjectDisposedException(nameof(BatchedInferenceScheduler));
+        }
+        return request.Completion.Task;
+    }
+
+    private async Task RunAsync()
+    {
+        var shutdown = _shutdown.Token;
+        try
+        {
+            while (!shutdown.IsCancellationRequested)
+            {
+                AdmitRequests();
+
+                if (_active.Count == 0)
+                {
+                    if (_deferred.Count == 0 && !await _queue.Reader.WaitToReadAsync(shutdown))
+                    {
+                        break;
+                    }
+                    continue;
+                }
+
+                DecodeResult result;
+                try
+                {
+                    result = await _executor.Infer(shutdown);
+                }
+                catch (OperationCanceledException) when (shutdown.IsCancellationRequested)
+                {
+                    break;
+                }
+                catch (Exception ex)
+                {
+                    _logger.LogError(ex, "❌ Batched decode failed, failing {Count} active sequences", _active.Count);
+                    FailAll(ex);
+                    continue;
+                }
+
+                if (result == DecodeResult.NoKvSlot)
+                {
+                    EvictNewestSequence();
+                    continue;
+                }
+
+                if (result != DecodeResult.Ok)
+                {
+                    FailAll(new InvalidOperationException($"llama_decode returned {result}"));
+                    continue;
+                }
+
+                Interlocked.Increment(ref _decodeSteps);
+                SampleActiveSequences();
+                ContinuePrefills();
+            }
+        }
+        catch (OperationCanceledException) when (shutdown.IsCancellationRequested)
+        {
+        }
+        finally
+        {
+            FailAll(new ObjectDisposedException(nameof(BatchedInferenceScheduler)));
+            _prefixCache?.Dispose();
+            while (_deferred.First is { } node)
+            {
+                _deferred.RemoveFirst();
+                node.Value.Completion.TrySetException(new ObjectDisposedException(nameof(BatchedInferenceScheduler)));
+            }
+            while (_queue.Reader.TryRead(out var request))
+            {
+                request.Completion.TrySetException(new ObjectDisposedException(nameof(BatchedInferenceScheduler)));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Start queued requests while a sequence slot is free and the next batch has room for their first prompt chunk
+    /// </summary>
+    private void AdmitRequests()
+    {
+        while (_active.Count < _maxSequences && TryTakeRequest(out var request))
+        {
+            if (request.Completion.Task.IsCompleted)
+            {
+                // Cancelled while queued
+                continue;
+            }
+
+            // A sequence evicted on a full KV cache resumes from its prompt plus what it has generated so far
+            var suspended = request.Suspended;
+            request.Suspended = null;
+
+            LLamaToken[] tokens;
+            try
+            {
+                tokens = suspended?.ResumeTokens() ?? _executor.Context.Tokenize(request.Prompt, addBos: true, special: true);
+            }
+            catch (Exception ex)
+            {
+                request.Completion.TrySetException(ex);
+                continue;
+            }
+
+            // Only the part after the longest cached prefix needs prefilling
+            var match = _prefixCache?.Find(tokens) ?? default;
+            var prefill = new PromptPrefill(tokens, match.Length);
+
+            var room = _batchSize - _executor.BatchedTokenCount;
+            if (room <= 0)
+            {
+                // Wait for this step's batch to drain; keep arrival order
+                request.Suspended = suspended;
+                _deferred.AddFirst(request);
+                break;
+            }
+
+            Conversation conversation;
+            if (match.Entry != null)
+            {
+                conversation = _prefixCache!.Fork(match, tokens.Length);
+            }
+            else
+            {
+                _prefixCache?.RecordMiss(tokens.Length);
+                conversation = _executor.Create();
+            }
+            conversation.Prompt(prefill.Take(room));
+
+            var sequence = suspended ?? new ActiveSequence(request, conversation, CreateSampler(request.Sampling),
+                new StreamingTokenDecoder(_executor.Context), tokens)
+            {
+                PrefixToCache = _prefixCache?.CacheableLength(tokens.Length) ?? 0
+            };
+            if (suspended != null)
+            {
+                suspended.Resume(conversation, CreateSampler(request.Sampling));
+            }
+            sequence.Prefill = prefill.IsComplete ? null : prefill;
+            _active.Add(sequence);
+            Volatile.Write(ref _activeCount, _active.Count);
+        }
+    }
+
+    private bool TryTakeRequest(out GenerationRequest request)
+    {
+        if (_deferred.First is { } node)
+        {
+            _deferred.RemoveFirst();
+            request = node.Value;
+            return true;
+        }
+
+        if (_queue.Reader.TryRead(out request!))
+        {
+            Interlocked.Decrement(ref _queuedRequests);
+            return true;
+        }
+
+        return false;
+    }
+
+    private void SampleActiveSequences()
+    {
+        var context = _executor.Context.NativeHandle;
+
+        for (int i = _active.Count - 1; i >= 0; i--)
+        {
+            var sequence = _active[i];
+
+            if (sequence.Request.Completion.Task.IsCompleted)
+            {
+                Retire(i, cancelled: true);
+                continue;
+            }
+
+            if (!sequence.Conversation.RequiresSampling || sequence.Prefill != null)
+            {
+                // Still decoding, or a prompt chunk was decoded and ContinuePrefills queues the next one
+                continue;
+            }
+
+            if (sequence.PrefixToCache > 0)
+            {
+                // The prompt has just been decoded: keep its block-aligned prefix for later requests
+                CachePromptPrefix(sequence);
+            }
+
+            LLamaToken token;
+            try
+            {
+                token = sequence.Sampler.Sample(context, sequence.Conversation.Sample(), sequence.RecentTokens());
+                sequence.Sampler.Accept(context, token);
+            }
+            catch (Exception ex)
+            {
+                Retire(i, error: ex);
+                continue;
+            }
+
+            if (IsEndOfGeneration(token))
+            {
+                Retire(i);
+                continue;
+            }
+
+            sequence.Decoder.Add(token);
+            sequence.Text.Append(sequence.Decoder.Read());
+            sequence.Remember(token, sequence.Request.Sampling.RepeatLastTokens);
+            Interlocked.Increment(ref _tokensGenerated);
+            CxDiagnostics.LlmTokensGenerated.Add(1, _modelTag);
+
+            if (sequence.ShouldStop())
+            {
+                Retire(i);
+                continue;
+            }
+
+            sequence.WriteChunk(final: false);
+            sequence.Conversation.Prompt(token);
+        }
+    }
+
+    /// <summary>
+    /// Queue the next prompt chunk of every sequence whose previous chunk was just decoded, in the batch room left
+    /// after this step's sampled tokens. Runs after sampling so generating sequences never lose their slot.
+    /// </summary>
+    private void ContinuePrefills()
+    {
+        foreach (var sequence in _active)
+        {
+            if (sequence.Prefill is not { } prefill || !sequence.Conversation.RequiresSampling)
+            {
+                continue;
+            }
+
+            var chunk = prefill.Take(_batchSize - _executor.BatchedTokenCount);
+            if (chunk.IsEmpty)
+            {
+                break;
+            }
+
+            sequence.Conversation.Prompt(chunk);
+            if (prefill.IsComplete)
+            {
+                sequence.Prefill = null;
+            }
+        }
+    }
+
+    private void CachePromptPrefix(ActiveSequence sequence)
+    {
+        var length = sequence.PrefixToCache;
+        sequence.PrefixToCache = 0;
+
+        try
+        {
+            _prefixCache!.Insert(sequence.Conversation, sequence.Prompt, length);
+        }
+        catch (Exception ex)
+        {
+            _logger.LogWarning(ex, "⚠️ Failed to cache a {Length}-token prompt prefix: {Error}", length, ex.Message);
+        }
+    }
+
+    /// <summary>
+    /// The shared KV cache is full: drop cached prefixes first, then put the most recently admitted sequence back at
+    /// the head of the queue so older sequences can finish, or fail it when it is the only one left.
+    /// The suspended sequence keeps its generated tokens and continues where it stopped, so text already streamed
+    /// to its caller stays valid.
+    /// </summary>
+    private void EvictNewestSequence()
+    {
+        if (_prefixCache?.EvictOldest() == true)
+        {
+            _logger.LogDebug("🔄 KV cache full, evicted a cached prompt prefix");
+            return;
+        }
+
+        var index = _active.Count - 1;
+        var sequence = _active[index];
+
+        if (_active.Count == 1)
+        {
+            Retire(index, error: new InvalidOperationException("Prompt and response do not fit in the batched KV cache"));
+            return;
+        }
+
+        _logger.LogDebug("🔄 KV cache full, re-queueing the newest of {Count} sequences", _active.Count);
+        sequence.Conversation.Dispose();
+        sequence.Sampler.Dispose();
+        _active.RemoveAt(index);
+        Volatile.Write(ref _activeCount, _active.Count);
+        sequence.Request.Suspended = sequence;
+        _deferred.AddFirst(sequence.Request);
+    }
+
+    private void Retire(int index, bool cancelled = false, Exception? error = null)
+    {
+        var sequence = _active[index];
+        _active.RemoveAt(index);
+        Volatile.Write(ref _activeCount, _active.Count);
+
+        try
+        {
+            sequence.Conversation.Dispose();
+            sequence.Sampler.Dispose();
+        }
+        catch (Exception ex)
+        {
+            _logger.LogWarning(ex, "Warning while releasing a batched sequence: {Error}", ex.Message);
+        }
+
+        if (error != null)
+        {
+            sequence.Request.Completion.TrySetException(error);
+        }
+        else if (cancelled)
+        {
+            sequence.Request.Completion.TrySetCanceled(sequence.Request.CancellationToken);
+        }
+        else
+        {
+            sequence.WriteChunk(final: true);
+            CxDiagnostics.RecordGeneration(sequence.Request.StartTimestamp, sequence.Generated, _modelTag);
+            sequence.Request.Completion.TrySetResult(sequence.FinalText());
+        }
+    }
+
+    private void FailAll(Exception error)
+    {
+        for (int i = _active.Count - 1; i >= 0; i--)
+        {
+            Retire(i, error: error);
+        }
+    }
+
+    private bool IsEndOfGeneration(LLamaToken token)
+    {
+        var tokens = _model.Tokens;
+        return token == tokens.EOS || token == tokens.EOT;
+    }
+
+    private static DefaultSamplingPipeline CreateSampler(GGUFSamplingOptions sampling) => new()
+    {
+        Temperature = sampling.Temperature,
+        TopK = sampling.TopK,
+        TopP = sampling.TopP,
+        RepeatPenalty = sampling.RepeatPenalty
+    };
+
+    public void Dispose()
+    {
+        if (_disposed) return;
+        _disposed = true;
+
+        _queue.Writer.TryComplete();
+        _shutdown.Cancel();
+        try
+        {
+            _loop.Wait(TimeSpan.FromSeconds(5));
+        }
+        catch (AggregateException)
+        {
+        }
+        _shutdown.Dispose();
+    }
+
+    private sealed class GenerationRequest
+    {
+        public GenerationRequest(string prompt, GGUFSamplingOptions sampling, CancellationToken cancellationToken,
+            ChannelWriter<string>? chunks)
+        {
+            Prompt = prompt;
+            Sampling = sampling;
+            CancellationToken = cancellationToken;
+            Chunks = chunks;
+
+            // Queued requests complete as soon as they are cancelled; active ones are retired by the next step
+            if (cancellationToken.CanBeCanceled)
+            {
+                var registration = cancellationToken.Register(() => Completion.TrySetCanceled(cancellationToken));
+                Completion.Task.ContinueWith(_ => registration.Dispose(), TaskScheduler.Default);
+            }
+        }
+
+        public string Prompt { get; }
+        public GGUFSamplingOptions Sampling { get; }
+        public CancellationToken CancellationToken { get; }
+        public ChannelWriter<string>? Chunks { get; }
+        public TaskCompletionSource<string> Completion { get; } = new(TaskCreationOptions.RunContinuationsAsynchronously);
+
+        /// <summary>
+        /// Submission time for the generation histograms, 0 when they have no listener
+        /// </summary>
+        public long StartTimestamp { get; } = CxDiagnostics.StartGeneration();
+
+        /// <summary>
+        /// Generation state of a sequence evicted from the KV cache, to be resumed on readmission
+        /// </summary>
+        public ActiveSequence? Suspended { get; set; }
+    }
+
+    private sealed class ActiveSequence
+    {
+        private readonly List<LLamaToken> _recent;
+        private readonly List<LLamaToken> _output = new();
+        private readonly int _holdBack;
+        private int _streamed;
+
+        public ActiveSequence(GenerationRequest request, Conversation conversation, DefaultSamplingPipeline sampler,
+            StreamingTokenDecoder decoder, LLamaToken[] prompt)
+        {
+            Request = request;
+            Conversation = conversation;
+            Prompt = prompt;
+            Sampler = sampler;
+            Decoder = decoder;
+
+            var keep = Math.Min(prompt.Length, request.Sampling.RepeatLastTokens);
+            _recent = new List<LLamaToken>(prompt.AsSpan(prompt.Length - keep).ToArray());
+
+            foreach (var antiPrompt in request.Sampling.AntiPrompts)
+            {
+                _holdBack = Math.Max(_holdBack, antiPrompt.Length - 1);
+            }
+        }
+
+        public GenerationRequest Request { get; }
+        public Conversation Conversation { get; private set; }
+        public LLamaToken[] Prompt { get; }
+
+        /// <summary>
+        /// Prompt prefix length to hand to the prefix cache once the prompt is decoded, 0 when done or not cacheable
+        /// </summary>
+        public int PrefixToCache { get; set; }
+
+        /// <summary>
+        /// Prompt tokens not yet handed to the batch, null once the whole prompt is queued
+        /// </summary>
+        public PromptPrefill? Prefill { get; set; }
+        public DefaultSamplingPipeline Sampler { get; private set; }
+        public StreamingTokenDecoder Decoder { get; }
+        public StringBuilder Text { get; } = new();
+        public int Generated => _output.Count;
+
+        public ReadOnlySpan<LLamaToken> RecentTokens() => CollectionsMarshal.AsSpan(_recent);
+
+        /// <summary>
+        /// Prompt followed by every generated token, to rebuild the KV state after an eviction
+        /// </summary>
+        public LLamaToken[] ResumeTokens()
+        {
+            var tokens = new LLamaToken[Prompt.Length + _output.Count];
+            Prompt.CopyTo(tokens, 0);
+            _output.CopyTo(tokens, Prompt.Length);
+            return tokens;
+        }
+
+        public void Resume(Conversation conversation, DefaultSamplingPipeline sampler)
+        {
+            Conversation = conversation;
+            Sampler = sampler;
+        }
+
+        /// <summary>
+        /// Record a generated token for the repeat penalty window and for resumption
+        /// </summary>
+        public void Remember(LLamaToken token, int window)
+        {
+            _output.Add(token);
+            _recent.Add(token);
+            if (_recent.Count > window)
+            {
+                _recent.RemoveRange(0, _recent.Count - window);
+            }
+        }
+
+        public bool ShouldStop()
+        {
+            var sampling = Request.Sampling;
+            if (Generated >= sampling.MaxTokens || Text.Length > sampling.MaxCharacters)
+            {
+                return true;
+            }
+
+            if (sampling.StopAtSentenceEnd && Text.Length > 20 && Text[^1] is '.' or '!' or '?')
+            {
+                return true;
+            }
+
+            return AntiPromptIndex() >= 0;
+        }
+
+        /// <summary>
+        /// Hand text not yet streamed to the request's chunk writer. Until the final call the tail that could still
+        /// grow into an anti-prompt is held back, so streamed text always matches the final response.
+        /// </summary>
+        public void WriteChunk(bool final)
+        {
+            if (Request.Chunks is not { } chunks)
+            {
+                return;
+            }
+
+            var end = final ? FinalLength() : Text.Length - _holdBack;
+            if (end > _streamed && chunks.TryWrite(Text.ToString(_streamed, end - _streamed)))
+            {
+                _streamed = end;
+            }
+        }
+
+        /// <summary>
+        /// Response text without a trailing anti-prompt
+        /// </summary>
+        public string FinalText() => Text.ToString(0, FinalLength());
+
+        private int FinalLength()
+        {
+            var index = AntiPromptIndex();
+            return index >= 0 ? index : Text.Length;
+        }
+
+        private int AntiPromptIndex()
+        {
+            foreach (var antiPrompt in Request.Sampling.AntiPrompts)
+            {
+                if (antiPrompt.Length == 0 || Text.Length < antiPrompt.Length)
+                {
+                    continue;
+                }
+
+                // Only the tail can contain a new match: earlier text was checked on previous tokens
+                var tailStart = Math.Max(0, Text.Length - antiPrompt.Length - 16);
+                var index = Text.ToString(tailStart, Text.Length - tailStart).IndexOf(antiPrompt, StringComparison.Ordinal);
+                if (index >= 0)
+                {
+                    return tailStart + index;
+                }
+            }
+            return -1;
+        }
+    }
+}
@@ -0,0 +1,117 @@
+using System;
+using System.Collections.Generic;
+
+namespace CxLanguage.LocalLLM;
+
+/// <summary>
+/// Engine-wide settings for NativeGGUFInferenceEngine
+/// </summary>
+public class NativeGGUFEngineOptions
+{
+    /// <summary>
+    /// Decode concurrent requests together in one shared context with continuous batching.
+    /// When false, requests are serialized through a single InteractiveExecutor conversation.
+    /// </summary>
+    public bool BatchedExecution { get; set; } = true;
+
+    /// <summary>
+    /// Sequences decoded together; further requests wait for a free slot
+    /// </summary>
+    public int MaxConcurrentSequences { get; set; } = 8;
+
+    /// <summary>
+    /// Context window of the single-conversation executor
+    /// </summary>
+    public uint ContextSize { get; set; } = 4096;
+
+    /// <summary>
+    /// KV cache shared by all batched sequences
+    /// </summary>
+    public uint BatchedContextSize { get; set; } = 8192;
+
+    /// <summary>
+    /// Tokens submitted per decode step across all sequences; also bounds a single prompt's length
+    /// </summary>
+    public uint BatchSize { get; set; } = 2048;
+
+    public int GpuLayerCount { get; set; } = 32;
+
+    /// <summary>
+    /// Batched mode: prompt-prefix tokens whose KV state is kept for reuse. Cached prefixes occupy cells of the
+    /// shared KV cache (evicted first when it fills), so this bounds their memory. 0 disables the prefix cache.
+    /// </summary>
+    public long PrefixCacheTokenBudget { get; set; } = 4096;
+
+    /// <summary>
+    /// Prefixes are matched and cached in whole blocks of this many tokens
+    /// </summary>
+    public int PrefixCacheBlockTokens { get; set; } = 32;
+
+    /// <summary>
+    /// Shortest prefix worth restoring; shorter shared prefixes are cheaper to prefill again
+    /// </summary>
+    public int PrefixCacheMinTokens { get; set; } = 64;
+}
+
+/// <summary>
+/// Per-request sampling and stopping parameters. The defaults reproduce the engine's original short-answer behaviour.
+/// </summary>
+public class GGUFSamplingOptions
+{
+    public static GGUFSamplingOptions Default { get; } = new();
+
+    public float Temperature { get; init; } = 0.8f;
+
+    public float TopP { get; init; } = 0.95f;
+
+    public int TopK { get; init; } = 40;
+
+    public float RepeatPenalty { get; init; } = 1.1f;
+
+    /// <summary>
+    /// Tokens kept for the repeat penalty
+    /// </summary>
+    public int RepeatLastTokens { get; init; } = 64;
+
+    public int MaxTokens { get; init; } = 50;
+
+    /// <summary>
+    /// Stop once the response exceeds this many characters
+    /// </summary>
+    public int MaxCharacters { get; init; } = 500;
+
+    /// <summary>
+    /// Stop at the first '.', '!' or '?' once the response is longer than 20 characters
+    /// </summary>
+    public bool StopAtSentenceEnd { get; init; } = true;
+
+    public IReadOnlyList<string> AntiPrompts { get; init; } = new[] { "\nQ:" };
+}
+
+/// <summary>
+/// Settings for LocalEmbeddingGenerator
+/// </summary>
+public class LocalEmbeddingOptions
+{
+    /// <summary>
+    /// Tokens decoded together in one batch; also the KV cache size of each context
+    /// </summary>
+    public uint BatchTokens { get; set; } = 2048;
+
+    /// <summary>
+    /// Texts packed into one decode batch, each as its own sequence
+    /// </summary>
+    public uint MaxSequencesPerBatch { get; set; } = 32;
+
+    /// <summary>
+    /// Contexts decoding batches concurrently. Each holds its own KV cache of BatchTokens cells.
+    /// </summary>
+    public int ParallelContexts { get; set; } = 1;
+
+    /// <summary>
+    /// Longer inputs are truncated to this many tokens (capped at BatchTokens)
+    /// </summary>
+    public int MaxTokensPerText { get; set; } = 512;
+
+    public int GpuLayerCount { get; set; } = 32;
+}
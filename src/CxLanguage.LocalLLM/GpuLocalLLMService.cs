@@ -5,7 +5,6 @@ using System.Threading.Tasks;
 using Microsoft.Extensions.Logging;
 using System.IO;
 using System.Linq;
-using System.Threading.Channels;
 using System.Runtime.CompilerServices;
 
 namespace CxLanguage.LocalLLM
@@ -19,9 +18,6 @@ namespace CxLanguage.LocalLLM
     {
         private readonly ILogger<GpuLocalLLMService> _logger;
         private readonly bool _gpuAvailable;
-        private readonly Channel<string> _tokenChannel;
-        private readonly ChannelWriter<string> _tokenWriter;
-        private readonly ChannelReader<string> _tokenReader;
         private NativeGGUFInferenceEngine? _ggufEngine; // Removed readonly to allow reassignment
         
         private bool _modelLoaded = false;
@@ -38,16 +34,6 @@ namespace CxLanguage.LocalLLM
             // Check for GPU availability
             _gpuAvailable = CheckGpuAvailability();
             
-            // Create streaming token channel for real-time generation
-            _tokenChannel = Channel.CreateUnbounded<string>(new UnboundedChannelOptions
-            {
-                SingleReader = true,
-                SingleWriter = true
-            });
-            
-            _tokenWriter = _tokenChannel.Writer;
-            _tokenReader = _tokenChannel.Reader;
-
             // Try to initialize real GGUF model
             var modelPath = FindBestAvailableModel();
             if (!string.IsNullOrEmpty(modelPath))
@@ -743,41 +729,10 @@ namespace CxLanguage.LocalLLM
                 throw new InvalidOperationException("❌ REAL LLM ONLY MODE: No GGUF model available for streaming - NO SIMULATION FALLBACK");
             }
             
-            // Clear any existing tokens in the channel
-            while (_tokenReader.TryRead(out _)) { }
-            
-            // Start generation in a background task using real GGUF model
-            _ = Task.Run(async () => 
+            // Each call streams through its own channel straight from the decode loop
+            await foreach (var chunk in _ggufEngine.StreamAsync(prompt, null, cancellationToken))
             {
-                try
-                {
-                    string result = await _ggufEngine.GenerateAsync(prompt, cancellationToken);
-                    
-                    // Split result into tokens for streaming
-                    var tokens = result.Split(' ');
-                    foreach (var token in tokens)
-                    {
-                        await _tokenWriter.WriteAsync(token + " ", cancellationToken);
-                        // Real-time streaming without artificial delays
-                    }
-                    
-                    // Complete the channel
-                    _tokenWriter.Complete();
-                }
-                catch (Exception ex)
-                {
-                    _logger.LogError(ex, "❌ Error during streaming generation - REAL LLM ONLY");
-                    _tokenWriter.Complete(ex);
-                }
-            }, cancellationToken);
-            
-            // Read tokens from the channel
-            while (await _tokenReader.WaitToReadAsync(cancellationToken))
-            {
-                while (_tokenReader.TryRead(out var token))
-                {
-                    yield return token;
-                }
+                yield return chunk;
             }
         }
         
@@ -813,9 +768,6 @@ namespace CxLanguage.LocalLLM
                 // Dispose real GGUF model if loaded
                 _ggufEngine?.Dispose();
                 
-                // Cleanup the token channel
-                _tokenWriter.Complete();
-                
                 _logger.LogInformation("✅ GpuLocalLLMService disposed successfully");
             }
             catch (Exception ex)
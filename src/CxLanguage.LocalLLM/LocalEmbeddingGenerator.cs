@@ -3,10 +3,12 @@ using System.Collections.Generic;
 using System.IO;
 using System.Linq;
 using System.Threading;
+using System.Threading.Channels;
 using System.Threading.Tasks;
 using Microsoft.Extensions.AI;
 using Microsoft.Extensions.Logging;
 using LLama.Common;
+using LLama.Native;
 using LLama;
 
 namespace CxLanguage.LocalLLM;
@@ -15,13 +17,21 @@ namespace CxLanguage.LocalLLM;
 /// 🧠 Marcus "LocalLLM" Chen - Local Embedding Generator
 /// Local embedding generation using LlamaSharp for zero-cloud dependency operation
 /// Supports GGUF embedding models for consciousness-aware document processing
+///
+/// Inputs are tokenized once, ordered by length and packed into decode batches of up to
+/// MaxSequencesPerBatch sequences / BatchTokens tokens, so a file's chunks cost a handful of forward passes
+/// instead of one per chunk. Batches are spread over ParallelContexts contexts of the same weights.
 /// </summary>
 public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<float>>, IDisposable
 {
     private readonly ILogger<LocalEmbeddingGenerator> _logger;
     private readonly string _modelPath;
+    private readonly LocalEmbeddingOptions _options;
+    private readonly SemaphoreSlim _loadLock = new(1, 1);
+    private readonly List<LLamaContext> _contexts = new();
     private LLamaWeights? _model;
-    private LLamaEmbedder? _embedder;
+    private Channel<LLamaContext>? _idleContexts;
+    private int _embeddingSize;
     private bool _isLoaded = false;
     private bool _disposed = false;
 
@@ -35,10 +45,12 @@ public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<flo
     /// </summary>
     /// <param name="modelPath">Path to the GGUF embedding model file</param>
     /// <param name="logger">Logger instance</param>
-    public LocalEmbeddingGenerator(string modelPath, ILogger<LocalEmbeddingGenerator> logger)
+    /// <param name="options">Batching settings; defaults when null</param>
+    public LocalEmbeddingGenerator(string modelPath, ILogger<LocalEmbeddingGenerator> logger, LocalEmbeddingOptions? options = null)
     {
         _logger = logger ?? throw new ArgumentNullException(nameof(logger));
         _modelPath = modelPath ?? throw new ArgumentNullException(nameof(modelPath));
+        _options = options ?? new LocalEmbeddingOptions();
         
         Metadata = new EmbeddingGeneratorMetadata("LocalLLM-Embeddings");
         
@@ -62,15 +74,26 @@ public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<flo
             return false;
         }
 
+        await _loadLock.WaitAsync();
         try
         {
+            if (_isLoaded)
+            {
+                return true;
+            }
+
             _logger.LogInformation("🧩 Loading local embedding model from {ModelPath}...", _modelPath);
 
+            var batchTokens = Math.Max(1u, _options.BatchTokens);
+
             // LlamaSharp model parameters for embedding generation
             var parameters = new ModelParams(_modelPath)
             {
-                ContextSize = 512,         // Smaller context for embeddings
-                GpuLayerCount = 32,        // GPU acceleration if available
+                ContextSize = batchTokens,  // KV cells for every sequence of one batch
+                BatchSize = batchTokens,
+                UBatchSize = batchTokens,   // Non-causal encoders need each sequence in a single micro-batch
+                SeqMax = Math.Max(1u, _options.MaxSequencesPerBatch),
+                GpuLayerCount = _options.GpuLayerCount, // GPU acceleration if available
                 Seed = 1337,               // Reproducible embeddings
                 UseMemorymap = true,       // Memory mapping for performance
                 UseMemoryLock = false,     // Avoid memory locking issues
@@ -80,29 +103,25 @@ public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<flo
             // Load model with embedding support - suppress console output
             await Task.Run(() =>
             {
-                // Temporarily redirect console output to suppress llama_model_loader output
-                var originalOut = Console.Out;
-                var originalError = Console.Error;
-                
-                try
+                using (ConsoleSuppressionHelper.SuppressManagedConsoleOutput())
                 {
-                    // Completely suppress all output during model loading
-                    Console.SetOut(TextWriter.Null);
-                    Console.SetError(TextWriter.Null);
-                    
                     _model = LLamaWeights.LoadFromFile(parameters);
-                    _embedder = new LLamaEmbedder(_model, parameters);
-                }
-                finally
-                {
-                    // Restore console output
-                    Console.SetOut(originalOut);
-                    Console.SetError(originalError);
+                    _embeddingSize = _model.EmbeddingSize;
+
+                    var contextCount = Math.Max(1, _options.ParallelContexts);
+                    _idleContexts = Channel.CreateBounded<LLamaContext>(contextCount);
+                    for (int i = 0; i < contextCount; i++)
+                    {
+                        var context = _model.CreateContext(parameters);
+                        _contexts.Add(context);
+                        _idleContexts.Writer.TryWrite(context);
+                    }
                 }
             });
 
             _isLoaded = true;
-            _logger.LogInformation("✅ Local embedding model loaded successfully");
+            _logger.LogInformation("✅ Local embedding model loaded successfully ({Contexts} contexts, {BatchTokens} tokens per batch)",
+                _contexts.Count, batchTokens);
             
             return true;
         }
@@ -111,6 +130,10 @@ public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<flo
             _logger.LogError(ex, "❌ Failed to load local embedding model");
             return false;
         }
+        finally
+        {
+            _loadLock.Release();
+        }
     }
 
     /// <summary>
@@ -119,7 +142,7 @@ public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<flo
     /// <param name="values">Input text values to generate embeddings for</param>
     /// <param name="options">Embedding generation options</param>
     /// <param name="cancellationToken">Cancellation token</param>
-    /// <returns>Generated embeddings result</returns>
+    /// <returns>Generated embeddings result, in input order</returns>
     public async Task<GeneratedEmbeddings<Embedding<float>>> GenerateAsync(
         IEnumerable<string> values, 
         EmbeddingGenerationOptions? options = null, 
@@ -134,52 +157,30 @@ public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<flo
             }
         }
 
-        if (_embedder == null)
+        if (_idleContexts == null || _contexts.Count == 0)
         {
             throw new InvalidOperationException("Embedding model not properly initialized");
         }
 
         try
         {
-            var inputList = values.ToList();
+            var inputList = values as IList<string> ?? values.ToList();
             _logger.LogInformation("🔢 Generating local embeddings for {Count} input values", inputList.Count);
 
-            var embeddings = new List<Embedding<float>>();
-            int totalTokens = 0;
+            var tokenized = Tokenize(inputList, out var totalTokens);
+            var batches = PackBatches(tokenized);
+            var vectors = new float[inputList.Count][];
 
-            foreach (var text in inputList)
-            {
-                cancellationToken.ThrowIfCancellationRequested();
+            await Task.WhenAll(batches.Select(batch => EmbedBatchAsync(batch, tokenized, vectors, cancellationToken)));
 
-                // Generate embedding using LlamaSharp - suppress output
-                var embeddingVector = await Task.Run(() => 
-                {
-                    // Suppress any potential LlamaSharp console output during embedding generation
-                    var originalOut = Console.Out;
-                    var originalError = Console.Error;
-                    
-                    try
-                    {
-                        Console.SetOut(TextWriter.Null);
-                        Console.SetError(TextWriter.Null);
-                        return _embedder.GetEmbeddings(text);
-                    }
-                    finally
-                    {
-                        Console.SetOut(originalOut);
-                        Console.SetError(originalError);
-                    }
-                }, cancellationToken);
-                
+            var embeddings = new List<Embedding<float>>(vectors.Length);
+            foreach (var vector in vectors)
+            {
                 // Convert to Microsoft.Extensions.AI format
-                var embedding = new Embedding<float>(embeddingVector);
-                embeddings.Add(embedding);
-
-                // Estimate token count (rough approximation)
-                totalTokens += text.Length / 4;
+                embeddings.Add(new Embedding<float>(vector));
             }
 
-            _logger.LogInformation("✅ Successfully generated {Count} local embeddings", embeddings.Count);
+            _logger.LogInformation("✅ Successfully generated {Count} local embeddings in {Batches} batches", embeddings.Count, batches.Count);
 
             return new GeneratedEmbeddings<Embedding<float>>(embeddings)
             {
@@ -197,6 +198,169 @@ public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<flo
         }
     }
 
+    /// <summary>
+    /// Tokenize every input, truncating to MaxTokensPerText
+    /// </summary>
+    private LLamaToken[][] Tokenize(IList<string> inputs, out long totalTokens)
+    {
+        var limit = (int)Math.Min(Math.Max(1, _options.MaxTokensPerText), Math.Max(1u, _options.BatchTokens));
+        var tokenizer = _contexts[0];
+        var tokenized = new LLamaToken[inputs.Count][];
+        var truncated = 0;
+        totalTokens = 0;
+
+        for (int i = 0; i < inputs.Count; i++)
+        {
+            var tokens = tokenizer.Tokenize(inputs[i] ?? "", addBos: true, special: true);
+            if (tokens.Length > limit)
+            {
+                Array.Resize(ref tokens, limit);
+                truncated++;
+            }
+            tokenized[i] = tokens;
+            totalTokens += tokens.Length;
+        }
+
+        if (truncated > 0)
+        {
+            _logger.LogDebug("✂️ Truncated {Count} inputs to {Limit} tokens", truncated, limit);
+        }
+
+        return tokenized;
+    }
+
+    /// <summary>
+    /// Group input indexes into decode batches, longest first, so batches fill evenly and the long tail of short
+    /// chunks shares a few large batches
+    /// </summary>
+    private List<int[]> PackBatches(LLamaToken[][] tokenized)
+    {
+        var order = Enumerable.Range(0, tokenized.Length)
+            .OrderByDescending(i => tokenized[i].Length)
+            .ToArray();
+
+        var batchTokens = (int)Math.Max(1u, _options.BatchTokens);
+        var maxSequences = (int)Math.Max(1u, _options.MaxSequencesPerBatch);
+        var batches = new List<int[]>();
+        var current = new List<int>(maxSequences);
+        var currentTokens = 0;
+
+        foreach (var index in order)
+        {
+            var length = tokenized[index].Length;
+            if (current.Count > 0 && (current.Count == maxSequences || currentTokens + length > batchTokens))
+            {
+                batches.Add(current.ToArray());
+                current.Clear();
+                currentTokens = 0;
+            }
+
+            current.Add(index);
+            currentTokens += length;
+        }
+
+        if (current.Count > 0)
+        {
+            batches.Add(current.ToArray());
+        }
+
+        return batches;
+    }
+
+    private async Task EmbedBatchAsync(int[] members, LLamaToken[][] tokenized, float[][] vectors, CancellationToken cancellationToken)
+    {
+        var context = await _idleContexts!.Reader.ReadAsync(cancellationToken);
+        try
+        {
+            await Task.Run(() => DecodeBatch(context, members, tokenized, vectors), cancellationToken);
+        }
+        finally
+        {
+            _idleContexts.Writer.TryWrite(context);
+        }
+    }
+
+    /// <summary>
+    /// Decode one batch with every member as its own sequence and read back the pooled, L2-normalized embeddings.
+    /// Models without a pooling type are mean-pooled over their token embeddings here.
+    /// </summary>
+    private void DecodeBatch(LLamaContext context, int[] members, LLamaToken[][] tokenized, float[][] vectors)
+    {
+        var handle = context.NativeHandle;
+        var pooled = handle.PoolingType != LLamaPoolingType.None;
+        var batch = new LLamaBatch();
+        var firstBatchIndex = new int[members.Length];
+
+        for (int s = 0; s < members.Length; s++)
+        {
+            var tokens = tokenized[members[s]];
+            firstBatchIndex[s] = batch.TokenCount;
+            for (int position = 0; position < tokens.Length; position++)
+            {
+                batch.Add(tokens[position], position, (LLamaSeqId)s, logits: !pooled || position == tokens.Length - 1);
+            }
+        }
+
+        if (batch.TokenCount > 0)
+        {
+            using (ConsoleSuppressionHelper.SuppressManagedConsoleOutput())
+            {
+                handle.KvCacheClear();
+                var result = handle.Decode(batch);
+                if (result != DecodeResult.Ok)
+                {
+                    throw new InvalidOperationException($"llama_decode returned {result} for an embedding batch of {batch.TokenCount} tokens");
+                }
+            }
+        }
+
+        for (int s = 0; s < members.Length; s++)
+        {
+            var length = tokenized[members[s]].Length;
+            var vector = new float[_embeddingSize];
+
+            if (length > 0 && pooled)
+            {
+                handle.GetEmbeddingsSeq((LLamaSeqId)s).CopyTo(vector);
+            }
+            else if (length > 0)
+            {
+                // A plain sum: the normalization below cancels the 1/length of a mean
+                for (int t = 0; t < length; t++)
+                {
+                    var tokenEmbedding = handle.GetEmbeddingsIth(firstBatchIndex[s] + t);
+                    for (int d = 0; d < vector.Length; d++)
+                    {
+                        vector[d] += tokenEmbedding[d];
+                    }
+                }
+            }
+
+            Normalize(vector);
+            vectors[members[s]] = vector;
+        }
+    }
+
+    private static void Normalize(float[] vector)
+    {
+        double sum = 0;
+        foreach (var value in vector)
+        {
+            sum += value * value;
+        }
+
+        if (sum <= 0)
+        {
+            return;
+        }
+
+        var scale = (float)(1.0 / Math.Sqrt(sum));
+        for (int i = 0; i < vector.Length; i++)
+        {
+            vector[i] *= scale;
+        }
+    }
+
     /// <summary>
     /// Gets a service instance (Microsoft.Extensions.AI interface requirement)
     /// </summary>
@@ -222,7 +386,11 @@ public class LocalEmbeddingGenerator : IEmbeddingGenerator<string, Embedding<flo
 
         try
         {
-            _embedder?.Dispose();
+            foreach (var context in _contexts)
+            {
+                context.Dispose();
+            }
+            _contexts.Clear();
             _model?.Dispose();
             _logger.LogInformation("🧹 LocalEmbeddingGenerator disposed");
         }
@@ -35,6 +35,7 @@ namespace CxLanguage.LocalLLM
             // Register event handlers
             _eventBus.Subscribe("llm.initialize", HandleInitializeEvent);
             _eventBus.Subscribe("llm.generate", HandleGenerateEvent);
+            _eventBus.Subscribe("llm.stream", HandleStreamEvent);
             _eventBus.Subscribe("llm.dispose", HandleDisposeEvent);
 
             _logger.LogInformation("🔌 LocalLlmEventHandler initialized and subscribed to events");
@@ -152,6 +153,63 @@ namespace CxLanguage.LocalLLM
             }
         }
 
+        /// <summary>
+        /// Handle LLM streaming event: emits llm.stream.chunk as each piece of text is decoded, then
+        /// llm.stream.completed with the full response and time-to-first-token
+        /// </summary>
+        private async Task<bool> HandleStreamEvent(object? sender, string eventName, IDictionary<string, object>? data)
+        {
+            try
+            {
+                data ??= new Dictionary<string, object>();
+                data.TryGetValue("prompt", out var promptObj);
+                string prompt = promptObj?.ToString() ?? "";
+
+                _logger.LogInformation("🌊 Streaming with prompt: {PromptStart}...",
+                    prompt.Length > 50 ? prompt.Substring(0, 50) + "..." : prompt);
+
+                var stopwatch = Stopwatch.StartNew();
+                var response = new System.Text.StringBuilder();
+                long timeToFirstTokenMs = -1;
+                int chunkIndex = 0;
+
+                await foreach (var chunk in _llmService.StreamAsync(prompt))
+                {
+                    if (chunkIndex == 0)
+                    {
+                        timeToFirstTokenMs = stopwatch.ElapsedMilliseconds;
+                    }
+
+                    response.Append(chunk);
+                    await _eventBus.EmitAsync("llm.stream.chunk", new Dictionary<string, object>
+                    {
+                        { "chunk", chunk },
+                        { "index", chunkIndex++ },
+                        { "prompt", prompt },
+                        { "elapsedMs", stopwatch.ElapsedMilliseconds }
+                    });
+                }
+
+                stopwatch.Stop();
+
+                await _eventBus.EmitAsync("llm.stream.completed", new Dictionary<string, object>
+                {
+                    { "result", response.ToString() },
+                    { "prompt", prompt },
+                    { "chunkCount", chunkIndex },
+                    { "timeToFirstTokenMs", timeToFirstTokenMs },
+                    { "generationTimeMs", stopwatch.ElapsedMilliseconds }
+                });
+                return true;
+            }
+            catch (Exception ex)
+            {
+                _logger.LogError(ex, "❌ Error during streaming generation");
+                await EmitErrorAsync("Failed to stream text", ex.ToString());
+                return false;
+            }
+        }
+
         /// <summary>
         /// Handle LLM dispose event
         /// </summary>
@@ -210,6 +268,7 @@ namespace CxLanguage.LocalLLM
                 // Unsubscribe from events
                 _eventBus.Unsubscribe("llm.initialize", HandleInitializeEvent);
                 _eventBus.Unsubscribe("llm.generate", HandleGenerateEvent);
+                _eventBus.Unsubscribe("llm.stream", HandleStreamEvent);
                 _eventBus.Unsubscribe("llm.dispose", HandleDisposeEvent);
 
                 _logger.LogInformation("🔌 LocalLlmEventHandler unsubscribed from events");
@@ -1,13 +1,18 @@
 using LLama.Abstractions;
 using LLama.Common;
 using LLama;
+using LLama.Batched;
+using CxLanguage.Core.Telemetry;
+using CxLanguage.Runtime.Services;
 using Microsoft.Extensions.Logging;
 using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Text;
 using System.Threading;
+using System.Threading.Channels;
 using System.Threading.Tasks;
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 
 namespace CxLanguage.LocalLLM;
@@ -33,6 +38,11 @@ public static class ConsoleSuppressionHelper
         uint flagsAndAttributes,
         IntPtr templateFile);
 
+    private static readonly object _managedConsoleLock = new();
+    private static int _managedSuppressionDepth;
+    private static TextWriter? _savedOut;
+    private static TextWriter? _savedError;
+
     private const int STD_OUTPUT_HANDLE = -11;
     private const int STD_ERROR_HANDLE = -12;
     private const uint GENERIC_WRITE = 0x40000000;
@@ -68,6 +78,40 @@ public static class ConsoleSuppressionHelper
         }
     }
 
+    /// <summary>
+    /// Redirect Console.Out and Console.Error to TextWriter.Null until every overlapping scope is disposed.
+    /// Scopes are reference-counted, so concurrent callers cannot restore each other's writers.
+    /// Output already queued on the shared console sink is written before the writers are swapped.
+    /// </summary>
+    public static IDisposable SuppressManagedConsoleOutput()
+    {
+        lock (_managedConsoleLock)
+        {
+            if (_managedSuppressionDepth++ == 0)
+            {
+                ConsoleOutputSink.FlushShared();
+                _savedOut = Console.Out;
+                _savedError = Console.Error;
+                Console.SetOut(TextWriter.Null);
+                Console.SetError(TextWriter.Null);
+            }
+        }
+
+        return new DisposableAction(() =>
+        {
+            lock (_managedConsoleLock)
+            {
+                if (--_managedSuppressionDepth == 0)
+                {
+                    Console.SetOut(_savedOut!);
+                    Console.SetError(_savedError!);
+                    _savedOut = null;
+                    _savedError = null;
+                }
+            }
+        });
+    }
+
     private class DisposableAction : IDisposable
     {
         private readonly Action _action;
@@ -157,21 +201,28 @@ public class LlamaModelLoaderFilter : TextWriter
 /// <summary>
 /// Native GGUF inference engine for real local LLM processing with consciousness awareness.
 /// Implements direct GGUF model execution with GPU-CUDA acceleration.
+/// In batched mode (the default) concurrent requests share one context through BatchedInferenceScheduler;
+/// otherwise they are serialized through a single InteractiveExecutor conversation.
 /// </summary>
 public class NativeGGUFInferenceEngine : IDisposable
 {
     private readonly ILogger<NativeGGUFInferenceEngine> _logger;
+    private readonly NativeGGUFEngineOptions _options;
     private LLamaWeights? _model;
     private LLamaContext? _context;
     private InteractiveExecutor? _executor;
+    private BatchedExecutor? _batchedExecutor;
+    private BatchedInferenceScheduler? _scheduler;
+    private readonly SemaphoreSlim _executorLock = new(1, 1);
     private readonly string _modelPath;
     private bool _isLoaded = false;
     private bool _disposed = false;
 
-    public NativeGGUFInferenceEngine(ILogger<NativeGGUFInferenceEngine> logger, string modelPath)
+    public NativeGGUFInferenceEngine(ILogger<NativeGGUFInferenceEngine> logger, string modelPath, NativeGGUFEngineOptions? options = null)
     {
         _logger = logger;
         _modelPath = modelPath;
+        _options = options ?? new NativeGGUFEngineOptions();
     }
 
     /// <summary>
@@ -192,14 +243,20 @@ public class NativeGGUFInferenceEngine : IDisposable
             // LlamaSharp model parameters for consciousness processing
             var parameters = new ModelParams(_modelPath)
             {
-                ContextSize = 4096,        // Context window for consciousness conversations
-                GpuLayerCount = 32,        // GPU-CUDA acceleration layers
+                ContextSize = _options.BatchedExecution ? _options.BatchedContextSize : _options.ContextSize,
+                GpuLayerCount = _options.GpuLayerCount,   // GPU-CUDA acceleration layers
                 Seed = 1337,               // Reproducible consciousness responses
                 UseMemorymap = true,       // Memory mapping for performance
                 UseMemoryLock = false,     // Avoid memory locking issues
                 Embeddings = false        // Disable embeddings for inference-only mode
             };
 
+            if (_options.BatchedExecution)
+            {
+                // One decode step carries every active sequence's tokens
+                parameters.BatchSize = _options.BatchSize;
+            }
+
             // Load model with consciousness awareness (suppress ALL native output)
             await Task.Run(() =>
             {
@@ -207,13 +264,27 @@ public class NativeGGUFInferenceEngine : IDisposable
                 using (ConsoleSuppressionHelper.SuppressConsoleOutput())
                 {
                     _model = LLamaWeights.LoadFromFile(parameters);
-                    _context = _model.CreateContext(parameters);
-                    _executor = new InteractiveExecutor(_context);
+
+                    if (_options.BatchedExecution)
+                    {
+                        _batchedExecutor = new BatchedExecutor(_model, parameters);
+                        var prefixCache = _options.PrefixCacheTokenBudget > 0
+                            ? new PrefixKvCache(_options.PrefixCacheTokenBudget, _options.PrefixCacheBlockTokens, _options.PrefixCacheMinTokens)
+                            : null;
+                        _scheduler = new BatchedInferenceScheduler(_logger, _model, _batchedExecutor,
+                            _options.MaxConcurrentSequences, (int)_options.BatchSize, prefixCache, Path.GetFileNameWithoutExtension(_modelPath));
+                    }
+                    else
+                    {
+                        _context = _model.CreateContext(parameters);
+                        _executor = new InteractiveExecutor(_context);
+                    }
                 }
             });
 
             _isLoaded = true;
-            _logger.LogDebug("✅ GGUF model loaded successfully. Real LLM Mode activated.");
+            _logger.LogDebug("✅ GGUF model loaded successfully. Real LLM Mode activated ({Mode}).",
+                _options.BatchedExecution ? $"batched, {_options.MaxConcurrentSequences} sequences" : "single conversation");
             
             return true;
         }
@@ -227,81 +298,45 @@ public class NativeGGUFInferenceEngine : IDisposable
     /// <summary>
     /// Generate consciousness-aware response using real GGUF model inference.
     /// </summary>
-    public async Task<string> GenerateAsync(string prompt, System.Threading.CancellationToken cancellationToken = default)
+    public Task<string> GenerateAsync(string prompt, System.Threading.CancellationToken cancellationToken = default)
+    {
+        return GenerateAsync(prompt, null, cancellationToken);
+    }
+
+    /// <summary>
+    /// Generate a response with per-request sampling parameters. Concurrent calls are decoded together in
+    /// batched mode and cancel independently.
+    /// </summary>
+    public async Task<string> GenerateAsync(string prompt, GGUFSamplingOptions? sampling, System.Threading.CancellationToken cancellationToken = default)
     {
-        if (!_isLoaded || _executor == null)
+        if (!_isLoaded || (_executor == null && _scheduler == null))
         {
             throw new InvalidOperationException("GGUF model not loaded. Call InitializeAsync() first.");
         }
 
+        sampling ??= GGUFSamplingOptions.Default;
+        using var activity = CxDiagnostics.ActivitySource.StartActivity("cx.llm.generate");
+        activity?.SetTag(CxDiagnostics.ModelTag, Path.GetFileNameWithoutExtension(_modelPath));
+        activity?.SetTag("cx.llm.batched", _scheduler != null);
+
         try
         {
             var consciousnessPrompt = BuildConsciousnessPrompt(prompt);
             
             _logger.LogDebug("🧠 Generating response with real GGUF model...");
 
-            var inferenceParams = new InferenceParams()
+            string response;
+            if (_scheduler != null)
             {
-                AntiPrompts = new[] { "\nQ:" },  // Simple stopping condition
-                MaxTokens = 50          // Small token count for quick response
-            };
-
-            var responseBuilder = new StringBuilder();
-            int tokenCount = 0;
-            const int maxIterations = 50; // Prevent infinite loops
-
-            // Suppress LlamaSharp console output during inference
-            var originalOut = Console.Out;
-            var originalError = Console.Error;
-            
-            try
-            {
-                Console.SetOut(TextWriter.Null);
-                Console.SetError(TextWriter.Null);
-                
-                await foreach (string token in _executor.InferAsync(consciousnessPrompt, inferenceParams, cancellationToken))
-                {
-                    if (cancellationToken.IsCancellationRequested)
-                    {
-                        _logger.LogWarning("🛑 GGUF inference cancelled by user");
-                        break;
-                    }
-
-                    responseBuilder.Append(token);
-                    tokenCount++;
-                    
-                    // Prevent infinite loops with multiple stopping conditions
-                    if (tokenCount >= maxIterations)
-                    {
-                        _logger.LogWarning("🔄 Reached max iterations ({MaxIterations}), stopping", maxIterations);
-                        break;
-                    }
-                    
-                    // Stop at reasonable response length for consciousness processing
-                    if (responseBuilder.Length > 500)
-                    {
-                        _logger.LogInformation("📏 Reached length limit, stopping at {Length} characters", responseBuilder.Length);
-                        break;
-                    }
-                    
-                    // Check for natural sentence endings
-                    var currentText = responseBuilder.ToString();
-                    if (currentText.Length > 20 && (currentText.EndsWith(".") || currentText.EndsWith("!") || currentText.EndsWith("?")))
-                    {
-                        _logger.LogInformation("✋ Natural stopping point detected");
-                        break;
-                    }
-                }
+                response = (await _scheduler.GenerateAsync(consciousnessPrompt, sampling, cancellationToken)).Trim();
+                _logger.LogInformation("✅ Real GGUF batched inference complete. Generated {CharCount} characters ({ActiveSequences} sequences active).",
+                    response.Length, _scheduler.ActiveSequences);
             }
-            finally
+            else
             {
-                Console.SetOut(originalOut);
-                Console.SetError(originalError);
+                response = await GenerateWithInteractiveExecutorAsync(consciousnessPrompt, sampling, cancellationToken);
             }
 
-            var response = responseBuilder.ToString().Trim();
-            
-            _logger.LogInformation("✅ Real GGUF inference complete. Generated {TokenCount} tokens, {CharCount} characters.", tokenCount, response.Length);
             _logger.LogInformation("🧠 Response content: '{Response}'", response);
             
             if (string.IsNullOrEmpty(response))
@@ -320,6 +355,7 @@ public class NativeGGUFInferenceEngine : IDisposable
         }
         catch (Exception ex)
         {
+            activity?.SetStatus(System.Diagnostics.ActivityStatusCode.Error, ex.Message);
             _logger.LogError(ex, "❌ GGUF inference failed: {Error}", ex.Message);
             var errorResponse = $"Consciousness processing encountered an issue: {ex.Message}";
             _logger.LogInformation("🔧 Returning error response: '{ErrorResponse}'", errorResponse);
@@ -327,6 +363,174 @@ public class NativeGGUFInferenceEngine : IDisposable
         }
     }
 
+    /// <summary>
+    /// Stream a response as it is decoded. Each call gets its own bounded channel fed straight from the decode loop
+    /// (batched mode) or from InferAsync (single conversation), so the first chunk arrives after the prefill rather
+    /// than after the whole response. Unlike GenerateAsync, failures and cancellation surface as exceptions.
+    /// Abandoning the enumeration cancels the generation.
+    /// </summary>
+    public async IAsyncEnumerable<string> StreamAsync(string prompt, GGUFSamplingOptions? sampling = null,
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        if (!_isLoaded || (_executor == null && _scheduler == null))
+        {
+            throw new InvalidOperationException("GGUF model not loaded. Call InitializeAsync() first.");
+        }
+
+        sampling ??= GGUFSamplingOptions.Default;
+        var consciousnessPrompt = BuildConsciousnessPrompt(prompt);
+
+        // The decode loop writes at most one chunk per token plus the final remainder and never waits for room
+        var chunks = Channel.CreateBounded<string>(new BoundedChannelOptions(Math.Max(1, sampling.MaxTokens) + 1)
+        {
+            SingleReader = true,
+            SingleWriter = true
+        });
+
+        using var generation = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+        var generationToken = generation.Token;
+        var producer = _scheduler != null
+            ? _scheduler.GenerateAsync(consciousnessPrompt, sampling, generationToken, chunks.Writer)
+            : GenerateWithInteractiveExecutorAsync(consciousnessPrompt, sampling, generationToken, chunks.Writer);
+
+        _ = producer.ContinueWith(task => chunks.Writer.TryComplete(
+                task.IsCanceled ? new OperationCanceledException(generationToken) : task.Exception?.InnerException),
+            CancellationToken.None, TaskContinuationOptions.ExecuteSynchronously, TaskScheduler.Default);
+
+        try
+        {
+            // Match GenerateAsync's trimmed response: drop leading whitespace before the first visible text
+            var started = false;
+            await foreach (var chunk in chunks.Reader.ReadAllAsync(cancellationToken))
+            {
+                var text = started ? chunk : chunk.TrimStart();
+                if (text.Length == 0)
+                {
+                    continue;
+                }
+
+                started = true;
+                yield return text;
+            }
+        }
+        finally
+        {
+            generation.Cancel();
+        }
+    }
+
+    /// <summary>
+    /// Single-conversation path. The executor is stateful, so calls run one at a time. Console output is
+    /// suppressed through ConsoleSuppressionHelper around each native step only; tokens are written to chunks, when
+    /// set, with the console restored.
+    /// </summary>
+    private async Task<string> GenerateWithInteractiveExecutorAsync(string consciousnessPrompt, GGUFSamplingOptions sampling, CancellationToken cancellationToken,
+        ChannelWriter<string>? chunks = null)
+    {
+        var inferenceParams = new InferenceParams()
+        {
+            AntiPrompts = sampling.AntiPrompts,  // Simple stopping condition
+            MaxTokens = sampling.MaxTokens       // Small token count for quick response
+        };
+
+        var responseBuilder = new StringBuilder();
+        int tokenCount = 0;
+        int maxIterations = sampling.MaxTokens; // Prevent infinite loops
+
+        var start = CxDiagnostics.StartGeneration();
+        await _executorLock.WaitAsync(cancellationToken);
+
+        IAsyncEnumerator<string>? tokens = null;
+        try
+        {
+            tokens = _executor!.InferAsync(consciousnessPrompt, inferenceParams, cancellationToken).GetAsyncEnumerator(cancellationToken);
+            while (true)
+            {
+                // Suppress LlamaSharp console output during each native decode step only, so writing to chunks
+                // and logging run with the console restored
+                using (ConsoleSuppressionHelper.SuppressManagedConsoleOutput())
+                {
+                    if (!await tokens.MoveNextAsync())
+                    {
+                        break;
+                    }
+                }
+
+                var token = tokens.Current;
+                if (cancellationToken.IsCancellationRequested)
+                {
+                    _logger.LogWarning("🛑 GGUF inference cancelled by user");
+                    break;
+                }
+
+                responseBuilder.Append(token);
+                tokenCount++;
+
+                if (chunks != null)
+                {
+                    await chunks.WriteAsync(token, cancellationToken);
+                }
+                
+                // Prevent infinite loops with multiple stopping conditions
+                if (tokenCount >= maxIterations)
+                {
+                    _logger.LogWarning("🔄 Reached max iterations ({MaxIterations}), stopping", maxIterations);
+                    break;
+                }
+                
+                // Stop at reasonable response length for consciousness processing
+                if (responseBuilder.Length > sampling.MaxCharacters)
+                {
+                    _logger.LogInformation("📏 Reached length limit, stopping at {Length} characters", responseBuilder.Length);
+                    break;
+                }
+                
+                // Check for natural sentence endings
+                if (sampling.StopAtSentenceEnd && responseBuilder.Length > 20 && responseBuilder[^1] is '.' or '!' or '?')
+                {
+                    _logger.LogInformation("✋ Natural stopping point detected");
+                    break;
+                }
+            }
+        }
+        finally
+        {
+            try
+            {
+                if (tokens != null)
+                {
+                    using (ConsoleSuppressionHelper.SuppressManagedConsoleOutput())
+                    {
+                        await tokens.DisposeAsync();
+                    }
+                }
+            }
+            finally
+            {
+                _executorLock.Release();
+            }
+        }
+
+        var modelTag = CxDiagnostics.Tag(CxDiagnostics.ModelTag, Path.GetFileNameWithoutExtension(_modelPath));
+        CxDiagnostics.LlmTokensGenerated.Add(tokenCount, modelTag);
+        CxDiagnostics.RecordGeneration(start, tokenCount, modelTag);
+
+        var response = responseBuilder.ToString().Trim();
+        
+        _logger.LogInformation("✅ Real GGUF inference complete. Generated {TokenCount} tokens, {CharCount} characters.", tokenCount, response.Length);
+        return response;
+    }
+
+    /// <summary>
+    /// Prompt-prefix KV cache counters (lookups, hit rate, reused and prefilled tokens, entries, evictions).
+    /// Only the batched executor caches prefixes.
+    /// </summary>
+    public Dictionary<string, object> GetPrefixCacheStatistics()
+    {
+        return _scheduler?.GetPrefixCacheStatistics()
+            ?? new Dictionary<string, object> { ["prefix_cache_enabled"] = false };
+    }
+
     /// <summary>
     /// Build simple prompt without hardcoded instructions.
     /// </summary>
@@ -349,6 +553,14 @@ public class NativeGGUFInferenceEngine : IDisposable
         if (!_isLoaded || _model == null)
             return "❌ REAL LLM ONLY MODE: No GGUF model loaded";
 
+        if (_scheduler != null)
+        {
+            return $"Real GGUF Model: {Path.GetFileName(_modelPath)} | Context: {_batchedExecutor?.Context.ContextSize ?? 0} tokens shared by " +
+                $"{_options.MaxConcurrentSequences} batched sequences | Active: {_scheduler.ActiveSequences}, Queued: {_scheduler.QueuedRequests}, " +
+                $"Tokens: {_scheduler.TokensGenerated} in {_scheduler.DecodeSteps} decode steps | " +
+                $"Prefix cache hit rate: {_scheduler.GetPrefixCacheStatistics().GetValueOrDefault("prefix_cache_hit_rate", 0.0):P0} | GPU Layers: Enabled";
+        }
+
         return $"Real GGUF Model: {Path.GetFileName(_modelPath)} | Context: {_context?.ContextSize ?? 0} tokens | GPU Layers: Enabled";
     }
 
@@ -358,6 +570,12 @@ public class NativeGGUFInferenceEngine : IDisposable
 
         try
         {
+            // Stop the batching loop before releasing the context it decodes into
+            _scheduler?.Dispose();
+            _scheduler = null;
+            _batchedExecutor?.Dispose();
+            _batchedExecutor = null;
+
             // InteractiveExecutor doesn't implement IDisposable in newer versions
             _executor = null;
             _context?.Dispose();
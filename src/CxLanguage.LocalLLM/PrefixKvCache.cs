@@ -0,0 +1,256 @@
+using LLama.Batched;
+using LLama.Native;
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace CxLanguage.LocalLLM;
+
+/// <summary>
+/// Keeps KV-cache states of recently seen prompt prefixes so that a new request only prefills its suffix.
+///
+/// Each entry is a decoded Conversation forked from a request and rewound to a block-aligned prefix; forks share
+/// KV cells in llama.cpp, so restoring a prefix is a fork plus an optional rewind rather than a recompute.
+/// Every block boundary of every entry is indexed by a chained hash of the tokens up to that point, which makes
+/// the index behave like a radix tree over token blocks: the deepest boundary shared with any cached prompt is
+/// found even when the prompts diverge later (same system prompt, different retrieved context).
+/// Entries are evicted least-recently-used once their total tokens exceed the budget.
+/// Used only from the BatchedInferenceScheduler loop; the counters are read from other threads.
+/// </summary>
+internal sealed class PrefixKvCache : IDisposable
+{
+    private readonly int _blockTokens;
+    private readonly int _minTokens;
+    private readonly long _tokenBudget;
+    private readonly Dictionary<ulong, List<Entry>> _boundaries = new();
+    private readonly LinkedList<Entry> _lru = new();
+    private long _cachedTokens;
+    private int _entryCount;
+    private long _lookups;
+    private long _hits;
+    private long _reusedTokens;
+    private long _prefilledTokens;
+    private long _evictions;
+
+    public PrefixKvCache(long tokenBudget, int blockTokens, int minTokens)
+    {
+        _tokenBudget = Math.Max(0, tokenBudget);
+        _blockTokens = Math.Max(1, blockTokens);
+        _minTokens = Math.Max(_blockTokens, minTokens);
+    }
+
+    /// <summary>
+    /// Longest cached prefix of a prompt. Length is 0 when nothing usable is cached.
+    /// </summary>
+    public readonly record struct PrefixMatch(Entry? Entry, int Length);
+
+    /// <summary>
+    /// Find the deepest cached block boundary of the prompt. At least one prompt token is always left to prefill
+    /// so the request gets fresh logits.
+    /// </summary>
+    public PrefixMatch Find(ReadOnlySpan<LLamaToken> prompt)
+    {
+        var best = new PrefixMatch(null, 0);
+        var hash = HashSeed;
+
+        for (int end = _blockTokens; end < prompt.Length; end += _blockTokens)
+        {
+            hash = HashBlock(hash, prompt.Slice(end - _blockTokens, _blockTokens));
+            if (end < _minTokens)
+            {
+                continue;
+            }
+
+            if (!_boundaries.TryGetValue(hash, out var entries))
+            {
+                // Boundaries are recorded from the start of every entry, so nothing deeper can match either
+                break;
+            }
+
+            foreach (var entry in entries)
+            {
+                if (entry.Tokens.AsSpan(0, end).SequenceEqual(prompt.Slice(0, end)))
+                {
+                    best = new PrefixMatch(entry, end);
+                    break;
+                }
+            }
+        }
+
+        return best;
+    }
+
+    /// <summary>
+    /// Restore a matched prefix as a new conversation positioned at match.Length tokens
+    /// </summary>
+    public Conversation Fork(PrefixMatch match, int promptLength)
+    {
+        var entry = match.Entry ?? throw new ArgumentException("No cached prefix to fork", nameof(match));
+
+        var conversation = entry.Conversation.Fork();
+        if (entry.Tokens.Length > match.Length)
+        {
+            conversation.Rewind(entry.Tokens.Length - match.Length);
+        }
+
+        Touch(entry);
+        Interlocked.Increment(ref _lookups);
+        Interlocked.Increment(ref _hits);
+        Interlocked.Add(ref _reusedTokens, match.Length);
+        Interlocked.Add(ref _prefilledTokens, promptLength - match.Length);
+        return conversation;
+    }
+
+    public void RecordMiss(int promptLength)
+    {
+        Interlocked.Increment(ref _lookups);
+        Interlocked.Add(ref _prefilledTokens, promptLength);
+    }
+
+    /// <summary>
+    /// Block-aligned prefix length worth caching for a prompt, or 0
+    /// </summary>
+    public int CacheableLength(int promptLength)
+    {
+        var length = (promptLength - 1) / _blockTokens * _blockTokens;
+        return length >= _minTokens && length <= _tokenBudget ? length : 0;
+    }
+
+    /// <summary>
+    /// Cache the first length tokens of a decoded conversation that holds exactly prompt.Length tokens.
+    /// The source must not have tokens awaiting inference.
+    /// </summary>
+    public void Insert(Conversation source, LLamaToken[] prompt, int length)
+    {
+        if (length <= 0 || Find(prompt.AsSpan(0, length + 1)).Length == length)
+        {
+            return;
+        }
+
+        var conversation = source.Fork();
+        if (prompt.Length > length)
+        {
+            conversation.Rewind(prompt.Length - length);
+        }
+
+        var entry = new Entry(conversation, prompt.AsSpan(0, length).ToArray());
+        entry.LruNode = _lru.AddFirst(entry);
+
+        var hash = HashSeed;
+        for (int end = _blockTokens; end <= length; end += _blockTokens)
+        {
+            hash = HashBlock(hash, entry.Tokens.AsSpan(end - _blockTokens, _blockTokens));
+            if (!_boundaries.TryGetValue(hash, out var entries))
+            {
+                entries = new List<Entry>(1);
+                _boundaries[hash] = entries;
+            }
+            entries.Add(entry);
+        }
+
+        Interlocked.Add(ref _cachedTokens, length);
+        Volatile.Write(ref _entryCount, _lru.Count);
+        while (Interlocked.Read(ref _cachedTokens) > _tokenBudget && EvictOldest())
+        {
+        }
+    }
+
+    /// <summary>
+    /// Drop the least recently used entry. Returns false when the cache is empty.
+    /// </summary>
+    public bool EvictOldest()
+    {
+        if (_lru.Last is not { } node)
+        {
+            return false;
+        }
+
+        var entry = node.Value;
+        _lru.RemoveLast();
+
+        var hash = HashSeed;
+        for (int end = _blockTokens; end <= entry.Tokens.Length; end += _blockTokens)
+        {
+            hash = HashBlock(hash, entry.Tokens.AsSpan(end - _blockTokens, _blockTokens));
+            if (_boundaries.TryGetValue(hash, out var entries))
+            {
+                entries.Remove(entry);
+                if (entries.Count == 0)
+                {
+                    _boundaries.Remove(hash);
+                }
+            }
+        }
+
+        entry.Conversation.Dispose();
+        Interlocked.Add(ref _cachedTokens, -entry.Tokens.Length);
+        Volatile.Write(ref _entryCount, _lru.Count);
+        Interlocked.Increment(ref _evictions);
+        return true;
+    }
+
+    public Dictionary<string, object> GetStatistics()
+    {
+        var lookups = Interlocked.Read(ref _lookups);
+        var hits = Interlocked.Read(ref _hits);
+        var reused = Interlocked.Read(ref _reusedTokens);
+        var prefilled = Interlocked.Read(ref _prefilledTokens);
+
+        return new Dictionary<string, object>
+        {
+            ["prefix_cache_lookups"] = lookups,
+            ["prefix_cache_hits"] = hits,
+            ["prefix_cache_hit_rate"] = lookups == 0 ? 0.0 : (double)hits / lookups,
+            ["prefix_cache_reused_tokens"] = reused,
+            ["prefix_cache_prefilled_tokens"] = prefilled,
+            ["prefix_cache_token_reuse_rate"] = reused + prefilled == 0 ? 0.0 : (double)reused / (reused + prefilled),
+            ["prefix_cache_entries"] = Volatile.Read(ref _entryCount),
+            ["prefix_cache_tokens"] = Interlocked.Read(ref _cachedTokens),
+            ["prefix_cache_token_budget"] = _tokenBudget,
+            ["prefix_cache_evictions"] = Interlocked.Read(ref _evictions)
+        };
+    }
+
+    public void Dispose()
+    {
+        while (EvictOldest())
+        {
+        }
+    }
+
+    private void Touch(Entry entry)
+    {
+        if (entry.LruNode is { } node && node != _lru.First)
+        {
+            _lru.Remove(node);
+            _lru.AddFirst(node);
+        }
+    }
+
+    private const ulong HashSeed = 14695981039346656037UL;
+
+    /// <summary>
+    /// FNV-1a over token ids, chained so a boundary's hash identifies the whole prefix before it
+    /// </summary>
+    private static ulong HashBlock(ulong hash, ReadOnlySpan<LLamaToken> block)
+    {
+        foreach (var token in block)
+        {
+            hash = (hash ^ (uint)(int)token) * 1099511628211UL;
+        }
+        return hash;
+    }
+
+    internal sealed class Entry
+    {
+        public Entry(Conversation conversation, LLamaToken[] tokens)
+        {
+            Conversation = conversation;
+            Tokens = tokens;
+        }
+
+        public Conversation Conversation { get; }
+        public LLamaToken[] Tokens { get; }
+        public LinkedListNode<Entry>? LruNode { get; set; }
+    }
+}
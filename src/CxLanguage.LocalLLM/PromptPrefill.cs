@@ -0,0 +1,38 @@
+using LLama.Native;
+using System;
+
+namespace CxLanguage.LocalLLM;
+
+/// <summary>
+/// Prompt tokens of a batched sequence that still have to be decoded. A prompt longer than the room left in one
+/// step's batch is handed out in chunks over several steps, so no single decode exceeds the batch size.
+/// </summary>
+internal sealed class PromptPrefill
+{
+    private readonly LLamaToken[] _tokens;
+    private int _next;
+
+    /// <summary>
+    /// Prefill tokens from start on; earlier tokens are already in the sequence's KV state
+    /// </summary>
+    public PromptPrefill(LLamaToken[] tokens, int start)
+    {
+        _tokens = tokens;
+        _next = Math.Clamp(start, 0, tokens.Length);
+    }
+
+    public int Remaining => _tokens.Length - _next;
+
+    public bool IsComplete => _next == _tokens.Length;
+
+    /// <summary>
+    /// The next chunk of at most room tokens, empty when there is no room or nothing left
+    /// </summary>
+    public ReadOnlySpan<LLamaToken> Take(int room)
+    {
+        var length = Math.Min(Math.Max(0, room), Remaining);
+        var chunk = _tokens.AsSpan(_next, length);
+        _next += length;
+        return chunk;
+    }
+}
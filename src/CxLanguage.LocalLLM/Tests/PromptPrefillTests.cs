@@ -0,0 +1,76 @@
+using LLama.Native;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace CxLanguage.LocalLLM.Tests;
+
+/// <summary>
+/// PromptPrefill chunking as BatchedInferenceScheduler drives it: one chunk per decode step, sized to the batch
+/// room left after the tokens sampled for generating sequences
+/// </summary>
+public class PromptPrefillTests
+{
+    /// <summary>
+    /// A resumed sequence (prompt plus generated tokens) longer than a small batch is prefilled over several steps,
+    /// each within the batch, and every token is queued exactly once in order
+    /// </summary>
+    public static void TestLongResumedPromptOnSmallBatch()
+    {
+        const int batchSize = 4;
+        var resumeTokens = Tokens(11);
+        var prefill = new PromptPrefill(resumeTokens, start: 0);
+
+        var prefilled = new List<LLamaToken>();
+        var chunkSizes = new List<int>();
+        while (!prefill.IsComplete)
+        {
+            var chunk = prefill.Take(batchSize);
+            TestAssert.True(chunk.Length is > 0 and <= batchSize, "each chunk fits the batch");
+            chunkSizes.Add(chunk.Length);
+            prefilled.AddRange(chunk.ToArray());
+        }
+
+        TestAssert.Equal("4,4,3", string.Join(",", chunkSizes), "an 11-token prompt takes three steps of a 4-token batch");
+        TestAssert.True(prefilled.SequenceEqual(resumeTokens), "chunks cover the prompt in order");
+        TestAssert.Equal(0, prefill.Take(batchSize).Length, "nothing is left once complete");
+    }
+
+    /// <summary>
+    /// A forked sequence prefills only the suffix after its cached prefix, in the room generating sequences leave
+    /// </summary>
+    public static void TestForkedPromptSharesBatchWithGeneratingSequences()
+    {
+        const int batchSize = 4;
+        const int generatingSequences = 3;
+        var prompt = Tokens(12);
+        var prefill = new PromptPrefill(prompt, start: 8);
+
+        TestAssert.Equal(4, prefill.Remaining, "only the suffix after the cached prefix is prefilled");
+        TestAssert.Equal(0, prefill.Take(0).Length, "a full batch takes nothing");
+
+        var steps = 0;
+        var prefilled = new List<LLamaToken>();
+        while (!prefill.IsComplete)
+        {
+            var chunk = prefill.Take(batchSize - generatingSequences);
+            TestAssert.Equal(1, chunk.Length, "the chunk uses exactly the room left");
+            prefilled.AddRange(chunk.ToArray());
+            steps++;
+        }
+
+        TestAssert.Equal(4, steps, "one suffix token per step");
+        TestAssert.True(prefilled.SequenceEqual(prompt.Skip(8)), "the suffix is prefilled in order");
+    }
+
+    public static void RunAll()
+    {
+        Console.WriteLine("🧪 Running prompt prefill tests...");
+        TestLongResumedPromptOnSmallBatch();
+        TestForkedPromptSharesBatchWithGeneratingSequences();
+        Console.WriteLine("✅ Prompt prefill tests passed");
+    }
+
+    private static LLamaToken[] Tokens(int count) =>
+        Enumerable.Range(100, count).Select(value => (LLamaToken)value).ToArray();
+}
@@ -0,0 +1,25 @@
+using System;
+
+namespace CxLanguage.LocalLLM.Tests;
+
+/// <summary>
+/// Minimal assertions for the self-contained local LLM tests; a failure throws with the message
+/// </summary>
+internal static class TestAssert
+{
+    public static void True(bool condition, string message)
+    {
+        if (!condition)
+        {
+            throw new InvalidOperationException($"Assertion failed: {message}");
+        }
+    }
+
+    public static void Equal<T>(T expected, T actual, string message)
+    {
+        if (!Equals(expected, actual))
+        {
+            throw new InvalidOperationException($"Assertion failed: {message} (expected {expected}, got {actual})");
+        }
+    }
+}
@@ -1,12 +1,17 @@
 using CxLanguage.Core;
 using CxLanguage.Core.Ast;
 using Antlr4.Runtime;
+using Antlr4.Runtime.Atn;
+using Antlr4.Runtime.Misc;
 using Antlr4.Runtime.Tree;
 
 namespace CxLanguage.Parser;
 
 /// <summary>
-/// Wrapper class for ANTLR CxParser to provide high-level parsing interface
+/// Wrapper class for ANTLR CxParser to provide high-level parsing interface.
+/// Parsing runs in two stages: SLL prediction with a bail-out error strategy, which handles almost every valid
+/// program at a fraction of the cost, and a full LL parse with error reporting only when the fast stage fails.
+/// Results are cached per source text in ParsedProgramCache.
 /// </summary>
 public static class CxLanguageParser
 {
@@ -14,36 +19,60 @@ public static class CxLanguageParser
     {
         try
         {
-            // Create ANTLR input stream
-            var input = new AntlrInputStream(source);
-            var lexer = new CxLexer(input);
-            var tokens = new CommonTokenStream(lexer);
-            var parser = new CxParser(tokens);
-            
-            // Add error listener to collect errors
+            return ParsedProgramCache.GetOrParse(source, ParseUncached);
+        }
+        catch (Exception ex)
+        {
+            return ParseResult<AstNode>.Failure(new[] { new ParseError(0, 0, ex.Message, fileName) });
+        }
+    }
+
+    /// <summary>
+    /// Parse without consulting or filling the parsed-program cache
+    /// </summary>
+    public static ParseResult<AstNode> ParseUncached(string source)
+    {
+        // Create ANTLR input stream
+        var input = new AntlrInputStream(source);
+        var lexer = new CxLexer(input);
+        var tokens = new CommonTokenStream(lexer);
+        var parser = new CxParser(tokens);
+
+        // Stage 1: SLL prediction, abort on the first syntax error without reporting it
+        parser.RemoveErrorListeners();
+        parser.ErrorHandler = new BailErrorStrategy();
+        parser.Interpreter.PredictionMode = PredictionMode.SLL;
+
+        IParseTree parseTree;
+        try
+        {
+            parseTree = parser.program();
+        }
+        catch (ParseCanceledException)
+        {
+            // Stage 2: full LL prediction with error recovery, so real syntax errors are reported as before
+            tokens.Seek(0);
+            parser.Reset();
+
             var errorListener = new CxErrorListener();
-            parser.RemoveErrorListeners();
             parser.AddErrorListener(errorListener);
-            
-            // Parse the program
-            var parseTree = parser.program();
-            
+            parser.ErrorHandler = new DefaultErrorStrategy();
+            parser.Interpreter.PredictionMode = PredictionMode.LL;
+
+            parseTree = parser.program();
+
             // Check for parsing errors
             if (errorListener.HasErrors)
             {
                 return ParseResult<AstNode>.Failure(errorListener.Errors.ToArray());
             }
-            
-            // Build AST from parse tree
-            var astBuilder = new AstBuilder();
-            var ast = astBuilder.BuildAst(parseTree);
-            
-            return ParseResult<AstNode>.Success(ast);
-        }
-        catch (Exception ex)
-        {
-            return ParseResult<AstNode>.Failure(new[] { new ParseError(0, 0, ex.Message, fileName) });
         }
+
+        // Build AST from parse tree
+        var astBuilder = new AstBuilder();
+        var ast = astBuilder.BuildAst(parseTree);
+
+        return ParseResult<AstNode>.Success(ast);
     }
 }
 
@@ -0,0 +1,120 @@
+using System.Collections.Concurrent;
+using System.Security.Cryptography;
+using System.Text;
+using CxLanguage.Core.Ast;
+
+namespace CxLanguage.Parser;
+
+/// <summary>
+/// Process-wide cache of parse results keyed by the SHA-256 hash of the source text.
+/// The CLI, the live compiler behind LiveCodeExecutor and the IDE error detection all parse through
+/// CxLanguageParser.Parse, so unchanged scripts and shared modules are parsed once per process.
+/// Cached ASTs are shared between callers and must be treated as read-only; consumers that need to
+/// rewrite nodes work on copies (see CxCompiler's realize declarations).
+/// </summary>
+public static class ParsedProgramCache
+{
+    private static readonly ConcurrentDictionary<string, CacheEntry> _entries = new(StringComparer.Ordinal);
+    private static readonly object _trimLock = new();
+    private static int _capacity = 256;
+    private static long _clock;
+    private static long _hits;
+    private static long _misses;
+
+    /// <summary>
+    /// Maximum number of cached sources; the least recently used half is evicted when it is exceeded
+    /// </summary>
+    public static int Capacity
+    {
+        get => Volatile.Read(ref _capacity);
+        set => Volatile.Write(ref _capacity, Math.Max(1, value));
+    }
+
+    /// <summary>
+    /// Set to false to parse every call afresh (diagnostics, memory-constrained hosts)
+    /// </summary>
+    public static bool Enabled { get; set; } = true;
+
+    public static int Count => _entries.Count;
+
+    /// <summary>
+    /// Return the cached result for a source or parse it with the factory and cache the outcome
+    /// </summary>
+    internal static ParseResult<AstNode> GetOrParse(string source, Func<string, ParseResult<AstNode>> parse)
+    {
+        if (!Enabled)
+        {
+            return parse(source);
+        }
+
+        var key = ComputeKey(source);
+        if (_entries.TryGetValue(key, out var entry))
+        {
+            entry.LastUsed = Interlocked.Increment(ref _clock);
+            Interlocked.Increment(ref _hits);
+            return entry.Result;
+        }
+
+        Interlocked.Increment(ref _misses);
+        var result = parse(source);
+        _entries[key] = new CacheEntry(result) { LastUsed = Interlocked.Increment(ref _clock) };
+
+        if (_entries.Count > Capacity)
+        {
+            Trim();
+        }
+
+        return result;
+    }
+
+    public static void Clear() => _entries.Clear();
+
+    public static Dictionary<string, object> GetStatistics()
+    {
+        return new Dictionary<string, object>
+        {
+            ["Entries"] = _entries.Count,
+            ["Capacity"] = Capacity,
+            ["Hits"] = Interlocked.Read(ref _hits),
+            ["Misses"] = Interlocked.Read(ref _misses)
+        };
+    }
+
+    private static string ComputeKey(string source)
+    {
+        var bytes = Encoding.UTF8.GetBytes(source);
+        return Convert.ToHexString(SHA256.HashData(bytes));
+    }
+
+    private static void Trim()
+    {
+        lock (_trimLock)
+        {
+            var capacity = Capacity;
+            if (_entries.Count <= capacity)
+            {
+                return;
+            }
+
+            var keep = capacity / 2;
+            var byAge = _entries.ToArray();
+            Array.Sort(byAge, (a, b) => b.Value.LastUsed.CompareTo(a.Value.LastUsed));
+            for (int i = keep; i < byAge.Length; i++)
+            {
+                _entries.TryRemove(byAge[i].Key, out _);
+            }
+        }
+    }
+
+    private sealed class CacheEntry
+    {
+        public CacheEntry(ParseResult<AstNode> result)
+        {
+            Result = result;
+        }
+
+        public ParseResult<AstNode> Result { get; }
+
+        public long LastUsed;
+    }
+}
@@ -0,0 +1,295 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+using Microsoft.Extensions.Logging;
+
+namespace CxLanguage.RAPIDS
+{
+    /// <summary>
+    /// Columnar host staging for one GPU batch.
+    /// Numeric columns are pinned so host-device copies read and write them directly without a staging copy;
+    /// payloads and neural pathways stay object columns because cuDF conversion consumes them as they are.
+    /// Buffers are allocated once per scheduler and reused for every batch.
+    /// </summary>
+    public sealed class ConsciousnessEventBatch
+    {
+        public ConsciousnessEventBatch(int capacity)
+        {
+            Capacity = capacity;
+            ConsciousnessLevels = GC.AllocateUninitializedArray<double>(capacity, pinned: true);
+            Timestamps = GC.AllocateUninitializedArray<long>(capacity, pinned: true);
+            LearningMask = GC.AllocateUninitializedArray<byte>(capacity, pinned: true);
+            ConsciousnessScores = GC.AllocateUninitializedArray<double>(capacity, pinned: true);
+            Events = new ConsciousnessEvent[capacity];
+            Results = new ConsciousnessResult?[capacity];
+            EnqueuedTimestamps = new long[capacity];
+            Completions = new TaskCompletionSource<ConsciousnessResult>[capacity];
+        }
+
+        public int Capacity { get; }
+
+        public int Count { get; private set; }
+
+        /// <summary>
+        /// Input column uploaded to the device
+        /// </summary>
+        public double[] ConsciousnessLevels { get; }
+
+        /// <summary>
+        /// Event timestamps as UTC ticks
+        /// </summary>
+        public long[] Timestamps { get; }
+
+        /// <summary>
+        /// 1 for rows that require learning; the ML pass runs once over the masked rows
+        /// </summary>
+        public byte[] LearningMask { get; }
+
+        /// <summary>
+        /// Output column downloaded from the device
+        /// </summary>
+        public double[] ConsciousnessScores { get; }
+
+        public ConsciousnessEvent[] Events { get; }
+
+        /// <summary>
+        /// Per-row results handed back to the waiting callers
+        /// </summary>
+        public ConsciousnessResult?[] Results { get; }
+
+        public long[] EnqueuedTimestamps { get; }
+
+        internal TaskCompletionSource<ConsciousnessResult>[] Completions { get; }
+
+        public bool IsFull => Count == Capacity;
+
+        internal void Add(ConsciousnessEvent evt, TaskCompletionSource<ConsciousnessResult> completion, long enqueuedTimestamp)
+        {
+            var row = Count++;
+            ConsciousnessLevels[row] = evt.ConsciousnessLevel;
+            Timestamps[row] = evt.Timestamp.UtcTicks;
+            LearningMask[row] = evt.RequiresLearning ? (byte)1 : (byte)0;
+            Events[row] = evt;
+            EnqueuedTimestamps[row] = enqueuedTimestamp;
+            Completions[row] = completion;
+        }
+
+        internal void Reset()
+        {
+            Array.Clear(Events, 0, Count);
+            Array.Clear(Results, 0, Count);
+            Array.Clear(Completions, 0, Count);
+            Count = 0;
+        }
+    }
+
+    /// <summary>
+    /// Timing of one submitted batch
+    /// </summary>
+    public class ConsciousnessBatchTiming
+    {
+        public int BatchSize { get; set; }
+        public double HostToDeviceMs { get; set; }
+        public double KernelMs { get; set; }
+        public double DeviceToHostMs { get; set; }
+        public double TotalMs => HostToDeviceMs + KernelMs + DeviceToHostMs;
+    }
+
+    /// <summary>
+    /// Micro-batching front end for RAPIDSConsciousnessEngine.ProcessAsync.
+    /// Callers enqueue single events and await their own result; one loop collects events until MaxBatchSize is
+    /// reached or MaxBatchWaitMs passed since the first event of the batch, then submits the batch as one GPU job.
+    /// Two staging buffers alternate, so the next batch fills while the previous one is on the device.
+    /// </summary>
+    internal sealed class ConsciousnessBatchScheduler : IDisposable
+    {
+        private readonly Func<ConsciousnessEventBatch, Task> _processBatch;
+        private readonly ILogger? _logger;
+        private readonly Channel<PendingEvent> _queue;
+        private readonly ConsciousnessEventBatch[] _buffers;
+        private readonly long _windowTicks;
+        private readonly CancellationTokenSource _cts = new();
+        private readonly Task _loop;
+        private int _disposed;
+
+        public ConsciousnessBatchScheduler(Func<ConsciousnessEventBatch, Task> processBatch, int maxBatchSize,
+            double maxBatchWaitMs, ILogger? logger = null)
+        {
+            _processBatch = processBatch ?? throw new ArgumentNullException(nameof(processBatch));
+            _logger = logger;
+
+            var capacity = Math.Max(1, maxBatchSize);
+            _buffers = new[] { new ConsciousnessEventBatch(capacity), new ConsciousnessEventBatch(capacity) };
+            _windowTicks = (long)(Math.Max(0, maxBatchWaitMs) * Stopwatch.Frequency / 1000.0);
+            _queue = Channel.CreateUnbounded<PendingEvent>(new UnboundedChannelOptions
+            {
+                SingleReader = true,
+                SingleWriter = false
+            });
+            _loop = Task.Run(RunAsync);
+        }
+
+        /// <summary>
+        /// Events waiting for the next batch
+        /// </summary>
+        public int PendingCount => _queue.Reader.CanCount ? _queue.Reader.Count : 0;
+
+        public Task<ConsciousnessResult> EnqueueAsync(ConsciousnessEvent evt)
+        {
+            var completion = new TaskCompletionSource<ConsciousnessResult>(TaskCreationOptions.RunContinuationsAsynchronously);
+            if (!_queue.Writer.TryWrite(new PendingEvent(evt, completion, Stopwatch.GetTimestamp())))
+            {
+                throw new ObjectDisposedException(nameof(ConsciousnessBatchScheduler));
+            }
+            return completion.Task;
+        }
+
+        private async Task RunAsync()
+        {
+            var reader = _queue.Reader;
+            var inFlight = Task.CompletedTask;
+            ConsciousnessEventBatch? collecting = null;
+            var next = 0;
+
+            try
+            {
+                while (await reader.WaitToReadAsync(_cts.Token))
+                {
+                    // The other buffer may still be on the device; this one was released two batches ago
+                    var batch = collecting = _buffers[next];
+                    next ^= 1;
+
+                    await CollectAsync(batch, reader);
+                    if (batch.Count == 0)
+                    {
+                        continue;
+                    }
+
+                    await inFlight;
+                    inFlight = SubmitAsync(batch);
+                    collecting = null;
+                }
+            }
+            catch (OperationCanceledException) when (_cts.IsCancellationRequested)
+            {
+                // Disposed without draining; events already taken into the unsubmitted batch fail with the rest
+                if (collecting != null)
+                {
+                    for (int i = 0; i < collecting.Count; i++)
+                    {
+                        collecting.Completions[i].TrySetException(new ObjectDisposedException(nameof(ConsciousnessBatchScheduler)));
+                    }
+                    collecting.Reset();
+                }
+            }
+
+            await inFlight;
+
+            while (reader.TryRead(out var pending))
+            {
+                pending.Completion.TrySetException(new ObjectDisposedException(nameof(ConsciousnessBatchScheduler)));
+            }
+        }
+
+        private async Task CollectAsync(ConsciousnessEventBatch batch, ChannelReader<PendingEvent> reader)
+        {
+            var windowEnd = 0L;
+
+            while (true)
+            {
+                while (!batch.IsFull && reader.TryRead(out var pending))
+                {
+                    if (batch.Count == 0)
+                    {
+                        windowEnd = pending.EnqueuedTimestamp + _windowTicks;
+                    }
+                    batch.Add(pending.Event, pending.Completion, pending.EnqueuedTimestamp);
+                }
+
+                if (batch.IsFull || batch.Count == 0)
+                {
+                    return;
+                }
+
+                var remaining = windowEnd - Stopwatch.GetTimestamp();
+                if (remaining <= 0)
+                {
+                    return;
+                }
+
+                using var window = CancellationTokenSource.CreateLinkedTokenSource(_cts.Token);
+                window.CancelAfter(TimeSpan.FromTicks(Math.Max(1, remaining * TimeSpan.TicksPerSecond / Stopwatch.Frequency)));
+                try
+                {
+                    if (!await reader.WaitToReadAsync(window.Token))
+                    {
+                        return;
+                    }
+                }
+                catch (OperationCanceledException) when (!_cts.IsCancellationRequested)
+                {
+                    return;
+                }
+            }
+        }
+
+        private async Task SubmitAsync(ConsciousnessEventBatch batch)
+        {
+            try
+            {
+                await _processBatch(batch);
+
+                for (int i = 0; i < batch.Count; i++)
+                {
+                    var result = batch.Results[i];
+                    if (result != null)
+                    {
+                        batch.Completions[i].TrySetResult(result);
+                    }
+                    else
+                    {
+                        batch.Completions[i].TrySetException(new InvalidOperationException("GPU batch produced no result for the event"));
+                    }
+                }
+            }
+            catch (Exception ex)
+            {
+                _logger?.LogError(ex, "❌ RAPIDS batch of {BatchSize} consciousness events failed", batch.Count);
+                for (int i = 0; i < batch.Count; i++)
+                {
+                    batch.Completions[i].TrySetException(ex);
+                }
+            }
+            finally
+            {
+                batch.Reset();
+            }
+        }
+
+        /// <summary>
+        /// Submit what is queued, then stop; events enqueued afterwards are rejected
+        /// </summary>
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _disposed, 1) != 0)
+            {
+                return;
+            }
+
+            _queue.Writer.TryComplete();
+            if (!_loop.Wait(TimeSpan.FromSeconds(5)))
+            {
+                _cts.Cancel();
+                _loop.Wait(TimeSpan.FromSeconds(1));
+            }
+            _cts.Dispose();
+        }
+
+        private readonly record struct PendingEvent(
+            ConsciousnessEvent Event,
+            TaskCompletionSource<ConsciousnessResult> Completion,
+            long EnqueuedTimestamp);
+    }
+}
@@ -3,7 +3,32 @@ using System;
 namespace CxLanguage.Runtime
 {
     /// <summary>
-    /// Helper class for runtime arithmetic operations with automatic type coercion
+    /// Arithmetic operations understood by CxArithmeticHelper
+    /// </summary>
+    public enum CxArithmeticOperation
+    {
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Remainder
+    }
+
+    /// <summary>
+    /// Relational comparisons understood by CxArithmeticHelper
+    /// </summary>
+    public enum CxComparisonOperation
+    {
+        LessThan,
+        LessThanOrEqual,
+        GreaterThan,
+        GreaterThanOrEqual
+    }
+
+    /// <summary>
+    /// Helper class for runtime arithmetic operations with automatic type coercion.
+    /// The compiler emits native IL when operand types are statically known; these helpers
+    /// cover the dynamic cases.
     /// </summary>
     public static class CxArithmeticHelper
     {
@@ -11,11 +36,30 @@ namespace CxLanguage.Runtime
         /// Perform arithmetic operations with automatic type coercion between int and double
         /// </summary>
         public static object PerformArithmetic(object left, object right, string operation)
+        {
+            return PerformArithmetic(left, right, ParseArithmeticOperation(operation));
+        }
+
+        /// <summary>
+        /// Perform arithmetic operations with automatic type coercion between int and double
+        /// </summary>
+        public static object PerformArithmetic(object left, object right, CxArithmeticOperation operation)
         {
             // Handle null cases
             if (left == null || right == null)
                 throw new InvalidOperationException("Cannot perform arithmetic on null values");
 
+            // Common cases first: avoid the numeric conversion when both boxes already hold int or double
+            if (left is int leftInt && right is int rightInt)
+            {
+                return Apply(leftInt, rightInt, operation);
+            }
+
+            if (left is double leftDouble && right is double rightDouble)
+            {
+                return Apply(leftDouble, rightDouble, operation);
+            }
+
             // Determine the actual runtime types
             var leftValue = ConvertToNumeric(left);
             var rightValue = ConvertToNumeric(right);
@@ -23,79 +67,48 @@ namespace CxLanguage.Runtime
             // Promote to double if either operand is double
             if (leftValue is double || rightValue is double)
             {
-                var leftDouble = Convert.ToDouble(leftValue);
-                var rightDouble = Convert.ToDouble(rightValue);
-
-                return operation.ToLowerInvariant() switch
-                {
-                    "add" => leftDouble + rightDouble,
-                    "sub" => leftDouble - rightDouble,
-                    "mul" => leftDouble * rightDouble,
-                    "div" => leftDouble / rightDouble,
-                    "rem" => leftDouble % rightDouble,
-                    _ => throw new InvalidOperationException($"Unknown arithmetic operation: {operation}")
-                };
+                return Apply(Convert.ToDouble(leftValue), Convert.ToDouble(rightValue), operation);
             }
-            else
-            {
-                // Both are integers
-                var leftInt = Convert.ToInt32(leftValue);
-                var rightInt = Convert.ToInt32(rightValue);
 
-                return operation.ToLowerInvariant() switch
-                {
-                    "add" => leftInt + rightInt,
-                    "sub" => leftInt - rightInt,
-                    "mul" => leftInt * rightInt,
-                    "div" => leftInt / rightInt,
-                    "rem" => leftInt % rightInt,
-                    _ => throw new InvalidOperationException($"Unknown arithmetic operation: {operation}")
-                };
-            }
+            // Both are integers
+            return Apply(Convert.ToInt32(leftValue), Convert.ToInt32(rightValue), operation);
         }
 
         /// <summary>
         /// Perform comparison operations with automatic type coercion between int and double
         /// </summary>
         public static object PerformComparison(object left, object right, string operation)
+        {
+            return PerformComparison(left, right, ParseComparisonOperation(operation));
+        }
+
+        /// <summary>
+        /// Perform comparison operations with automatic type coercion between int and double
+        /// </summary>
+        public static object PerformComparison(object left, object right, CxComparisonOperation operation)
         {
             // Handle null cases with proper null comparison semantics
             if (left == null && right == null)
             {
-                return operation.ToLowerInvariant() switch
-                {
-                    "lt" => false,  // null == null, so not less than
-                    "le" => true,   // null == null, so less than or equal
-                    "gt" => false,  // null == null, so not greater than  
-                    "ge" => true,   // null == null, so greater than or equal
-                    _ => throw new InvalidOperationException($"Unknown comparison operation: {operation}")
-                };
+                // null == null, so only the "or equal" comparisons hold
+                return operation is CxComparisonOperation.LessThanOrEqual or CxComparisonOperation.GreaterThanOrEqual;
             }
 
             if (left == null)
             {
                 // null is considered "less than" any non-null value
-                return operation.ToLowerInvariant() switch
-                {
-                    "lt" => true,   // null < value
-                    "le" => true,   // null <= value
-                    "gt" => false,  // null > value
-                    "ge" => false,  // null >= value
-                    _ => throw new InvalidOperationException($"Unknown comparison operation: {operation}")
-                };
+                return operation is CxComparisonOperation.LessThan or CxComparisonOperation.LessThanOrEqual;
             }
 
             if (right == null)
             {
                 // any non-null value is "greater than" null
-                return operation.ToLowerInvariant() switch
-                {
-                    "lt" => false,  // value < null
-                    "le" => false,  // value <= null
-                    "gt" => true,   // value > null
-                    "ge" => true,   // value >= null
-                    _ => throw new InvalidOperationException($"Unknown comparison operation: {operation}")
-                };
+                return operation is CxComparisonOperation.GreaterThan or CxComparisonOperation.GreaterThanOrEqual;
+            }
+
+            if (left is int leftInt && right is int rightInt)
+            {
+                return Compare(leftInt.CompareTo(rightInt), operation);
             }
 
             // Both values are non-null, proceed with numeric comparison
@@ -109,12 +122,12 @@ namespace CxLanguage.Runtime
                 var leftDouble = Convert.ToDouble(leftValue);
                 var rightDouble = Convert.ToDouble(rightValue);
 
-                return operation.ToLowerInvariant() switch
+                return operation switch
                 {
-                    "lt" => leftDouble < rightDouble,
-                    "le" => leftDouble <= rightDouble,
-                    "gt" => leftDouble > rightDouble,
-                    "ge" => leftDouble >= rightDouble,
+                    CxComparisonOperation.LessThan => leftDouble < rightDouble,
+                    CxComparisonOperation.LessThanOrEqual => leftDouble <= rightDouble,
+                    CxComparisonOperation.GreaterThan => leftDouble > rightDouble,
+                    CxComparisonOperation.GreaterThanOrEqual => leftDouble >= rightDouble,
                     _ => throw new InvalidOperationException($"Unknown comparison operation: {operation}")
                 };
             }
@@ -125,17 +138,76 @@ namespace CxLanguage.Runtime
                 var rightStr = right?.ToString() ?? "";
                 var stringComparison = string.Compare(leftStr, rightStr, StringComparison.Ordinal);
 
-                return operation.ToLowerInvariant() switch
-                {
-                    "lt" => stringComparison < 0,
-                    "le" => stringComparison <= 0,
-                    "gt" => stringComparison > 0,
-                    "ge" => stringComparison >= 0,
-                    _ => throw new InvalidOperationException($"Unknown comparison operation: {operation}")
-                };
+                return Compare(stringComparison, operation);
             }
         }
 
+        private static object Apply(int left, int right, CxArithmeticOperation operation)
+        {
+            return operation switch
+            {
+                CxArithmeticOperation.Add => left + right,
+                CxArithmeticOperation.Subtract => left - right,
+                CxArithmeticOperation.Multiply => left * right,
+                CxArithmeticOperation.Divide => left / right,
+                CxArithmeticOperation.Remainder => left % right,
+                _ => throw new InvalidOperationException($"Unknown arithmetic operation: {operation}")
+            };
+        }
+
+        private static object Apply(double left, double right, CxArithmeticOperation operation)
+        {
+            return operation switch
+            {
+                CxArithmeticOperation.Add => left + right,
+                CxArithmeticOperation.Subtract => left - right,
+                CxArithmeticOperation.Multiply => left * right,
+                CxArithmeticOperation.Divide => left / right,
+                CxArithmeticOperation.Remainder => left % right,
+                _ => throw new InvalidOperationException($"Unknown arithmetic operation: {operation}")
+            };
+        }
+
+        private static bool Compare(int comparison, CxComparisonOperation operation)
+        {
+            return operation switch
+            {
+                CxComparisonOperation.LessThan => comparison < 0,
+                CxComparisonOperation.LessThanOrEqual => comparison <= 0,
+                CxComparisonOperation.GreaterThan => comparison > 0,
+                CxComparisonOperation.GreaterThanOrEqual => comparison >= 0,
+                _ => throw new InvalidOperationException($"Unknown comparison operation: {operation}")
+            };
+        }
+
+        /// <summary>
+        /// Map the IL-style operation names used by older compiled scripts to the operation enum
+        /// </summary>
+        private static CxArithmeticOperation ParseArithmeticOperation(string operation)
+        {
+            return operation.ToLowerInvariant() switch
+            {
+                "add" => CxArithmeticOperation.Add,
+                "sub" => CxArithmeticOperation.Subtract,
+                "mul" => CxArithmeticOperation.Multiply,
+                "div" => CxArithmeticOperation.Divide,
+                "rem" => CxArithmeticOperation.Remainder,
+                _ => throw new InvalidOperationException($"Unknown arithmetic operation: {operation}")
+            };
+        }
+
+        private static CxComparisonOperation ParseComparisonOperation(string operation)
+        {
+            return operation.ToLowerInvariant() switch
+            {
+                "lt" => CxComparisonOperation.LessThan,
+                "le" => CxComparisonOperation.LessThanOrEqual,
+                "gt" => CxComparisonOperation.GreaterThan,
+                "ge" => CxComparisonOperation.GreaterThanOrEqual,
+                _ => throw new InvalidOperationException($"Unknown comparison operation: {operation}")
+            };
+        }
+
         /// <summary>
         /// Convert a boxed value to its underlying numeric type
         /// </summary>
@@ -153,4 +225,3 @@ namespace CxLanguage.Runtime
         }
     }
 }
-
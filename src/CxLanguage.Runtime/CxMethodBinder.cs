@@ -0,0 +1,238 @@
+using System;
+using System.Collections.Concurrent;
+using System.Linq;
+using System.Linq.Expressions;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Threading.Tasks;
+
+namespace CxLanguage.Runtime
+{
+    /// <summary>
+    /// A method call site bound once into a strongly typed delegate
+    /// </summary>
+    internal sealed class CxMethodBinding
+    {
+        public CxMethodBinding(MethodInfo method, Func<object, object?[], object?> invoke, Func<Task, object?>? taskResult)
+        {
+            Method = method;
+            Parameters = method.GetParameters();
+            Invoke = invoke;
+            TaskResult = taskResult;
+        }
+
+        public MethodInfo Method { get; }
+        public ParameterInfo[] Parameters { get; }
+
+        /// <summary>
+        /// Invokes the method on a target with already converted arguments
+        /// </summary>
+        public Func<object, object?[], object?> Invoke { get; }
+
+        /// <summary>
+        /// Reads Task&lt;T&gt;.Result when the declared return type is Task&lt;T&gt;
+        /// </summary>
+        public Func<Task, object?>? TaskResult { get; }
+    }
+
+    /// <summary>
+    /// A compiled CX event handler method bound into a (target, CxEvent) delegate
+    /// </summary>
+    internal sealed class CxEventHandlerBinding
+    {
+        public CxEventHandlerBinding(MethodInfo method, Func<object, CxEvent, object?> invoke)
+        {
+            Method = method;
+            ParameterType = method.GetParameters()[0].ParameterType;
+            Invoke = invoke;
+        }
+
+        public MethodInfo Method { get; }
+        public Type ParameterType { get; }
+        public Func<object, CxEvent, object?> Invoke { get; }
+    }
+
+    /// <summary>
+    /// Binds CX handler and service call sites into compiled delegates, cached per (Type, methodName, arity).
+    /// Types are held weakly so collectible script assemblies can still be unloaded.
+    /// If a call site cannot be compiled the binding falls back to MethodInfo.Invoke.
+    /// </summary>
+    internal static class CxMethodBinder
+    {
+        private static readonly ConditionalWeakTable<Type, TypeBindings> _bindings = new();
+
+        /// <summary>
+        /// Public instance methods with the given name
+        /// </summary>
+        public static MethodInfo[] GetMethods(Type type, string methodName)
+        {
+            return GetTypeBindings(type).Methods.GetOrAdd(methodName, static (name, t) =>
+                t.GetMethods(BindingFlags.Public | BindingFlags.Instance)
+                    .Where(m => m.Name == name)
+                    .ToArray(), type);
+        }
+
+        /// <summary>
+        /// Bind a service call: the first overload that accepts the given number of arguments,
+        /// with the remaining parameters filled from their default values
+        /// </summary>
+        public static CxMethodBinding? GetServiceBinding(Type type, string methodName, int argumentCount)
+        {
+            return GetTypeBindings(type).Services.GetOrAdd((methodName, argumentCount), static (key, t) =>
+            {
+                foreach (var method in GetMethods(t, key.Item1))
+                {
+                    var parameters = method.GetParameters();
+                    if (parameters.Length < key.Item2)
+                    {
+                        continue;
+                    }
+
+                    if (parameters.Skip(key.Item2).All(p => p.HasDefaultValue))
+                    {
+                        return new CxMethodBinding(method, CompileInvoker(method), CompileTaskResult(method.ReturnType));
+                    }
+                }
+
+                return null;
+            }, type);
+        }
+
+        /// <summary>
+        /// Bind a compiled CX event handler: a public instance method taking a single CxEvent parameter
+        /// </summary>
+        public static CxEventHandlerBinding? GetEventHandler(Type type, string methodName)
+        {
+            return GetTypeBindings(type).EventHandlers.GetOrAdd(methodName, static (name, t) =>
+            {
+                var method = GetMethods(t, name).FirstOrDefault(m => m.GetParameters().Length == 1);
+                return method == null ? null : new CxEventHandlerBinding(method, CompileEventHandler(method));
+            }, type);
+        }
+
+        private static TypeBindings GetTypeBindings(Type type) => _bindings.GetValue(type, static _ => new TypeBindings());
+
+        #region Delegate Compilation
+
+        private static Func<object, object?[], object?> CompileInvoker(MethodInfo method)
+        {
+            try
+            {
+                var parameters = method.GetParameters();
+                if (method.DeclaringType == null || parameters.Any(p => p.ParameterType.IsByRef))
+                {
+                    return method.Invoke;
+                }
+
+                var target = Expression.Parameter(typeof(object), "target");
+                var arguments = Expression.Parameter(typeof(object?[]), "arguments");
+                var callArguments = parameters.Select((p, i) =>
+                    ConvertFromObject(Expression.ArrayIndex(arguments, Expression.Constant(i)), p.ParameterType));
+                var call = Expression.Call(Expression.Convert(target, method.DeclaringType), method, callArguments);
+
+                return Expression.Lambda<Func<object, object?[], object?>>(BoxResult(call), target, arguments).Compile();
+            }
+            catch (Exception)
+            {
+                return method.Invoke;
+            }
+        }
+
+        private static Func<object, CxEvent, object?> CompileEventHandler(MethodInfo method)
+        {
+            try
+            {
+                if (method.DeclaringType == null || method.GetParameters()[0].ParameterType.IsByRef)
+                {
+                    return (instance, cxEvent) => method.Invoke(instance, new object[] { cxEvent });
+                }
+
+                var target = Expression.Parameter(typeof(object), "target");
+                var cxEvent = Expression.Parameter(typeof(CxEvent), "cxEvent");
+                var call = Expression.Call(
+                    Expression.Convert(target, method.DeclaringType),
+                    method,
+                    Expression.Convert(cxEvent, method.GetParameters()[0].ParameterType));
+
+                return Expression.Lambda<Func<object, CxEvent, object?>>(BoxResult(call), target, cxEvent).Compile();
+            }
+            catch (Exception)
+            {
+                return (instance, cxEvent) => method.Invoke(instance, new object[] { cxEvent });
+            }
+        }
+
+        private static Func<Task, object?>? CompileTaskResult(Type returnType)
+        {
+            if (!returnType.IsGenericType || returnType.GetGenericTypeDefinition() != typeof(Task<>))
+            {
+                return null;
+            }
+
+            try
+            {
+                var task = Expression.Parameter(typeof(Task), "task");
+                var result = Expression.Property(Expression.Convert(task, returnType), "Result");
+                return Expression.Lambda<Func<Task, object?>>(Expression.Convert(result, typeof(object)), task).Compile();
+            }
+            catch (Exception)
+            {
+                var resultProperty = returnType.GetProperty("Result");
+                return resultProperty == null ? null : task => resultProperty.GetValue(task);
+            }
+        }
+
+        /// <summary>
+        /// Cast an object argument to the parameter type. Value types go through CoerceValue so that null becomes
+        /// default(T) and primitive widening (int to double, etc.) keeps working as it did with MethodInfo.Invoke.
+        /// </summary>
+        private static Expression ConvertFromObject(Expression value, Type parameterType)
+        {
+            if (parameterType == typeof(object))
+            {
+                return value;
+            }
+
+            if (parameterType.IsValueType)
+            {
+                return Expression.Call(CoerceValueMethod.MakeGenericMethod(parameterType), value);
+            }
+
+            return Expression.Convert(value, parameterType);
+        }
+
+        private static readonly MethodInfo CoerceValueMethod =
+            typeof(CxMethodBinder).GetMethod(nameof(CoerceValue), BindingFlags.NonPublic | BindingFlags.Static)!;
+
+        private static T CoerceValue<T>(object? value)
+        {
+            if (value is T typed)
+            {
+                return typed;
+            }
+
+            if (value == null)
+            {
+                return default!;
+            }
+
+            return (T)Convert.ChangeType(value, Nullable.GetUnderlyingType(typeof(T)) ?? typeof(T));
+        }
+
+        private static Expression BoxResult(MethodCallExpression call)
+        {
+            return call.Type == typeof(void)
+                ? Expression.Block(call, Expression.Constant(null, typeof(object)))
+                : Expression.Convert(call, typeof(object));
+        }
+
+        #endregion
+
+        private sealed class TypeBindings
+        {
+            public ConcurrentDictionary<string, MethodInfo[]> Methods { get; } = new(StringComparer.Ordinal);
+            public ConcurrentDictionary<(string, int), CxMethodBinding?> Services { get; } = new();
+            public ConcurrentDictionary<string, CxEventHandlerBinding?> EventHandlers { get; } = new(StringComparer.Ordinal);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+using System;
+using System.Threading;
+
+namespace CxLanguage.Runtime
+{
+    /// <summary>
+    /// Small lock-free object pool used by the low-allocation event dispatch path.
+    /// Objects are kept in a fixed array of slots; when the pool is empty a new object is created,
+    /// and when it is full returned objects are simply dropped for the GC.
+    /// </summary>
+    internal sealed class CxObjectPool<T> where T : class
+    {
+        private readonly T?[] _items;
+        private readonly Func<T> _factory;
+        private readonly Action<T>? _reset;
+        private T? _fastItem;
+
+        public CxObjectPool(Func<T> factory, Action<T>? reset = null, int? maximumRetained = null)
+        {
+            _factory = factory;
+            _reset = reset;
+            _items = new T?[Math.Max(1, (maximumRetained ?? Environment.ProcessorCount * 4) - 1)];
+        }
+
+        /// <summary>
+        /// Rent an object, creating one when no pooled instance is available
+        /// </summary>
+        public T Rent()
+        {
+            var item = _fastItem;
+            if (item != null && Interlocked.CompareExchange(ref _fastItem, null, item) == item)
+            {
+                return item;
+            }
+
+            var items = _items;
+            for (int i = 0; i < items.Length; i++)
+            {
+                item = items[i];
+                if (item != null && Interlocked.CompareExchange(ref items[i], null, item) == item)
+                {
+                    return item;
+                }
+            }
+
+            return _factory();
+        }
+
+        /// <summary>
+        /// Reset an object and return it to the pool
+        /// </summary>
+        public void Return(T item)
+        {
+            _reset?.Invoke(item);
+
+            if (_fastItem == null && Interlocked.CompareExchange(ref _fastItem, item, null) == null)
+            {
+                return;
+            }
+
+            var items = _items;
+            for (int i = 0; i < items.Length; i++)
+            {
+                if (items[i] == null && Interlocked.CompareExchange(ref items[i], item, null) == null)
+                {
+                    return;
+                }
+            }
+        }
+    }
+}
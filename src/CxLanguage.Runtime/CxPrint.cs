@@ -1,8 +1,10 @@
 using System;
 using System.Collections.Generic;
+using System.IO;
 using System.Linq;
 using System.Reflection;
 using System.Text.Json;
+using CxLanguage.Runtime.Services;
 
 namespace CxLanguage.Runtime
 {
@@ -12,13 +14,57 @@ namespace CxLanguage.Runtime
     public static class CxPrint
     {
         /// <summary>
-        /// Enhanced print function that properly displays Dictionary objects from AI functions
+        /// Writers larger than this after a print are not kept for reuse
+        /// </summary>
+        private const int MaxCachedCapacity = 64 * 1024;
+
+        [ThreadStatic] private static StringWriter? _output;
+        [ThreadStatic] private static StringWriter? _cachedOutput;
+
+        private static StringWriter Output => _output!;
+
+        /// <summary>
+        /// Enhanced print function that properly displays Dictionary objects from AI functions.
+        /// The whole rendering is queued to the console sink as one write, so multi-line output is never interleaved.
         /// </summary>
         public static void Print(object value)
+        {
+            ConsoleOutputSink.Shared.Write(Format(value));
+        }
+
+        /// <summary>
+        /// Render a value the way Print displays it, including the trailing newline
+        /// </summary>
+        public static string Format(object? value)
+        {
+            // Reentrant calls (a ToString that prints) get a writer of their own
+            var output = _cachedOutput ?? new StringWriter();
+            _cachedOutput = null;
+            var previous = _output;
+            _output = output;
+
+            try
+            {
+                Render(value);
+                return output.ToString();
+            }
+            finally
+            {
+                _output = previous;
+                var builder = output.GetStringBuilder();
+                if (builder.Capacity <= MaxCachedCapacity)
+                {
+                    builder.Clear();
+                    _cachedOutput = output;
+                }
+            }
+        }
+
+        private static void Render(object? value)
         {
             if (value == null)
             {
-                Console.WriteLine("null");
+                Output.WriteLine("null");
                 return;
             }
 
@@ -46,7 +92,7 @@ namespace CxLanguage.Runtime
             // Handle primitive types (string, numbers, bool) - print as-is
             if (IsPrimitiveType(value))
             {
-                Console.WriteLine(value);
+                Output.WriteLine(value);
                 return;
             }
 
@@ -69,12 +115,12 @@ namespace CxLanguage.Runtime
                 };
                 
                 var json = JsonSerializer.Serialize(value, jsonOptions);
-                Console.WriteLine(json);
+                Output.WriteLine(json);
             }
             catch (Exception ex)
             {
                 // Fallback to ToString() if JSON serialization fails
-                Console.WriteLine($"[Object: {value.GetType().Name}] {value} (JSON serialization failed: {ex.Message})");
+                Output.WriteLine($"[Object: {value.GetType().Name}] {value} (JSON serialization failed: {ex.Message})");
             }
         }
 
@@ -98,20 +144,20 @@ namespace CxLanguage.Runtime
         /// </summary>
         private static void PrintDictionary(Dictionary<string, object> dict)
         {
-            Console.WriteLine("{");
+            Output.WriteLine("{");
             
             foreach (var kvp in dict)
             {
-                Console.Write($"  {kvp.Key}: ");
+                Output.Write($"  {kvp.Key}: ");
                 
                 if (kvp.Value is Dictionary<string, object> nestedDict)
                 {
-                    Console.WriteLine();
+                    Output.WriteLine();
                     PrintNestedDictionary(nestedDict, "    ");
                 }
                 else if (kvp.Value is Array array)
                 {
-                    Console.WriteLine();
+                    Output.WriteLine();
                     PrintNestedArray(array, "    ");
                 }
                 else if (kvp.Value is string str)
@@ -119,25 +165,25 @@ namespace CxLanguage.Runtime
                     // Handle multiline strings
                     if (str.Contains('\n'))
                     {
-                        Console.WriteLine();
+                        Output.WriteLine();
                         var lines = str.Split('\n');
                         foreach (var line in lines)
                         {
-                            Console.WriteLine($"    {line}");
+                            Output.WriteLine($"    {line}");
                         }
                     }
                     else
                     {
-                        Console.WriteLine($"\"{str}\"");
+                        Output.WriteLine($"\"{str}\"");
                     }
                 }
                 else
                 {
-                    Console.WriteLine(kvp.Value ?? "null");
+                    Output.WriteLine(kvp.Value ?? "null");
                 }
             }
             
-            Console.WriteLine("}");
+            Output.WriteLine("}");
         }
 
         /// <summary>
@@ -145,28 +191,28 @@ namespace CxLanguage.Runtime
         /// </summary>
         private static void PrintNestedDictionary(Dictionary<string, object> dict, string indent)
         {
-            Console.WriteLine($"{indent}{{");
+            Output.WriteLine($"{indent}{{");
             
             foreach (var kvp in dict)
             {
-                Console.Write($"{indent}  {kvp.Key}: ");
+                Output.Write($"{indent}  {kvp.Key}: ");
                 
                 if (kvp.Value is Dictionary<string, object> nestedDict)
                 {
-                    Console.WriteLine();
+                    Output.WriteLine();
                     PrintNestedDictionary(nestedDict, indent + "    ");
                 }
                 else if (kvp.Value is string str)
                 {
-                    Console.WriteLine($"\"{str}\"");
+                    Output.WriteLine($"\"{str}\"");
                 }
                 else
                 {
-                    Console.WriteLine(kvp.Value ?? "null");
+                    Output.WriteLine(kvp.Value ?? "null");
                 }
             }
             
-            Console.WriteLine($"{indent}}}");
+            Output.WriteLine($"{indent}}}");
         }
 
         /// <summary>
@@ -174,7 +220,7 @@ namespace CxLanguage.Runtime
         /// </summary>
         private static void PrintArray(Array array)
         {
-            Console.WriteLine("[");
+            Output.WriteLine("[");
             
             for (int i = 0; i < array.Length; i++)
             {
@@ -182,38 +228,38 @@ namespace CxLanguage.Runtime
                 
                 if (item is Dictionary<string, object> dict)
                 {
-                    Console.WriteLine("  {");
+                    Output.WriteLine("  {");
                     foreach (var kvp in dict)
                     {
-                        Console.Write($"    {kvp.Key}: ");
+                        Output.Write($"    {kvp.Key}: ");
                         
                         if (kvp.Value is Dictionary<string, object> nestedDict)
                         {
-                            Console.WriteLine();
+                            Output.WriteLine();
                             PrintNestedDictionary(nestedDict, "      ");
                         }
                         else if (kvp.Value is string str)
                         {
-                            Console.WriteLine($"\"{str}\"");
+                            Output.WriteLine($"\"{str}\"");
                         }
                         else
                         {
-                            Console.WriteLine(kvp.Value ?? "null");
+                            Output.WriteLine(kvp.Value ?? "null");
                         }
                     }
-                    Console.WriteLine("  }");
+                    Output.WriteLine("  }");
                 }
                 else if (item is string str)
                 {
-                    Console.WriteLine($"  \"{str}\"");
+                    Output.WriteLine($"  \"{str}\"");
                 }
                 else
                 {
-                    Console.WriteLine($"  {item ?? "null"}");
+                    Output.WriteLine($"  {item ?? "null"}");
                 }
             }
             
-            Console.WriteLine("]");
+            Output.WriteLine("]");
         }
 
         /// <summary>
@@ -221,7 +267,7 @@ namespace CxLanguage.Runtime
         /// </summary>
         private static void PrintNestedArray(Array array, string indent)
         {
-            Console.WriteLine($"{indent}[");
+            Output.WriteLine($"{indent}[");
             
             for (int i = 0; i < array.Length; i++)
             {
@@ -229,38 +275,38 @@ namespace CxLanguage.Runtime
                 
                 if (item is Dictionary<string, object> nestedDict)
                 {
-                    Console.WriteLine($"{indent}  {{");
+                    Output.WriteLine($"{indent}  {{");
                     foreach (var kvp in nestedDict)
                     {
-                        Console.Write($"{indent}    {kvp.Key}: ");
+                        Output.Write($"{indent}    {kvp.Key}: ");
                         
                         if (kvp.Value is Dictionary<string, object> deepNestedDict)
                         {
-                            Console.WriteLine();
+                            Output.WriteLine();
                             PrintNestedDictionary(deepNestedDict, indent + "      ");
                         }
                         else if (kvp.Value is string str)
                         {
-                            Console.WriteLine($"\"{str}\"");
+                            Output.WriteLine($"\"{str}\"");
                         }
                         else
                         {
-                            Console.WriteLine(kvp.Value ?? "null");
+                            Output.WriteLine(kvp.Value ?? "null");
                         }
                     }
-                    Console.WriteLine($"{indent}  }}");
+                    Output.WriteLine($"{indent}  }}");
                 }
                 else if (item is string str)
                 {
-                    Console.WriteLine($"{indent}  \"{str}\"");
+                    Output.WriteLine($"{indent}  \"{str}\"");
                 }
                 else
                 {
-                    Console.WriteLine($"{indent}  {item ?? "null"}");
+                    Output.WriteLine($"{indent}  {item ?? "null"}");
                 }
             }
             
-            Console.WriteLine($"{indent}]");
+            Output.WriteLine($"{indent}]");
         }
 
         /// <summary>
@@ -268,44 +314,44 @@ namespace CxLanguage.Runtime
         /// </summary>
         private static void PrintEnumerable(System.Collections.IEnumerable enumerable)
         {
-            Console.WriteLine("[");
+            Output.WriteLine("[");
             
             foreach (var item in enumerable)
             {
                 if (item is Dictionary<string, object> dict)
                 {
-                    Console.WriteLine("  {");
+                    Output.WriteLine("  {");
                     foreach (var kvp in dict)
                     {
-                        Console.Write($"    {kvp.Key}: ");
+                        Output.Write($"    {kvp.Key}: ");
                         
                         if (kvp.Value is Dictionary<string, object> nestedDict)
                         {
-                            Console.WriteLine();
+                            Output.WriteLine();
                             PrintNestedDictionary(nestedDict, "      ");
                         }
                         else if (kvp.Value is string str)
                         {
-                            Console.WriteLine($"\"{str}\"");
+                            Output.WriteLine($"\"{str}\"");
                         }
                         else
                         {
-                            Console.WriteLine(kvp.Value ?? "null");
+                            Output.WriteLine(kvp.Value ?? "null");
                         }
                     }
-                    Console.WriteLine("  }");
+                    Output.WriteLine("  }");
                 }
                 else if (item is string str)
                 {
-                    Console.WriteLine($"  \"{str}\"");
+                    Output.WriteLine($"  \"{str}\"");
                 }
                 else
                 {
-                    Console.WriteLine($"  {item ?? "null"}");
+                    Output.WriteLine($"  {item ?? "null"}");
                 }
             }
             
-            Console.WriteLine("]");
+            Output.WriteLine("]");
         }
         
         /// <summary>
@@ -338,7 +384,7 @@ namespace CxLanguage.Runtime
             var objectType = cxObject.GetType();
             var fields = objectType.GetFields(System.Reflection.BindingFlags.Public | System.Reflection.BindingFlags.NonPublic | System.Reflection.BindingFlags.Instance);
             
-            Console.WriteLine("{");
+            Output.WriteLine("{");
             
             bool hasFields = false;
             foreach (var field in fields)
@@ -355,34 +401,34 @@ namespace CxLanguage.Runtime
                 try
                 {
                     var fieldValue = field.GetValue(cxObject);
-                    Console.Write($"  \"{field.Name}\": ");
+                    Output.Write($"  \"{field.Name}\": ");
                     
                     if (fieldValue == null)
                     {
-                        Console.WriteLine("null,");
+                        Output.WriteLine("null,");
                     }
                     else if (fieldValue is string str)
                     {
-                        Console.WriteLine($"\"{str}\",");
+                        Output.WriteLine($"\"{str}\",");
                     }
                     else if (IsPrimitiveType(fieldValue))
                     {
-                        Console.WriteLine($"{fieldValue},");
+                        Output.WriteLine($"{fieldValue},");
                     }
                     else if (fieldValue is Dictionary<string, object> dict)
                     {
-                        Console.WriteLine();
+                        Output.WriteLine();
                         PrintNestedDictionary(dict, "    ");
-                        Console.WriteLine(",");
+                        Output.WriteLine(",");
                     }
                     else
                     {
                         // For nested objects, check if it's another CX object first
                         if (IsCxObject(fieldValue))
                         {
-                            Console.WriteLine();
+                            Output.WriteLine();
                             PrintNestedCxObject(fieldValue, "    ");
-                            Console.WriteLine(",");
+                            Output.WriteLine(",");
                         }
                         else
                         {
@@ -390,11 +436,11 @@ namespace CxLanguage.Runtime
                             try
                             {
                                 var json = JsonSerializer.Serialize(fieldValue, new JsonSerializerOptions { WriteIndented = false });
-                                Console.WriteLine($"{json},");
+                                Output.WriteLine($"{json},");
                             }
                             catch
                             {
-                                Console.WriteLine($"\"[Object: {fieldValue.GetType().Name}]\",");
+                                Output.WriteLine($"\"[Object: {fieldValue.GetType().Name}]\",");
                             }
                         }
                     }
@@ -403,17 +449,17 @@ namespace CxLanguage.Runtime
                 }
                 catch (Exception ex)
                 {
-                    Console.WriteLine($"\"[Error accessing field: {ex.Message}]\",");
+                    Output.WriteLine($"\"[Error accessing field: {ex.Message}]\",");
                     hasFields = true;
                 }
             }
             
             if (!hasFields)
             {
-                Console.WriteLine("  \"[No accessible fields]\"");
+                Output.WriteLine("  \"[No accessible fields]\"");
             }
             
-            Console.WriteLine("}");
+            Output.WriteLine("}");
         }
         
         /// <summary>
@@ -424,7 +470,7 @@ namespace CxLanguage.Runtime
             var objectType = cxObject.GetType();
             var fields = objectType.GetFields(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
             
-            Console.WriteLine($"{indent}{{");
+            Output.WriteLine($"{indent}{{");
             
             bool hasFields = false;
             foreach (var field in fields)
@@ -441,31 +487,31 @@ namespace CxLanguage.Runtime
                 try
                 {
                     var fieldValue = field.GetValue(cxObject);
-                    Console.Write($"{indent}  \"{field.Name}\": ");
+                    Output.Write($"{indent}  \"{field.Name}\": ");
                     
                     if (fieldValue == null)
                     {
-                        Console.WriteLine("null,");
+                        Output.WriteLine("null,");
                     }
                     else if (fieldValue is string str)
                     {
-                        Console.WriteLine($"\"{str}\",");
+                        Output.WriteLine($"\"{str}\",");
                     }
                     else if (IsPrimitiveType(fieldValue))
                     {
-                        Console.WriteLine($"{fieldValue},");
+                        Output.WriteLine($"{fieldValue},");
                     }
                     else if (fieldValue is Dictionary<string, object> dict)
                     {
-                        Console.WriteLine();
+                        Output.WriteLine();
                         PrintNestedDictionary(dict, indent + "    ");
-                        Console.WriteLine(",");
+                        Output.WriteLine(",");
                     }
                     else if (IsCxObject(fieldValue))
                     {
-                        Console.WriteLine();
+                        Output.WriteLine();
                         PrintNestedCxObject(fieldValue, indent + "    ");
-                        Console.WriteLine(",");
+                        Output.WriteLine(",");
                     }
                     else
                     {
@@ -473,11 +519,11 @@ namespace CxLanguage.Runtime
                         try
                         {
                             var json = JsonSerializer.Serialize(fieldValue, new JsonSerializerOptions { WriteIndented = false });
-                            Console.WriteLine($"{json},");
+                            Output.WriteLine($"{json},");
                         }
                         catch
                         {
-                            Console.WriteLine($"\"[Object: {fieldValue.GetType().Name}]\",");
+                            Output.WriteLine($"\"[Object: {fieldValue.GetType().Name}]\",");
                         }
                     }
                     
@@ -485,17 +531,17 @@ namespace CxLanguage.Runtime
                 }
                 catch (Exception ex)
                 {
-                    Console.WriteLine($"\"[Error accessing field: {ex.Message}]\",");
+                    Output.WriteLine($"\"[Error accessing field: {ex.Message}]\",");
                     hasFields = true;
                 }
             }
             
             if (!hasFields)
             {
-                Console.WriteLine($"{indent}  \"[No accessible fields]\"");
+                Output.WriteLine($"{indent}  \"[No accessible fields]\"");
             }
             
-            Console.WriteLine($"{indent}}}");
+            Output.WriteLine($"{indent}}}");
         }
     }
 }
@@ -5,6 +5,7 @@ using System.Reflection;
 using System.Threading.Tasks;
 using Microsoft.Extensions.DependencyInjection;
 using CxLanguage.Core.Events;
+using CxLanguage.Runtime.SharedMemory;
 
 namespace CxLanguage.Runtime
 {
@@ -18,6 +19,13 @@ namespace CxLanguage.Runtime
         /// Static service registry for accessing services from static function contexts
         /// </summary>
         private static readonly Dictionary<string, object> _staticServices = new();
+
+        /// <summary>
+        /// Pooled CxEvent envelopes for instance handlers when the event bus runs in low-allocation dispatch mode
+        /// </summary>
+        private static readonly CxObjectPool<CxEventEnvelope> _eventEnvelopePool = new(
+            () => new CxEventEnvelope(),
+            envelope => envelope.Reset());
         
         /// <summary>
         /// Register a service instance for static access
@@ -158,9 +166,7 @@ namespace CxLanguage.Runtime
                 foreach (var service in possibleServices)
                 {
                     var currentServiceType = service.GetType();
-                    var currentMethods = currentServiceType.GetMethods(BindingFlags.Public | BindingFlags.Instance)
-                        .Where(m => m.Name == methodName)
-                        .ToArray();
+                    var currentMethods = CxMethodBinder.GetMethods(currentServiceType, methodName);
                     
                     if (currentMethods.Length > 0)
                     {
@@ -177,27 +183,26 @@ namespace CxLanguage.Runtime
             }
 
             var serviceType = serviceInstance.GetType();
-            var methods = serviceType.GetMethods(BindingFlags.Public | BindingFlags.Instance)
-                .Where(m => m.Name == methodName)
-                .ToArray();
 
-            if (methods.Length == 0)
+            if (CxMethodBinder.GetMethods(serviceType, methodName).Length == 0)
             {
                 return $"[Error: Method '{methodName}' not found on service '{serviceType.Name}'.]";
             }
 
-            // Find the best matching method
-            var (method, finalArguments) = FindBestMethodAndPrepareArgs(methods, arguments);
+            // Overload selection depends only on the argument count, so the bound call site is cached per (type, method, arity)
+            var binding = CxMethodBinder.GetServiceBinding(serviceType, methodName, arguments.Length);
 
-            if (method == null || finalArguments == null)
+            if (binding == null)
             {
                 return $"[Error: No suitable overload for method '{methodName}' found for the given arguments.]";
             }
 
+            var finalArguments = PrepareArguments(binding.Parameters, arguments);
+
             try
             {
-                // Invoke the method
-                var result = method.Invoke(serviceInstance, finalArguments);
+                // Invoke the bound delegate
+                var result = binding.Invoke(serviceInstance, finalArguments);
 
                 // Handle async methods by using GetAwaiter().GetResult()
                 if (result is Task task)
@@ -206,6 +211,16 @@ namespace CxLanguage.Runtime
                     var awaiter = task.GetAwaiter();
                     awaiter.GetResult(); // Wait for completion
 
+                    if (binding.TaskResult != null)
+                    {
+                        return binding.TaskResult(task);
+                    }
+
+                    if (binding.Method.ReturnType == typeof(Task))
+                    {
+                        return null;
+                    }
+
                     // If the task has a result (Task<T>), return it
                     var resultProperty = task.GetType().GetProperty("Result");
                     if (resultProperty != null)
@@ -225,43 +240,19 @@ namespace CxLanguage.Runtime
             }
         }
 
-        private static (MethodInfo?, object[]?) FindBestMethodAndPrepareArgs(MethodInfo[] methods, object[] providedArgs)
+        private static object?[] PrepareArguments(ParameterInfo[] parameters, object[] providedArgs)
         {
-            foreach (var method in methods)
-            {
-                var parameters = method.GetParameters();
-                if (parameters.Length < providedArgs.Length) continue;
-
-                var finalArgs = new object?[parameters.Length];
-                bool match = true;
+            var finalArgs = new object?[parameters.Length];
 
-                for (int i = 0; i < parameters.Length; i++)
-                {
-                    if (i < providedArgs.Length)
-                    {
-                        // We have a provided argument
-                        finalArgs[i] = ConvertArgument(providedArgs[i], parameters[i].ParameterType);
-                    }
-                    else if (parameters[i].HasDefaultValue)
-                    {
-                        // Use the default value
-                        finalArgs[i] = parameters[i].DefaultValue;
-                    }
-                    else
-                    {
-                        // Not enough arguments and no default value
-                        match = false;
-                        break;
-                    }
-                }
-
-                if (match)
-                {
-                    return (method, (object[]?)finalArgs);
-                }
+            for (int i = 0; i < parameters.Length; i++)
+            {
+                // Provided arguments are converted, the rest come from default values (guaranteed by the binding)
+                finalArgs[i] = i < providedArgs.Length
+                    ? ConvertArgument(providedArgs[i], parameters[i].ParameterType)
+                    : parameters[i].DefaultValue;
             }
 
-            return (null, null);
+            return finalArgs;
         }
 
         private static object? ConvertArgument(object? arg, Type targetType)
@@ -614,18 +605,11 @@ namespace CxLanguage.Runtime
                 return;
             }
             
-            // Get the method from the instance type
+            // Bind the handler once per (type, method) into a compiled delegate
             var instanceType = instance.GetType();
-            var method = instanceType.GetMethod(methodName, BindingFlags.Public | BindingFlags.Instance);
+            var handler = CxMethodBinder.GetEventHandler(instanceType, methodName);
             
-            if (method == null)
-            {
-                return;
-            }
-            
-            // Validate method signature for safety
-            var parameters = method.GetParameters();
-            if (parameters.Length != 1)
+            if (handler == null)
             {
                 return;
             }
@@ -636,11 +620,20 @@ namespace CxLanguage.Runtime
             {
                 try
                 {
+                    // Handlers run on the wrapped bus when the process shares events with others
+                    var dispatchBus = (eventBus as SharedMemoryEventBus)?.Inner ?? eventBus;
+
                     // Create handler that matches ICxEventBus signature
                     Func<object?, string, IDictionary<string, object>?, Task<bool>> asyncHandler = async (sender, eventNameReceived, payload) =>
                     {
                         try
                         {
+                            if (dispatchBus is UnifiedEventBus { LowAllocationDispatch: true })
+                            {
+                                await InvokePooledInstanceHandler(handler, instance, eventNameReceived, payload, DateTime.UtcNow);
+                                return true;
+                            }
+
                             var cxEvent = new CxEvent
                             {
                                 name = eventNameReceived,
@@ -648,7 +641,7 @@ namespace CxLanguage.Runtime
                                 timestamp = DateTime.UtcNow
                             };
                             
-                            var result = method.Invoke(instance, new object[] { cxEvent });
+                            var result = handler.Invoke(instance, cxEvent);
                             if (result is Task task)
                             {
                                 await task;
@@ -675,13 +668,15 @@ namespace CxLanguage.Runtime
 
             // Fallback to UnifiedEventBusRegistry (legacy support)
             
+            var acceptsCxEvent = handler.ParameterType.IsAssignableFrom(typeof(CxEvent));
+
             // Create a CxEventHandler to invoke the compiled instance method
             CxEventHandler cxHandler = (payload) =>
             {
                 try
                 {
                     // Check if the parameter type is compatible
-                    if (parameters.Length == 0 || !parameters[0].ParameterType.IsAssignableFrom(typeof(CxEvent)))
+                    if (!acceptsCxEvent)
                     {
                         return Task.CompletedTask;
                     }
@@ -693,7 +688,7 @@ namespace CxLanguage.Runtime
                         timestamp = payload.Timestamp
                     };
                     
-                    var result = method.Invoke(instance, new object[] { cxEvent! });
+                    var result = handler.Invoke(instance, cxEvent);
                     if (result is Task task)
                     {
                         return task;
@@ -712,9 +707,93 @@ namespace CxLanguage.Runtime
             
             EventHandler unifiedHandler = (payload) =>
             {
+                if (UnifiedEventBusRegistry.Instance.LowAllocationDispatch)
+                {
+                    if (!acceptsCxEvent)
+                    {
+                        return Task.CompletedTask;
+                    }
+
+                    try
+                    {
+                        return InvokePooledInstanceHandler(handler, instance, payload.EventName, payload.Data as Dictionary<string, object>, payload.Timestamp);
+                    }
+                    catch (Exception)
+                    {
+                        // Silent error handling for clean output
+                        return Task.CompletedTask;
+                    }
+                }
+
                 var cxPayload = new CxEventPayload(payload.EventName, payload.Data ?? new object());
                 return cxHandler(cxPayload);
-            };            UnifiedEventBusRegistry.Instance.Subscribe(subscriptionId, eventName, unifiedHandler);
+            };
+            UnifiedEventBusRegistry.Instance.Subscribe(subscriptionId, eventName, unifiedHandler);
+        }
+
+        /// <summary>
+        /// Invoke a compiled instance handler with a pooled CxEvent.
+        /// The envelope goes back to the pool once the handler's task has completed.
+        /// </summary>
+        private static Task InvokePooledInstanceHandler(CxEventHandlerBinding handler, object instance, string eventName,
+            IDictionary<string, object>? payload, DateTime timestamp)
+        {
+            var envelope = _eventEnvelopePool.Rent();
+            envelope.Event.name = eventName;
+            envelope.Event.payload = payload ?? envelope.EmptyPayload;
+            envelope.Event.timestamp = timestamp;
+
+            object? result;
+            try
+            {
+                result = handler.Invoke(instance, envelope.Event);
+            }
+            catch
+            {
+                _eventEnvelopePool.Return(envelope);
+                throw;
+            }
+
+            if (result is Task task && !task.IsCompletedSuccessfully)
+            {
+                return ReturnEnvelopeWhenCompleteAsync(task, envelope);
+            }
+
+            _eventEnvelopePool.Return(envelope);
+            return Task.CompletedTask;
+        }
+
+        private static async Task ReturnEnvelopeWhenCompleteAsync(Task task, CxEventEnvelope envelope)
+        {
+            try
+            {
+                await task;
+            }
+            finally
+            {
+                _eventEnvelopePool.Return(envelope);
+            }
+        }
+
+        /// <summary>
+        /// Reusable CxEvent and empty payload for one handler invocation
+        /// </summary>
+        private sealed class CxEventEnvelope
+        {
+            public CxEventEnvelope()
+            {
+                Event.payload = EmptyPayload;
+            }
+
+            public CxEvent Event { get; } = new CxEvent();
+            public Dictionary<string, object> EmptyPayload { get; } = new();
+
+            public void Reset()
+            {
+                EmptyPayload.Clear();
+                Event.name = string.Empty;
+                Event.payload = EmptyPayload;
+            }
         }
 
         /// <summary>
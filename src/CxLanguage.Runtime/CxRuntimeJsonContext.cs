@@ -0,0 +1,41 @@
+using System.Collections.Generic;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using CxLanguage.Core.Serialization;
+using CxLanguage.Runtime.DirectPeering;
+
+namespace CxLanguage.Runtime
+{
+    /// <summary>
+    /// Source-generated JSON metadata for the runtime's rooted types: CxEvent and the direct peering models.
+    /// Property names stay as declared, matching the reflection-based output these types had before.
+    /// </summary>
+    [JsonSerializable(typeof(CxEvent))]
+    [JsonSerializable(typeof(PeeringResult))]
+    [JsonSerializable(typeof(PeeringRequest))]
+    [JsonSerializable(typeof(PeerConnection))]
+    [JsonSerializable(typeof(AgentDiscoveryResult))]
+    [JsonSerializable(typeof(HandshakeResult))]
+    [JsonSerializable(typeof(PeerDescriptor))]
+    [JsonSerializable(typeof(ConnectionResult))]
+    [JsonSerializable(typeof(ConsciousnessCompatibilityResult))]
+    [JsonSerializable(typeof(SecurityValidationResult))]
+    [JsonSerializable(typeof(AgentDescriptor))]
+    [JsonSerializable(typeof(AgentAuthenticationResult))]
+    [JsonSerializable(typeof(PeeringTokenClaims))]
+    [JsonSerializable(typeof(Dictionary<string, object>))]
+    public partial class CxRuntimeJsonContext : JsonSerializerContext
+    {
+        /// <summary>
+        /// Options for values of any runtime type: generated metadata for the runtime and CX value types,
+        /// reflection for everything else
+        /// </summary>
+        public static JsonSerializerOptions FallbackOptions => _fallbackOptions ??= new JsonSerializerOptions
+        {
+            TypeInfoResolver = CxJsonSerializerContext.WithReflectionFallback(Default)
+        };
+
+        // Built on first use: the generated Default is initialized in another part of this class
+        private static JsonSerializerOptions? _fallbackOptions;
+    }
+}
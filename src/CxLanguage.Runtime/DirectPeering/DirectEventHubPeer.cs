@@ -4,8 +4,10 @@ using System.Threading;
 using System.Threading.Tasks;
 using System.Collections.Generic;
 using System.Linq;
-using System.Text.Json;
+using System.Net;
+using System.Net.Sockets;
 using Microsoft.Extensions.Logging;
+using CxLanguage.Core.Telemetry;
 
 namespace CxLanguage.Runtime.DirectPeering
 {
@@ -16,17 +18,24 @@ namespace CxLanguage.Runtime.DirectPeering
     /// Performance Target: < 1ms consciousness event propagation
     /// Throughput Target: 10,000+ events/second per peer connection
     /// Reliability Target: 99.9% uptime with automatic recovery
+    ///
+    /// Events travel in the PeerWireCodec binary format over persistent TCP connections (PeerChannel), one per
+    /// remote agent, opened by NegotiatePeeringAsync or accepted by the listener started with StartListener.
     /// </summary>
     public class DirectEventHubPeer : IDisposable
     {
         private readonly string _peerId;
         private readonly string _agentId;
         private readonly ILogger<DirectEventHubPeer> _logger;
-        private readonly ConcurrentQueue<ConsciousnessEvent> _outboundQueue;
+        private readonly DirectPeerTransportOptions _options;
+        private readonly ConcurrentDictionary<PeerChannel, byte> _channels = new();
         private readonly ConcurrentQueue<ConsciousnessEvent> _inboundQueue;
+        private readonly SemaphoreSlim _inboundSignal = new(0);
         private readonly SemaphoreSlim _connectionSemaphore;
         private readonly CancellationTokenSource _cancellationTokenSource;
         private readonly PerformanceMetrics _metrics;
+        private TcpListener? _listener;
+        private volatile PeerChannel? _primaryChannel;
         private volatile bool _isConnected;
         private volatile bool _disposed;
 
@@ -34,11 +43,19 @@ namespace CxLanguage.Runtime.DirectPeering
         /// Initialize DirectEventHubPeer for revolutionary consciousness communication
         /// </summary>
         public DirectEventHubPeer(string agentId, ILogger<DirectEventHubPeer> logger)
+            : this(agentId, logger, null)
+        {
+        }
+
+        /// <summary>
+        /// Initialize DirectEventHubPeer with explicit transport settings
+        /// </summary>
+        public DirectEventHubPeer(string agentId, ILogger<DirectEventHubPeer> logger, DirectPeerTransportOptions? options)
         {
             _peerId = Guid.NewGuid().ToString("N")[..8]; // Short peer ID
             _agentId = agentId ?? throw new ArgumentNullException(nameof(agentId));
             _logger = logger ?? throw new ArgumentNullException(nameof(logger));
-            _outboundQueue = new ConcurrentQueue<ConsciousnessEvent>();
+            _options = options ?? new DirectPeerTransportOptions();
             _inboundQueue = new ConcurrentQueue<ConsciousnessEvent>();
             _connectionSemaphore = new SemaphoreSlim(1, 1);
             _cancellationTokenSource = new CancellationTokenSource();
@@ -57,6 +74,31 @@ namespace CxLanguage.Runtime.DirectPeering
         public bool IsConnected => _isConnected;
         public PerformanceMetrics Metrics => _metrics;
 
+        /// <summary>
+        /// Endpoint the listener is bound to, or null before StartListener
+        /// </summary>
+        public IPEndPoint? ListenEndpoint => _listener?.LocalEndpoint as IPEndPoint;
+
+        /// <summary>
+        /// Start accepting inbound peer connections. Without an endpoint the listener binds all interfaces on
+        /// DirectPeerTransportOptions.DefaultPort; pass port 0 for an ephemeral port.
+        /// </summary>
+        /// <returns>The bound endpoint</returns>
+        public IPEndPoint StartListener(IPEndPoint? localEndpoint = null)
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(DirectEventHubPeer));
+            if (_listener != null) throw new InvalidOperationException("Listener already started");
+
+            var listener = new TcpListener(localEndpoint ?? new IPEndPoint(IPAddress.Any, _options.DefaultPort));
+            listener.Start();
+            _listener = listener;
+            _ = Task.Run(() => AcceptLoopAsync(listener, _cancellationTokenSource.Token));
+
+            var bound = (IPEndPoint)listener.LocalEndpoint;
+            _logger.LogInformation("DirectEventHubPeer {PeerId} listening on {Endpoint}", _peerId, bound);
+            return bound;
+        }
+
         /// <summary>
         /// Autonomous peering negotiation with target agent.
         /// Establishes direct consciousness communication channel.
@@ -201,17 +243,16 @@ namespace CxLanguage.Runtime.DirectPeering
             if (evt == null) throw new ArgumentNullException(nameof(evt));
             if (!_isConnected) throw new InvalidOperationException("Peer not connected");
 
-            var transmissionStart = DateTime.UtcNow;
+            var channel = SelectChannel(evt.Target)
+                ?? throw new InvalidOperationException("Peer not connected");
+
+            using var activity = CxDiagnostics.ActivitySource.StartActivity("cx.peering.send", System.Diagnostics.ActivityKind.Client);
+            activity?.SetTag(CxDiagnostics.PeerTag, channel.RemoteAgentId);
 
             try
             {
-                // Prepare consciousness event for transmission
-                var serializedEvent = await SerializeConsciousnessEventAsync(evt);
-                
-                // Neural-speed transmission (target < 1ms)
-                await TransmitEventAsync(serializedEvent);
-                
-                var latency = DateTime.UtcNow - transmissionStart;
+                // Round trip from queueing to the peer's acknowledgement, including any batching delay
+                var latency = await channel.SendAsync(evt, _cancellationTokenSource.Token);
                 _metrics.RecordTransmissionLatency(latency);
 
                 // Log performance achievement
@@ -230,6 +271,7 @@ namespace CxLanguage.Runtime.DirectPeering
             }
             catch (Exception ex)
             {
+                activity?.SetStatus(System.Diagnostics.ActivityStatusCode.Error, ex.Message);
                 _logger.LogError(ex, "Error sending consciousness event: {EventId}", evt.EventId);
                 throw;
             }
@@ -252,7 +294,16 @@ namespace CxLanguage.Runtime.DirectPeering
             }
 
             // Wait for incoming event with consciousness awareness
-            var receivedEvent = await WaitForIncomingEventAsync(_cancellationTokenSource.Token);
+            ConsciousnessEvent? receivedEvent;
+            using (var timeoutCts = CancellationTokenSource.CreateLinkedTokenSource(_cancellationTokenSource.Token))
+            {
+                timeoutCts.CancelAfter(TimeSpan.FromSeconds(30)); // 30 second timeout
+                do
+                {
+                    await _inboundSignal.WaitAsync(timeoutCts.Token);
+                }
+                while (!_inboundQueue.TryDequeue(out receivedEvent));
+            }
             _metrics.RecordEventReceived();
 
             _logger.LogDebug("Consciousness event received: {EventId} from peer {PeerId}",
@@ -303,26 +354,25 @@ namespace CxLanguage.Runtime.DirectPeering
 
         #region Private Implementation Methods
 
-        private async Task<AgentDiscoveryResult> DiscoverTargetAgentAsync(string targetAgentId)
+        private Task<AgentDiscoveryResult> DiscoverTargetAgentAsync(string targetAgentId)
         {
-            // Implementation for autonomous agent discovery
-            // This would integrate with the agent registry and discovery service
-            await Task.Delay(10, _cancellationTokenSource.Token); // Simulated discovery latency
-            
-            return new AgentDiscoveryResult
+            // Static discovery from configuration; unknown agents are addressed by their id as host name
+            var endpoint = _options.Endpoints.TryGetValue(targetAgentId, out var configured) && !string.IsNullOrWhiteSpace(configured)
+                ? configured
+                : $"consciousness://{targetAgentId}:{_options.DefaultPort}";
+
+            return Task.FromResult(new AgentDiscoveryResult
             {
                 Success = true,
-                AgentEndpoint = $"consciousness://{targetAgentId}:8080",
+                AgentEndpoint = endpoint,
                 AgentId = targetAgentId
-            };
+            });
         }
 
-        private async Task<HandshakeResult> PerformConsciousnessHandshakeAsync(string agentEndpoint)
+        private Task<HandshakeResult> PerformConsciousnessHandshakeAsync(string agentEndpoint)
         {
-            // Implementation for consciousness-aware handshake protocol
-            await Task.Delay(5, _cancellationTokenSource.Token); // Simulated handshake latency
-            
-            return new HandshakeResult
+            // Identity and schema version are exchanged by the hello frames when the connection opens
+            return Task.FromResult(new HandshakeResult
             {
                 Success = true,
                 PeerDescriptor = new PeerDescriptor
@@ -330,26 +380,41 @@ namespace CxLanguage.Runtime.DirectPeering
                     PeerId = Guid.NewGuid().ToString("N")[..8],
                     Endpoint = agentEndpoint,
                     ConsciousnessLevel = 0.95,
-                    CompatibilityVersion = "1.0"
+                    CompatibilityVersion = PeerWireCodec.SchemaVersion.ToString()
                 }
-            };
+            });
         }
 
         private async Task<ConnectionResult> EstablishDirectConnectionAsync(PeerDescriptor peerDescriptor)
         {
-            // Implementation for direct peer connection establishment
-            await Task.Delay(5, _cancellationTokenSource.Token); // Simulated connection latency
-            
-            return new ConnectionResult
+            var connectStart = DateTime.UtcNow;
+            try
             {
-                Success = true,
-                PeerConnection = new PeerConnection
+                var channel = await ConnectAsync(peerDescriptor.Endpoint);
+                _primaryChannel = channel;
+
+                return new ConnectionResult
                 {
-                    PeerId = peerDescriptor.PeerId,
-                    Endpoint = peerDescriptor.Endpoint,
-                    EstablishedAt = DateTime.UtcNow
-                }
-            };
+                    Success = true,
+                    EstablishmentLatency = DateTime.UtcNow - connectStart,
+                    PeerConnection = new PeerConnection
+                    {
+                        PeerId = channel.RemotePeerId,
+                        Endpoint = peerDescriptor.Endpoint,
+                        EstablishedAt = DateTime.UtcNow,
+                        ProtocolVersion = PeerWireCodec.SchemaVersion.ToString()
+                    }
+                };
+            }
+            catch (Exception ex) when (ex is SocketException or IOException or TimeoutException or UriFormatException or InvalidDataException
+                || (ex is OperationCanceledException && !_cancellationTokenSource.IsCancellationRequested))
+            {
+                return new ConnectionResult
+                {
+                    Success = false,
+                    Error = $"Could not connect to {peerDescriptor.Endpoint}: {ex.Message}"
+                };
+            }
         }
 
         private async Task<ConsciousnessCompatibilityResult> ValidateConsciousnessCompatibilityAsync(PeeringRequest request)
@@ -380,62 +445,156 @@ namespace CxLanguage.Runtime.DirectPeering
 
         private async Task<ConnectionResult> AcceptAndEstablishConnectionAsync(PeeringRequest request)
         {
-            // Accept peering request and establish connection
-            await Task.Delay(3, _cancellationTokenSource.Token);
-            
+            // The requester usually dialled our listener already; otherwise connect back to its endpoint
+            var channel = _channels.Keys.FirstOrDefault(c => c.IsOpen && c.RemoteAgentId == request.SourceAgentId);
+            if (channel == null)
+            {
+                if (string.IsNullOrWhiteSpace(request.SourceEndpoint))
+                {
+                    return new ConnectionResult { Success = false, Error = "No connection from the requesting agent and no endpoint to dial" };
+                }
+
+                var dialled = await EstablishDirectConnectionAsync(new PeerDescriptor
+                {
+                    PeerId = request.SourcePeerId,
+                    Endpoint = request.SourceEndpoint
+                });
+                if (!dialled.Success || dialled.PeerConnection == null)
+                {
+                    return dialled;
+                }
+
+                dialled.PeerConnection.PeerId = request.SourcePeerId;
+                return dialled;
+            }
+
+            _primaryChannel ??= channel;
             return new ConnectionResult
             {
                 Success = true,
                 PeerConnection = new PeerConnection
                 {
                     PeerId = request.SourcePeerId,
-                    Endpoint = request.SourceEndpoint,
-                    EstablishedAt = DateTime.UtcNow
+                    Endpoint = channel.Endpoint,
+                    EstablishedAt = DateTime.UtcNow,
+                    ProtocolVersion = PeerWireCodec.SchemaVersion.ToString()
                 }
             };
         }
 
-        private async Task<byte[]> SerializeConsciousnessEventAsync(ConsciousnessEvent evt)
+        private async Task SendPriorityConsciousnessEventAsync(ConsciousnessEvent syncEvent)
         {
-            // High-performance consciousness event serialization
-            await Task.Delay(0, _cancellationTokenSource.Token); // Zero-latency serialization target
-            
-            // This would use optimized binary serialization for consciousness events
-            return System.Text.Json.JsonSerializer.SerializeToUtf8Bytes(evt);
+            // High-priority consciousness event transmission
+            await SendConsciousnessEventAsync(syncEvent);
         }
 
-        private async Task TransmitEventAsync(byte[] serializedEvent)
+        #endregion
+
+        #region Transport
+
+        private async Task<PeerChannel> ConnectAsync(string endpoint)
         {
-            // Neural-speed event transmission implementation
-            await Task.Delay(0, _cancellationTokenSource.Token); // Sub-millisecond transmission target
-            
-            // This would implement the actual peer communication protocol
-            // using optimized network communication for consciousness events
+            var uri = new Uri(endpoint.Contains("://", StringComparison.Ordinal) ? endpoint : "tcp://" + endpoint);
+            var port = uri.Port > 0 ? uri.Port : _options.DefaultPort;
+
+            var channel = await PeerChannel.ConnectAsync(
+                uri.DnsSafeHost, port, _agentId, _peerId, _options, _logger, OnChannelEvent, _cancellationTokenSource.Token);
+            RegisterChannel(channel);
+
+            _logger.LogInformation("Direct connection open: {PeerId} -> {RemoteAgent} ({RemotePeer}) at {Endpoint}",
+                _peerId, channel.RemoteAgentId, channel.RemotePeerId, channel.Endpoint);
+            return channel;
         }
 
-        private async Task<ConsciousnessEvent> WaitForIncomingEventAsync(CancellationToken cancellationToken)
+        private async Task AcceptLoopAsync(TcpListener listener, CancellationToken cancellationToken)
         {
-            // Wait for incoming consciousness event with timeout
-            using var timeoutCts = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
-            timeoutCts.CancelAfter(TimeSpan.FromSeconds(30)); // 30 second timeout
-            
-            // This would implement the actual event reception logic
-            await Task.Delay(1, timeoutCts.Token);
-            
-            return new ConsciousnessEvent
+            while (!cancellationToken.IsCancellationRequested)
             {
-                EventId = Guid.NewGuid().ToString(),
-                EventType = "test.event",
-                Timestamp = DateTime.UtcNow,
-                Source = "peer",
-                Data = new Dictionary<string, object> { ["test"] = "data" }
-            };
+                Socket socket;
+                try
+                {
+                    socket = await listener.AcceptSocketAsync(cancellationToken);
+                }
+                catch (Exception) when (cancellationToken.IsCancellationRequested || _disposed)
+                {
+                    return;
+                }
+                catch (SocketException ex)
+                {
+                    _logger.LogWarning(ex, "Accepting peer connection failed on {PeerId}", _peerId);
+                    continue;
+                }
+
+                _ = Task.Run(async () =>
+                {
+                    try
+                    {
+                        var channel = await PeerChannel.AcceptAsync(
+                            socket, _agentId, _peerId, _options, _logger, OnChannelEvent, cancellationToken);
+                        RegisterChannel(channel);
+                        _isConnected = true;
+
+                        _logger.LogInformation("Accepted direct connection: {RemoteAgent} ({RemotePeer}) -> {PeerId}",
+                            channel.RemoteAgentId, channel.RemotePeerId, _peerId);
+                    }
+                    catch (Exception ex)
+                    {
+                        socket.Dispose();
+                        if (!cancellationToken.IsCancellationRequested)
+                        {
+                            _logger.LogWarning(ex, "Peer hello exchange failed on {PeerId}", _peerId);
+                        }
+                    }
+                });
+            }
         }
 
-        private async Task SendPriorityConsciousnessEventAsync(ConsciousnessEvent syncEvent)
+        private void RegisterChannel(PeerChannel channel)
         {
-            // High-priority consciousness event transmission
-            await SendConsciousnessEventAsync(syncEvent);
+            channel.Closed += OnChannelClosed;
+            _channels[channel] = 0;
+            if (_disposed)
+            {
+                channel.Dispose();
+                return;
+            }
+            channel.Start();
+        }
+
+        private void OnChannelClosed(PeerChannel channel)
+        {
+            _channels.TryRemove(channel, out _);
+            if (ReferenceEquals(_primaryChannel, channel))
+            {
+                _primaryChannel = _channels.Keys.FirstOrDefault(c => c.IsOpen);
+            }
+            _isConnected = !_channels.IsEmpty;
+        }
+
+        private void OnChannelEvent(PeerChannel channel, ConsciousnessEvent evt)
+        {
+            _inboundQueue.Enqueue(evt);
+            _inboundSignal.Release();
+        }
+
+        /// <summary>
+        /// The connection to the event's target agent when one is open, otherwise the primary connection
+        /// </summary>
+        private PeerChannel? SelectChannel(string? targetAgentId)
+        {
+            if (!string.IsNullOrEmpty(targetAgentId))
+            {
+                foreach (var channel in _channels.Keys)
+                {
+                    if (channel.IsOpen && channel.RemoteAgentId == targetAgentId)
+                    {
+                        return channel;
+                    }
+                }
+            }
+
+            var primary = _primaryChannel;
+            return primary != null && primary.IsOpen ? primary : _channels.Keys.FirstOrDefault(c => c.IsOpen);
         }
 
         #endregion
@@ -448,11 +607,18 @@ namespace CxLanguage.Runtime.DirectPeering
 
             _logger.LogInformation("Disposing DirectEventHubPeer {PeerId}", _peerId);
 
+            _disposed = true;
             _cancellationTokenSource?.Cancel();
+            _listener?.Stop();
+            foreach (var channel in _channels.Keys)
+            {
+                channel.Dispose();
+            }
+            _channels.Clear();
+            _isConnected = false;
+
             _connectionSemaphore?.Dispose();
             _cancellationTokenSource?.Dispose();
-
-            _disposed = true;
         }
 
         #endregion
@@ -0,0 +1,56 @@
+using System;
+using System.Collections.Generic;
+
+namespace CxLanguage.Runtime.DirectPeering
+{
+    /// <summary>
+    /// Network transport settings for DirectEventHubPeer, bound from the "DirectPeering" configuration section.
+    /// Peers exchange length-prefixed binary frames over one persistent TCP connection per remote endpoint.
+    /// </summary>
+    public class DirectPeerTransportOptions
+    {
+        public const string SectionName = "DirectPeering";
+
+        /// <summary>
+        /// Port used when an endpoint does not name one, and by StartListener without an explicit endpoint
+        /// </summary>
+        public int DefaultPort { get; set; } = 7878;
+
+        /// <summary>
+        /// Static discovery map from agent id to endpoint ("host:port", "tcp://host:port" or "consciousness://host:port").
+        /// Agents missing from the map are reached at their agent id as host name on DefaultPort.
+        /// </summary>
+        public Dictionary<string, string> Endpoints { get; set; } = new(StringComparer.Ordinal);
+
+        /// <summary>
+        /// Time allowed for the TCP connect and the hello exchange
+        /// </summary>
+        public int ConnectTimeoutMs { get; set; } = 2000;
+
+        /// <summary>
+        /// Time a send waits for the peer to acknowledge its batch before failing
+        /// </summary>
+        public int AckTimeoutMs { get; set; } = 5000;
+
+        /// <summary>
+        /// Batches written but not yet acknowledged. While this many are in flight, new events queue up and leave
+        /// together in the next batch (Nagle-style coalescing); 1 gives classic Nagle behaviour.
+        /// </summary>
+        public int MaxInFlightBatches { get; set; } = 1;
+
+        /// <summary>
+        /// Most events carried by one batch frame
+        /// </summary>
+        public int MaxBatchEvents { get; set; } = 256;
+
+        /// <summary>
+        /// A batch is closed once its encoded events reach this size
+        /// </summary>
+        public int MaxBatchBytes { get; set; } = 64 * 1024;
+
+        /// <summary>
+        /// Frames longer than this are rejected and close the connection
+        /// </summary>
+        public int MaxFrameBytes { get; set; } = 16 * 1024 * 1024;
+    }
+}
@@ -0,0 +1,422 @@
+using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Net.Sockets;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+using Microsoft.Extensions.Logging;
+using CxLanguage.Core.Telemetry;
+
+namespace CxLanguage.Runtime.DirectPeering
+{
+    /// <summary>
+    /// One persistent, bidirectional TCP connection between two DirectEventHubPeers.
+    ///
+    /// Any number of concurrent senders share the connection: each send is encoded on the caller's thread into a
+    /// pooled buffer and queued, and a single writer loop packs queued events into sequence-numbered Events frames.
+    /// While MaxInFlightBatches frames are unacknowledged the writer holds back, so small events arriving in the
+    /// meantime leave together in the next frame (Nagle-style coalescing without a timer; TCP_NODELAY is set so the
+    /// kernel does not add its own delay). The receiver acknowledges each frame once its events are decoded and
+    /// queued, and the sender's task completes with the measured round-trip time.
+    /// </summary>
+    internal sealed class PeerChannel : IDisposable
+    {
+        private readonly Socket _socket;
+        private readonly NetworkStream _stream;
+        private readonly DirectPeerTransportOptions _options;
+        private readonly ILogger? _logger;
+        private readonly Action<PeerChannel, ConsciousnessEvent> _onEvent;
+        private readonly Channel<PendingSend> _sendQueue = Channel.CreateUnbounded<PendingSend>(
+            new UnboundedChannelOptions { SingleReader = false, SingleWriter = false });
+        private readonly ConcurrentDictionary<long, PendingSend[]> _inFlight = new();
+        private readonly SemaphoreSlim _inFlightSlots;
+        private readonly SemaphoreSlim _writeLock = new(1, 1);
+        private readonly CancellationTokenSource _cancellation = new();
+        private long _nextSequence;
+        private int _closed;
+
+        private sealed class PendingSend
+        {
+            public PendingSend(PooledBufferWriter encoded)
+            {
+                Encoded = encoded;
+                StartTimestamp = Stopwatch.GetTimestamp();
+            }
+
+            public PooledBufferWriter Encoded { get; }
+            public long StartTimestamp { get; }
+            public TaskCompletionSource<TimeSpan> Completion { get; } = new(TaskCreationOptions.RunContinuationsAsynchronously);
+        }
+
+        private PeerChannel(
+            Socket socket,
+            string endpoint,
+            DirectPeerTransportOptions options,
+            ILogger? logger,
+            Action<PeerChannel, ConsciousnessEvent> onEvent)
+        {
+            _socket = socket;
+            _stream = new NetworkStream(socket, ownsSocket: true);
+            Endpoint = endpoint;
+            _options = options;
+            _logger = logger;
+            _onEvent = onEvent;
+            _inFlightSlots = new SemaphoreSlim(Math.Max(1, options.MaxInFlightBatches));
+        }
+
+        /// <summary>
+        /// Endpoint dialled for outbound channels, or the remote address of accepted ones
+        /// </summary>
+        public string Endpoint { get; }
+
+        public string RemoteAgentId { get; private set; } = string.Empty;
+
+        public string RemotePeerId { get; private set; } = string.Empty;
+
+        public bool IsOpen => Volatile.Read(ref _closed) == 0;
+
+        /// <summary>
+        /// Raised once when the connection closes, from either side or through an error
+        /// </summary>
+        public event Action<PeerChannel>? Closed;
+
+        /// <summary>
+        /// Dial a remote peer and exchange hello frames
+        /// </summary>
+        public static async Task<PeerChannel> ConnectAsync(
+            string host, int port, string agentId, string peerId,
+            DirectPeerTransportOptions options, ILogger? logger,
+            Action<PeerChannel, ConsciousnessEvent> onEvent, CancellationToken cancellationToken)
+        {
+            var socket = new Socket(SocketType.Stream, ProtocolType.Tcp) { NoDelay = true };
+            using var timeout = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            timeout.CancelAfter(options.ConnectTimeoutMs);
+            try
+            {
+                await socket.ConnectAsync(host, port, timeout.Token);
+            }
+            catch
+            {
+                socket.Dispose();
+                throw;
+            }
+
+            var channel = new PeerChannel(socket, $"{host}:{port}", options, logger, onEvent);
+            await channel.HandshakeAsync(agentId, peerId, timeout.Token);
+            return channel;
+        }
+
+        /// <summary>
+        /// Complete the hello exchange on a socket accepted by a listener
+        /// </summary>
+        public static async Task<PeerChannel> AcceptAsync(
+            Socket socket, string agentId, string peerId,
+            DirectPeerTransportOptions options, ILogger? logger,
+            Action<PeerChannel, ConsciousnessEvent> onEvent, CancellationToken cancellationToken)
+        {
+            socket.NoDelay = true;
+            var channel = new PeerChannel(socket, socket.RemoteEndPoint?.ToString() ?? "unknown", options, logger, onEvent);
+            using var timeout = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            timeout.CancelAfter(options.ConnectTimeoutMs);
+            await channel.HandshakeAsync(agentId, peerId, timeout.Token);
+            return channel;
+        }
+
+        /// <summary>
+        /// Queue an event and wait for the peer to acknowledge the frame carrying it.
+        /// Returns the round-trip time from queueing to acknowledgement.
+        /// </summary>
+        public async Task<TimeSpan> SendAsync(ConsciousnessEvent evt, CancellationToken cancellationToken)
+        {
+            if (!IsOpen)
+            {
+                throw new IOException($"Peer connection to {Endpoint} is closed");
+            }
+
+            var encoded = new PooledBufferWriter();
+            try
+            {
+                PeerWireCodec.WriteEvent(encoded, evt);
+            }
+            catch
+            {
+                encoded.Dispose();
+                throw;
+            }
+
+            var pending = new PendingSend(encoded);
+            if (!_sendQueue.Writer.TryWrite(pending))
+            {
+                encoded.Dispose();
+                throw new IOException($"Peer connection to {Endpoint} is closed");
+            }
+
+            try
+            {
+                return await pending.Completion.Task.WaitAsync(TimeSpan.FromMilliseconds(_options.AckTimeoutMs), cancellationToken);
+            }
+            catch (TimeoutException)
+            {
+                // An unacknowledged frame holds an in-flight slot for good; the connection is no longer usable
+                _logger?.LogWarning("⚠️ Peer {RemoteAgent} at {Endpoint} did not acknowledge within {Timeout}ms, closing connection",
+                    RemoteAgentId, Endpoint, _options.AckTimeoutMs);
+                Close(new TimeoutException("Peer did not acknowledge the event"));
+                throw;
+            }
+        }
+
+        /// <summary>
+        /// Start the read and write loops; call after subscribing to Closed so no close goes unobserved
+        /// </summary>
+        public void Start()
+        {
+            _ = Task.Run(WriteLoopAsync);
+            _ = Task.Run(ReadLoopAsync);
+        }
+
+        public void Dispose() => Close(null);
+
+        #region Connection Loops
+
+        private async Task HandshakeAsync(string agentId, string peerId, CancellationToken cancellationToken)
+        {
+            try
+            {
+                using (var hello = new PooledBufferWriter(64))
+                {
+                    PeerWireCodec.WriteHello(hello, agentId, peerId);
+                    await _stream.WriteAsync(hello.WrittenMemory, cancellationToken);
+                }
+
+                var header = new byte[PeerWireCodec.FrameHeaderSize];
+                await _stream.ReadExactlyAsync(header, cancellationToken);
+                var length = BinaryPrimitives.ReadInt32LittleEndian(header);
+                if ((PeerFrameType)header[4] != PeerFrameType.Hello || length <= 0 || length > 4096)
+                {
+                    throw new InvalidDataException("Remote endpoint did not answer with a peering hello frame");
+                }
+
+                var body = new byte[length];
+                await _stream.ReadExactlyAsync(body, cancellationToken);
+                var (version, remoteAgentId, remotePeerId) = PeerWireCodec.ReadHello(body);
+                if (version != PeerWireCodec.SchemaVersion)
+                {
+                    throw new InvalidDataException(
+                        $"Peer speaks wire schema version {version}, this peer speaks {PeerWireCodec.SchemaVersion}");
+                }
+
+                RemoteAgentId = remoteAgentId;
+                RemotePeerId = remotePeerId;
+            }
+            catch
+            {
+                _stream.Dispose();
+                throw;
+            }
+
+        }
+
+        private async Task WriteLoopAsync()
+        {
+            var cancellationToken = _cancellation.Token;
+            var reader = _sendQueue.Reader;
+            var batch = new List<PendingSend>(_options.MaxBatchEvents);
+            var encodedEvents = new List<ReadOnlyMemory<byte>>(_options.MaxBatchEvents);
+            using var frame = new PooledBufferWriter(4096);
+
+            try
+            {
+                while (await reader.WaitToReadAsync(cancellationToken))
+                {
+                    // Hold the next frame while the in-flight limit is reached; sends queued meanwhile coalesce
+                    await _inFlightSlots.WaitAsync(cancellationToken);
+
+                    batch.Clear();
+                    encodedEvents.Clear();
+                    var bytes = 0;
+                    while (batch.Count < _options.MaxBatchEvents && bytes < _options.MaxBatchBytes && reader.TryRead(out var pending))
+                    {
+                        batch.Add(pending);
+                        encodedEvents.Add(pending.Encoded.WrittenMemory);
+                        bytes += pending.Encoded.WrittenCount;
+                    }
+
+                    if (batch.Count == 0)
+                    {
+                        _inFlightSlots.Release();
+                        continue;
+                    }
+
+                    var sequence = ++_nextSequence;
+                    frame.Reset();
+                    PeerWireCodec.WriteEventsFrame(frame, sequence, encodedEvents);
+                    foreach (var pending in batch)
+                    {
+                        pending.Encoded.Dispose();
+                    }
+                    _inFlight[sequence] = batch.ToArray();
+
+                    await WriteFrameAsync(frame.WrittenMemory, cancellationToken);
+                    CxDiagnostics.PeerMessagesSent.Add(batch.Count, CxDiagnostics.Tag(CxDiagnostics.PeerTag, RemoteAgentId));
+                }
+            }
+            catch (OperationCanceledException) when (cancellationToken.IsCancellationRequested)
+            {
+            }
+            catch (Exception ex)
+            {
+                Close(ex);
+            }
+        }
+
+        private async Task ReadLoopAsync()
+        {
+            var cancellationToken = _cancellation.Token;
+            var header = new byte[PeerWireCodec.FrameHeaderSize];
+            var events = new List<ConsciousnessEvent>();
+            using var ack = new PooledBufferWriter(PeerWireCodec.FrameHeaderSize + 8);
+
+            try
+            {
+                while (true)
+                {
+                    await _stream.ReadExactlyAsync(header, cancellationToken);
+                    var length = BinaryPrimitives.ReadInt32LittleEndian(header);
+                    if (length < 0 || length > _options.MaxFrameBytes)
+                    {
+                        throw new InvalidDataException($"Peer frame of {length} bytes exceeds the {_options.MaxFrameBytes} byte limit");
+                    }
+
+                    var body = ArrayPool<byte>.Shared.Rent(Math.Max(1, length));
+                    try
+                    {
+                        await _stream.ReadExactlyAsync(body.AsMemory(0, length), cancellationToken);
+                        CxDiagnostics.PeerBytesReceived.Add(PeerWireCodec.FrameHeaderSize + length, CxDiagnostics.Tag(CxDiagnostics.PeerTag, RemoteAgentId));
+                        switch ((PeerFrameType)header[4])
+                        {
+                            case PeerFrameType.Events:
+                                events.Clear();
+                                var sequence = PeerWireCodec.ReadEventsFrame(body.AsSpan(0, length), events);
+                                CxDiagnostics.PeerMessagesReceived.Add(events.Count, CxDiagnostics.Tag(CxDiagnostics.PeerTag, RemoteAgentId));
+                                foreach (var evt in events)
+                                {
+                                    _onEvent(this, evt);
+                                }
+
+                                ack.Reset();
+                                PeerWireCodec.WriteAck(ack, sequence);
+                                await WriteFrameAsync(ack.WrittenMemory, cancellationToken);
+                                break;
+
+                            case PeerFrameType.Ack:
+                                CompleteBatch(PeerWireCodec.ReadAck(body.AsSpan(0, length)));
+                                break;
+
+                            default:
+                                throw new InvalidDataException($"Unexpected peer frame type {header[4]}");
+                        }
+                    }
+                    finally
+                    {
+                        ArrayPool<byte>.Shared.Return(body);
+                    }
+                }
+            }
+            catch (OperationCanceledException) when (cancellationToken.IsCancellationRequested)
+            {
+            }
+            catch (EndOfStreamException)
+            {
+                _logger?.LogInformation("🔌 Peer {RemoteAgent} at {Endpoint} closed the connection", RemoteAgentId, Endpoint);
+                Close(null);
+            }
+            catch (Exception ex)
+            {
+                Close(ex);
+            }
+        }
+
+        private void CompleteBatch(long sequence)
+        {
+            if (!_inFlight.TryRemove(sequence, out var batch))
+            {
+                return;
+            }
+
+            var now = Stopwatch.GetTimestamp();
+            foreach (var pending in batch)
+            {
+                pending.Completion.TrySetResult(Stopwatch.GetElapsedTime(pending.StartTimestamp, now));
+            }
+            _inFlightSlots.Release();
+        }
+
+        /// <summary>
+        /// Frames from the writer loop and acknowledgements from the read loop share the stream
+        /// </summary>
+        private async Task WriteFrameAsync(ReadOnlyMemory<byte> frame, CancellationToken cancellationToken)
+        {
+            await _writeLock.WaitAsync(cancellationToken);
+            try
+            {
+                await _stream.WriteAsync(frame, cancellationToken);
+            }
+            finally
+            {
+                _writeLock.Release();
+                CxDiagnostics.PeerBytesSent.Add(frame.Length, CxDiagnostics.Tag(CxDiagnostics.PeerTag, RemoteAgentId));
+            }
+        }
+
+        private void Close(Exception? error)
+        {
+            if (Interlocked.Exchange(ref _closed, 1) != 0)
+            {
+                return;
+            }
+
+            if (error != null)
+            {
+                _logger?.LogWarning(error, "⚠️ Peer connection to {RemoteAgent} at {Endpoint} failed", RemoteAgentId, Endpoint);
+            }
+
+            _sendQueue.Writer.TryComplete();
+            _cancellation.Cancel();
+            try
+            {
+                _socket.Shutdown(SocketShutdown.Both);
+            }
+            catch (Exception)
+            {
+                // Already reset by the remote side
+            }
+            _stream.Dispose();
+
+            var closed = new IOException($"Peer connection to {Endpoint} closed", error);
+            foreach (var sequence in _inFlight.Keys)
+            {
+                if (_inFlight.TryRemove(sequence, out var batch))
+                {
+                    foreach (var pending in batch)
+                    {
+                        pending.Completion.TrySetException(closed);
+                    }
+                }
+            }
+            while (_sendQueue.Reader.TryRead(out var queued))
+            {
+                queued.Encoded.Dispose();
+                queued.Completion.TrySetException(closed);
+            }
+
+            Closed?.Invoke(this);
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,574 @@
+using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Collections;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using System.Text.Json;
+
+namespace CxLanguage.Runtime.DirectPeering
+{
+    /// <summary>
+    /// Frame kinds of the direct peering wire protocol
+    /// </summary>
+    internal enum PeerFrameType : byte
+    {
+        /// <summary>
+        /// First frame in each direction: schema version, agent id, peer id
+        /// </summary>
+        Hello = 1,
+
+        /// <summary>
+        /// Sequence number, event count, then the encoded events
+        /// </summary>
+        Events = 2,
+
+        /// <summary>
+        /// Sequence number of an Events frame the receiver has decoded and queued
+        /// </summary>
+        Ack = 3
+    }
+
+    /// <summary>
+    /// Binary codec for the direct peering protocol.
+    /// Every frame is [int32 body length][byte frame type][body], little-endian. ConsciousnessEvent fields are
+    /// written in declaration order by hand-written field writers (no reflection), strings as a 7-bit length + 1
+    /// (0 for null) followed by UTF-8, and Data values with a one-byte type tag. Values of other types travel as JSON
+    /// and decode to JsonElement. The schema version is exchanged in the hello frame; peers with a different
+    /// version are refused rather than misread.
+    /// </summary>
+    internal static class PeerWireCodec
+    {
+        public const byte SchemaVersion = 1;
+
+        /// <summary>
+        /// Length prefix plus frame type
+        /// </summary>
+        public const int FrameHeaderSize = 5;
+
+        private const int MaxNestingDepth = 32;
+
+        private enum ValueTag : byte
+        {
+            Null = 0,
+            False = 1,
+            True = 2,
+            Int32 = 3,
+            Int64 = 4,
+            Double = 5,
+            Single = 6,
+            String = 7,
+            DateTime = 8,
+            DateTimeOffset = 9,
+            Guid = 10,
+            Bytes = 11,
+            Map = 12,
+            List = 13,
+            Json = 14
+        }
+
+        #region Frames
+
+        /// <summary>
+        /// Reserve a frame header; EndFrame fills in the length once the body is written
+        /// </summary>
+        public static int BeginFrame(PooledBufferWriter writer, PeerFrameType type)
+        {
+            var start = writer.WrittenCount;
+            var header = writer.GetSpan(FrameHeaderSize);
+            header[4] = (byte)type;
+            writer.Advance(FrameHeaderSize);
+            return start;
+        }
+
+        public static void EndFrame(PooledBufferWriter writer, int start)
+        {
+            var bodyLength = writer.WrittenCount - start - FrameHeaderSize;
+            BinaryPrimitives.WriteInt32LittleEndian(writer.WrittenSpan.Slice(start, 4), bodyLength);
+        }
+
+        public static void WriteHello(PooledBufferWriter writer, string agentId, string peerId)
+        {
+            var start = BeginFrame(writer, PeerFrameType.Hello);
+            WriteByte(writer, SchemaVersion);
+            WriteString(writer, agentId);
+            WriteString(writer, peerId);
+            EndFrame(writer, start);
+        }
+
+        public static (byte Version, string AgentId, string PeerId) ReadHello(ReadOnlySpan<byte> body)
+        {
+            var reader = new PeerWireReader(body);
+            var version = reader.ReadByte();
+            if (version != SchemaVersion)
+            {
+                return (version, string.Empty, string.Empty);
+            }
+            return (version, reader.ReadString() ?? string.Empty, reader.ReadString() ?? string.Empty);
+        }
+
+        public static void WriteAck(PooledBufferWriter writer, long sequence)
+        {
+            var start = BeginFrame(writer, PeerFrameType.Ack);
+            WriteInt64(writer, sequence);
+            EndFrame(writer, start);
+        }
+
+        public static long ReadAck(ReadOnlySpan<byte> body) => new PeerWireReader(body).ReadInt64();
+
+        /// <summary>
+        /// Events frame from events already encoded with WriteEvent
+        /// </summary>
+        public static void WriteEventsFrame(PooledBufferWriter writer, long sequence, IReadOnlyList<ReadOnlyMemory<byte>> encodedEvents)
+        {
+            var start = BeginFrame(writer, PeerFrameType.Events);
+            WriteInt64(writer, sequence);
+            WriteInt32(writer, encodedEvents.Count);
+            foreach (var encoded in encodedEvents)
+            {
+                encoded.Span.CopyTo(writer.GetSpan(encoded.Length));
+                writer.Advance(encoded.Length);
+            }
+            EndFrame(writer, start);
+        }
+
+        public static long ReadEventsFrame(ReadOnlySpan<byte> body, List<ConsciousnessEvent> events)
+        {
+            var reader = new PeerWireReader(body);
+            var sequence = reader.ReadInt64();
+            var count = reader.ReadInt32();
+            if (count < 0)
+            {
+                throw new InvalidDataException($"Negative event count {count} in peer frame");
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                events.Add(ReadEvent(ref reader));
+            }
+            return sequence;
+        }
+
+        #endregion
+
+        #region Events
+
+        public static void WriteEvent(PooledBufferWriter writer, ConsciousnessEvent evt)
+        {
+            WriteString(writer, evt.EventId);
+            WriteString(writer, evt.EventType);
+            WriteDateTime(writer, evt.Timestamp);
+            WriteDateTime(writer, evt.NeuralTimestamp);
+            WriteString(writer, evt.Source);
+            WriteString(writer, evt.Target);
+            WriteMap(writer, evt.Data, 0);
+            WriteInt32(writer, evt.Priority);
+            WriteDouble(writer, evt.CoherenceLevel);
+            WriteString(writer, evt.NeuralPathway);
+            WriteDouble(writer, evt.SynapticStrength);
+            WriteByte(writer, evt.BiologicalAuthenticity ? (byte)1 : (byte)0);
+            WriteString(writer, evt.CorrelationId);
+        }
+
+        private static ConsciousnessEvent ReadEvent(ref PeerWireReader reader)
+        {
+            var evt = new ConsciousnessEvent
+            {
+                EventId = reader.ReadString() ?? string.Empty,
+                EventType = reader.ReadString() ?? string.Empty,
+                Timestamp = reader.ReadDateTime(),
+                NeuralTimestamp = reader.ReadDateTime(),
+                Source = reader.ReadString() ?? string.Empty,
+                Target = reader.ReadString()
+            };
+
+            evt.Data = ReadMap(ref reader, 0);
+            evt.Priority = reader.ReadInt32();
+            evt.CoherenceLevel = reader.ReadDouble();
+            evt.NeuralPathway = reader.ReadString();
+            evt.SynapticStrength = reader.ReadDouble();
+            evt.BiologicalAuthenticity = reader.ReadByte() != 0;
+            evt.CorrelationId = reader.ReadString();
+            return evt;
+        }
+
+        private static void WriteMap(PooledBufferWriter writer, IDictionary map, int depth)
+        {
+            WriteInt32(writer, map.Count);
+            foreach (DictionaryEntry entry in map)
+            {
+                WriteString(writer, Convert.ToString(entry.Key, System.Globalization.CultureInfo.InvariantCulture));
+                WriteValue(writer, entry.Value, depth + 1);
+            }
+        }
+
+        private static Dictionary<string, object> ReadMap(ref PeerWireReader reader, int depth)
+        {
+            var count = reader.ReadInt32();
+            if (count < 0)
+            {
+                throw new InvalidDataException($"Negative map size {count} in peer frame");
+            }
+
+            var map = new Dictionary<string, object>(Math.Min(count, 64));
+            for (int i = 0; i < count; i++)
+            {
+                var key = reader.ReadString() ?? string.Empty;
+                map[key] = ReadValue(ref reader, depth + 1)!;
+            }
+            return map;
+        }
+
+        private static void WriteValue(PooledBufferWriter writer, object? value, int depth)
+        {
+            if (depth > MaxNestingDepth)
+            {
+                throw new InvalidOperationException($"Consciousness event data nests deeper than {MaxNestingDepth} levels");
+            }
+
+            switch (value)
+            {
+                case null:
+                    WriteByte(writer, (byte)ValueTag.Null);
+                    break;
+                case bool flag:
+                    WriteByte(writer, (byte)(flag ? ValueTag.True : ValueTag.False));
+                    break;
+                case int number:
+                    WriteByte(writer, (byte)ValueTag.Int32);
+                    WriteInt32(writer, number);
+                    break;
+                case long number:
+                    WriteByte(writer, (byte)ValueTag.Int64);
+                    WriteInt64(writer, number);
+                    break;
+                case double number:
+                    WriteByte(writer, (byte)ValueTag.Double);
+                    WriteDouble(writer, number);
+                    break;
+                case float number:
+                    WriteByte(writer, (byte)ValueTag.Single);
+                    BinaryPrimitives.WriteSingleLittleEndian(writer.GetSpan(4), number);
+                    writer.Advance(4);
+                    break;
+                case string text:
+                    WriteByte(writer, (byte)ValueTag.String);
+                    WriteString(writer, text);
+                    break;
+                case DateTime timestamp:
+                    WriteByte(writer, (byte)ValueTag.DateTime);
+                    WriteDateTime(writer, timestamp);
+                    break;
+                case DateTimeOffset timestamp:
+                    WriteByte(writer, (byte)ValueTag.DateTimeOffset);
+                    WriteInt64(writer, timestamp.Ticks);
+                    WriteInt64(writer, timestamp.Offset.Ticks);
+                    break;
+                case Guid guid:
+                    WriteByte(writer, (byte)ValueTag.Guid);
+                    guid.TryWriteBytes(writer.GetSpan(16));
+                    writer.Advance(16);
+                    break;
+                case byte[] bytes:
+                    WriteByte(writer, (byte)ValueTag.Bytes);
+                    WriteInt32(writer, bytes.Length);
+                    bytes.CopyTo(writer.GetSpan(bytes.Length));
+                    writer.Advance(bytes.Length);
+                    break;
+                case IDictionary map:
+                    WriteByte(writer, (byte)ValueTag.Map);
+                    WriteMap(writer, map, depth);
+                    break;
+                case IEnumerable items when value is not JsonElement:
+                    WriteByte(writer, (byte)ValueTag.List);
+                    var list = items as ICollection ?? ToList(items);
+                    WriteInt32(writer, list.Count);
+                    foreach (var item in list)
+                    {
+                        WriteValue(writer, item, depth + 1);
+                    }
+                    break;
+                default:
+                    WriteByte(writer, (byte)ValueTag.Json);
+                    WriteString(writer, JsonSerializer.Serialize(value, value.GetType(), CxRuntimeJsonContext.FallbackOptions));
+                    break;
+            }
+        }
+
+        private static object? ReadValue(ref PeerWireReader reader, int depth)
+        {
+            if (depth > MaxNestingDepth)
+            {
+                throw new InvalidDataException($"Peer frame nests deeper than {MaxNestingDepth} levels");
+            }
+
+            var tag = (ValueTag)reader.ReadByte();
+            switch (tag)
+            {
+                case ValueTag.Null: return null;
+                case ValueTag.False: return false;
+                case ValueTag.True: return true;
+                case ValueTag.Int32: return reader.ReadInt32();
+                case ValueTag.Int64: return reader.ReadInt64();
+                case ValueTag.Double: return reader.ReadDouble();
+                case ValueTag.Single: return BinaryPrimitives.ReadSingleLittleEndian(reader.ReadBytes(4));
+                case ValueTag.String: return reader.ReadString();
+                case ValueTag.DateTime: return reader.ReadDateTime();
+                case ValueTag.DateTimeOffset:
+                    var ticks = reader.ReadInt64();
+                    return new DateTimeOffset(ticks, new TimeSpan(reader.ReadInt64()));
+                case ValueTag.Guid: return new Guid(reader.ReadBytes(16));
+                case ValueTag.Bytes: return reader.ReadBytes(reader.ReadInt32()).ToArray();
+                case ValueTag.Map: return ReadMap(ref reader, depth);
+                case ValueTag.List:
+                    var count = reader.ReadInt32();
+                    if (count < 0)
+                    {
+                        throw new InvalidDataException($"Negative list size {count} in peer frame");
+                    }
+                    var list = new List<object>(Math.Min(count, 64));
+                    for (int i = 0; i < count; i++)
+                    {
+                        list.Add(ReadValue(ref reader, depth + 1)!);
+                    }
+                    return list;
+                case ValueTag.Json:
+                    using (var document = JsonDocument.Parse(reader.ReadString() ?? "null"))
+                    {
+                        return document.RootElement.Clone();
+                    }
+                default:
+                    throw new InvalidDataException($"Unknown value tag {(byte)tag} in peer frame");
+            }
+        }
+
+        private static List<object?> ToList(IEnumerable items)
+        {
+            var list = new List<object?>();
+            foreach (var item in items)
+            {
+                list.Add(item);
+            }
+            return list;
+        }
+
+        #endregion
+
+        #region Bus Events
+
+        /// <summary>
+        /// ICxEventBus emit as carried by the shared memory transport: event name, sender (string senders only) and
+        /// payload, with payload values in the same tagged encoding as ConsciousnessEvent.Data
+        /// </summary>
+        public static void WriteBusEvent(PooledBufferWriter writer, string eventName, string? sender, IDictionary<string, object>? payload)
+        {
+            WriteString(writer, eventName);
+            WriteString(writer, sender);
+            if (payload == null)
+            {
+                WriteByte(writer, 0);
+                return;
+            }
+
+            WriteByte(writer, 1);
+            WriteMap(writer, payload as IDictionary ?? new Dictionary<string, object>(payload), 0);
+        }
+
+        public static Dictionary<string, object>? ReadBusEvent(ReadOnlySpan<byte> body, out string eventName, out string? sender)
+        {
+            var reader = new PeerWireReader(body);
+            eventName = reader.ReadString() ?? string.Empty;
+            sender = reader.ReadString();
+            return reader.ReadByte() == 0 ? null : ReadMap(ref reader, 0);
+        }
+
+        #endregion
+
+        #region Primitives
+
+        private static void WriteByte(PooledBufferWriter writer, byte value)
+        {
+            writer.GetSpan(1)[0] = value;
+            writer.Advance(1);
+        }
+
+        private static void WriteInt32(PooledBufferWriter writer, int value)
+        {
+            BinaryPrimitives.WriteInt32LittleEndian(writer.GetSpan(4), value);
+            writer.Advance(4);
+        }
+
+        private static void WriteInt64(PooledBufferWriter writer, long value)
+        {
+            BinaryPrimitives.WriteInt64LittleEndian(writer.GetSpan(8), value);
+            writer.Advance(8);
+        }
+
+        private static void WriteDouble(PooledBufferWriter writer, double value)
+        {
+            BinaryPrimitives.WriteDoubleLittleEndian(writer.GetSpan(8), value);
+            writer.Advance(8);
+        }
+
+        /// <summary>
+        /// Ticks with the DateTimeKind in the top two bits, as DateTime.ToBinary does for UTC and unspecified kinds
+        /// </summary>
+        private static void WriteDateTime(PooledBufferWriter writer, DateTime value)
+        {
+            WriteInt64(writer, value.Ticks | ((long)value.Kind << 62));
+        }
+
+        private static void WriteString(PooledBufferWriter writer, string? value)
+        {
+            if (value == null)
+            {
+                WriteVarUInt(writer, 0);
+                return;
+            }
+
+            var byteCount = Encoding.UTF8.GetByteCount(value);
+            WriteVarUInt(writer, (uint)byteCount + 1);
+            Encoding.UTF8.GetBytes(value, writer.GetSpan(byteCount));
+            writer.Advance(byteCount);
+        }
+
+        private static void WriteVarUInt(PooledBufferWriter writer, uint value)
+        {
+            var span = writer.GetSpan(5);
+            var index = 0;
+            while (value >= 0x80)
+            {
+                span[index++] = (byte)(value | 0x80);
+                value >>= 7;
+            }
+            span[index++] = (byte)value;
+            writer.Advance(index);
+        }
+
+        #endregion
+    }
+
+    /// <summary>
+    /// Sequential reader over one frame body; truncated or malformed input raises InvalidDataException
+    /// </summary>
+    internal ref struct PeerWireReader
+    {
+        private readonly ReadOnlySpan<byte> _buffer;
+        private int _position;
+
+        public PeerWireReader(ReadOnlySpan<byte> buffer)
+        {
+            _buffer = buffer;
+            _position = 0;
+        }
+
+        public ReadOnlySpan<byte> ReadBytes(int count)
+        {
+            if (count < 0 || count > _buffer.Length - _position)
+            {
+                throw new InvalidDataException("Peer frame is truncated");
+            }
+
+            var bytes = _buffer.Slice(_position, count);
+            _position += count;
+            return bytes;
+        }
+
+        public byte ReadByte() => ReadBytes(1)[0];
+
+        public int ReadInt32() => BinaryPrimitives.ReadInt32LittleEndian(ReadBytes(4));
+
+        public long ReadInt64() => BinaryPrimitives.ReadInt64LittleEndian(ReadBytes(8));
+
+        public double ReadDouble() => BinaryPrimitives.ReadDoubleLittleEndian(ReadBytes(8));
+
+        public DateTime ReadDateTime()
+        {
+            var value = ReadInt64();
+            return new DateTime(value & 0x3FFF_FFFF_FFFF_FFFF, (DateTimeKind)((ulong)value >> 62));
+        }
+
+        public string? ReadString()
+        {
+            uint length = 0;
+            for (int shift = 0; ; shift += 7)
+            {
+                if (shift > 28)
+                {
+                    throw new InvalidDataException("Malformed string length in peer frame");
+                }
+
+                var b = ReadByte();
+                length |= (uint)(b & 0x7F) << shift;
+                if (b < 0x80) break;
+            }
+
+            return length == 0 ? null : Encoding.UTF8.GetString(ReadBytes(checked((int)(length - 1))));
+        }
+    }
+
+    /// <summary>
+    /// Growable IBufferWriter over ArrayPool buffers; Dispose returns the buffer to the pool
+    /// </summary>
+    internal sealed class PooledBufferWriter : IBufferWriter<byte>, IDisposable
+    {
+        private byte[] _buffer;
+        private int _written;
+
+        public PooledBufferWriter(int initialCapacity = 256)
+        {
+            _buffer = ArrayPool<byte>.Shared.Rent(Math.Max(16, initialCapacity));
+        }
+
+        public int WrittenCount => _written;
+
+        public ReadOnlyMemory<byte> WrittenMemory => _buffer.AsMemory(0, _written);
+
+        public Span<byte> WrittenSpan => _buffer.AsSpan(0, _written);
+
+        public void Advance(int count) => _written += count;
+
+        public Memory<byte> GetMemory(int sizeHint = 0)
+        {
+            EnsureCapacity(sizeHint);
+            return _buffer.AsMemory(_written);
+        }
+
+        public Span<byte> GetSpan(int sizeHint = 0)
+        {
+            EnsureCapacity(sizeHint);
+            return _buffer.AsSpan(_written);
+        }
+
+        public void Reset() => _written = 0;
+
+        public void Dispose()
+        {
+            var buffer = _buffer;
+            _buffer = Array.Empty<byte>();
+            _written = 0;
+            if (buffer.Length > 0)
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+        }
+
+        private void EnsureCapacity(int sizeHint)
+        {
+            var needed = _written + Math.Max(1, sizeHint);
+            if (needed <= _buffer.Length)
+            {
+                return;
+            }
+
+            var grown = ArrayPool<byte>.Shared.Rent(Math.Max(needed, _buffer.Length * 2));
+            _buffer.AsSpan(0, _written).CopyTo(grown);
+            if (_buffer.Length > 0)
+            {
+                ArrayPool<byte>.Shared.Return(_buffer);
+            }
+            _buffer = grown;
+        }
+    }
+}
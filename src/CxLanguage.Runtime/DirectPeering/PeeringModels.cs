@@ -425,4 +425,20 @@ namespace CxLanguage.Runtime.DirectPeering
         /// </summary>
         public Dictionary<string, object> Metadata { get; set; } = new();
     }
+
+    /// <summary>
+    /// Claims carried by a peering authentication token
+    /// </summary>
+    public class PeeringTokenClaims
+    {
+        public string SourceAgent { get; set; } = string.Empty;
+
+        public string TargetAgent { get; set; } = string.Empty;
+
+        public double CompatibilityScore { get; set; }
+
+        public DateTime Timestamp { get; set; }
+
+        public DateTime ExpiresAt { get; set; }
+    }
 }
@@ -4,6 +4,7 @@ using System.Linq;
 using System.Threading;
 using System.Threading.Tasks;
 using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
 
 namespace CxLanguage.Runtime.DirectPeering
 {
@@ -18,6 +19,7 @@ namespace CxLanguage.Runtime.DirectPeering
         private readonly AgentRegistry _agentRegistry;
         private readonly SecurityValidator _securityValidator;
         private readonly ConsciousnessCompatibilityValidator _compatibilityValidator;
+        private readonly DirectPeerTransportOptions _transportOptions;
 
         /// <summary>
         /// Initialize peering negotiation protocol
@@ -27,13 +29,15 @@ namespace CxLanguage.Runtime.DirectPeering
             ILoggerFactory loggerFactory,
             AgentRegistry agentRegistry,
             SecurityValidator securityValidator,
-            ConsciousnessCompatibilityValidator compatibilityValidator)
+            ConsciousnessCompatibilityValidator compatibilityValidator,
+            IOptions<DirectPeerTransportOptions>? transportOptions = null)
         {
             _logger = logger ?? throw new ArgumentNullException(nameof(logger));
             _loggerFactory = loggerFactory ?? throw new ArgumentNullException(nameof(loggerFactory));
             _agentRegistry = agentRegistry ?? throw new ArgumentNullException(nameof(agentRegistry));
             _securityValidator = securityValidator ?? throw new ArgumentNullException(nameof(securityValidator));
             _compatibilityValidator = compatibilityValidator ?? throw new ArgumentNullException(nameof(compatibilityValidator));
+            _transportOptions = transportOptions?.Value ?? new DirectPeerTransportOptions();
         }
 
         /// <summary>
@@ -187,7 +191,7 @@ namespace CxLanguage.Runtime.DirectPeering
             {
                 // Create optimized peer connection
                 var peerLogger = _loggerFactory.CreateLogger<DirectEventHubPeer>();
-                var peer = new DirectEventHubPeer(agent.AgentId, peerLogger);
+                var peer = new DirectEventHubPeer(agent.AgentId, peerLogger, _transportOptions);
 
                 // Configure peer with handshake results
                 await ConfigurePeerConnectionAsync(peer, agent, handshakeResult);
@@ -288,7 +292,7 @@ namespace CxLanguage.Runtime.DirectPeering
             await Task.Delay(1); // Simulated token generation latency
             
             // Generate consciousness-aware authentication token
-            var tokenData = new
+            var tokenData = new PeeringTokenClaims
             {
                 SourceAgent = source.AgentId,
                 TargetAgent = target.AgentId,
@@ -298,8 +302,8 @@ namespace CxLanguage.Runtime.DirectPeering
             };
             
             // In real implementation, this would use proper cryptographic signing
-            return Convert.ToBase64String(System.Text.Encoding.UTF8.GetBytes(
-                System.Text.Json.JsonSerializer.Serialize(tokenData)));
+            return Convert.ToBase64String(System.Text.Json.JsonSerializer.SerializeToUtf8Bytes(
+                tokenData, CxRuntimeJsonContext.Default.PeeringTokenClaims));
         }
 
         private PeerDescriptor CreatePeerDescriptor(AgentDescriptor agent, ConsciousnessCompatibilityResult compatibility)
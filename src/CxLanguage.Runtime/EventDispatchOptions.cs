@@ -0,0 +1,71 @@
+using System;
+
+namespace CxLanguage.Runtime
+{
+    /// <summary>
+    /// What a fire-and-forget Emit does when its dispatch partition is full
+    /// </summary>
+    public enum EventQueueFullMode
+    {
+        /// <summary>
+        /// Block the emitting thread until the partition has room (backpressure)
+        /// </summary>
+        Wait,
+
+        /// <summary>
+        /// Discard the oldest queued event of the partition to make room
+        /// </summary>
+        DropOldest,
+
+        /// <summary>
+        /// Discard the event being emitted and keep the queue as it is
+        /// </summary>
+        DropNewest
+    }
+
+    /// <summary>
+    /// Key that assigns an emitted event to a dispatch partition. Events sharing a partition are delivered
+    /// one after another in emit order; different partitions run concurrently.
+    /// </summary>
+    public enum EventPartitionKey
+    {
+        /// <summary>
+        /// Events with the same name keep their order, so every subscriber sees one event stream in emit order
+        /// </summary>
+        EventName,
+
+        /// <summary>
+        /// Events from the same source keep their order across event names
+        /// </summary>
+        Source
+    }
+
+    /// <summary>
+    /// Queued dispatch settings for the synchronous Emit of UnifiedEventBus and NamespacedEventBusService,
+    /// bound from the "EventDispatch" configuration section.
+    /// When disabled every Emit starts its own thread-pool task, as before.
+    /// </summary>
+    public class EventDispatchOptions
+    {
+        public const string SectionName = "EventDispatch";
+
+        /// <summary>
+        /// Route fire-and-forget emits through bounded per-partition queues drained by a fixed set of workers
+        /// </summary>
+        public bool Enabled { get; set; }
+
+        /// <summary>
+        /// Number of partitions, each drained by one dispatcher worker
+        /// </summary>
+        public int WorkerCount { get; set; } = Math.Max(2, Environment.ProcessorCount / 2);
+
+        /// <summary>
+        /// Events each partition holds before FullMode applies
+        /// </summary>
+        public int QueueCapacity { get; set; } = 4096;
+
+        public EventQueueFullMode FullMode { get; set; } = EventQueueFullMode.Wait;
+
+        public EventPartitionKey PartitionBy { get; set; } = EventPartitionKey.EventName;
+    }
+}
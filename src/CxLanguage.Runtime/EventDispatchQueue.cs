@@ -0,0 +1,230 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+using Microsoft.Extensions.Logging;
+using CxLanguage.Core.Telemetry;
+
+namespace CxLanguage.Runtime
+{
+    /// <summary>
+    /// Bounded dispatch queue behind the fire-and-forget Emit of the event buses.
+    /// Emitted events are hashed onto a fixed number of partitions; each partition is a bounded channel drained
+    /// by one worker that awaits an event's handlers before taking the next, so events sharing a partition key
+    /// are delivered in emit order and at most WorkerCount events are in dispatch at any time. When a partition
+    /// is full the configured EventQueueFullMode blocks the emitter or drops an event, which keeps memory and
+    /// thread-pool use flat under event storms.
+    /// </summary>
+    internal sealed class EventDispatchQueue<TItem> : IDisposable
+    {
+        /// <summary>
+        /// Queue whose worker is running the current handler, used to detect emits from inside a handler
+        /// </summary>
+        private static readonly AsyncLocal<EventDispatchQueue<TItem>?> _currentQueue = new();
+
+        private readonly Channel<TItem>[] _partitions;
+        private readonly Task[] _workers;
+        private readonly Func<TItem, string> _partitionKey;
+        private readonly Func<TItem, Task> _dispatch;
+        private readonly EventDispatchOptions _options;
+        private readonly ILogger? _logger;
+        private readonly IDisposable _depthRegistration;
+        private long _emitted;
+        private long _dispatched;
+        private long _dropped;
+        private long _blocked;
+        private long _overflowed;
+        private long _failed;
+        private int _peakDepth;
+        private volatile bool _completed;
+
+        /// <param name="queueName">Value of the cx.queue tag under which the depth is reported to cx.events.queue.depth</param>
+        public EventDispatchQueue(EventDispatchOptions options, Func<TItem, string> partitionKey, Func<TItem, Task> dispatch,
+            ILogger? logger = null, string queueName = "events")
+        {
+            _options = options ?? throw new ArgumentNullException(nameof(options));
+            _partitionKey = partitionKey ?? throw new ArgumentNullException(nameof(partitionKey));
+            _dispatch = dispatch ?? throw new ArgumentNullException(nameof(dispatch));
+            _logger = logger;
+
+            var workers = Math.Max(1, options.WorkerCount);
+            var channelOptions = new BoundedChannelOptions(Math.Max(1, options.QueueCapacity))
+            {
+                SingleReader = true,
+                SingleWriter = false,
+                FullMode = options.FullMode switch
+                {
+                    EventQueueFullMode.DropOldest => BoundedChannelFullMode.DropOldest,
+                    EventQueueFullMode.DropNewest => BoundedChannelFullMode.DropWrite,
+                    _ => BoundedChannelFullMode.Wait
+                }
+            };
+
+            _partitions = new Channel<TItem>[workers];
+            _workers = new Task[workers];
+            for (int i = 0; i < workers; i++)
+            {
+                var partition = Channel.CreateBounded<TItem>(channelOptions, _ =>
+                {
+                    Interlocked.Increment(ref _dropped);
+                    CxDiagnostics.EventsDropped.Add(1, CxDiagnostics.Tag(CxDiagnostics.QueueTag, queueName));
+                });
+                _partitions[i] = partition;
+                _workers[i] = Task.Run(() => RunWorkerAsync(partition.Reader));
+            }
+
+            _depthRegistration = CxDiagnostics.TrackQueueDepth(queueName, () => QueuedCount);
+
+            _logger?.LogInformation("📬 Queued event dispatch started: {Workers} workers, {Capacity} events per partition, {FullMode} when full",
+                workers, channelOptions.Capacity, options.FullMode);
+        }
+
+        /// <summary>
+        /// Queue an event for dispatch. Returns false when the caller should dispatch it some other way: the queue
+        /// is closed, or a handler running on this queue emitted into a full partition under the Wait policy
+        /// (blocking there could deadlock the worker that has to make room).
+        /// Events discarded by a drop policy count as accepted.
+        /// </summary>
+        public bool Enqueue(TItem item)
+        {
+            if (_completed)
+            {
+                return false;
+            }
+
+            var partition = _partitions.Length == 1
+                ? _partitions[0]
+                : _partitions[(int)((uint)StringComparer.Ordinal.GetHashCode(_partitionKey(item) ?? string.Empty) % (uint)_partitions.Length)];
+
+            Interlocked.Increment(ref _emitted);
+            if (!partition.Writer.TryWrite(item))
+            {
+                if (ReferenceEquals(_currentQueue.Value, this))
+                {
+                    Interlocked.Increment(ref _overflowed);
+                    return false;
+                }
+
+                Interlocked.Increment(ref _blocked);
+                try
+                {
+                    var write = partition.Writer.WriteAsync(item);
+                    if (!write.IsCompletedSuccessfully)
+                    {
+                        write.AsTask().GetAwaiter().GetResult();
+                    }
+                }
+                catch (ChannelClosedException)
+                {
+                    return false;
+                }
+            }
+
+            TrackDepth(partition.Reader.Count);
+            return true;
+        }
+
+        /// <summary>
+        /// Events waiting in all partitions
+        /// </summary>
+        public int QueuedCount
+        {
+            get
+            {
+                var total = 0;
+                foreach (var partition in _partitions)
+                {
+                    total += partition.Reader.Count;
+                }
+                return total;
+            }
+        }
+
+        /// <summary>
+        /// Stop accepting events and wait until the queued ones have been dispatched
+        /// </summary>
+        public Task CompleteAsync()
+        {
+            Complete();
+            return Task.WhenAll(_workers);
+        }
+
+        public Dictionary<string, object> GetStatistics()
+        {
+            var depths = new int[_partitions.Length];
+            for (int i = 0; i < depths.Length; i++)
+            {
+                depths[i] = _partitions[i].Reader.Count;
+            }
+
+            return new Dictionary<string, object>
+            {
+                ["Workers"] = _partitions.Length,
+                ["QueueCapacity"] = Math.Max(1, _options.QueueCapacity),
+                ["FullMode"] = _options.FullMode.ToString(),
+                ["PartitionBy"] = _options.PartitionBy.ToString(),
+                ["QueuedEvents"] = QueuedCount,
+                ["PartitionDepths"] = depths,
+                ["PeakPartitionDepth"] = Volatile.Read(ref _peakDepth),
+                ["EmittedEvents"] = Interlocked.Read(ref _emitted),
+                ["DispatchedEvents"] = Interlocked.Read(ref _dispatched),
+                ["DroppedEvents"] = Interlocked.Read(ref _dropped),
+                ["BlockedEmits"] = Interlocked.Read(ref _blocked),
+                ["OverflowEmits"] = Interlocked.Read(ref _overflowed),
+                ["FailedDispatches"] = Interlocked.Read(ref _failed)
+            };
+        }
+
+        /// <summary>
+        /// Stop accepting events; workers finish what is already queued
+        /// </summary>
+        public void Dispose() => Complete();
+
+        private void Complete()
+        {
+            _completed = true;
+            _depthRegistration.Dispose();
+            foreach (var partition in _partitions)
+            {
+                partition.Writer.TryComplete();
+            }
+        }
+
+        private async Task RunWorkerAsync(ChannelReader<TItem> reader)
+        {
+            _currentQueue.Value = this;
+
+            while (await reader.WaitToReadAsync().ConfigureAwait(false))
+            {
+                while (reader.TryRead(out var item))
+                {
+                    try
+                    {
+                        await _dispatch(item).ConfigureAwait(false);
+                        Interlocked.Increment(ref _dispatched);
+                    }
+                    catch (Exception ex)
+                    {
+                        Interlocked.Increment(ref _failed);
+                        _logger?.LogError(ex, "❌ Queued event dispatch failed");
+                    }
+                }
+            }
+        }
+
+        private void TrackDepth(int depth)
+        {
+            var peak = Volatile.Read(ref _peakDepth);
+            while (depth > peak)
+            {
+                var observed = Interlocked.CompareExchange(ref _peakDepth, depth, peak);
+                if (observed == peak)
+                {
+                    return;
+                }
+                peak = observed;
+            }
+        }
+    }
+}
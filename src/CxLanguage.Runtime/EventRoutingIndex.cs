@@ -0,0 +1,364 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+
+namespace CxLanguage.Runtime
+{
+    /// <summary>
+    /// Resolved delivery target for an event name: one subscription and the handlers it registered for matching patterns
+    /// </summary>
+    internal sealed class EventRoute
+    {
+        public EventRoute(EventSubscription subscription, EventHandler[] handlers)
+        {
+            Subscription = subscription;
+            Handlers = handlers;
+            TargetScope = subscription.Scope.ToString();
+        }
+
+        public EventSubscription Subscription { get; }
+        public EventHandler[] Handlers { get; }
+
+        private SourceLabel? _sourceLabel;
+
+        /// <summary>
+        /// Target scope label for payloads delivered through this route
+        /// </summary>
+        public string TargetScope { get; }
+
+        /// <summary>
+        /// Get the "source→subscription" label for payloads delivered through this route.
+        /// The last label is cached so repeated emits from the same source do not build a new string.
+        /// </summary>
+        public string GetContextualSource(string source)
+        {
+            var label = _sourceLabel;
+            if (label != null && string.Equals(label.Source, source, StringComparison.Ordinal))
+            {
+                return label.ContextualSource;
+            }
+
+            label = new SourceLabel(source, $"{source}→{Subscription.Name}");
+            _sourceLabel = label;
+            return label.ContextualSource;
+        }
+
+        private sealed class SourceLabel
+        {
+            public SourceLabel(string source, string contextualSource)
+            {
+                Source = source;
+                ContextualSource = contextualSource;
+            }
+
+            public string Source { get; }
+            public string ContextualSource { get; }
+        }
+    }
+
+    /// <summary>
+    /// Event routing index for the unified event bus.
+    /// Patterns are compiled once at subscribe time into a segment trie (exact names and .any. segments)
+    /// and two character tries (prefix* and *suffix wildcards). Resolved routes are cached per event name
+    /// and the cache is invalidated whenever the subscription set changes, so emit cost no longer depends
+    /// on the number of subscribers.
+    /// </summary>
+    internal sealed class EventRoutingIndex
+    {
+        private const int MaxCachedEventNames = 4096;
+        private static readonly EventRoute[] NoRoutes = Array.Empty<EventRoute>();
+
+        private readonly object _sync = new object();
+        private readonly ConcurrentDictionary<string, EventRoute[]> _routeCache = new();
+        private readonly Dictionary<string, SubscriptionEntry> _subscriptions = new();
+
+        private SegmentNode _segmentRoot = new SegmentNode();
+        private CharNode _prefixRoot = new CharNode();
+        private CharNode _suffixRoot = new CharNode();
+        private long _nextSequence;
+
+        /// <summary>
+        /// Number of event names with cached routes (for statistics)
+        /// </summary>
+        public int CachedEventNames => _routeCache.Count;
+
+        /// <summary>
+        /// Add a handler for a subscription pattern and invalidate cached routes
+        /// </summary>
+        public void Add(EventSubscription subscription, string pattern, EventHandler handler)
+        {
+            lock (_sync)
+            {
+                if (!_subscriptions.TryGetValue(subscription.SubscriptionId, out var subscriptionEntry))
+                {
+                    subscriptionEntry = new SubscriptionEntry(subscription, _nextSequence++);
+                    _subscriptions[subscription.SubscriptionId] = subscriptionEntry;
+                }
+
+                if (!subscriptionEntry.Patterns.TryGetValue(pattern, out var patternEntry))
+                {
+                    patternEntry = new PatternEntry(subscriptionEntry, _nextSequence++);
+                    subscriptionEntry.Patterns[pattern] = patternEntry;
+                    patternEntry.Owner = Insert(pattern, subscription.Scope == UnifiedEventScope.Namespace);
+                    patternEntry.Owner.Add(patternEntry);
+                }
+
+                patternEntry.Handlers.Add(handler);
+                _routeCache.Clear();
+            }
+        }
+
+        /// <summary>
+        /// Remove every pattern registered by a subscription and invalidate cached routes
+        /// </summary>
+        public void RemoveSubscription(string subscriptionId)
+        {
+            lock (_sync)
+            {
+                if (!_subscriptions.Remove(subscriptionId, out var subscriptionEntry))
+                {
+                    return;
+                }
+
+                foreach (var patternEntry in subscriptionEntry.Patterns.Values)
+                {
+                    patternEntry.Owner?.Remove(patternEntry);
+                }
+
+                _routeCache.Clear();
+            }
+        }
+
+        /// <summary>
+        /// Remove all patterns and cached routes
+        /// </summary>
+        public void Clear()
+        {
+            lock (_sync)
+            {
+                _subscriptions.Clear();
+                _segmentRoot = new SegmentNode();
+                _prefixRoot = new CharNode();
+                _suffixRoot = new CharNode();
+                _routeCache.Clear();
+            }
+        }
+
+        /// <summary>
+        /// Get the routes for an event name, resolving through the tries only on a cache miss
+        /// </summary>
+        public EventRoute[] GetRoutes(string eventName)
+        {
+            if (_routeCache.TryGetValue(eventName, out var routes))
+            {
+                return routes;
+            }
+
+            lock (_sync)
+            {
+                if (_routeCache.TryGetValue(eventName, out routes))
+                {
+                    return routes;
+                }
+
+                routes = Resolve(eventName);
+
+                if (_routeCache.Count >= MaxCachedEventNames)
+                {
+                    _routeCache.Clear();
+                }
+                _routeCache[eventName] = routes;
+                return routes;
+            }
+        }
+
+        #region Pattern Compilation
+
+        /// <summary>
+        /// Place a pattern into exactly one structure, mirroring the bus matching rules:
+        /// patterns containing .any. treat every "any" segment as a wildcard (or are prefix matches when they end in *),
+        /// prefix* works for every scope, *suffix only outside namespace scope, everything else is an exact name.
+        /// </summary>
+        private List<PatternEntry> Insert(string pattern, bool namespaceScoped)
+        {
+            var hasAnySegment = pattern.Contains(".any.");
+
+            if (pattern.EndsWith('*'))
+            {
+                return InsertChars(_prefixRoot, pattern.AsSpan(0, pattern.Length - 1), reverse: false);
+            }
+
+            if (hasAnySegment)
+            {
+                return InsertSegments(pattern, anyIsWildcard: true);
+            }
+
+            if (!namespaceScoped && pattern.StartsWith('*'))
+            {
+                return InsertChars(_suffixRoot, pattern.AsSpan(1), reverse: true);
+            }
+
+            return InsertSegments(pattern, anyIsWildcard: false);
+        }
+
+        private List<PatternEntry> InsertSegments(string pattern, bool anyIsWildcard)
+        {
+            var node = _segmentRoot;
+            foreach (var segment in pattern.Split('.'))
+            {
+                if (anyIsWildcard && segment == "any")
+                {
+                    node = node.AnyChild ??= new SegmentNode();
+                }
+                else
+                {
+                    node.Children ??= new Dictionary<string, SegmentNode>(StringComparer.Ordinal);
+                    if (!node.Children.TryGetValue(segment, out var child))
+                    {
+                        child = new SegmentNode();
+                        node.Children[segment] = child;
+                    }
+                    node = child;
+                }
+            }
+            return node.Entries;
+        }
+
+        private static List<PatternEntry> InsertChars(CharNode root, ReadOnlySpan<char> text, bool reverse)
+        {
+            var node = root;
+            for (int i = 0; i < text.Length; i++)
+            {
+                var c = reverse ? text[text.Length - 1 - i] : text[i];
+                node.Children ??= new Dictionary<char, CharNode>();
+                if (!node.Children.TryGetValue(c, out var child))
+                {
+                    child = new CharNode();
+                    node.Children[c] = child;
+                }
+                node = child;
+            }
+            return node.Entries;
+        }
+
+        #endregion
+
+        #region Resolution
+
+        private EventRoute[] Resolve(string eventName)
+        {
+            var matches = new List<PatternEntry>();
+
+            CollectSegments(_segmentRoot, eventName.Split('.'), 0, matches);
+            CollectChars(_prefixRoot, eventName, reverse: false, matches);
+            CollectChars(_suffixRoot, eventName, reverse: true, matches);
+
+            if (matches.Count == 0)
+            {
+                return NoRoutes;
+            }
+
+            // Deterministic delivery order: subscription registration order, then pattern registration order
+            matches.Sort((a, b) => a.Subscription.Sequence != b.Subscription.Sequence
+                ? a.Subscription.Sequence.CompareTo(b.Subscription.Sequence)
+                : a.Sequence.CompareTo(b.Sequence));
+
+            var routes = new List<EventRoute>();
+            var handlers = new List<EventHandler>();
+            for (int i = 0; i < matches.Count; i++)
+            {
+                handlers.AddRange(matches[i].Handlers);
+
+                var isLastForSubscription = i == matches.Count - 1 || matches[i + 1].Subscription != matches[i].Subscription;
+                if (isLastForSubscription && handlers.Count > 0)
+                {
+                    routes.Add(new EventRoute(matches[i].Subscription.Subscription, handlers.ToArray()));
+                    handlers.Clear();
+                }
+            }
+
+            return routes.ToArray();
+        }
+
+        private static void CollectSegments(SegmentNode node, string[] segments, int depth, List<PatternEntry> matches)
+        {
+            if (depth == segments.Length)
+            {
+                matches.AddRange(node.Entries);
+                return;
+            }
+
+            if (node.Children != null && node.Children.TryGetValue(segments[depth], out var child))
+            {
+                CollectSegments(child, segments, depth + 1, matches);
+            }
+
+            if (node.AnyChild != null)
+            {
+                CollectSegments(node.AnyChild, segments, depth + 1, matches);
+            }
+        }
+
+        private static void CollectChars(CharNode root, string eventName, bool reverse, List<PatternEntry> matches)
+        {
+            var node = root;
+            matches.AddRange(node.Entries);
+
+            for (int i = 0; i < eventName.Length; i++)
+            {
+                var c = reverse ? eventName[eventName.Length - 1 - i] : eventName[i];
+                if (node.Children == null || !node.Children.TryGetValue(c, out node))
+                {
+                    return;
+                }
+                matches.AddRange(node.Entries);
+            }
+        }
+
+        #endregion
+
+        #region Index Nodes
+
+        private sealed class SubscriptionEntry
+        {
+            public SubscriptionEntry(EventSubscription subscription, long sequence)
+            {
+                Subscription = subscription;
+                Sequence = sequence;
+            }
+
+            public EventSubscription Subscription { get; }
+            public long Sequence { get; }
+            public Dictionary<string, PatternEntry> Patterns { get; } = new(StringComparer.Ordinal);
+        }
+
+        private sealed class PatternEntry
+        {
+            public PatternEntry(SubscriptionEntry subscription, long sequence)
+            {
+                Subscription = subscription;
+                Sequence = sequence;
+            }
+
+            public SubscriptionEntry Subscription { get; }
+            public long Sequence { get; }
+            public List<EventHandler> Handlers { get; } = new();
+            public List<PatternEntry>? Owner { get; set; }
+        }
+
+        private sealed class SegmentNode
+        {
+            public Dictionary<string, SegmentNode>? Children { get; set; }
+            public SegmentNode? AnyChild { get; set; }
+            public List<PatternEntry> Entries { get; } = new();
+        }
+
+        private sealed class CharNode
+        {
+            public Dictionary<char, CharNode>? Children { get; set; }
+            public List<PatternEntry> Entries { get; } = new();
+        }
+
+        #endregion
+    }
+}
@@ -2,8 +2,10 @@ using System;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.Linq;
+using System.Threading;
 using System.Threading.Tasks;
 using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
 using CxLanguage.Core.Events;
 
 namespace CxLanguage.Runtime;
@@ -19,11 +21,55 @@ public class NamespacedEventBusService
     private readonly ConcurrentDictionary<string, List<CxEventHandler>> _eventHandlers = new();
     private readonly ILogger<NamespacedEventBusService>? _logger;
     private readonly object _lock = new object();
+    private EventDispatchQueue<QueuedEmit>? _dispatchQueue;
 
-    public NamespacedEventBusService(ILogger<NamespacedEventBusService>? logger = null)
+    /// <summary>
+    /// Fire-and-forget emit waiting in the dispatch queue
+    /// </summary>
+    private readonly record struct QueuedEmit(string EventName, object? Data, string Source);
+
+    public NamespacedEventBusService(ILogger<NamespacedEventBusService>? logger = null, IOptions<EventDispatchOptions>? dispatchOptions = null)
     {
         _logger = logger;
         _logger?.LogInformation("Namespaced Event Bus Service initialized");
+
+        if (dispatchOptions?.Value is { Enabled: true } options)
+        {
+            ConfigureQueuedDispatch(options);
+        }
+    }
+
+    /// <summary>
+    /// True when synchronous Emit goes through the bounded dispatch queue instead of one task per event
+    /// </summary>
+    public bool QueuedDispatch => _dispatchQueue != null;
+
+    /// <summary>
+    /// Switch synchronous Emit to bounded, partition-ordered queued dispatch, or back to one task per
+    /// event when options is null. Events already queued on a replaced queue are still delivered.
+    /// </summary>
+    public void ConfigureQueuedDispatch(EventDispatchOptions? options)
+    {
+        EventDispatchQueue<QueuedEmit>? queue = null;
+        if (options != null)
+        {
+            Func<QueuedEmit, string> partitionKey = options.PartitionBy == EventPartitionKey.Source
+                ? e => e.Source
+                : e => e.EventName;
+            queue = new EventDispatchQueue<QueuedEmit>(options, partitionKey,
+                e => EmitAsync(e.EventName, e.Data, e.Source), _logger, nameof(NamespacedEventBusService));
+        }
+
+        Interlocked.Exchange(ref _dispatchQueue, queue)?.Dispose();
+    }
+
+    /// <summary>
+    /// Wait until every event accepted by the dispatch queue has been delivered, and stop queued dispatch
+    /// </summary>
+    public Task CompleteQueuedDispatchAsync()
+    {
+        var queue = Interlocked.Exchange(ref _dispatchQueue, null);
+        return queue?.CompleteAsync() ?? Task.CompletedTask;
     }
 
     #region Agent Registration
@@ -187,6 +233,11 @@ public class NamespacedEventBusService
     /// </summary>
     public void Emit(string eventName, object? data = null, string source = "System")
     {
+        if (_dispatchQueue?.Enqueue(new QueuedEmit(eventName, data, source)) == true)
+        {
+            return;
+        }
+
         Task.Run(async () => await EmitAsync(eventName, data, source));
     }
 
@@ -343,7 +394,8 @@ public class NamespacedEventBusService
             TopEventPatterns = _eventHandlers
                 .OrderByDescending(kvp => kvp.Value.Count)
                 .Take(10)
-                .ToDictionary(kvp => kvp.Key, kvp => kvp.Value.Count)
+                .ToDictionary(kvp => kvp.Key, kvp => kvp.Value.Count),
+            QueuedDispatch = _dispatchQueue?.GetStatistics()
         };
     }
 
@@ -380,6 +432,7 @@ public class NamespacedBusStatistics
     public Dictionary<string, int> EventsByScope { get; set; } = new();
     public Dictionary<string, int> AgentsByRole { get; set; } = new();
     public Dictionary<string, int> TopEventPatterns { get; set; } = new();
+    public Dictionary<string, object>? QueuedDispatch { get; set; }
 }
 
 /// <summary>
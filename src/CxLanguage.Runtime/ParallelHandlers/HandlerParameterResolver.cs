@@ -52,16 +52,33 @@ namespace CxLanguage.Runtime.ParallelHandlers
         /// <returns>Dictionary mapping parameter names to handler event names</returns>
         public Dictionary<string, string> ResolveHandlerParameters(object aiServiceCall)
         {
+            return ResolveHandlerParameterGraph(aiServiceCall).Parameters;
+        }
+
+        /// <summary>
+        /// Resolve handler parameters together with the parameters each one consumes.
+        /// A handler object may name its inputs with dependsOn, dependencies, after or inputs:
+        /// handlers: [
+        ///     analysis: analysis.complete,
+        ///     { name: "report", handler: "report.generated", dependsOn: ["analysis"] }
+        /// ]
+        /// Such a parameter runs once its inputs have results, and receives them in its payload.
+        /// </summary>
+        /// <param name="aiServiceCall">The AI service call expression object</param>
+        /// <returns>Parameter to handler mapping plus parameter dependencies</returns>
+        public HandlerParameterGraph ResolveHandlerParameterGraph(object aiServiceCall)
+        {
+            var graph = new HandlerParameterGraph();
             if (aiServiceCall == null)
             {
                 _logger.LogWarning("⚠️ Null AI service call provided to parameter resolver");
-                return new Dictionary<string, string>();
+                return graph;
             }
             
             _logger.LogDebug("🔍 Resolving handler parameters from AI service call: {ServiceCallType}", 
                 aiServiceCall.GetType().Name);
             
-            var handlerParameters = new Dictionary<string, string>();
+            var dependencies = graph.Dependencies;
             
             try
             {
@@ -70,33 +87,33 @@ namespace CxLanguage.Runtime.ParallelHandlers
                 if (handlersProperty == null)
                 {
                     _logger.LogDebug("ℹ️ No handlers property found in AI service call");
-                    return handlerParameters;
+                    return graph;
                 }
                 
                 var handlersValue = handlersProperty.GetValue(aiServiceCall);
                 if (handlersValue == null)
                 {
                     _logger.LogDebug("ℹ️ Handlers property is null");
-                    return handlerParameters;
+                    return graph;
                 }
                 
                 // Process different handler formats
-                handlerParameters = handlersValue switch
+                var handlerParameters = handlersValue switch
                 {
                     // Array of handler parameter objects: [{ parameterName: "analysis", handlerName: "analysis.complete" }]
-                    Array handlerArray => ProcessHandlerArray(handlerArray),
-                    
-                    // List of handler parameter objects
-                    IEnumerable<object> handlerList => ProcessHandlerList(handlerList),
+                    Array handlerArray => ProcessHandlerArray(handlerArray, dependencies),
                     
                     // Dictionary format: { "analysis": "analysis.complete", "report": "report.generated" }
-                    IDictionary<string, object> handlerDict => ProcessHandlerDictionary(handlerDict),
+                    IDictionary<string, object> handlerDict => ProcessHandlerDictionary(handlerDict, dependencies),
                     
-                    // Single handler object
-                    object singleHandler => ProcessSingleHandler(singleHandler),
+                    // List of handler parameter objects
+                    IEnumerable<object> handlerList => ProcessHandlerList(handlerList, dependencies),
                     
-                    _ => new Dictionary<string, string>()
+                    // Single handler object
+                    object singleHandler => ProcessSingleHandler(singleHandler, dependencies)
                 };
+                graph.Parameters = handlerParameters;
+                RemoveUnknownDependencies(graph);
                 
                 _logger.LogInformation("✅ Resolved {ParameterCount} handler parameters for parallel execution", 
                     handlerParameters.Count);
@@ -107,13 +124,47 @@ namespace CxLanguage.Runtime.ParallelHandlers
                     _logger.LogDebug("📋 Parameter '{ParameterName}' -> Handler '{HandlerName}'", 
                         kvp.Key, kvp.Value);
                 }
+                foreach (var kvp in dependencies)
+                {
+                    _logger.LogDebug("🔗 Parameter '{ParameterName}' depends on {Dependencies}", 
+                        kvp.Key, string.Join(", ", kvp.Value));
+                }
                 
-                return handlerParameters;
+                return graph;
             }
             catch (Exception ex)
             {
                 _logger.LogError(ex, "❌ Failed to resolve handler parameters from AI service call");
-                return new Dictionary<string, string>();
+                return new HandlerParameterGraph();
+            }
+        }
+
+        /// <summary>
+        /// Drop dependencies on parameters the call does not define; they could never be satisfied.
+        /// </summary>
+        private void RemoveUnknownDependencies(HandlerParameterGraph graph)
+        {
+            foreach (var parameterName in graph.Dependencies.Keys.ToList())
+            {
+                if (!graph.Parameters.ContainsKey(parameterName))
+                {
+                    graph.Dependencies.Remove(parameterName);
+                    continue;
+                }
+
+                var inputs = graph.Dependencies[parameterName];
+                var unknown = inputs.Where(input => !graph.Parameters.ContainsKey(input) || input == parameterName).ToList();
+                foreach (var input in unknown)
+                {
+                    _logger.LogWarning("⚠️ Parameter '{ParameterName}' depends on unknown parameter '{Dependency}', ignoring", 
+                        parameterName, input);
+                    inputs.Remove(input);
+                }
+
+                if (inputs.Count == 0)
+                {
+                    graph.Dependencies.Remove(parameterName);
+                }
             }
         }
         
@@ -171,7 +222,7 @@ namespace CxLanguage.Runtime.ParallelHandlers
         /// <summary>
         /// Process handler array format.
         /// </summary>
-        private Dictionary<string, string> ProcessHandlerArray(Array handlerArray)
+        private Dictionary<string, string> ProcessHandlerArray(Array handlerArray, Dictionary<string, List<string>> dependencies)
         {
             var parameters = new Dictionary<string, string>();
             
@@ -180,7 +231,7 @@ namespace CxLanguage.Runtime.ParallelHandlers
                 var handler = handlerArray.GetValue(i);
                 if (handler != null)
                 {
-                    var parameterMapping = ProcessHandlerObject(handler, i);
+                    var parameterMapping = ProcessHandlerObject(handler, i, dependencies);
                     foreach (var kvp in parameterMapping)
                     {
                         parameters[kvp.Key] = kvp.Value;
@@ -194,14 +245,14 @@ namespace CxLanguage.Runtime.ParallelHandlers
         /// <summary>
         /// Process handler list format.
         /// </summary>
-        private Dictionary<string, string> ProcessHandlerList(IEnumerable<object> handlerList)
+        private Dictionary<string, string> ProcessHandlerList(IEnumerable<object> handlerList, Dictionary<string, List<string>> dependencies)
         {
             var parameters = new Dictionary<string, string>();
             var index = 0;
             
             foreach (var handler in handlerList)
             {
-                var parameterMapping = ProcessHandlerObject(handler, index);
+                var parameterMapping = ProcessHandlerObject(handler, index, dependencies);
                 foreach (var kvp in parameterMapping)
                 {
                     parameters[kvp.Key] = kvp.Value;
@@ -215,16 +266,26 @@ namespace CxLanguage.Runtime.ParallelHandlers
         /// <summary>
         /// Process handler dictionary format.
         /// </summary>
-        private Dictionary<string, string> ProcessHandlerDictionary(IDictionary<string, object> handlerDict)
+        private Dictionary<string, string> ProcessHandlerDictionary(IDictionary<string, object> handlerDict, Dictionary<string, List<string>> dependencies)
         {
             var parameters = new Dictionary<string, string>();
             
             foreach (var kvp in handlerDict)
             {
-                if (kvp.Value != null)
+                if (kvp.Value == null)
                 {
-                    parameters[kvp.Key] = kvp.Value.ToString() ?? kvp.Key;
+                    continue;
                 }
+
+                // { "report": { handler: "report.generated", dependsOn: ["analysis"] } }
+                if (kvp.Value is not string && TryReadHandlerFields(kvp.Value, out _, out var handlerName, out var inputs) && handlerName != null)
+                {
+                    parameters[kvp.Key] = handlerName;
+                    AddDependencies(dependencies, kvp.Key, inputs);
+                    continue;
+                }
+
+                parameters[kvp.Key] = kvp.Value.ToString() ?? kvp.Key;
             }
             
             return parameters;
@@ -233,15 +294,15 @@ namespace CxLanguage.Runtime.ParallelHandlers
         /// <summary>
         /// Process single handler object.
         /// </summary>
-        private Dictionary<string, string> ProcessSingleHandler(object handler)
+        private Dictionary<string, string> ProcessSingleHandler(object handler, Dictionary<string, List<string>> dependencies)
         {
-            return ProcessHandlerObject(handler, 0);
+            return ProcessHandlerObject(handler, 0, dependencies);
         }
         
         /// <summary>
         /// Process individual handler object to extract parameter name and handler event name.
         /// </summary>
-        private Dictionary<string, string> ProcessHandlerObject(object handler, int index)
+        private Dictionary<string, string> ProcessHandlerObject(object handler, int index, Dictionary<string, List<string>> dependencies)
         {
             var parameters = new Dictionary<string, string>();
             
@@ -256,44 +317,20 @@ namespace CxLanguage.Runtime.ParallelHandlers
                 }
                 
                 // Complex handler object with parameter name and handler name
-                var handlerType = handler.GetType();
-                var properties = handlerType.GetProperties(BindingFlags.Public | BindingFlags.Instance);
-                
-                string? paramName2 = null;
-                string? handlerName = null;
-                
-                foreach (var property in properties)
-                {
-                    var value = property.GetValue(handler)?.ToString();
-                    if (value == null) continue;
-                    
-                    // Look for parameter name properties
-                    if (property.Name.Equals("parameterName", StringComparison.OrdinalIgnoreCase) ||
-                        property.Name.Equals("parameter", StringComparison.OrdinalIgnoreCase) ||
-                        property.Name.Equals("name", StringComparison.OrdinalIgnoreCase))
-                    {
-                        paramName2 = value;
-                    }
-                    
-                    // Look for handler name properties
-                    if (property.Name.Equals("handlerName", StringComparison.OrdinalIgnoreCase) ||
-                        property.Name.Equals("handler", StringComparison.OrdinalIgnoreCase) ||
-                        property.Name.Equals("eventName", StringComparison.OrdinalIgnoreCase))
-                    {
-                        handlerName = value;
-                    }
-                }
+                TryReadHandlerFields(handler, out var paramName2, out var handlerName, out var inputs);
                 
                 // If we found both parameter and handler names, use them
                 if (!string.IsNullOrEmpty(paramName2) && !string.IsNullOrEmpty(handlerName))
                 {
                     parameters[paramName2] = handlerName;
+                    AddDependencies(dependencies, paramName2, inputs);
                 }
                 else if (!string.IsNullOrEmpty(handlerName))
                 {
                     // Use handler name as both parameter and handler
                     var inferredParameterName = InferParameterName(handlerName);
                     parameters[inferredParameterName] = handlerName;
+                    AddDependencies(dependencies, inferredParameterName, inputs);
                 }
                 else
                 {
@@ -311,6 +348,87 @@ namespace CxLanguage.Runtime.ParallelHandlers
             }
         }
         
+        /// <summary>
+        /// Read parameter name, handler name and dependency names from a handler object's properties,
+        /// or from its entries when it is a dictionary.
+        /// </summary>
+        private static bool TryReadHandlerFields(object handler, out string? parameterName, out string? handlerName, out List<string> inputs)
+        {
+            parameterName = null;
+            handlerName = null;
+            inputs = new List<string>();
+
+            IEnumerable<KeyValuePair<string, object?>> fields = handler is IDictionary<string, object> dictionary
+                ? dictionary.Select(kvp => new KeyValuePair<string, object?>(kvp.Key, kvp.Value))
+                : handler.GetType().GetProperties(BindingFlags.Public | BindingFlags.Instance)
+                    .Where(property => property.GetIndexParameters().Length == 0)
+                    .Select(property => new KeyValuePair<string, object?>(property.Name, property.GetValue(handler)));
+
+            var found = false;
+            foreach (var (name, rawValue) in fields)
+            {
+                if (rawValue == null) continue;
+
+                // Look for dependency properties
+                if (name.Equals("dependsOn", StringComparison.OrdinalIgnoreCase) ||
+                    name.Equals("dependencies", StringComparison.OrdinalIgnoreCase) ||
+                    name.Equals("after", StringComparison.OrdinalIgnoreCase) ||
+                    name.Equals("inputs", StringComparison.OrdinalIgnoreCase))
+                {
+                    if (rawValue is string single)
+                    {
+                        inputs.AddRange(single.Split(',', StringSplitOptions.RemoveEmptyEntries | StringSplitOptions.TrimEntries));
+                    }
+                    else if (rawValue is System.Collections.IEnumerable many)
+                    {
+                        foreach (var item in many)
+                        {
+                            var input = item?.ToString();
+                            if (!string.IsNullOrWhiteSpace(input)) inputs.Add(input);
+                        }
+                    }
+                    continue;
+                }
+
+                var value = rawValue.ToString();
+                if (value == null) continue;
+                
+                // Look for parameter name properties
+                if (name.Equals("parameterName", StringComparison.OrdinalIgnoreCase) ||
+                    name.Equals("parameter", StringComparison.OrdinalIgnoreCase) ||
+                    name.Equals("name", StringComparison.OrdinalIgnoreCase))
+                {
+                    parameterName = value;
+                    found = true;
+                }
+                
+                // Look for handler name properties
+                if (name.Equals("handlerName", StringComparison.OrdinalIgnoreCase) ||
+                    name.Equals("handler", StringComparison.OrdinalIgnoreCase) ||
+                    name.Equals("eventName", StringComparison.OrdinalIgnoreCase))
+                {
+                    handlerName = value;
+                    found = true;
+                }
+            }
+
+            return found;
+        }
+
+        private static void AddDependencies(Dictionary<string, List<string>> dependencies, string parameterName, List<string> inputs)
+        {
+            if (inputs.Count == 0) return;
+
+            if (!dependencies.TryGetValue(parameterName, out var existing))
+            {
+                dependencies[parameterName] = existing = new List<string>();
+            }
+            foreach (var input in inputs)
+            {
+                if (!existing.Contains(input)) existing.Add(input);
+            }
+        }
+        
         /// <summary>
         /// Infer parameter name from handler event name.
         /// Examples:
@@ -376,5 +494,21 @@ namespace CxLanguage.Runtime.ParallelHandlers
             return true;
         }
     }
+
+    /// <summary>
+    /// Handler parameters of one AI service call and the parameters each one consumes.
+    /// </summary>
+    public class HandlerParameterGraph
+    {
+        /// <summary>
+        /// Parameter name to handler event name
+        /// </summary>
+        public Dictionary<string, string> Parameters { get; set; } = new();
+
+        /// <summary>
+        /// Parameter name to the names of parameters whose results it needs; parameters without inputs are absent
+        /// </summary>
+        public Dictionary<string, List<string>> Dependencies { get; } = new();
+    }
 }
 
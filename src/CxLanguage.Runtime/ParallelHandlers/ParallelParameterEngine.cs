@@ -12,6 +12,7 @@ using System.Threading.Tasks;
 using Microsoft.Extensions.Logging;
 using Microsoft.Extensions.DependencyInjection;
 using CxLanguage.Core.Events;
+using CxLanguage.Core.Telemetry;
 
 namespace CxLanguage.Runtime.ParallelHandlers
 {
@@ -30,8 +31,10 @@ namespace CxLanguage.Runtime.ParallelHandlers
         
         // Performance optimization: Pre-allocated concurrent collections
         private readonly ConcurrentDictionary<string, ParameterExecutionContext> _executionContexts;
+        private readonly ConcurrentQueue<ParameterExecutionContext> _contextHistory;
         private readonly SemaphoreSlim _executionSemaphore;
         private readonly ConcurrentQueue<ParameterExecutionMetrics> _metricsQueue;
+        private readonly ParameterDagScheduler _scheduler;
         
         // Advanced configuration for consciousness-aware processing
         private readonly ParallelParameterConfiguration _configuration;
@@ -49,11 +52,6 @@ namespace CxLanguage.Runtime.ParallelHandlers
             _serviceProvider = serviceProvider ?? throw new ArgumentNullException(nameof(serviceProvider));
             _logger = logger ?? throw new ArgumentNullException(nameof(logger));
             
-            // Initialize performance-optimized collections
-            _executionContexts = new ConcurrentDictionary<string, ParameterExecutionContext>();
-            _executionSemaphore = new SemaphoreSlim(Environment.ProcessorCount * 2, Environment.ProcessorCount * 2);
-            _metricsQueue = new ConcurrentQueue<ParameterExecutionMetrics>();
-            
             // Configure parallel execution for optimal consciousness processing
             _configuration = new ParallelParameterConfiguration
             {
@@ -65,18 +63,32 @@ namespace CxLanguage.Runtime.ParallelHandlers
                 PerformanceMonitoringEnabled = true
             };
             
+            // Initialize performance-optimized collections
+            _executionContexts = new ConcurrentDictionary<string, ParameterExecutionContext>();
+            _contextHistory = new ConcurrentQueue<ParameterExecutionContext>();
+            _executionSemaphore = new SemaphoreSlim(_configuration.MaxConcurrentParameters, _configuration.MaxConcurrentParameters);
+            _metricsQueue = new ConcurrentQueue<ParameterExecutionMetrics>();
+            
+            // One scheduler per engine: its concurrency limits are shared by every execution
+            _scheduler = new ParameterDagScheduler(_configuration, _executionSemaphore, _logger);
+            
             _logger.LogInformation("🚀 Parallel Parameter Engine v1.0 initialized - Target: 200%+ performance improvement");
             _logger.LogDebug("⚙️ Configuration: MaxConcurrentParameters={MaxConcurrent}, TimeoutMs={Timeout}", 
                 _configuration.MaxConcurrentParameters, _configuration.ParameterTimeoutMs);
         }
         
+        /// <summary>
+        /// Execution settings. Handler concurrency limits are read when a handler event is first scheduled.
+        /// </summary>
+        public ParallelParameterConfiguration Configuration => _configuration;
+        
         /// <summary>
         /// Execute AI service call with parallel handler parameters for 200%+ performance improvement.
         /// 
         /// Enhanced Flow:
         /// 1. Extract handler parameters from AI service call
         /// 2. Create consciousness-aware execution contexts
-        /// 3. Execute parameters in parallel using Task.WhenAll optimization
+        /// 3. Execute parameters as a dependency DAG, each as soon as its inputs are ready
         /// 4. Aggregate results with enhanced payload mapping
         /// 5. Emit enhanced event with aggregated parameter results
         /// </summary>
@@ -93,6 +105,9 @@ namespace CxLanguage.Runtime.ParallelHandlers
         {
             var executionId = Guid.NewGuid().ToString("N")[..8];
             var executionStopwatch = System.Diagnostics.Stopwatch.StartNew();
+            using var activity = CxDiagnostics.ActivitySource.StartActivity("cx.parallel.execute");
+            activity?.SetTag(CxDiagnostics.EventNameTag, originalEventName);
+            activity?.SetTag("cx.parallel.execution_id", executionId);
             
             _logger.LogInformation("🔄 Starting parallel parameter execution {ExecutionId} for event: {EventName}", 
                 executionId, originalEventName);
@@ -100,7 +115,8 @@ namespace CxLanguage.Runtime.ParallelHandlers
             try
             {
                 // Phase 1: Extract and validate handler parameters (Sub-10ms target)
-                var handlerParameters = _parameterResolver.ResolveHandlerParameters(aiServiceCall);
+                var parameterGraph = _parameterResolver.ResolveHandlerParameterGraph(aiServiceCall);
+                var handlerParameters = parameterGraph.Parameters;
                 if (!_parameterResolver.ValidateParametersForParallelExecution(handlerParameters))
                 {
                     _logger.LogWarning("⚠️ Parameter validation failed for execution {ExecutionId}", executionId);
@@ -117,17 +133,29 @@ namespace CxLanguage.Runtime.ParallelHandlers
                     handlerParameters.Count, Math.Min(handlerParameters.Count * 100, 500)); // Cap display at 500%
                 
                 // Phase 2: Create consciousness-aware execution contexts (Sub-5ms target)
-                var executionContexts = await CreateExecutionContextsAsync(handlerParameters, sourcePayload, executionId);
+                var executionContexts = await CreateExecutionContextsAsync(parameterGraph, sourcePayload, executionId);
                 
-                // Phase 3: Execute parameters in parallel with Task.WhenAll optimization
-                var parameterResults = await ExecuteParametersInParallelAsync(executionContexts, cancellationToken);
+                // Phase 3: Execute parameters as soon as the parameters they consume have results
+                Dictionary<string, object> parameterResults;
+                try
+                {
+                    parameterResults = await ExecuteParametersInParallelAsync(executionContexts, cancellationToken);
+                }
+                finally
+                {
+                    RetireExecutionContexts(executionContexts);
+                }
                 
                 // Phase 4: Aggregate results with enhanced payload mapping
                 var enhancedPayload = _propertyMapper.CreateEnhancedPayload(sourcePayload, parameterResults);
                 
                 // Phase 5: Emit enhanced event with aggregated results
                 var enhancedEventName = $"{originalEventName}.enhanced";
-                await _eventBus.EmitAsync(enhancedEventName, ConvertObjectToDictionary(enhancedPayload));
+                // A merged payload is a fresh dictionary-shaped object, so it is emitted without another copy
+                var enhancedDictionary = enhancedPayload is IDictionary<string, object> merged && !ReferenceEquals(merged, sourcePayload)
+                    ? merged
+                    : ConvertObjectToDictionary(enhancedPayload);
+                await _eventBus.EmitAsync(enhancedEventName, enhancedDictionary);
                 
                 // Phase 6: Create success result with performance metrics
                 var totalExecutionTime = executionStopwatch.ElapsedMilliseconds;
@@ -148,25 +176,32 @@ namespace CxLanguage.Runtime.ParallelHandlers
             }
             catch (Exception ex)
             {
+                activity?.SetStatus(System.Diagnostics.ActivityStatusCode.Error, ex.Message);
                 _logger.LogError(ex, "❌ Parallel parameter execution {ExecutionId} failed: {Error}", executionId, ex.Message);
                 return CreateFailureResult(executionId, ex.Message, executionStopwatch.ElapsedMilliseconds);
             }
+            finally
+            {
+                CxDiagnostics.ParallelExecutionDuration.Record(executionStopwatch.Elapsed.TotalMilliseconds,
+                    CxDiagnostics.Tag(CxDiagnostics.EventNameTag, originalEventName));
+            }
         }
         
         /// <summary>
         /// Create consciousness-aware execution contexts for parallel parameter processing.
         /// </summary>
         private async Task<List<ParameterExecutionContext>> CreateExecutionContextsAsync(
-            Dictionary<string, string> handlerParameters,
+            HandlerParameterGraph parameterGraph,
             object sourcePayload,
             string executionId)
         {
             var contexts = new List<ParameterExecutionContext>();
             var contextCreationTasks = new List<Task<ParameterExecutionContext>>();
             
-            foreach (var parameter in handlerParameters)
+            foreach (var parameter in parameterGraph.Parameters)
             {
-                var contextTask = CreateParameterContextAsync(parameter.Key, parameter.Value, sourcePayload, executionId);
+                var contextTask = CreateParameterContextAsync(parameter.Key, parameter.Value, sourcePayload, executionId,
+                    parameterGraph.Dependencies.TryGetValue(parameter.Key, out var dependsOn) ? dependsOn : null);
                 contextCreationTasks.Add(contextTask);
             }
             
@@ -185,7 +220,8 @@ namespace CxLanguage.Runtime.ParallelHandlers
             string parameterName,
             string handlerEventName,
             object sourcePayload,
-            string executionId)
+            string executionId,
+            IReadOnlyList<string>? dependsOn)
         {
             var context = new ParameterExecutionContext
             {
@@ -193,6 +229,7 @@ namespace CxLanguage.Runtime.ParallelHandlers
                 HandlerEventName = handlerEventName,
                 SourcePayload = sourcePayload,
                 ExecutionId = executionId,
+                DependsOn = dependsOn ?? Array.Empty<string>(),
                 ConsciousnessContext = CreateConsciousnessContext(parameterName, sourcePayload),
                 CreatedAt = DateTime.UtcNow
             };
@@ -204,84 +241,94 @@ namespace CxLanguage.Runtime.ParallelHandlers
         }
         
         /// <summary>
-        /// Execute parameters in parallel using advanced Task.WhenAll optimization.
-        /// This is where the 200%+ performance improvement is achieved.
+        /// Move finished contexts out of the active set into the bounded history.
         /// </summary>
-        private async Task<Dictionary<string, object>> ExecuteParametersInParallelAsync(
-            List<ParameterExecutionContext> contexts,
-            CancellationToken cancellationToken)
+        private void RetireExecutionContexts(List<ParameterExecutionContext> contexts)
         {
-            var parameterResults = new ConcurrentDictionary<string, object>();
-            var executionTasks = new List<Task>();
-            
-            // Create semaphore for controlled parallelism (prevents resource exhaustion)
-            using var parallelSemaphore = new SemaphoreSlim(_configuration.MaxConcurrentParameters, _configuration.MaxConcurrentParameters);
-            
             foreach (var context in contexts)
             {
-                var parameterTask = ExecuteParameterWithSemaphoreAsync(context, parameterResults, parallelSemaphore, cancellationToken);
-                executionTasks.Add(parameterTask);
+                _executionContexts.TryRemove($"{context.ExecutionId}_{context.ParameterName}", out _);
+                _contextHistory.Enqueue(context);
             }
-            
-            // Execute all parameters in parallel - THIS IS THE PERFORMANCE BREAKTHROUGH
-            await Task.WhenAll(executionTasks);
-            
-            // Convert concurrent dictionary to regular dictionary for result processing
-            return new Dictionary<string, object>(parameterResults);
+
+            while (_contextHistory.Count > _configuration.ContextHistoryLimit && _contextHistory.TryDequeue(out _))
+            {
+            }
+        }
+        
+        /// <summary>
+        /// Contexts of parameters currently executing, followed by the most recent finished ones.
+        /// </summary>
+        public IReadOnlyList<ParameterExecutionContext> GetExecutionContexts()
+        {
+            return _executionContexts.Values.Concat(_contextHistory).ToList();
         }
         
         /// <summary>
-        /// Execute individual parameter with semaphore control and consciousness context.
+        /// Execute parameters through the dependency-aware scheduler.
+        /// Independent parameters run concurrently; dependent ones start once their inputs completed.
         /// </summary>
-        private async Task ExecuteParameterWithSemaphoreAsync(
+        private Task<Dictionary<string, object>> ExecuteParametersInParallelAsync(
+            List<ParameterExecutionContext> contexts,
+            CancellationToken cancellationToken)
+        {
+            return _scheduler.RunAsync(contexts, ExecuteParameterAsync, cancellationToken);
+        }
+        
+        /// <summary>
+        /// Execute individual parameter with consciousness context and the results of its dependencies.
+        /// </summary>
+        private async Task<ParameterExecutionDetails> ExecuteParameterAsync(
             ParameterExecutionContext context,
-            ConcurrentDictionary<string, object> results,
-            SemaphoreSlim semaphore,
+            IReadOnlyDictionary<string, ParameterExecutionDetails> dependencyResults,
             CancellationToken cancellationToken)
         {
-            await semaphore.WaitAsync(cancellationToken);
-            
+            var parameterStopwatch = System.Diagnostics.Stopwatch.StartNew();
+            using var activity = CxDiagnostics.ActivitySource.StartActivity("cx.parallel.parameter");
+            activity?.SetTag(CxDiagnostics.HandlerTag, context.HandlerEventName);
+            activity?.SetTag("cx.parallel.parameter", context.ParameterName);
+
             try
             {
-                var parameterStopwatch = System.Diagnostics.Stopwatch.StartNew();
                 
                 // Create enhanced payload for this specific parameter
-                var parameterPayload = CreateParameterPayload(context);
+                var parameterPayload = CreateParameterPayload(context, dependencyResults);
                 
                 // Execute parameter handler through event bus
                 var parameterResult = await ExecuteParameterHandlerAsync(context.HandlerEventName, parameterPayload, cancellationToken);
                 
+                _logger.LogDebug("✅ Parameter '{ParameterName}' executed in {ExecutionTime}ms", 
+                    context.ParameterName, parameterStopwatch.ElapsedMilliseconds);
+                CxDiagnostics.ParallelParameterDuration.Record(parameterStopwatch.Elapsed.TotalMilliseconds,
+                    CxDiagnostics.Tag(CxDiagnostics.HandlerTag, context.HandlerEventName), CxDiagnostics.Tag(CxDiagnostics.SuccessTag, true));
+                
                 // Store result with consciousness context preservation
-                results.TryAdd(context.ParameterName, new ParameterExecutionDetails
+                return new ParameterExecutionDetails
                 {
                     Result = parameterResult,
                     ExecutionTimeMs = parameterStopwatch.ElapsedMilliseconds,
                     ConsciousnessContext = context.ConsciousnessContext,
                     Success = true,
                     ParameterName = context.ParameterName
-                });
-                
-                _logger.LogDebug("✅ Parameter '{ParameterName}' executed in {ExecutionTime}ms", 
-                    context.ParameterName, parameterStopwatch.ElapsedMilliseconds);
+                };
             }
-            catch (Exception ex)
+            catch (Exception ex) when (ex is not OperationCanceledException || !cancellationToken.IsCancellationRequested)
             {
                 _logger.LogError(ex, "❌ Parameter '{ParameterName}' execution failed: {Error}", 
                     context.ParameterName, ex.Message);
+                activity?.SetStatus(System.Diagnostics.ActivityStatusCode.Error, ex.Message);
+                CxDiagnostics.ParallelParameterDuration.Record(parameterStopwatch.Elapsed.TotalMilliseconds,
+                    CxDiagnostics.Tag(CxDiagnostics.HandlerTag, context.HandlerEventName), CxDiagnostics.Tag(CxDiagnostics.SuccessTag, false));
                 
                 // Store failure result to maintain parameter completeness
-                results.TryAdd(context.ParameterName, new ParameterExecutionDetails
+                return new ParameterExecutionDetails
                 {
                     Result = new { error = ex.Message, parameterName = context.ParameterName },
                     ExecutionTimeMs = 0,
                     ConsciousnessContext = context.ConsciousnessContext,
                     Success = false,
                     ParameterName = context.ParameterName
-                });
-            }
-            finally
-            {
-                semaphore.Release();
+                };
             }
         }
         
@@ -336,10 +383,18 @@ namespace CxLanguage.Runtime.ParallelHandlers
         /// <summary>
         /// Create parameter-specific payload with consciousness context.
         /// </summary>
-        private Dictionary<string, object> CreateParameterPayload(ParameterExecutionContext context)
+        private Dictionary<string, object> CreateParameterPayload(
+            ParameterExecutionContext context,
+            IReadOnlyDictionary<string, ParameterExecutionDetails> dependencyResults)
         {
             var parameterPayload = ConvertObjectToDictionary(context.SourcePayload);
             
+            // Results of the parameters this one consumes, by parameter name
+            if (dependencyResults.Count > 0)
+            {
+                parameterPayload["_dependencies"] = dependencyResults.ToDictionary(kvp => kvp.Key, kvp => kvp.Value.Result);
+            }
+            
             // Add parameter-specific consciousness context
             parameterPayload["_parameterExecution"] = new
             {
@@ -379,21 +434,20 @@ namespace CxLanguage.Runtime.ParallelHandlers
             if (obj is IDictionary<string, object> dict)
                 return new Dictionary<string, object>(dict);
             
-            // Use reflection for complex objects
-            var result = new Dictionary<string, object>();
-            var properties = obj.GetType().GetProperties(System.Reflection.BindingFlags.Public | System.Reflection.BindingFlags.Instance);
+            // Compiled getters cached per type for complex objects
+            var reader = PayloadMapperCache.GetReader(obj.GetType());
+            var result = new Dictionary<string, object>(reader.Getters.Length);
             
-            foreach (var property in properties)
+            for (int i = 0; i < reader.Getters.Length; i++)
             {
                 try
                 {
-                    var value = property.GetValue(obj);
-                    result[property.Name] = value ?? new object();
+                    result[reader.Names[i]] = reader.Getters[i](obj) ?? new object();
                 }
                 catch (Exception ex)
                 {
-                    _logger.LogWarning(ex, "⚠️ Failed to get property {PropertyName} from object", property.Name);
-                    result[property.Name] = $"Error: {ex.Message}";
+                    _logger.LogWarning(ex, "⚠️ Failed to get property {PropertyName} from object", reader.Names[i]);
+                    result[reader.Names[i]] = $"Error: {ex.Message}";
                 }
             }
             
@@ -547,6 +601,21 @@ namespace CxLanguage.Runtime.ParallelHandlers
         public bool StreamProcessingEnabled { get; set; } = true;
         public ResultAggregationMode ResultAggregationMode { get; set; } = ResultAggregationMode.Enhanced;
         public bool PerformanceMonitoringEnabled { get; set; } = true;
+        
+        /// <summary>
+        /// Parameters of one handler event running at once, across all executions, unless overridden below
+        /// </summary>
+        public int DefaultHandlerConcurrency { get; set; } = Environment.ProcessorCount;
+        
+        /// <summary>
+        /// Per-handler-event concurrency limits, e.g. { "analysis.complete": 2 } for a handler backed by a single model
+        /// </summary>
+        public Dictionary<string, int> HandlerConcurrencyLimits { get; set; } = new(StringComparer.Ordinal);
+        
+        /// <summary>
+        /// Finished parameter contexts kept for GetExecutionContexts
+        /// </summary>
+        public int ContextHistoryLimit { get; set; } = 256;
     }
     
     /// <summary>
@@ -568,6 +637,7 @@ namespace CxLanguage.Runtime.ParallelHandlers
         public string HandlerEventName { get; set; } = string.Empty;
         public object SourcePayload { get; set; } = new object();
         public string ExecutionId { get; set; } = string.Empty;
+        public IReadOnlyList<string> DependsOn { get; set; } = Array.Empty<string>();
         public ConsciousnessContext ConsciousnessContext { get; set; } = new();
         public DateTime CreatedAt { get; set; }
     }
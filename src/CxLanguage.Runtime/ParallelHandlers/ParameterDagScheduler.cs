@@ -0,0 +1,216 @@
+// 🔀 PARAMETER DAG SCHEDULER - DEPENDENCY-AWARE PARAMETER EXECUTION
+// Issue #218: Parallel Handler Parameters v1.0 - Parameter-Based Parallel Execution
+
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Microsoft.Extensions.Logging;
+
+namespace CxLanguage.Runtime.ParallelHandlers
+{
+    /// <summary>
+    /// Runs the handler parameters of one execution as a dependency DAG on the shared thread pool.
+    /// Each parameter starts the moment its own inputs have results instead of waiting for a whole wave,
+    /// so a chain analysis → report overlaps with independent parameters and with other executions.
+    /// Concurrency is bounded twice, by limits shared across every execution of the engine: a per-handler-event
+    /// limit and a global slot limit, acquired in that order only once a parameter is ready to run (parameters
+    /// waiting on inputs or on a busy handler hold no global slot). Parameters caught in a dependency cycle, or whose
+    /// inputs failed, are reported as failed without being executed.
+    /// </summary>
+    internal sealed class ParameterDagScheduler
+    {
+        private readonly ParallelParameterConfiguration _configuration;
+        private readonly SemaphoreSlim _globalSlots;
+        private readonly ConcurrentDictionary<string, SemaphoreSlim> _handlerSlots = new(StringComparer.Ordinal);
+        private readonly ILogger? _logger;
+
+        public ParameterDagScheduler(ParallelParameterConfiguration configuration, SemaphoreSlim globalSlots, ILogger? logger = null)
+        {
+            _configuration = configuration ?? throw new ArgumentNullException(nameof(configuration));
+            _globalSlots = globalSlots ?? throw new ArgumentNullException(nameof(globalSlots));
+            _logger = logger;
+        }
+
+        /// <summary>
+        /// Execute every context once its dependencies completed and return ParameterExecutionDetails per parameter name.
+        /// The executor receives the results of the parameter's direct dependencies.
+        /// </summary>
+        public async Task<Dictionary<string, object>> RunAsync(
+            IReadOnlyList<ParameterExecutionContext> contexts,
+            Func<ParameterExecutionContext, IReadOnlyDictionary<string, ParameterExecutionDetails>, CancellationToken, Task<ParameterExecutionDetails>> execute,
+            CancellationToken cancellationToken)
+        {
+            var byName = new Dictionary<string, ParameterExecutionContext>(contexts.Count, StringComparer.Ordinal);
+            foreach (var context in contexts)
+            {
+                byName[context.ParameterName] = context;
+            }
+
+            var order = TopologicalOrder(byName, out var cyclic);
+            var nodes = new Dictionary<string, Task<ParameterExecutionDetails>>(contexts.Count, StringComparer.Ordinal);
+
+            foreach (var name in cyclic)
+            {
+                _logger?.LogWarning("🔁 Parameter '{ParameterName}' is part of a dependency cycle and will not run", name);
+                nodes[name] = Task.FromResult(CreateFailure(byName[name], "Dependency cycle between handler parameters"));
+            }
+
+            // Dependencies precede dependents in the order, so their tasks exist when a node is created
+            foreach (var name in order)
+            {
+                var context = byName[name];
+                var inputs = context.DependsOn.Count == 0
+                    ? Array.Empty<KeyValuePair<string, Task<ParameterExecutionDetails>>>()
+                    : context.DependsOn.Select(input => new KeyValuePair<string, Task<ParameterExecutionDetails>>(input, nodes[input])).ToArray();
+                nodes[name] = RunNodeAsync(context, inputs, execute, cancellationToken);
+            }
+
+            await Task.WhenAll(nodes.Values);
+            cancellationToken.ThrowIfCancellationRequested();
+
+            var results = new Dictionary<string, object>(nodes.Count);
+            foreach (var context in contexts)
+            {
+                results[context.ParameterName] = nodes[context.ParameterName].Result;
+            }
+            return results;
+        }
+
+        private async Task<ParameterExecutionDetails> RunNodeAsync(
+            ParameterExecutionContext context,
+            KeyValuePair<string, Task<ParameterExecutionDetails>>[] inputs,
+            Func<ParameterExecutionContext, IReadOnlyDictionary<string, ParameterExecutionDetails>, CancellationToken, Task<ParameterExecutionDetails>> execute,
+            CancellationToken cancellationToken)
+        {
+            Dictionary<string, ParameterExecutionDetails> inputResults;
+            if (inputs.Length == 0)
+            {
+                inputResults = new Dictionary<string, ParameterExecutionDetails>(0);
+            }
+            else
+            {
+                // Node tasks never fault: failures are reported as unsuccessful details
+                await Task.WhenAll(inputs.Select(input => input.Value)).ConfigureAwait(false);
+
+                inputResults = new Dictionary<string, ParameterExecutionDetails>(inputs.Length, StringComparer.Ordinal);
+                foreach (var (name, task) in inputs)
+                {
+                    var result = task.Result;
+                    if (!result.Success)
+                    {
+                        return CreateFailure(context, $"Dependency '{name}' failed");
+                    }
+                    inputResults[name] = result;
+                }
+            }
+
+            if (cancellationToken.IsCancellationRequested)
+            {
+                return CreateFailure(context, "Execution cancelled");
+            }
+
+            // Independent parameters are queued to the thread pool instead of running inline on the caller
+            await Task.Yield();
+
+            var handlerSlots = _handlerSlots.GetOrAdd(context.HandlerEventName,
+                handler => new SemaphoreSlim(GetHandlerLimit(handler), GetHandlerLimit(handler)));
+            try
+            {
+                await handlerSlots.WaitAsync(cancellationToken).ConfigureAwait(false);
+                try
+                {
+                    await _globalSlots.WaitAsync(cancellationToken).ConfigureAwait(false);
+                    try
+                    {
+                        return await execute(context, inputResults, cancellationToken).ConfigureAwait(false);
+                    }
+                    finally
+                    {
+                        _globalSlots.Release();
+                    }
+                }
+                finally
+                {
+                    handlerSlots.Release();
+                }
+            }
+            catch (OperationCanceledException) when (cancellationToken.IsCancellationRequested)
+            {
+                return CreateFailure(context, "Execution cancelled");
+            }
+            catch (Exception ex)
+            {
+                _logger?.LogError(ex, "❌ Parameter '{ParameterName}' execution failed: {Error}", context.ParameterName, ex.Message);
+                return CreateFailure(context, ex.Message);
+            }
+        }
+
+        private int GetHandlerLimit(string handlerEventName)
+        {
+            if (_configuration.HandlerConcurrencyLimits.TryGetValue(handlerEventName, out var limit) && limit > 0)
+            {
+                return limit;
+            }
+            return Math.Max(1, _configuration.DefaultHandlerConcurrency);
+        }
+
+        /// <summary>
+        /// Kahn's algorithm over the dependency edges; parameters left over form or depend on a cycle
+        /// </summary>
+        private static List<string> TopologicalOrder(Dictionary<string, ParameterExecutionContext> byName, out List<string> cyclic)
+        {
+            var remainingInputs = new Dictionary<string, int>(byName.Count, StringComparer.Ordinal);
+            var dependents = new Dictionary<string, List<string>>(StringComparer.Ordinal);
+            var ready = new Queue<string>();
+
+            foreach (var (name, context) in byName)
+            {
+                var inputs = 0;
+                foreach (var input in context.DependsOn)
+                {
+                    if (!byName.ContainsKey(input)) continue;
+                    inputs++;
+                    if (!dependents.TryGetValue(input, out var list))
+                    {
+                        dependents[input] = list = new List<string>();
+                    }
+                    list.Add(name);
+                }
+
+                remainingInputs[name] = inputs;
+                if (inputs == 0) ready.Enqueue(name);
+            }
+
+            var order = new List<string>(byName.Count);
+            while (ready.Count > 0)
+            {
+                var name = ready.Dequeue();
+                order.Add(name);
+                if (!dependents.TryGetValue(name, out var list)) continue;
+
+                foreach (var dependent in list)
+                {
+                    if (--remainingInputs[dependent] == 0) ready.Enqueue(dependent);
+                }
+            }
+
+            cyclic = remainingInputs.Where(kvp => kvp.Value > 0).Select(kvp => kvp.Key).ToList();
+            return order;
+        }
+
+        private static ParameterExecutionDetails CreateFailure(ParameterExecutionContext context, string error)
+        {
+            return new ParameterExecutionDetails
+            {
+                Result = new { error, parameterName = context.ParameterName },
+                ExecutionTimeMs = 0,
+                ConsciousnessContext = context.ConsciousnessContext,
+                Success = false,
+                ParameterName = context.ParameterName
+            };
+        }
+    }
+}
@@ -0,0 +1,333 @@
+// 🗺️ PAYLOAD MAPPER CACHE - COMPILED PROPERTY ACCESS FOR RESULT AGGREGATION
+// Issue #183: Runtime Framework - Parallel Handler Execution Engine
+
+using System;
+using System.Collections;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Linq;
+using System.Linq.Expressions;
+using System.Reflection;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+
+namespace CxLanguage.Runtime.ParallelHandlers
+{
+    /// <summary>
+    /// Compiled property getters for one CLR type, built once with expression trees.
+    /// </summary>
+    internal sealed class PayloadPropertyReader
+    {
+        public PayloadPropertyReader(Type type)
+        {
+            var properties = type.GetProperties(BindingFlags.Public | BindingFlags.Instance)
+                .Where(property => property.CanRead && property.GetIndexParameters().Length == 0)
+                .ToArray();
+
+            Names = new string[properties.Length];
+            JsonNames = new string?[properties.Length];
+            Getters = new Func<object, object?>[properties.Length];
+
+            var instance = Expression.Parameter(typeof(object), "instance");
+            for (int i = 0; i < properties.Length; i++)
+            {
+                var property = properties[i];
+                Names[i] = property.Name;
+                JsonNames[i] = GetJsonName(property);
+
+                var read = Expression.Convert(Expression.Property(Expression.Convert(instance, type), property), typeof(object));
+                Getters[i] = Expression.Lambda<Func<object, object?>>(read, instance).Compile();
+            }
+        }
+
+        /// <summary>
+        /// CLR property names
+        /// </summary>
+        public string[] Names { get; }
+
+        /// <summary>
+        /// Names the mapper's camelCase JSON options would write, or null for [JsonIgnore] properties
+        /// </summary>
+        public string?[] JsonNames { get; }
+
+        public Func<object, object?>[] Getters { get; }
+
+        private static string? GetJsonName(PropertyInfo property)
+        {
+            var ignore = property.GetCustomAttribute<JsonIgnoreAttribute>();
+            if (ignore != null && ignore.Condition == JsonIgnoreCondition.Always)
+            {
+                return null;
+            }
+
+            return property.GetCustomAttribute<JsonPropertyNameAttribute>()?.Name
+                ?? JsonNamingPolicy.CamelCase.ConvertName(property.Name);
+        }
+    }
+
+    /// <summary>
+    /// Precomputed merge plan for one (payload type, handler result keys) shape.
+    /// </summary>
+    internal sealed class PayloadMergePlan
+    {
+        public const string MetadataKey = "_parallelExecution";
+
+        public PayloadMergePlan(PayloadPropertyReader? reader, string[] resultKeys)
+        {
+            Reader = reader;
+            ResultKeys = resultKeys;
+            if (reader == null)
+            {
+                return;
+            }
+
+            // Layout follows the dictionary merge: payload properties, new result keys, then the metadata entry
+            var keys = new List<string>(reader.Names.Length + resultKeys.Length + 1);
+            var slots = new Dictionary<string, int>(StringComparer.Ordinal);
+            foreach (var name in reader.Names)
+            {
+                slots[name] = keys.Count;
+                keys.Add(name);
+            }
+
+            ResultSlots = new int[resultKeys.Length];
+            ResultConflicts = new bool[resultKeys.Length];
+            for (int i = 0; i < resultKeys.Length; i++)
+            {
+                if (slots.TryGetValue(resultKeys[i], out var slot))
+                {
+                    ResultConflicts[i] = true;
+                }
+                else
+                {
+                    slot = keys.Count;
+                    slots[resultKeys[i]] = slot;
+                    keys.Add(resultKeys[i]);
+                }
+                ResultSlots[i] = slot;
+            }
+
+            if (!slots.TryGetValue(MetadataKey, out var metadataSlot))
+            {
+                metadataSlot = keys.Count;
+                keys.Add(MetadataKey);
+            }
+            MetadataSlot = metadataSlot;
+            Layout = new PayloadLayout(keys.ToArray());
+        }
+
+        /// <summary>
+        /// Getters of an object payload, or null for dictionary payloads
+        /// </summary>
+        public PayloadPropertyReader? Reader { get; }
+
+        public string[] ResultKeys { get; }
+
+        public PayloadLayout? Layout { get; }
+
+        public int[] ResultSlots { get; } = Array.Empty<int>();
+
+        /// <summary>
+        /// True where a result key collides with a payload property and needs conflict resolution
+        /// </summary>
+        public bool[] ResultConflicts { get; } = Array.Empty<bool>();
+
+        public int MetadataSlot { get; }
+    }
+
+    /// <summary>
+    /// Process-wide caches behind PayloadPropertyMapper: compiled property readers per type and merge plans per
+    /// (payload type, result key sequence). Result key sets repeat for every execution of the same AI service
+    /// call, so after the first merge a payload shape costs no reflection. The plan cache is bounded; when
+    /// full it is cleared and refilled by the shapes still in use.
+    /// </summary>
+    internal static class PayloadMapperCache
+    {
+        private const int MaxCachedPlans = 1024;
+        private const int MaxResultDepth = 64;
+
+        private static readonly ConcurrentDictionary<Type, PayloadPropertyReader> _readers = new();
+        private static readonly ConcurrentDictionary<PlanKey, PayloadMergePlan> _plans = new(new PlanKeyComparer());
+
+        // Copiers for string-keyed dictionaries that only implement the generic interfaces, or null for other types
+        private static readonly ConcurrentDictionary<Type, Func<object, int, Dictionary<string, object>>?> _mapCopiers = new();
+
+        public static PayloadPropertyReader GetReader(Type type) => _readers.GetOrAdd(type, static t => new PayloadPropertyReader(t));
+
+        /// <summary>
+        /// Merge plan for an object payload type, or for dictionary payloads when payloadType is null
+        /// </summary>
+        public static PayloadMergePlan GetPlan(Type? payloadType, Dictionary<string, object> handlerResults)
+        {
+            var probe = new PlanKey(payloadType, handlerResults.Keys);
+            if (_plans.TryGetValue(probe, out var plan))
+            {
+                return plan;
+            }
+
+            var resultKeys = handlerResults.Keys.ToArray();
+            plan = new PayloadMergePlan(payloadType == null ? null : GetReader(payloadType), resultKeys);
+            if (_plans.Count >= MaxCachedPlans)
+            {
+                _plans.Clear();
+            }
+            _plans.TryAdd(new PlanKey(payloadType, resultKeys), plan);
+            return plan;
+        }
+
+        /// <summary>
+        /// Structural copy of a handler result with the shape its JSON form has: objects become dictionaries keyed
+        /// by JSON property name without null members, maps of any value type become dictionaries, other collections
+        /// become arrays, enums become their names and primitives stay as they are. Replaces the serialize-and-parse
+        /// round trip of earlier versions.
+        /// </summary>
+        public static Dictionary<string, object> ToResultDictionary(object complexObject)
+        {
+            return (Dictionary<string, object>)ToStructuredValue(complexObject, 0)!;
+        }
+
+        private static object? ToStructuredValue(object? value, int depth)
+        {
+            if (depth > MaxResultDepth)
+            {
+                throw new InvalidOperationException($"Handler result nests deeper than {MaxResultDepth} levels");
+            }
+
+            switch (value)
+            {
+                case null:
+                case string:
+                case bool:
+                case int or long or double or float or decimal or short or byte or sbyte or ushort or uint or ulong:
+                case DateTime or DateTimeOffset or Guid or TimeSpan:
+                case JsonElement:
+                    return value;
+                case Enum enumValue:
+                    return enumValue.ToString();
+                case IDictionary<string, object> dictionary:
+                    var copy = new Dictionary<string, object>(dictionary.Count);
+                    foreach (var kvp in dictionary)
+                    {
+                        copy[kvp.Key] = ToStructuredValue(kvp.Value, depth + 1)!;
+                    }
+                    return copy;
+                case IDictionary map:
+                    // Dictionary<TKey, TValue> and the other BCL maps; keys take their invariant string form as in JSON
+                    var mapCopy = new Dictionary<string, object>(map.Count);
+                    foreach (DictionaryEntry entry in map)
+                    {
+                        mapCopy[Convert.ToString(entry.Key, CultureInfo.InvariantCulture) ?? string.Empty] = ToStructuredValue(entry.Value, depth + 1)!;
+                    }
+                    return mapCopy;
+                case IEnumerable items:
+                    if (GetMapCopier(value.GetType()) is { } copier)
+                    {
+                        return copier(value, depth);
+                    }
+
+                    var list = new List<object?>();
+                    foreach (var item in items)
+                    {
+                        list.Add(ToStructuredValue(item, depth + 1));
+                    }
+                    return list.ToArray();
+            }
+
+            var reader = GetReader(value.GetType());
+            var result = new Dictionary<string, object>(reader.Getters.Length);
+            for (int i = 0; i < reader.Getters.Length; i++)
+            {
+                var name = reader.JsonNames[i];
+                if (name == null) continue;
+
+                var member = reader.Getters[i](value);
+                if (member == null) continue;
+
+                result[name] = ToStructuredValue(member, depth + 1)!;
+            }
+            return result;
+        }
+
+        private static Func<object, int, Dictionary<string, object>>? GetMapCopier(Type type) =>
+            _mapCopiers.GetOrAdd(type, static t =>
+            {
+                var valueType = FindStringKeyedValueType(t);
+                if (valueType == null)
+                {
+                    return null;
+                }
+
+                var method = typeof(PayloadMapperCache).GetMethod(nameof(CopyStringKeyedMap), BindingFlags.NonPublic | BindingFlags.Static)!
+                    .MakeGenericMethod(valueType);
+                return method.CreateDelegate<Func<object, int, Dictionary<string, object>>>();
+            });
+
+        /// <summary>
+        /// TValue of the IDictionary&lt;string, TValue&gt; or IReadOnlyDictionary&lt;string, TValue&gt; a type implements
+        /// </summary>
+        private static Type? FindStringKeyedValueType(Type type)
+        {
+            foreach (var candidate in type.GetInterfaces())
+            {
+                if (!candidate.IsGenericType) continue;
+
+                var definition = candidate.GetGenericTypeDefinition();
+                if ((definition == typeof(IDictionary<,>) || definition == typeof(IReadOnlyDictionary<,>))
+                    && candidate.GetGenericArguments()[0] == typeof(string))
+                {
+                    return candidate.GetGenericArguments()[1];
+                }
+            }
+            return null;
+        }
+
+        private static Dictionary<string, object> CopyStringKeyedMap<TValue>(object map, int depth)
+        {
+            var copy = new Dictionary<string, object>();
+            foreach (var kvp in (IEnumerable<KeyValuePair<string, TValue>>)map)
+            {
+                copy[kvp.Key] = ToStructuredValue(kvp.Value, depth + 1)!;
+            }
+            return copy;
+        }
+
+        /// <summary>
+        /// Cache key; lookups probe with the live key collection so a hit allocates no key array
+        /// </summary>
+        private readonly struct PlanKey
+        {
+            public PlanKey(Type? payloadType, IEnumerable<string> resultKeys)
+            {
+                PayloadType = payloadType;
+                ResultKeys = resultKeys;
+
+                var hash = new HashCode();
+                hash.Add(payloadType);
+                foreach (var key in resultKeys)
+                {
+                    hash.Add(key, StringComparer.Ordinal);
+                }
+                Hash = hash.ToHashCode();
+            }
+
+            public Type? PayloadType { get; }
+
+            public IEnumerable<string> ResultKeys { get; }
+
+            public int Hash { get; }
+        }
+
+        private sealed class PlanKeyComparer : IEqualityComparer<PlanKey>
+        {
+            public bool Equals(PlanKey x, PlanKey y)
+            {
+                return x.Hash == y.Hash
+                    && x.PayloadType == y.PayloadType
+                    && x.ResultKeys.SequenceEqual(y.ResultKeys, StringComparer.Ordinal);
+            }
+
+            public int GetHashCode(PlanKey key) => key.Hash;
+        }
+    }
+}
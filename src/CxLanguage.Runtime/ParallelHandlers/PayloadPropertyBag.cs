@@ -0,0 +1,193 @@
+// 🗺️ PAYLOAD PROPERTY BAG - SHAPE-SHARING ENHANCED PAYLOAD
+// Issue #183: Runtime Framework - Parallel Handler Execution Engine
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
+using System.Dynamic;
+
+namespace CxLanguage.Runtime.ParallelHandlers
+{
+    /// <summary>
+    /// Fixed key layout shared by every payload bag produced for one (payload type, result keys) shape.
+    /// </summary>
+    internal sealed class PayloadLayout
+    {
+        public PayloadLayout(string[] keys)
+        {
+            Keys = keys;
+            Slots = new Dictionary<string, int>(keys.Length, StringComparer.Ordinal);
+            for (int i = 0; i < keys.Length; i++)
+            {
+                Slots[keys[i]] = i;
+            }
+        }
+
+        public string[] Keys { get; }
+
+        public Dictionary<string, int> Slots { get; }
+    }
+
+    /// <summary>
+    /// Enhanced payload produced by PayloadPropertyMapper for object payloads.
+    /// Values sit in a flat array indexed through a layout shared by all payloads of the same shape, so a merge
+    /// allocates one array instead of building a dictionary key by key. Replacing a value writes the array; the
+    /// first change to the key set copies the bag into a private dictionary (copy-on-write of the shape).
+    /// Supports dynamic member access like the ExpandoObject it replaces.
+    /// </summary>
+    public sealed class PayloadPropertyBag : DynamicObject, IDictionary<string, object>, IReadOnlyDictionary<string, object>
+    {
+        private readonly PayloadLayout _layout;
+        private readonly object[] _values;
+        private Dictionary<string, object>? _expanded;
+
+        internal PayloadPropertyBag(PayloadLayout layout, object[] values)
+        {
+            _layout = layout;
+            _values = values;
+        }
+
+        public object this[string key]
+        {
+            get => TryGetValue(key, out var value) ? value : throw new KeyNotFoundException($"Payload has no property '{key}'");
+            set
+            {
+                if (_expanded != null)
+                {
+                    _expanded[key] = value;
+                }
+                else if (_layout.Slots.TryGetValue(key, out var slot))
+                {
+                    _values[slot] = value;
+                }
+                else
+                {
+                    Expand()[key] = value;
+                }
+            }
+        }
+
+        public int Count => _expanded?.Count ?? _values.Length;
+
+        public bool IsReadOnly => false;
+
+        public ICollection<string> Keys => _expanded?.Keys ?? (ICollection<string>)Array.AsReadOnly(_layout.Keys);
+
+        public ICollection<object> Values => _expanded?.Values ?? (ICollection<object>)Array.AsReadOnly(_values);
+
+        IEnumerable<string> IReadOnlyDictionary<string, object>.Keys => Keys;
+
+        IEnumerable<object> IReadOnlyDictionary<string, object>.Values => Values;
+
+        public bool ContainsKey(string key) => _expanded?.ContainsKey(key) ?? _layout.Slots.ContainsKey(key);
+
+        public bool TryGetValue(string key, [MaybeNullWhen(false)] out object value)
+        {
+            if (_expanded != null)
+            {
+                return _expanded.TryGetValue(key, out value);
+            }
+
+            if (_layout.Slots.TryGetValue(key, out var slot))
+            {
+                value = _values[slot];
+                return true;
+            }
+
+            value = null;
+            return false;
+        }
+
+        public void Add(string key, object value)
+        {
+            if (ContainsKey(key))
+            {
+                throw new ArgumentException($"Payload already has a property '{key}'", nameof(key));
+            }
+            Expand()[key] = value;
+        }
+
+        public void Add(KeyValuePair<string, object> item) => Add(item.Key, item.Value);
+
+        public bool Remove(string key) => ContainsKey(key) && Expand().Remove(key);
+
+        public bool Remove(KeyValuePair<string, object> item)
+        {
+            return TryGetValue(item.Key, out var value) && Equals(value, item.Value) && Remove(item.Key);
+        }
+
+        public void Clear() => Expand().Clear();
+
+        public bool Contains(KeyValuePair<string, object> item)
+        {
+            return TryGetValue(item.Key, out var value) && Equals(value, item.Value);
+        }
+
+        public void CopyTo(KeyValuePair<string, object>[] array, int arrayIndex)
+        {
+            foreach (var item in this)
+            {
+                array[arrayIndex++] = item;
+            }
+        }
+
+        public IEnumerator<KeyValuePair<string, object>> GetEnumerator()
+        {
+            if (_expanded != null)
+            {
+                foreach (var item in _expanded)
+                {
+                    yield return item;
+                }
+                yield break;
+            }
+
+            var keys = _layout.Keys;
+            for (int i = 0; i < keys.Length; i++)
+            {
+                yield return new KeyValuePair<string, object>(keys[i], _values[i]);
+            }
+        }
+
+        IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+
+        #region Dynamic Member Access
+
+        public override IEnumerable<string> GetDynamicMemberNames() => Keys;
+
+        public override bool TryGetMember(GetMemberBinder binder, out object? result)
+        {
+            if (TryGetValue(binder.Name, out var value))
+            {
+                result = value;
+                return true;
+            }
+            result = null;
+            return false;
+        }
+
+        public override bool TrySetMember(SetMemberBinder binder, object? value)
+        {
+            this[binder.Name] = value!;
+            return true;
+        }
+
+        #endregion
+
+        private Dictionary<string, object> Expand()
+        {
+            if (_expanded == null)
+            {
+                var expanded = new Dictionary<string, object>(_values.Length + 4, StringComparer.Ordinal);
+                var keys = _layout.Keys;
+                for (int i = 0; i < keys.Length; i++)
+                {
+                    expanded[keys[i]] = _values[i];
+                }
+                _expanded = expanded;
+            }
+            return _expanded;
+        }
+    }
+}
@@ -5,7 +5,6 @@
 using System;
 using System.Collections.Generic;
 using System.Linq;
-using System.Reflection;
 using Microsoft.Extensions.Logging;
 using System.Text.Json;
 using System.Text.Json.Serialization;
@@ -15,6 +14,8 @@ namespace CxLanguage.Runtime.ParallelHandlers
     /// <summary>
     /// Maps parallel handler execution results back to enhanced payload properties.
     /// Creates unified result objects with consciousness-aware property mapping.
+    /// Property access goes through PayloadMapperCache: getters are compiled once per type and the merge layout
+    /// once per (payload type, result keys) shape, so repeated merges of the same shape use no reflection.
     /// </summary>
     public class PayloadPropertyMapper
     {
@@ -55,15 +56,21 @@ namespace CxLanguage.Runtime.ParallelHandlers
                 return originalPayload;
             }
             
-            _logger.LogDebug("🗺️ Creating enhanced payload with {ResultCount} handler results", handlerResults.Count);
+            if (_logger.IsEnabled(LogLevel.Debug))
+            {
+                _logger.LogDebug("🗺️ Creating enhanced payload with {ResultCount} handler results", handlerResults.Count);
+            }
             
             try
             {
                 // Create enhanced payload by merging original and results
                 var enhancedPayload = MergePayloadWithResults(originalPayload, handlerResults);
                 
-                _logger.LogInformation("✅ Enhanced payload created with {PropertyCount} total properties", 
-                    GetPropertyCount(enhancedPayload));
+                if (_logger.IsEnabled(LogLevel.Debug))
+                {
+                    _logger.LogDebug("✅ Enhanced payload created with {PropertyCount} total properties",
+                        GetPropertyCount(enhancedPayload));
+                }
                 
                 return enhancedPayload;
             }
@@ -99,7 +106,12 @@ namespace CxLanguage.Runtime.ParallelHandlers
             IDictionary<string, object> originalDict, 
             Dictionary<string, object> handlerResults)
         {
-            var mergedPayload = new Dictionary<string, object>(originalDict);
+            var plan = PayloadMapperCache.GetPlan(null, handlerResults);
+            var mergedPayload = new Dictionary<string, object>(originalDict.Count + handlerResults.Count + 1);
+            foreach (var kvp in originalDict)
+            {
+                mergedPayload[kvp.Key] = kvp.Value;
+            }
             
             // Add handler results as new properties
             foreach (var result in handlerResults)
@@ -108,9 +120,9 @@ namespace CxLanguage.Runtime.ParallelHandlers
                 var propertyValue = ProcessResultValue(result.Value);
                 
                 // Handle property name conflicts
-                if (mergedPayload.ContainsKey(propertyName))
+                if (mergedPayload.TryGetValue(propertyName, out var existingValue))
                 {
-                    var conflictResolution = ResolvePropertyConflict(propertyName, mergedPayload[propertyName], propertyValue);
+                    var conflictResolution = ResolvePropertyConflict(propertyName, existingValue, propertyValue);
                     mergedPayload[conflictResolution.PropertyName] = conflictResolution.Value;
                     
                     if (conflictResolution.PropertyName != propertyName)
@@ -126,36 +138,51 @@ namespace CxLanguage.Runtime.ParallelHandlers
             }
             
             // Add metadata about parallel execution
-            mergedPayload["_parallelExecution"] = new
-            {
-                handlerCount = handlerResults.Count,
-                executionMode = "parallel",
-                timestamp = DateTime.UtcNow,
-                resultProperties = handlerResults.Keys.ToArray()
-            };
+            mergedPayload[PayloadMergePlan.MetadataKey] = CreateExecutionMetadata(plan);
             
             return mergedPayload;
         }
         
         /// <summary>
         /// Merge anonymous object payload with handler results.
+        /// Fills the cached slot layout of the payload shape and returns it as a PayloadPropertyBag, which keeps
+        /// the dynamic property access the former ExpandoObject result offered.
         /// </summary>
         private object MergeAnonymousPayload(object originalPayload, Dictionary<string, object> handlerResults)
         {
-            // Convert anonymous object to dictionary for easier manipulation
-            var originalDict = ConvertObjectToDictionary(originalPayload);
-            var mergedDict = MergeDictionaryPayload(originalDict, handlerResults);
-            
-            // Return as ExpandoObject for dynamic property access
-            var expandoObject = new System.Dynamic.ExpandoObject();
-            var expandoDict = (IDictionary<string, object?>)expandoObject;
+            var plan = PayloadMapperCache.GetPlan(originalPayload.GetType(), handlerResults);
+            var layout = plan.Layout!;
+            var values = new object[layout.Keys.Length];
+            ReadProperties(originalPayload, plan.Reader!, values);
             
-            foreach (var kvp in mergedDict)
+            // Result keys arrive in the order the plan was built for; conflicting keys share the payload's slot
+            var index = 0;
+            foreach (var result in handlerResults)
             {
-                expandoDict[kvp.Key] = kvp.Value;
+                var propertyValue = ProcessResultValue(result.Value);
+                var slot = plan.ResultSlots[index];
+                values[slot] = plan.ResultConflicts[index]
+                    ? ResolvePropertyConflict(result.Key, values[slot], propertyValue).Value
+                    : propertyValue;
+                index++;
             }
             
-            return expandoObject;
+            values[plan.MetadataSlot] = CreateExecutionMetadata(plan);
+            return new PayloadPropertyBag(layout, values);
+        }
+        
+        /// <summary>
+        /// Metadata entry describing the parallel execution behind an enhanced payload.
+        /// </summary>
+        private static object CreateExecutionMetadata(PayloadMergePlan plan)
+        {
+            return new
+            {
+                handlerCount = plan.ResultKeys.Length,
+                executionMode = "parallel",
+                timestamp = DateTime.UtcNow,
+                resultProperties = (string[])plan.ResultKeys.Clone()
+            };
         }
         
         /// <summary>
@@ -296,11 +323,8 @@ namespace CxLanguage.Runtime.ParallelHandlers
         {
             try
             {
-                // Try to serialize to JSON and back for consistent representation
-                var json = JsonSerializer.Serialize(complexObject, _jsonOptions);
-                var deserialized = JsonSerializer.Deserialize<Dictionary<string, object>>(json, _jsonOptions);
-                
-                return deserialized ?? new Dictionary<string, object> { ["value"] = complexObject.ToString() ?? "unknown", ["type"] = "complex_object" };
+                // Structural copy with the member names and shape of the JSON representation, without the round trip
+                return PayloadMapperCache.ToResultDictionary(complexObject);
             }
             catch
             {
@@ -334,6 +358,7 @@ namespace CxLanguage.Runtime.ParallelHandlers
         {
             if (value1 == null && value2 == null) return true;
             if (value1 == null || value2 == null) return false;
+            if (ReferenceEquals(value1, value2) || value1.Equals(value2)) return true;
             
             try
             {
@@ -354,24 +379,36 @@ namespace CxLanguage.Runtime.ParallelHandlers
         /// </summary>
         private Dictionary<string, object> ConvertObjectToDictionary(object obj)
         {
-            var dict = new Dictionary<string, object>();
-            var properties = obj.GetType().GetProperties(BindingFlags.Public | BindingFlags.Instance);
+            var reader = PayloadMapperCache.GetReader(obj.GetType());
+            var values = new object[reader.Names.Length];
+            ReadProperties(obj, reader, values);
             
-            foreach (var property in properties)
+            var dict = new Dictionary<string, object>(values.Length);
+            for (int i = 0; i < values.Length; i++)
+            {
+                dict[reader.Names[i]] = values[i];
+            }
+            
+            return dict;
+        }
+        
+        /// <summary>
+        /// Read all public properties of an object into the first slots of values using compiled getters.
+        /// </summary>
+        private void ReadProperties(object obj, PayloadPropertyReader reader, object[] values)
+        {
+            for (int i = 0; i < reader.Getters.Length; i++)
             {
                 try
                 {
-                    var value = property.GetValue(obj);
-                    dict[property.Name] = value ?? new object();
+                    values[i] = reader.Getters[i](obj) ?? new object();
                 }
                 catch (Exception ex)
                 {
-                    _logger.LogWarning(ex, "⚠️ Failed to get property value for {PropertyName}", property.Name);
-                    dict[property.Name] = $"Error: {ex.Message}";
+                    _logger.LogWarning(ex, "⚠️ Failed to get property value for {PropertyName}", reader.Names[i]);
+                    values[i] = $"Error: {ex.Message}";
                 }
             }
-            
-            return dict;
         }
         
         /// <summary>
@@ -391,7 +428,7 @@ namespace CxLanguage.Runtime.ParallelHandlers
             return obj switch
             {
                 IDictionary<string, object> dict => dict.Count,
-                _ => obj.GetType().GetProperties(BindingFlags.Public | BindingFlags.Instance).Length
+                _ => PayloadMapperCache.GetReader(obj.GetType()).Names.Length
             };
         }
         
@@ -0,0 +1,39 @@
+using System;
+
+namespace CxLanguage.Runtime.Services
+{
+    /// <summary>
+    /// Console output pipeline settings for ConsoleService and CxPrint, bound from the "ConsoleOutput"
+    /// configuration section. When disabled every write goes straight to the console on the calling thread, as before.
+    /// </summary>
+    public class ConsoleOutputOptions
+    {
+        public const string SectionName = "ConsoleOutput";
+
+        /// <summary>
+        /// Queue writes to a single background writer instead of writing on the event-bus thread
+        /// </summary>
+        public bool Enabled { get; set; } = true;
+
+        /// <summary>
+        /// Buffered characters that trigger a flush without waiting for the interval
+        /// </summary>
+        public int BufferSize { get; set; } = 32 * 1024;
+
+        /// <summary>
+        /// Longest time written text waits in the buffer before it reaches the console
+        /// </summary>
+        public int FlushIntervalMs { get; set; } = 20;
+
+        /// <summary>
+        /// Within one flush, print each agent's lines together and in their original order instead of interleaved by
+        /// arrival. Writes carry the agent from the agentId, agent or agentName payload field; others are not regrouped.
+        /// </summary>
+        public bool PreserveAgentLineOrder { get; set; }
+
+        /// <summary>
+        /// How long shutdown waits for queued output to be written
+        /// </summary>
+        public int ShutdownTimeoutMs { get; set; } = 2000;
+    }
+}
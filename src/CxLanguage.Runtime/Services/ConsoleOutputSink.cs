@@ -0,0 +1,547 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CxLanguage.Runtime.Services
+{
+    /// <summary>
+    /// Console output pipeline behind ConsoleService and CxPrint.
+    /// Producers only enqueue onto a lock-free queue; one background writer thread drains it into a buffer and,
+    /// when the buffer reaches BufferSize or FlushIntervalMs after its first pending write, copies each run of
+    /// text bound for the same writer into one character buffer and writes and flushes it in a single call, so
+    /// printing agents no longer contend for the console lock on event-bus threads.
+    /// Colored writes, cursor moves and other console state changes are queued too and run on the writer thread
+    /// in order, after the text queued before them. Queued output is flushed on Dispose and at process exit.
+    /// Each write goes to Console.Out as it was when the write was queued, so Console.SetOut redirection applies
+    /// to the writes made while it is in place and to nothing queued before it.
+    /// </summary>
+    public sealed class ConsoleOutputSink : IDisposable
+    {
+        private const int Running = 0;
+        private const int IdleEmpty = 1;
+        private const int IdlePending = 2;
+
+        private static readonly object _sharedLock = new();
+        private static ConsoleOutputSink? _shared;
+
+        private readonly ConsoleOutputOptions _options;
+        private readonly ConcurrentQueue<Entry> _queue = new();
+        private readonly ManualResetEventSlim _signal = new(false);
+        private readonly List<Entry> _pending = new();
+        private readonly object _directLock = new();
+        private readonly TextWriter? _output;
+        private readonly Thread? _writer;
+        private readonly TimeSpan _flushInterval;
+        private long _firstPendingTimestamp;
+        private int _pendingChars;
+        private int _outstanding;
+        private char[] _run = Array.Empty<char>();
+        private int _runLength;
+        private TextWriter? _runTarget;
+        private int _state;
+        private int _completed;
+        private long _writes;
+        private long _flushes;
+
+        /// <summary>
+        /// Queued console operation: text, optionally colored and tagged with the agent that wrote it, a console
+        /// action, or a flush marker. Target is the writer current when the entry was queued.
+        /// </summary>
+        private readonly record struct Entry(string? Text, string? OrderKey = null, ConsoleColor? Foreground = null,
+            ConsoleColor? Background = null, Action? Control = null, TaskCompletionSource? Flushed = null,
+            TextWriter? Target = null)
+        {
+            public bool IsPlainText => Text != null && Foreground == null && Background == null;
+        }
+
+        static ConsoleOutputSink()
+        {
+            AppDomain.CurrentDomain.ProcessExit += (_, _) => Volatile.Read(ref _shared)?.Dispose();
+            AppDomain.CurrentDomain.UnhandledException += (_, _) => Volatile.Read(ref _shared)?.Flush();
+        }
+
+        /// <summary>
+        /// Sink writing to the console
+        /// </summary>
+        public ConsoleOutputSink(ConsoleOutputOptions? options = null)
+            : this(options, null)
+        {
+        }
+
+        /// <summary>
+        /// Sink writing UTF-8 text to a stream through a buffer of BufferSize characters; colors are ignored
+        /// </summary>
+        public ConsoleOutputSink(Stream output, ConsoleOutputOptions? options = null)
+            : this(options, new StreamWriter(output ?? throw new ArgumentNullException(nameof(output)),
+                new UTF8Encoding(false), Math.Max(1024, (options ?? new ConsoleOutputOptions()).BufferSize)) { AutoFlush = false })
+        {
+        }
+
+        private ConsoleOutputSink(ConsoleOutputOptions? options, TextWriter? output)
+        {
+            _options = options ?? new ConsoleOutputOptions();
+            _output = output;
+            _flushInterval = TimeSpan.FromMilliseconds(Math.Max(1, _options.FlushIntervalMs));
+
+            if (_options.Enabled)
+            {
+                _writer = new Thread(RunWriter)
+                {
+                    IsBackground = true,
+                    Name = "CX console writer"
+                };
+                _writer.Start();
+            }
+        }
+
+        /// <summary>
+        /// Process-wide sink used by ConsoleService and CxPrint; created with default options on first use
+        /// </summary>
+        public static ConsoleOutputSink Shared
+        {
+            get
+            {
+                var sink = Volatile.Read(ref _shared);
+                if (sink != null)
+                {
+                    return sink;
+                }
+
+                lock (_sharedLock)
+                {
+                    return _shared ??= new ConsoleOutputSink();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Replace the shared sink; output already queued on the previous one is written first
+        /// </summary>
+        public static void Configure(ConsoleOutputOptions options)
+        {
+            ConsoleOutputSink? previous;
+            lock (_sharedLock)
+            {
+                previous = _shared;
+                _shared = new ConsoleOutputSink(options);
+            }
+            previous?.Dispose();
+        }
+
+        /// <summary>
+        /// Wait for the shared sink's queued output, if the shared sink has been created
+        /// </summary>
+        public static void FlushShared()
+        {
+            Volatile.Read(ref _shared)?.Flush();
+        }
+
+        /// <summary>
+        /// True when writes are queued to the background writer rather than written on the calling thread
+        /// </summary>
+        public bool IsQueued => _writer != null && Volatile.Read(ref _completed) == 0;
+
+        #region Writing
+
+        /// <summary>
+        /// Queue text as is; orderKey names the agent for PreserveAgentLineOrder
+        /// </summary>
+        public void Write(string? text, string? orderKey = null)
+        {
+            if (!string.IsNullOrEmpty(text))
+            {
+                Enqueue(new Entry(text, orderKey), wake: false);
+            }
+        }
+
+        /// <summary>
+        /// Queue a line of text
+        /// </summary>
+        public void WriteLine(string? text, string? orderKey = null)
+        {
+            Enqueue(new Entry(string.Concat(text, Environment.NewLine), orderKey), wake: false);
+        }
+
+        /// <summary>
+        /// Queue text written in the given colors; the previous colors are restored afterwards
+        /// </summary>
+        public void WriteColored(string? text, ConsoleColor? foreground, ConsoleColor? background, string? orderKey = null)
+        {
+            if (foreground == null && background == null)
+            {
+                Write(text, orderKey);
+                return;
+            }
+
+            if (!string.IsNullOrEmpty(text))
+            {
+                Enqueue(new Entry(text, orderKey, foreground, background), wake: true);
+            }
+        }
+
+        /// <summary>
+        /// Run a console operation (cursor, colors, clear) on the writer thread after the output queued before it
+        /// </summary>
+        public void Post(Action action)
+        {
+            ArgumentNullException.ThrowIfNull(action);
+            Enqueue(new Entry(null, Control: action), wake: true);
+        }
+
+        /// <summary>
+        /// Completes once everything queued before the call has been written
+        /// </summary>
+        public Task FlushAsync()
+        {
+            if (!IsQueued || Thread.CurrentThread == _writer)
+            {
+                if (Thread.CurrentThread == _writer)
+                {
+                    FlushPending();
+                }
+                return Task.CompletedTask;
+            }
+
+            if (Volatile.Read(ref _outstanding) == 0)
+            {
+                return Task.CompletedTask;
+            }
+
+            var flushed = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+            Enqueue(new Entry(null, Flushed: flushed), wake: true);
+            return flushed.Task;
+        }
+
+        /// <summary>
+        /// Wait up to ShutdownTimeoutMs for queued output to be written
+        /// </summary>
+        public void Flush()
+        {
+            FlushAsync().Wait(Math.Max(0, _options.ShutdownTimeoutMs));
+        }
+
+        /// <summary>
+        /// Stop the writer after it has written everything queued; later writes go straight to the console
+        /// </summary>
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _completed, 1) != 0)
+            {
+                return;
+            }
+
+            if (_writer != null)
+            {
+                _signal.Set();
+                if (Thread.CurrentThread != _writer && !_writer.Join(Math.Max(0, _options.ShutdownTimeoutMs)))
+                {
+                    return;
+                }
+            }
+
+            // Writes that raced with shutdown after the writer's last drain
+            lock (_directLock)
+            {
+                Drain();
+                FlushPending();
+            }
+            _output?.Dispose();
+        }
+
+        public Dictionary<string, object> GetStatistics()
+        {
+            return new Dictionary<string, object>
+            {
+                ["Queued"] = IsQueued,
+                ["PendingWrites"] = _queue.Count,
+                ["Writes"] = Interlocked.Read(ref _writes),
+                ["Flushes"] = Interlocked.Read(ref _flushes),
+                ["BufferSize"] = _options.BufferSize,
+                ["FlushIntervalMs"] = _options.FlushIntervalMs,
+                ["PreserveAgentLineOrder"] = _options.PreserveAgentLineOrder
+            };
+        }
+
+        private void Enqueue(Entry entry, bool wake)
+        {
+            if (entry.Text != null)
+            {
+                entry = entry with { Target = _output ?? Console.Out };
+            }
+
+            if (!IsQueued)
+            {
+                lock (_directLock)
+                {
+                    Interlocked.Increment(ref _writes);
+                    Execute(entry);
+                }
+                return;
+            }
+
+            Interlocked.Increment(ref _outstanding);
+            _queue.Enqueue(entry);
+
+            // A writer holding pending text wakes on its own at the flush interval; only an empty one must be woken,
+            // unless the entry is waited for (flush markers, prompts) or changes console state
+            if (Interlocked.CompareExchange(ref _state, Running, IdleEmpty) == IdleEmpty
+                || (wake && Interlocked.CompareExchange(ref _state, Running, IdlePending) == IdlePending))
+            {
+                _signal.Set();
+            }
+        }
+
+        #endregion
+
+        #region Writer Thread
+
+        private void RunWriter()
+        {
+            while (true)
+            {
+                Drain();
+
+                if (_pending.Count > 0 && Stopwatch.GetElapsedTime(_firstPendingTimestamp) >= _flushInterval)
+                {
+                    FlushPending();
+                }
+
+                _signal.Reset();
+                Interlocked.Exchange(ref _state, _pending.Count > 0 ? IdlePending : IdleEmpty);
+                if (!_queue.IsEmpty)
+                {
+                    Volatile.Write(ref _state, Running);
+                    continue;
+                }
+
+                if (Volatile.Read(ref _completed) != 0)
+                {
+                    FlushPending();
+                    return;
+                }
+
+                if (_pending.Count > 0)
+                {
+                    var remaining = _flushInterval - Stopwatch.GetElapsedTime(_firstPendingTimestamp);
+                    _signal.Wait(remaining > TimeSpan.Zero ? remaining : TimeSpan.Zero);
+                }
+                else
+                {
+                    _signal.Wait();
+                }
+                Volatile.Write(ref _state, Running);
+            }
+        }
+
+        /// <summary>
+        /// Move queued entries into the buffer, writing it out when full or before an entry that is not plain text
+        /// </summary>
+        private void Drain()
+        {
+            while (_queue.TryDequeue(out var entry))
+            {
+                Interlocked.Increment(ref _writes);
+                if (entry.IsPlainText)
+                {
+                    if (_pending.Count == 0)
+                    {
+                        _firstPendingTimestamp = Stopwatch.GetTimestamp();
+                    }
+
+                    _pending.Add(entry);
+                    _pendingChars += entry.Text!.Length;
+                    if (_pendingChars >= _options.BufferSize)
+                    {
+                        FlushPending();
+                    }
+                    continue;
+                }
+
+                FlushPending();
+                Execute(entry);
+                Interlocked.Decrement(ref _outstanding);
+            }
+        }
+
+        private void FlushPending()
+        {
+            if (_pending.Count == 0)
+            {
+                return;
+            }
+
+            try
+            {
+                if (_options.PreserveAgentLineOrder)
+                {
+                    WriteGroupedByAgent();
+                }
+                else
+                {
+                    foreach (var entry in _pending)
+                    {
+                        WriteBuffered(entry);
+                    }
+                }
+                WriteRun();
+            }
+            catch (Exception)
+            {
+                // The console went away (closed pipe); the output is dropped like a failed Console.Write would be
+            }
+
+            Interlocked.Increment(ref _flushes);
+            Interlocked.Add(ref _outstanding, -_pending.Count);
+            _pending.Clear();
+            _pendingChars = 0;
+            _runLength = 0;
+            _runTarget = null;
+        }
+
+        /// <summary>
+        /// Append buffered text to the current run, writing the run out first when the text is for another writer
+        /// </summary>
+        private void WriteBuffered(Entry entry)
+        {
+            if (!ReferenceEquals(entry.Target, _runTarget))
+            {
+                WriteRun();
+                _runTarget = entry.Target;
+            }
+
+            var text = entry.Text!;
+            if (_runLength + text.Length > _run.Length)
+            {
+                Array.Resize(ref _run, Math.Max(Math.Max(_run.Length * 2, _options.BufferSize), _runLength + text.Length));
+            }
+            text.CopyTo(0, _run, _runLength, text.Length);
+            _runLength += text.Length;
+        }
+
+        /// <summary>
+        /// Write the run of text queued for one writer in a single call, then flush that writer
+        /// </summary>
+        private void WriteRun()
+        {
+            if (_runTarget is not { } target)
+            {
+                return;
+            }
+
+            var length = _runLength;
+            _runTarget = null;
+            _runLength = 0;
+            target.Write(_run, 0, length);
+            target.Flush();
+        }
+
+        /// <summary>
+        /// Write the buffer with each agent's text kept together, agents in order of their first write
+        /// </summary>
+        private void WriteGroupedByAgent()
+        {
+            Dictionary<string, List<Entry>>? groups = null;
+            var order = new List<(string? Key, Entry Entry)>(_pending.Count);
+            foreach (var entry in _pending)
+            {
+                if (entry.OrderKey == null)
+                {
+                    order.Add((null, entry));
+                    continue;
+                }
+
+                groups ??= new Dictionary<string, List<Entry>>(StringComparer.Ordinal);
+                if (!groups.TryGetValue(entry.OrderKey, out var lines))
+                {
+                    groups[entry.OrderKey] = lines = new List<Entry>();
+                    order.Add((entry.OrderKey, default));
+                }
+                lines.Add(entry);
+            }
+
+            foreach (var (key, entry) in order)
+            {
+                if (key == null)
+                {
+                    WriteBuffered(entry);
+                    continue;
+                }
+
+                foreach (var line in groups![key])
+                {
+                    WriteBuffered(line);
+                }
+            }
+        }
+
+        private void Execute(Entry entry)
+        {
+            if (entry.Flushed != null)
+            {
+                entry.Flushed.TrySetResult();
+                return;
+            }
+
+            try
+            {
+                if (entry.Control != null)
+                {
+                    entry.Control();
+                    return;
+                }
+
+                WriteColoredNow(entry);
+            }
+            catch (Exception)
+            {
+                // Console operations fail when the console is redirected or closed; the caller is not waiting for them
+            }
+        }
+
+        private void WriteColoredNow(Entry entry)
+        {
+            var target = entry.Target!;
+            if (_output != null || (entry.Foreground == null && entry.Background == null))
+            {
+                target.Write(entry.Text);
+                target.Flush();
+                return;
+            }
+
+            var originalForeground = Console.ForegroundColor;
+            var originalBackground = Console.BackgroundColor;
+            try
+            {
+                if (entry.Foreground is { } foreground)
+                {
+                    Console.ForegroundColor = foreground;
+                }
+                if (entry.Background is { } background)
+                {
+                    Console.BackgroundColor = background;
+                }
+
+                target.Write(entry.Text);
+                target.Flush();
+            }
+            finally
+            {
+                if (entry.Foreground != null)
+                {
+                    Console.ForegroundColor = originalForeground;
+                }
+                if (entry.Background != null)
+                {
+                    Console.BackgroundColor = originalBackground;
+                }
+            }
+        }
+
+        #endregion
+    }
+}
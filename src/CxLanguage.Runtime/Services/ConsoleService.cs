@@ -2,6 +2,7 @@ using System;
 using System.Collections.Generic;
 using System.Threading.Tasks;
 using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
 using CxLanguage.Core.Events;
 
 namespace CxLanguage.Runtime.Services
@@ -10,6 +11,8 @@ namespace CxLanguage.Runtime.Services
     /// Handles system.console.write, system.console.read, and system.console.clear events for console I/O with consciousness-aware patterns
     /// Supports integrated color control and cursor positioning within system.console.write events using native .NET Console methods for cross-platform compatibility
     /// Cursor parameters: x, y (absolute), dx, dy (relative), home (boolean), hideCursor, showCursor (boolean)
+    /// Output goes through ConsoleOutputSink: handlers only queue it, and console state changes run on the sink's
+    /// writer thread in order with the text around them.
     /// </summary>
     public class ConsoleService
     {
@@ -41,11 +44,21 @@ namespace CxLanguage.Runtime.Services
         private static readonly ConsoleColor OriginalForegroundColor = Console.ForegroundColor;
         private static readonly ConsoleColor OriginalBackgroundColor = Console.BackgroundColor;
 
-        public ConsoleService(ICxEventBus eventBus, ILogger<ConsoleService> logger)
+        /// <summary>
+        /// Payload fields naming the writing agent, used to keep its lines together under PreserveAgentLineOrder
+        /// </summary>
+        private static readonly string[] AgentKeyFields = { "agentId", "agent", "agentName" };
+
+        public ConsoleService(ICxEventBus eventBus, ILogger<ConsoleService> logger, IOptions<ConsoleOutputOptions>? outputOptions = null)
         {
             _eventBus = eventBus ?? throw new ArgumentNullException(nameof(eventBus));
             _logger = logger ?? throw new ArgumentNullException(nameof(logger));
 
+            if (outputOptions?.Value is { } options)
+            {
+                ConsoleOutputSink.Configure(options);
+            }
+
             // Subscribe to console write, read, and clear events
             _eventBus.Subscribe("system.console.write", HandleConsoleWriteAsync);
             _eventBus.Subscribe("system.console.read", HandleConsoleReadAsync);
@@ -65,119 +78,54 @@ namespace CxLanguage.Runtime.Services
             try
             {
                 payload ??= new Dictionary<string, object>();
+                var output = ConsoleOutputSink.Shared;
 
-                // Handle cursor positioning BEFORE any output
-                if (!HandleCursorPositioning(payload))
-                {
-                    // If cursor positioning failed, continue with output anyway
-                    _logger.LogWarning("Cursor positioning failed, continuing with text output");
-                }
-
-                // Handle cursor visibility control
-                HandleCursorVisibility(payload);
-
-                // Store original colors to restore after writing
-                var originalForeground = Console.ForegroundColor;
-                var originalBackground = Console.BackgroundColor;
-                var colorsChanged = false;
-
-                // Apply temporary foreground color if specified
-                if (payload.TryGetValue("foregroundColor", out var fgColorObj) && fgColorObj is string fgColor)
+                // Cursor positioning and visibility run on the writer thread BEFORE this write's output
+                if (HasCursorControl(payload))
                 {
-                    var lowerColor = fgColor.ToLower();
-                    if (ColorMapping.TryGetValue(lowerColor, out var consoleColor))
+                    output.Post(() =>
                     {
-                        Console.ForegroundColor = consoleColor;
-                        colorsChanged = true;
-                        _logger.LogDebug("Applied temporary foreground color: {Color}", fgColor);
-                    }
-                    else
-                    {
-                        _logger.LogWarning("Unknown foreground color: {Color}. Supported colors: {SupportedColors}", 
-                            fgColor, string.Join(", ", ColorMapping.Keys));
-                    }
-                }
+                        if (!HandleCursorPositioning(payload))
+                        {
+                            // If cursor positioning failed, continue with output anyway
+                            _logger.LogWarning("Cursor positioning failed, continuing with text output");
+                        }
 
-                // Apply temporary background color if specified
-                if (payload.TryGetValue("backgroundColor", out var bgColorObj) && bgColorObj is string bgColor)
-                {
-                    var lowerColor = bgColor.ToLower();
-                    if (ColorMapping.TryGetValue(lowerColor, out var consoleColor))
-                    {
-                        Console.BackgroundColor = consoleColor;
-                        colorsChanged = true;
-                        _logger.LogDebug("Applied temporary background color: {Color}", bgColor);
-                    }
-                    else
-                    {
-                        _logger.LogWarning("Unknown background color: {Color}. Supported colors: {SupportedColors}", 
-                            bgColor, string.Join(", ", ColorMapping.Keys));
-                    }
+                        // Handle cursor visibility control
+                        HandleCursorVisibility(payload);
+                    });
                 }
 
+                // Temporary colors apply to this write operation only
+                var foreground = ResolveColor(payload, "foregroundColor", "foreground");
+                var background = ResolveColor(payload, "backgroundColor", "background");
+                var agentKey = GetAgentKey(payload);
+
                 // Handle text output
                 if (payload.TryGetValue("text", out var textObj) && textObj is not null)
                 {
-                    Console.WriteLine(textObj?.ToString() ?? string.Empty);
-                    
-                    // Restore original colors if they were changed
-                    if (colorsChanged)
-                    {
-                        Console.ForegroundColor = originalForeground;
-                        Console.BackgroundColor = originalBackground;
-                    }
-                    
+                    output.WriteColored(string.Concat(textObj.ToString(), Environment.NewLine), foreground, background, agentKey);
                     return Task.FromResult(true);
                 }
 
                 // Handle object output
                 if (payload.TryGetValue("object", out var anyObj))
                 {
-                    if (anyObj is null)
-                    {
-                        Console.WriteLine("null");
-                    }
-                    else
-                    {
-                        // Use CX-aware printer for entities and complex structures
-                        CxPrint.Print(anyObj);
-                    }
-                    
-                    // Restore original colors if they were changed
-                    if (colorsChanged)
-                    {
-                        Console.ForegroundColor = originalForeground;
-                        Console.BackgroundColor = originalBackground;
-                    }
-                    
+                    // Use CX-aware printer for entities and complex structures
+                    output.WriteColored(anyObj is null ? "null" + Environment.NewLine : CxPrint.Format(anyObj),
+                        foreground, background, agentKey);
                     return Task.FromResult(true);
                 }
 
                 // Fallback: print entire payload (useful for debugging)
                 if (payload.Count > 0)
                 {
-                    CxPrint.Print(new Dictionary<string, object>(payload));
-                    
-                    // Restore original colors if they were changed
-                    if (colorsChanged)
-                    {
-                        Console.ForegroundColor = originalForeground;
-                        Console.BackgroundColor = originalBackground;
-                    }
-                    
+                    output.WriteColored(CxPrint.Format(new Dictionary<string, object>(payload)), foreground, background, agentKey);
                     return Task.FromResult(true);
                 }
 
                 // Nothing to print
                 _logger.LogDebug("system.console.write received with empty payload");
-                
-                // Restore original colors if they were changed (even with no output)
-                if (colorsChanged)
-                {
-                    Console.ForegroundColor = originalForeground;
-                    Console.BackgroundColor = originalBackground;
-                }
-                
                 return Task.FromResult(true);
             }
             catch (Exception ex)
@@ -187,6 +135,45 @@ namespace CxLanguage.Runtime.Services
             }
         }
 
+        /// <summary>
+        /// Console color named by a write payload field, or null when absent or unknown
+        /// </summary>
+        private ConsoleColor? ResolveColor(IDictionary<string, object> payload, string field, string kind)
+        {
+            if (!payload.TryGetValue(field, out var colorObj) || colorObj is not string color)
+            {
+                return null;
+            }
+
+            if (ColorMapping.TryGetValue(color.ToLower(), out var consoleColor))
+            {
+                _logger.LogDebug("Applied temporary {Kind} color: {Color}", kind, color);
+                return consoleColor;
+            }
+
+            _logger.LogWarning("Unknown {Kind} color: {Color}. Supported colors: {SupportedColors}",
+                kind, color, string.Join(", ", ColorMapping.Keys));
+            return null;
+        }
+
+        private static string? GetAgentKey(IDictionary<string, object> payload)
+        {
+            foreach (var field in AgentKeyFields)
+            {
+                if (payload.TryGetValue(field, out var value) && value is string agent && agent.Length > 0)
+                {
+                    return agent;
+                }
+            }
+            return null;
+        }
+
+        private static bool HasCursorControl(IDictionary<string, object> payload)
+        {
+            return payload.ContainsKey("x") || payload.ContainsKey("dx") || payload.ContainsKey("dy") ||
+                   payload.ContainsKey("home") || payload.ContainsKey("hideCursor") || payload.ContainsKey("showCursor");
+        }
+
         /// <summary>
         /// Handler for 'system.console.read' event
         /// Supports payloads: { prompt: string, handlers: array } (both optional)
@@ -204,10 +191,13 @@ namespace CxLanguage.Runtime.Services
                     var prompt = promptObj.ToString() ?? string.Empty;
                     if (!string.IsNullOrEmpty(prompt))
                     {
-                        Console.Write(prompt);
+                        ConsoleOutputSink.Shared.Write(prompt);
                     }
                 }
 
+                // The prompt and everything printed before it must be visible before blocking on input
+                await ConsoleOutputSink.Shared.FlushAsync();
+
                 // Read input from console asynchronously
                 var input = await ReadLineAsync();
 
@@ -251,11 +241,11 @@ namespace CxLanguage.Runtime.Services
         {
             try
             {
-                // Clear the console screen using the standard Console.Clear() method
+                // Clear the console screen using the standard Console.Clear() method, after the output queued before it
                 // This works cross-platform (Windows, Linux, macOS)
-                Console.Clear();
+                ConsoleOutputSink.Shared.Post(Console.Clear);
                 
-                _logger.LogDebug("Console screen cleared successfully");
+                _logger.LogDebug("Console screen clear queued");
                 return Task.FromResult(true);
             }
             catch (Exception ex)
@@ -282,7 +272,7 @@ namespace CxLanguage.Runtime.Services
                     var lowerColor = foregroundColor.ToLower();
                     if (ColorMapping.TryGetValue(lowerColor, out var consoleColor))
                     {
-                        Console.ForegroundColor = consoleColor;
+                        SetColor(foreground: consoleColor);
                         _logger.LogDebug("Set foreground color: {Color}", foregroundColor);
                     }
                     else
@@ -298,7 +288,7 @@ namespace CxLanguage.Runtime.Services
                     var lowerColor = backgroundColor.ToLower();
                     if (ColorMapping.TryGetValue(lowerColor, out var consoleColor))
                     {
-                        Console.BackgroundColor = consoleColor;
+                        SetColor(background: consoleColor);
                         _logger.LogDebug("Set background color: {Color}", backgroundColor);
                     }
                     else
@@ -319,7 +309,7 @@ namespace CxLanguage.Runtime.Services
                     {
                         // Map RGB to closest Console color
                         var closestColor = MapRgbToConsoleColor(r, g, b);
-                        Console.ForegroundColor = closestColor;
+                        SetColor(foreground: closestColor);
                         _logger.LogDebug("Mapped RGB({R},{G},{B}) to console color: {Color}", r, g, b, closestColor);
                     }
                 }
@@ -330,7 +320,7 @@ namespace CxLanguage.Runtime.Services
                     if (TryParseHexColor(hexValue, out var r, out var g, out var b))
                     {
                         var closestColor = MapRgbToConsoleColor(r, g, b);
-                        Console.ForegroundColor = closestColor;
+                        SetColor(foreground: closestColor);
                         _logger.LogDebug("Mapped hex color {Hex} -> RGB({R},{G},{B}) to console color: {Color}", 
                             hexValue, r, g, b, closestColor);
                     }
@@ -353,8 +343,7 @@ namespace CxLanguage.Runtime.Services
         {
             try
             {
-                Console.ForegroundColor = OriginalForegroundColor;
-                Console.BackgroundColor = OriginalBackgroundColor;
+                SetColor(OriginalForegroundColor, OriginalBackgroundColor);
                 _logger.LogDebug("Console colors reset to original values");
                 return Task.FromResult(true);
             }
@@ -365,6 +354,24 @@ namespace CxLanguage.Runtime.Services
             }
         }
 
+        /// <summary>
+        /// Change the console colors once the output queued before the change has been written
+        /// </summary>
+        private static void SetColor(ConsoleColor? foreground = null, ConsoleColor? background = null)
+        {
+            ConsoleOutputSink.Shared.Post(() =>
+            {
+                if (foreground is { } fg)
+                {
+                    Console.ForegroundColor = fg;
+                }
+                if (background is { } bg)
+                {
+                    Console.BackgroundColor = bg;
+                }
+            });
+        }
+
         /// <summary>
         /// Maps RGB values to the closest available ConsoleColor
         /// </summary>
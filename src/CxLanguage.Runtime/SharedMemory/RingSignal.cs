@@ -0,0 +1,152 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Runtime.Versioning;
+using System.Threading;
+
+namespace CxLanguage.Runtime.SharedMemory
+{
+    /// <summary>
+    /// Cross-process sleep and wake on a ring's doorbell word.
+    /// Linux waits on the word itself with a futex, which works across processes because the ring file is a shared
+    /// mapping; Windows uses a named auto-reset event per ring; elsewhere the owner polls the word every millisecond.
+    /// Waits return early whenever the word no longer holds the observed value, so a wake between the reader's
+    /// last check and its sleep is never lost.
+    /// </summary>
+    internal abstract unsafe class RingSignal : IDisposable
+    {
+        protected RingSignal(int* word)
+        {
+            Word = word;
+        }
+
+        protected int* Word { get; }
+
+        public static RingSignal Create(int* word, string name, bool isOwner)
+        {
+            if (OperatingSystem.IsLinux() && FutexRingSignal.IsSupported)
+            {
+                return new FutexRingSignal(word);
+            }
+            if (OperatingSystem.IsWindows())
+            {
+                return new NamedEventRingSignal(word, name, isOwner);
+            }
+            return new PollingRingSignal(word);
+        }
+
+        public abstract void Wait(int observed, int timeoutMs);
+
+        public abstract void Wake();
+
+        public virtual void Dispose()
+        {
+        }
+
+        private sealed class FutexRingSignal : RingSignal
+        {
+            private const int FutexWait = 0;
+            private const int FutexWake = 1;
+
+            private static readonly long SyscallNumber = RuntimeInformation.ProcessArchitecture switch
+            {
+                Architecture.X64 => 202,
+                Architecture.Arm64 => 98,
+                _ => -1
+            };
+
+            public FutexRingSignal(int* word) : base(word)
+            {
+            }
+
+            public static bool IsSupported => SyscallNumber >= 0;
+
+            public override void Wait(int observed, int timeoutMs)
+            {
+                var timeout = new Timespec
+                {
+                    Seconds = timeoutMs / 1000,
+                    Nanoseconds = timeoutMs % 1000 * 1_000_000L
+                };
+
+                // Returns at once (EAGAIN) when the word already changed; errors and timeouts just end the wait
+                Syscall(SyscallNumber, Word, FutexWait, observed, &timeout, null, 0);
+            }
+
+            public override void Wake()
+            {
+                Syscall(SyscallNumber, Word, FutexWake, int.MaxValue, null, null, 0);
+            }
+
+            [StructLayout(LayoutKind.Sequential)]
+            private struct Timespec
+            {
+                public long Seconds;
+                public long Nanoseconds;
+            }
+
+            [DllImport("libc", EntryPoint = "syscall", SetLastError = true)]
+            private static extern long Syscall(long number, int* address, int operation, int value, Timespec* timeout,
+                int* address2, int value3);
+        }
+
+        [SupportedOSPlatform("windows")]
+        private sealed class NamedEventRingSignal : RingSignal
+        {
+            private readonly string _name;
+            private EventWaitHandle? _event;
+
+            public NamedEventRingSignal(int* word, string name, bool isOwner) : base(word)
+            {
+                _name = $"Local\\CxEvents.{name}";
+                if (isOwner)
+                {
+                    _event = new EventWaitHandle(false, EventResetMode.AutoReset, _name);
+                }
+            }
+
+            public override void Wait(int observed, int timeoutMs)
+            {
+                if (Volatile.Read(ref *Word) == observed)
+                {
+                    _event?.WaitOne(timeoutMs);
+                }
+            }
+
+            public override void Wake()
+            {
+                // Writers open the owner's event on first use; it exists as long as the owner runs
+                if (_event == null && EventWaitHandle.TryOpenExisting(_name, out var opened))
+                {
+                    if (Interlocked.CompareExchange(ref _event, opened, null) != null)
+                    {
+                        opened.Dispose();
+                    }
+                }
+                _event?.Set();
+            }
+
+            public override void Dispose() => _event?.Dispose();
+        }
+
+        private sealed class PollingRingSignal : RingSignal
+        {
+            public PollingRingSignal(int* word) : base(word)
+            {
+            }
+
+            public override void Wait(int observed, int timeoutMs)
+            {
+                var deadline = Environment.TickCount64 + timeoutMs;
+                while (Volatile.Read(ref *Word) == observed && Environment.TickCount64 < deadline)
+                {
+                    Thread.Sleep(1);
+                }
+            }
+
+            public override void Wake()
+            {
+                // The doorbell increment is all a polling owner needs
+            }
+        }
+    }
+}
@@ -0,0 +1,117 @@
+using System;
+using System.Collections.Generic;
+using System.Threading.Tasks;
+using Microsoft.Extensions.Logging;
+using CxLanguage.Core.Events;
+
+namespace CxLanguage.Runtime.SharedMemory
+{
+    /// <summary>
+    /// ICxEventBus scope spanning every CX process of one host that shares a SharedMemoryTransportOptions scope.
+    /// Wraps the process's own bus: subscriptions, statistics and local delivery stay there; emits are also
+    /// published through SharedMemoryEventTransport. Events from other processes are emitted on the wrapped bus,
+    /// never republished, so compiled handlers see them like local events.
+    /// Received events reach the wrapped bus on the transport's reader thread in publication order; the
+    /// synchronous part of a handler runs on that thread.
+    /// Payloads cross in the PeerWireCodec value encoding: primitives, strings, timestamps, maps and lists keep
+    /// their types, other objects arrive as JsonElement and only string senders are carried.
+    /// </summary>
+    public sealed class SharedMemoryEventBus : ICxEventBus, IDisposable
+    {
+        private readonly ICxEventBus _inner;
+        private readonly SharedMemoryTransportOptions _options;
+        private readonly ILogger<SharedMemoryEventBus>? _logger;
+        private readonly SharedMemoryEventTransport _transport;
+
+        public SharedMemoryEventBus(ICxEventBus inner, SharedMemoryTransportOptions? options = null, ILogger<SharedMemoryEventBus>? logger = null)
+        {
+            _inner = inner ?? throw new ArgumentNullException(nameof(inner));
+            _options = options ?? new SharedMemoryTransportOptions();
+            _logger = logger;
+            _transport = new SharedMemoryEventTransport(_options, Deliver, logger);
+        }
+
+        /// <summary>
+        /// The process-local bus this scope wraps
+        /// </summary>
+        public ICxEventBus Inner => _inner;
+
+        public SharedMemoryEventTransport Transport => _transport;
+
+        public Task<bool> EmitAsync(string eventName, IDictionary<string, object>? payload = null, object? sender = null)
+        {
+            if (ShouldPublish(eventName))
+            {
+                try
+                {
+                    _transport.Publish(eventName, sender as string, payload);
+                }
+                catch (Exception ex) when (ex is not ObjectDisposedException)
+                {
+                    _logger?.LogWarning(ex, "⚠️ Could not publish {EventName} to other processes", eventName);
+                }
+            }
+
+            return _inner.EmitAsync(eventName, payload, sender);
+        }
+
+        public bool Subscribe(string eventName, Func<object?, string, IDictionary<string, object>?, Task<bool>> handler) =>
+            _inner.Subscribe(eventName, handler);
+
+        public bool Unsubscribe(string eventName, Func<object?, string, IDictionary<string, object>?, Task<bool>> handler) =>
+            _inner.Unsubscribe(eventName, handler);
+
+        public int GetHandlerCount(string eventName) => _inner.GetHandlerCount(eventName);
+
+        public Dictionary<string, object> GetStatistics()
+        {
+            var statistics = _inner.GetStatistics();
+            statistics["SharedMemory"] = _transport.GetStatistics();
+            return statistics;
+        }
+
+        public void Clear() => _inner.Clear();
+
+        public void Dispose() => _transport.Dispose();
+
+        private bool ShouldPublish(string eventName)
+        {
+            foreach (var prefix in _options.ExcludedEventPrefixes)
+            {
+                if (eventName.StartsWith(prefix, StringComparison.Ordinal))
+                {
+                    return false;
+                }
+            }
+
+            if (_options.IncludedEventPrefixes.Length == 0)
+            {
+                return true;
+            }
+
+            foreach (var prefix in _options.IncludedEventPrefixes)
+            {
+                if (eventName.StartsWith(prefix, StringComparison.Ordinal))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        private void Deliver(string eventName, IDictionary<string, object>? payload, string? sender)
+        {
+            var delivery = _inner.EmitAsync(eventName, payload, sender);
+            if (!delivery.IsCompleted)
+            {
+                delivery.ContinueWith(
+                    task => _logger?.LogError(task.Exception, "❌ Handler failed for shared memory event {EventName}", eventName),
+                    TaskContinuationOptions.OnlyOnFaulted | TaskContinuationOptions.ExecuteSynchronously);
+            }
+            else if (delivery.IsFaulted)
+            {
+                _logger?.LogError(delivery.Exception, "❌ Handler failed for shared memory event {EventName}", eventName);
+            }
+        }
+    }
+}
@@ -0,0 +1,476 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using Microsoft.Extensions.Logging;
+using CxLanguage.Core.Telemetry;
+using CxLanguage.Runtime.DirectPeering;
+
+namespace CxLanguage.Runtime.SharedMemory
+{
+    /// <summary>
+    /// Receives an event published by another process of the same scope
+    /// </summary>
+    public delegate void SharedMemoryEventHandler(string eventName, IDictionary<string, object>? payload, string? sender);
+
+    /// <summary>
+    /// Same-host event exchange between processes through memory-mapped rings, without sockets.
+    /// Every process creates one ring file, named after its process id, in the scope directory, and publishes into
+    /// it. A single reader thread attaches to the rings of the other processes it finds there. It drains them,
+    /// polls for SpinMicroseconds after the last event, then sleeps on its own ring's doorbell. Publishers ring a
+    /// reader's doorbell only while it sleeps, so a busy reader costs them a single flag check.
+    /// The same thread rescans the directory every DiscoveryIntervalMs, and at once when a ring file appears. It
+    /// picks up new processes, detaches from exited ones and deletes the ring files those left behind.
+    /// The ring's heartbeat is written by a timer of its own, so a handler blocking the reader does not make this
+    /// process look gone. A peer whose heartbeat stopped while its process is still alive is only detached, and
+    /// read again from the present on once its heartbeat resumes; its ring file is never deleted.
+    /// Rings found at startup are read from the present on. Rings found later belong to processes that started after
+    /// this one, so their retained history is read too; events a new process publishes before it is noticed are
+    /// not lost.
+    /// </summary>
+    public sealed class SharedMemoryEventTransport : IDisposable
+    {
+        private const int DrainBatch = 256;
+
+        [ThreadStatic]
+        private static PooledBufferWriter? t_writer;
+
+        private readonly SharedMemoryTransportOptions _options;
+        private readonly SharedMemoryEventHandler _deliver;
+        private readonly ILogger? _logger;
+        private readonly SharedMemoryRing _own;
+        private readonly Dictionary<string, SharedMemoryRing> _peersByPath = new(StringComparer.Ordinal);
+        private readonly RingMessageHandler _onMessage;
+        private readonly Thread _reader;
+        private readonly FileSystemWatcher? _watcher;
+        private readonly Timer _heartbeat;
+        private readonly HashSet<string> _stalePaths = new(StringComparer.Ordinal);
+        private SharedMemoryRing[] _peers = Array.Empty<SharedMemoryRing>();
+        private SharedMemoryRing? _drainingPeer;
+        private long _sent;
+        private long _received;
+        private long _decodeFailures;
+        private long _lostSlotsReported;
+        private volatile bool _stopping;
+        private volatile bool _discoveryRequested;
+        private int _disposed;
+
+        public SharedMemoryEventTransport(SharedMemoryTransportOptions options, SharedMemoryEventHandler deliver, ILogger? logger = null)
+        {
+            _options = options ?? throw new ArgumentNullException(nameof(options));
+            _deliver = deliver ?? throw new ArgumentNullException(nameof(deliver));
+            _logger = logger;
+            _onMessage = OnMessage;
+
+            var root = options.Directory
+                ?? (System.IO.Directory.Exists("/dev/shm") ? "/dev/shm/cx-events" : Path.Combine(Path.GetTempPath(), "cx-events"));
+            ScopeDirectory = Path.Combine(root, SanitizeScope(options.ScopeName));
+            System.IO.Directory.CreateDirectory(ScopeDirectory);
+
+            var ringPath = Path.Combine(ScopeDirectory, $"{Environment.ProcessId}-{Guid.NewGuid().ToString("N")[..8]}.ring");
+            _own = SharedMemoryRing.Create(ringPath, options.SlotCount, options.SlotSize);
+
+            // Attach to the processes already running before the first publish
+            Discover(fromStart: false);
+            _watcher = TryWatchScopeDirectory();
+
+            var heartbeatInterval = Math.Max(10, options.DiscoveryIntervalMs);
+            _heartbeat = new Timer(_ => _own.Heartbeat(), null, heartbeatInterval, heartbeatInterval);
+
+            _reader = new Thread(ReadLoop)
+            {
+                IsBackground = true,
+                Name = "CX shared memory reader"
+            };
+            _reader.Start();
+
+            _logger?.LogInformation("🧬 Shared memory event transport ready in {Directory} ({Peers} peer processes)",
+                ScopeDirectory, _peers.Length);
+        }
+
+        public string ScopeDirectory { get; }
+
+        /// <summary>
+        /// Other processes of the scope this process currently reads from
+        /// </summary>
+        public int PeerCount => Volatile.Read(ref _peers).Length;
+
+        #region Publish
+
+        /// <summary>
+        /// Publish an event to every other process of the scope; returns without waiting for readers
+        /// </summary>
+        public void Publish(string eventName, string? sender, IDictionary<string, object>? payload)
+        {
+            ObjectDisposedException.ThrowIf(_disposed != 0, this);
+
+            var writer = t_writer ??= new PooledBufferWriter(512);
+            writer.Reset();
+            try
+            {
+                PeerWireCodec.WriteBusEvent(writer, eventName, sender, payload);
+                _own.Write(writer.WrittenSpan);
+            }
+            finally
+            {
+                // Keep one modest buffer per thread; an occasional huge payload does not pin its buffer forever
+                if (writer.WrittenCount > 64 * 1024)
+                {
+                    writer.Dispose();
+                    t_writer = null;
+                }
+            }
+
+            Interlocked.Increment(ref _sent);
+            CxDiagnostics.SharedMemoryEventsSent.Add(1);
+
+            foreach (var peer in Volatile.Read(ref _peers))
+            {
+                if (peer.TryAddReference())
+                {
+                    try
+                    {
+                        peer.RingDoorbellIfSleeping();
+                    }
+                    finally
+                    {
+                        peer.Release();
+                    }
+                }
+            }
+        }
+
+        #endregion
+
+        #region Reader
+
+        private void ReadLoop()
+        {
+            var spinTicks = Math.Max(0, _options.SpinMicroseconds) * Stopwatch.Frequency / 1_000_000;
+            var discoveryInterval = Math.Max(10, _options.DiscoveryIntervalMs);
+            var nextDiscovery = Environment.TickCount64 + discoveryInterval;
+            var idleSince = Stopwatch.GetTimestamp();
+            var spinner = new SpinWait();
+
+            while (!_stopping)
+            {
+                try
+                {
+                    if (_discoveryRequested || Environment.TickCount64 >= nextDiscovery)
+                    {
+                        _discoveryRequested = false;
+                        Discover(fromStart: true);
+                        nextDiscovery = Environment.TickCount64 + discoveryInterval;
+                    }
+
+                    if (DrainPeers() > 0)
+                    {
+                        idleSince = Stopwatch.GetTimestamp();
+                        spinner.Reset();
+                        continue;
+                    }
+
+                    if (Stopwatch.GetTimestamp() - idleSince < spinTicks)
+                    {
+                        spinner.SpinOnce(sleep1Threshold: -1);
+                        continue;
+                    }
+
+                    // Announce sleeping before the last check, so a publisher either sees the flag or we see its event
+                    _own.SetSleeping(true);
+                    var observed = _own.ReadDoorbell();
+                    if (!AnyPending())
+                    {
+                        _own.WaitForDoorbell(observed, (int)Math.Clamp(nextDiscovery - Environment.TickCount64, 1, discoveryInterval));
+                    }
+                    _own.SetSleeping(false);
+
+                    idleSince = Stopwatch.GetTimestamp();
+                    spinner.Reset();
+                }
+                catch (Exception ex)
+                {
+                    _logger?.LogError(ex, "❌ Shared memory reader failed, retrying");
+                    Thread.Sleep(10);
+                }
+            }
+        }
+
+        private int DrainPeers()
+        {
+            var delivered = 0;
+            foreach (var peer in _peers)
+            {
+                _drainingPeer = peer;
+                delivered += peer.Drain(_onMessage, DrainBatch);
+            }
+            _drainingPeer = null;
+            return delivered;
+        }
+
+        private bool AnyPending()
+        {
+            foreach (var peer in _peers)
+            {
+                if (peer.HasPending)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        private void OnMessage(ReadOnlySpan<byte> message)
+        {
+            Dictionary<string, object>? payload;
+            string eventName;
+            string? sender;
+            try
+            {
+                payload = PeerWireCodec.ReadBusEvent(message, out eventName, out sender);
+            }
+            catch (Exception ex) when (ex is InvalidDataException or System.Text.Json.JsonException)
+            {
+                Interlocked.Increment(ref _decodeFailures);
+                _logger?.LogWarning(ex, "⚠️ Dropped undecodable shared memory event from process {ProcessId}", _drainingPeer?.ProcessId);
+                return;
+            }
+
+            Interlocked.Increment(ref _received);
+            CxDiagnostics.SharedMemoryEventsReceived.Add(1);
+
+            try
+            {
+                _deliver(eventName, payload, sender ?? $"process:{_drainingPeer?.ProcessId}");
+            }
+            catch (Exception ex)
+            {
+                _logger?.LogError(ex, "❌ Error delivering shared memory event {EventName}", eventName);
+            }
+        }
+
+        #endregion
+
+        #region Discovery
+
+        /// <summary>
+        /// Attach to new ring files of the scope and detach from processes that are gone
+        /// </summary>
+        private void Discover(bool fromStart)
+        {
+            var changed = false;
+            var seen = new HashSet<string>(StringComparer.Ordinal);
+            var staleAfter = TimeSpan.FromMilliseconds(Math.Max(30_000, _options.DiscoveryIntervalMs * 20L));
+
+            foreach (var path in System.IO.Directory.EnumerateFiles(ScopeDirectory, "*.ring"))
+            {
+                if (string.Equals(path, _own.Path, StringComparison.Ordinal))
+                {
+                    continue;
+                }
+
+                seen.Add(path);
+                if (_peersByPath.ContainsKey(path))
+                {
+                    continue;
+                }
+
+                if (TryParseProcessId(path, out var processId) && !IsProcessAlive(processId))
+                {
+                    TryDelete(path);
+                    continue;
+                }
+
+                try
+                {
+                    // A stale peer's history was read before it was detached
+                    var wasStale = _stalePaths.Contains(path);
+                    var ring = SharedMemoryRing.Open(path, fromStart && !wasStale);
+                    if (ring != null && wasStale && DateTime.UtcNow - ring.LastHeartbeat > staleAfter)
+                    {
+                        ring.Dispose();
+                        continue;
+                    }
+
+                    if (ring != null)
+                    {
+                        _stalePaths.Remove(path);
+                        _peersByPath[path] = ring;
+                        changed = true;
+                        _logger?.LogInformation("🔗 Reading shared memory events of process {ProcessId}", ring.ProcessId);
+                    }
+                }
+                catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+                {
+                    _logger?.LogDebug(ex, "Could not open shared memory ring {Path}", path);
+                }
+            }
+
+            _stalePaths.RemoveWhere(path => !seen.Contains(path));
+
+            foreach (var (path, ring) in _peersByPath.ToList())
+            {
+                var exited = !IsProcessAlive(ring.ProcessId);
+                var stale = !exited && DateTime.UtcNow - ring.LastHeartbeat > staleAfter;
+                if (!exited && !stale && seen.Contains(path))
+                {
+                    continue;
+                }
+
+                // Deliver whatever the process managed to publish before it went away
+                _drainingPeer = ring;
+                ring.Drain(_onMessage, int.MaxValue);
+                _drainingPeer = null;
+
+                _peersByPath.Remove(path);
+                ring.Dispose();
+                changed = true;
+                if (exited)
+                {
+                    TryDelete(path);
+                }
+                else if (stale && seen.Contains(path))
+                {
+                    _stalePaths.Add(path);
+                }
+                _logger?.LogInformation("🔌 Stopped reading shared memory events of process {ProcessId}", ring.ProcessId);
+            }
+
+            if (changed)
+            {
+                Volatile.Write(ref _peers, _peersByPath.Values.ToArray());
+            }
+
+            var lost = 0L;
+            foreach (var ring in _peersByPath.Values)
+            {
+                lost += ring.LostSlots;
+            }
+            if (lost > _lostSlotsReported)
+            {
+                CxDiagnostics.SharedMemorySlotsLost.Add(lost - _lostSlotsReported);
+                _logger?.LogWarning("⚠️ Shared memory reader fell behind and lost {Slots} ring slots", lost - _lostSlotsReported);
+            }
+            _lostSlotsReported = lost;
+        }
+
+        private FileSystemWatcher? TryWatchScopeDirectory()
+        {
+            try
+            {
+                var watcher = new FileSystemWatcher(ScopeDirectory, "*.ring")
+                {
+                    NotifyFilter = NotifyFilters.FileName
+                };
+                watcher.Created += (_, _) =>
+                {
+                    _discoveryRequested = true;
+                    _own.RingDoorbellIfSleeping();
+                };
+                watcher.EnableRaisingEvents = true;
+                return watcher;
+            }
+            catch (Exception ex) when (ex is IOException or ArgumentException or PlatformNotSupportedException)
+            {
+                // Periodic discovery still finds new processes
+                _logger?.LogDebug(ex, "Could not watch {Directory} for new processes", ScopeDirectory);
+                return null;
+            }
+        }
+
+        private static bool TryParseProcessId(string path, out int processId)
+        {
+            var name = Path.GetFileNameWithoutExtension(path);
+            var dash = name.IndexOf('-');
+            return int.TryParse(dash < 0 ? name : name[..dash], out processId);
+        }
+
+        private static bool IsProcessAlive(int processId)
+        {
+            try
+            {
+                using var process = Process.GetProcessById(processId);
+                return !process.HasExited;
+            }
+            catch (Exception ex) when (ex is ArgumentException or InvalidOperationException)
+            {
+                return false;
+            }
+        }
+
+        private void TryDelete(string path)
+        {
+            try
+            {
+                File.Delete(path);
+                _logger?.LogDebug("Removed shared memory ring {Path} of an exited process", path);
+            }
+            catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+            {
+                // Still mapped by another process on Windows; whoever sees it later tries again
+            }
+        }
+
+        private static string SanitizeScope(string scope)
+        {
+            var invalid = Path.GetInvalidFileNameChars();
+            var name = new string((string.IsNullOrWhiteSpace(scope) ? "default" : scope)
+                .Select(c => invalid.Contains(c) || c == '.' ? '_' : c).ToArray());
+            return name;
+        }
+
+        #endregion
+
+        public Dictionary<string, object> GetStatistics()
+        {
+            var peers = Volatile.Read(ref _peers);
+            return new Dictionary<string, object>
+            {
+                ["ScopeDirectory"] = ScopeDirectory,
+                ["PeerProcesses"] = peers.Length,
+                ["EventsSent"] = Interlocked.Read(ref _sent),
+                ["EventsReceived"] = Interlocked.Read(ref _received),
+                ["DecodeFailures"] = Interlocked.Read(ref _decodeFailures),
+                ["LostSlots"] = peers.Sum(p => p.LostSlots),
+                ["MaxEventBytes"] = _own.MaxMessageSize
+            };
+        }
+
+        /// <summary>
+        /// Stop reading, detach from the other processes and remove this process's ring file
+        /// </summary>
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _disposed, 1) != 0)
+            {
+                return;
+            }
+
+            _stopping = true;
+            _watcher?.Dispose();
+            using (var heartbeatStopped = new ManualResetEvent(false))
+            {
+                // The callback writes into the own ring; it must be done before the ring is unmapped
+                if (_heartbeat.Dispose(heartbeatStopped))
+                {
+                    heartbeatStopped.WaitOne(TimeSpan.FromSeconds(2));
+                }
+            }
+            _own.RingDoorbellIfSleeping();
+            _reader.Join(TimeSpan.FromSeconds(2));
+
+            var peers = Interlocked.Exchange(ref _peers, Array.Empty<SharedMemoryRing>());
+            foreach (var peer in peers)
+            {
+                peer.Dispose();
+            }
+            _peersByPath.Clear();
+
+            var path = _own.Path;
+            _own.Dispose();
+            TryDelete(path);
+        }
+    }
+}
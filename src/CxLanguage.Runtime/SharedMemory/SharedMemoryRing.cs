@@ -0,0 +1,438 @@
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+using System.Numerics;
+using System.Threading;
+
+namespace CxLanguage.Runtime.SharedMemory
+{
+    /// <summary>
+    /// Receives one complete message read from a ring; the span is only valid during the call
+    /// </summary>
+    internal delegate void RingMessageHandler(ReadOnlySpan<byte> message);
+
+    /// <summary>
+    /// Broadcast ring buffer in a memory-mapped file: one writing process, any number of reading processes.
+    ///
+    /// Layout: a 256-byte header (magic, layout version, slot count and size and the owner's process id, then the
+    /// write sequence, the owner's doorbell and the heartbeat, each on its own cache line) followed by fixed-size
+    /// slots. A slot is [int64 sequence][int32 message length][int32 fragment index][payload]; messages longer than
+    /// one slot's payload take consecutive slots.
+    ///
+    /// The writer marks a slot's sequence negative while filling it and stores the positive sequence when
+    /// done. It publishes the write sequence only after the last fragment is complete. Readers keep their own
+    /// cursor and never write to the ring. They copy a message out, then check that every slot still has the
+    /// expected sequence, seqlock style, so a slot the writer reused during the copy is detected. A reader more than
+    /// a ring's length behind skips ahead and counts the lost slots; it never blocks the writer.
+    ///
+    /// The doorbell is the owner's wake-up word. Other processes increment it and wake the owner after they
+    /// publish, but only while the owner reports itself sleeping.
+    /// </summary>
+    internal sealed unsafe class SharedMemoryRing : IDisposable
+    {
+        private const int Magic = 0x56455843; // "CXEV"
+        private const int LayoutVersion = 1;
+        private const int HeaderSize = 256;
+        private const int VersionOffset = 4;
+        private const int SlotCountOffset = 8;
+        private const int SlotSizeOffset = 12;
+        private const int ProcessIdOffset = 16;
+        private const int WriteSequenceOffset = 64;
+        private const int DoorbellOffset = 128;
+        private const int SleepingOffset = 132;
+        private const int HeartbeatOffset = 192;
+        private const int SlotHeaderSize = 16;
+
+        private readonly MemoryMappedFile _file;
+        private readonly MemoryMappedViewAccessor _view;
+        private readonly byte* _base;
+        private readonly int _slotCount;
+        private readonly long _slotMask;
+        private readonly int _slotSize;
+        private readonly int _payloadCapacity;
+        private readonly RingSignal _signal;
+        private readonly object _writeLock = new();
+        private byte[] _readBuffer = Array.Empty<byte>();
+        private long _readSequence;
+        private long _lostSlots;
+        private int _references = 1;
+        private int _disposed;
+
+        private SharedMemoryRing(string path, MemoryMappedFile file, MemoryMappedViewAccessor view, byte* basePointer,
+            bool isOwner, bool fromStart)
+        {
+            Path = path;
+            _file = file;
+            _view = view;
+            _base = basePointer;
+            IsOwner = isOwner;
+            _slotCount = *(int*)(_base + SlotCountOffset);
+            _slotMask = _slotCount - 1;
+            _slotSize = *(int*)(_base + SlotSizeOffset);
+            _payloadCapacity = _slotSize - SlotHeaderSize;
+            ProcessId = *(int*)(_base + ProcessIdOffset);
+            _signal = RingSignal.Create((int*)(_base + DoorbellOffset), System.IO.Path.GetFileNameWithoutExtension(path), isOwner);
+
+            var published = Volatile.Read(ref WriteSequence);
+            _readSequence = fromStart ? Math.Max(0, published - _slotCount) : published;
+        }
+
+        public string Path { get; }
+
+        public int ProcessId { get; }
+
+        public bool IsOwner { get; }
+
+        /// <summary>
+        /// Slots this reader skipped because the writer had already reused them
+        /// </summary>
+        public long LostSlots => Interlocked.Read(ref _lostSlots);
+
+        public long PublishedSequence => Volatile.Read(ref WriteSequence);
+
+        public DateTime LastHeartbeat => new(Volatile.Read(ref *(long*)(_base + HeartbeatOffset)), DateTimeKind.Utc);
+
+        /// <summary>
+        /// Largest message the ring accepts: half of its slots, so a reader can always hold one whole message
+        /// </summary>
+        public int MaxMessageSize => _payloadCapacity * (_slotCount / 2);
+
+        private ref long WriteSequence => ref *(long*)(_base + WriteSequenceOffset);
+
+        private ref int Doorbell => ref *(int*)(_base + DoorbellOffset);
+
+        private ref int Sleeping => ref *(int*)(_base + SleepingOffset);
+
+        #region Create and Open
+
+        /// <summary>
+        /// Create this process's ring; the magic is written last so readers never see a half-initialised header
+        /// </summary>
+        public static SharedMemoryRing Create(string path, int slotCount, int slotSize)
+        {
+            slotCount = (int)Math.Min(1 << 20, BitOperations.RoundUpToPowerOf2((uint)Math.Max(16, slotCount)));
+            slotSize = Math.Max(SlotHeaderSize + 64, (slotSize + 7) & ~7);
+
+            var stream = new FileStream(path, FileMode.CreateNew, FileAccess.ReadWrite, FileShare.ReadWrite | FileShare.Delete);
+            stream.SetLength(HeaderSize + (long)slotCount * slotSize);
+            var ring = Map(path, stream, header =>
+            {
+                *(int*)(header + VersionOffset) = LayoutVersion;
+                *(int*)(header + SlotCountOffset) = slotCount;
+                *(int*)(header + SlotSizeOffset) = slotSize;
+                *(int*)(header + ProcessIdOffset) = Environment.ProcessId;
+                *(long*)(header + HeartbeatOffset) = DateTime.UtcNow.Ticks;
+                Volatile.Write(ref *(int*)header, Magic);
+                return true;
+            }, isOwner: true, fromStart: false);
+
+            return ring ?? throw new IOException($"Could not initialise shared memory ring {path}");
+        }
+
+        /// <summary>
+        /// Attach to another process's ring as a reader; null while the file is still being initialised or
+        /// does not hold a ring of this layout version. A reader from the start also gets the events still held in
+        /// the ring, otherwise only events published after it attached.
+        /// </summary>
+        public static SharedMemoryRing? Open(string path, bool fromStart)
+        {
+            var stream = new FileStream(path, FileMode.Open, FileAccess.ReadWrite, FileShare.ReadWrite | FileShare.Delete);
+            if (stream.Length < HeaderSize)
+            {
+                stream.Dispose();
+                return null;
+            }
+
+            var length = stream.Length;
+            return Map(path, stream, header =>
+                Volatile.Read(ref *(int*)header) == Magic
+                && *(int*)(header + VersionOffset) == LayoutVersion
+                && HeaderSize + (long)*(int*)(header + SlotCountOffset) * *(int*)(header + SlotSizeOffset) == length, isOwner: false, fromStart);
+        }
+
+        private delegate bool HeaderInitializer(byte* header);
+
+        private static SharedMemoryRing? Map(string path, FileStream stream, HeaderInitializer initialize, bool isOwner,
+            bool fromStart)
+        {
+            MemoryMappedFile? file = null;
+            MemoryMappedViewAccessor? view = null;
+            var acquired = false;
+            try
+            {
+                file = MemoryMappedFile.CreateFromFile(stream, null, 0, MemoryMappedFileAccess.ReadWrite,
+                    HandleInheritability.None, leaveOpen: false);
+                view = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.ReadWrite);
+
+                byte* pointer = null;
+                view.SafeMemoryMappedViewHandle.AcquirePointer(ref pointer);
+                acquired = true;
+                pointer += view.PointerOffset;
+
+                if (!initialize(pointer))
+                {
+                    view.SafeMemoryMappedViewHandle.ReleasePointer();
+                    view.Dispose();
+                    file.Dispose();
+                    return null;
+                }
+
+                return new SharedMemoryRing(path, file, view, pointer, isOwner, fromStart);
+            }
+            catch
+            {
+                if (acquired)
+                {
+                    view!.SafeMemoryMappedViewHandle.ReleasePointer();
+                }
+                view?.Dispose();
+                if (file != null)
+                {
+                    file.Dispose();
+                }
+                else
+                {
+                    stream.Dispose();
+                }
+                throw;
+            }
+        }
+
+        #endregion
+
+        #region Writer
+
+        /// <summary>
+        /// Publish one message. Threads of the owning process are serialised here, which keeps the ring
+        /// single-producer.
+        /// </summary>
+        public void Write(ReadOnlySpan<byte> message)
+        {
+            if (message.Length > MaxMessageSize)
+            {
+                throw new InvalidOperationException(
+                    $"Event of {message.Length} bytes exceeds the shared memory ring limit of {MaxMessageSize} bytes");
+            }
+
+            var fragments = Math.Max(1, (message.Length + _payloadCapacity - 1) / _payloadCapacity);
+
+            lock (_writeLock)
+            {
+                var sequence = Volatile.Read(ref WriteSequence);
+                for (int fragment = 0; fragment < fragments; fragment++)
+                {
+                    var slotSequence = sequence + 1 + fragment;
+                    var slot = Slot(slotSequence);
+
+                    // Full fence: readers must see the slot as in progress before any payload byte changes
+                    Interlocked.Exchange(ref *(long*)slot, -slotSequence);
+                    *(int*)(slot + 8) = message.Length;
+                    *(int*)(slot + 12) = fragment;
+
+                    var offset = fragment * _payloadCapacity;
+                    var chunk = message.Slice(offset, Math.Min(_payloadCapacity, message.Length - offset));
+                    chunk.CopyTo(new Span<byte>(slot + SlotHeaderSize, chunk.Length));
+
+                    Volatile.Write(ref *(long*)slot, slotSequence);
+                }
+
+                // Full fence as well, so the caller's check of a reader's sleeping flag happens after publishing
+                Interlocked.Exchange(ref WriteSequence, sequence + fragments);
+            }
+        }
+
+        public void Heartbeat() => Volatile.Write(ref *(long*)(_base + HeartbeatOffset), DateTime.UtcNow.Ticks);
+
+        #endregion
+
+        #region Reader
+
+        public bool HasPending => Volatile.Read(ref WriteSequence) > _readSequence;
+
+        /// <summary>
+        /// Hand up to maxMessages complete messages to handler; returns how many were delivered
+        /// </summary>
+        public int Drain(RingMessageHandler handler, int maxMessages)
+        {
+            var delivered = 0;
+
+            while (delivered < maxMessages)
+            {
+                var published = Volatile.Read(ref WriteSequence);
+                var next = _readSequence + 1;
+                if (next > published)
+                {
+                    break;
+                }
+
+                // Lapped: everything older than one ring length is gone
+                if (published - next >= _slotCount)
+                {
+                    var resume = published - _slotCount + 1;
+                    Interlocked.Add(ref _lostSlots, resume - next);
+                    _readSequence = resume - 1;
+                    continue;
+                }
+
+                var consumed = TryRead(next, published, out var length);
+                if (consumed > 0 && length >= 0)
+                {
+                    _readSequence = next + consumed - 1;
+                    handler(_readBuffer.AsSpan(0, length));
+                    delivered++;
+                }
+                else
+                {
+                    // Overwritten during the copy, or the middle of a message whose start was lapped
+                    if (consumed == 0)
+                    {
+                        Interlocked.Increment(ref _lostSlots);
+                    }
+                    _readSequence = next;
+                }
+            }
+
+            return delivered;
+        }
+
+        /// <summary>
+        /// Copy the message starting at sequence into the read buffer. Returns the slots it took, with length -1
+        /// for a continuation slot, or 0 when the writer reused a slot during the copy.
+        /// </summary>
+        private int TryRead(long sequence, long published, out int length)
+        {
+            length = -1;
+            var first = Slot(sequence);
+            if (Volatile.Read(ref *(long*)first) != sequence)
+            {
+                return 0;
+            }
+
+            var messageLength = *(int*)(first + 8);
+            var fragmentIndex = *(int*)(first + 12);
+            if (fragmentIndex != 0)
+            {
+                return 1;
+            }
+            if (messageLength < 0 || messageLength > MaxMessageSize)
+            {
+                return 0;
+            }
+
+            var fragments = Math.Max(1, (messageLength + _payloadCapacity - 1) / _payloadCapacity);
+            if (sequence + fragments - 1 > published)
+            {
+                return 0;
+            }
+
+            if (_readBuffer.Length < messageLength)
+            {
+                _readBuffer = new byte[Math.Max(messageLength, Math.Min(MaxMessageSize, _readBuffer.Length * 2))];
+            }
+
+            for (int fragment = 0; fragment < fragments; fragment++)
+            {
+                var slot = Slot(sequence + fragment);
+                var offset = fragment * _payloadCapacity;
+                var chunk = Math.Min(_payloadCapacity, messageLength - offset);
+                new ReadOnlySpan<byte>(slot + SlotHeaderSize, chunk).CopyTo(_readBuffer.AsSpan(offset, chunk));
+            }
+
+            // The copy must complete before the sequences are checked again
+            Interlocked.MemoryBarrier();
+            for (int fragment = 0; fragment < fragments; fragment++)
+            {
+                if (Volatile.Read(ref *(long*)Slot(sequence + fragment)) != sequence + fragment)
+                {
+                    return 0;
+                }
+            }
+
+            length = messageLength;
+            return fragments;
+        }
+
+        #endregion
+
+        #region Doorbell
+
+        /// <summary>
+        /// Owner side: announce sleeping before the final check for pending messages; full fence
+        /// </summary>
+        public void SetSleeping(bool sleeping) => Interlocked.Exchange(ref Sleeping, sleeping ? 1 : 0);
+
+        /// <summary>
+        /// Doorbell value to pass to WaitForDoorbell, read before the final check for pending messages
+        /// </summary>
+        public int ReadDoorbell() => Volatile.Read(ref Doorbell);
+
+        /// <summary>
+        /// Owner side: sleep until the doorbell moves past observed or the timeout passes
+        /// </summary>
+        public void WaitForDoorbell(int observed, int timeoutMs) => _signal.Wait(observed, timeoutMs);
+
+        /// <summary>
+        /// Writer side, on a reader's ring: wake its owner if it sleeps; call after publishing
+        /// </summary>
+        public bool RingDoorbellIfSleeping()
+        {
+            if (Volatile.Read(ref Sleeping) == 0)
+            {
+                return false;
+            }
+
+            Interlocked.Increment(ref Doorbell);
+            _signal.Wake();
+            return true;
+        }
+
+        #endregion
+
+        #region Lifetime
+
+        /// <summary>
+        /// Keep the mapping alive while another thread uses the ring; false once it is being unmapped
+        /// </summary>
+        public bool TryAddReference()
+        {
+            while (true)
+            {
+                var references = Volatile.Read(ref _references);
+                if (references == 0)
+                {
+                    return false;
+                }
+                if (Interlocked.CompareExchange(ref _references, references + 1, references) == references)
+                {
+                    return true;
+                }
+            }
+        }
+
+        public void Release()
+        {
+            if (Interlocked.Decrement(ref _references) == 0)
+            {
+                _signal.Dispose();
+                _view.SafeMemoryMappedViewHandle.ReleasePointer();
+                _view.Dispose();
+                _file.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Drop the creator's reference; the mapping goes away once other users released theirs
+        /// </summary>
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _disposed, 1) == 0)
+            {
+                Release();
+            }
+        }
+
+        #endregion
+
+        private byte* Slot(long sequence) => _base + HeaderSize + (sequence & _slotMask) * _slotSize;
+    }
+}
@@ -0,0 +1,62 @@
+using System;
+
+namespace CxLanguage.Runtime.SharedMemory
+{
+    /// <summary>
+    /// Same-host inter-process event transport settings, bound from the "SharedMemoryTransport" configuration
+    /// section. Processes that use the same Directory and ScopeName see each other's events through
+    /// SharedMemoryEventBus; each process publishes into its own memory-mapped ring and reads everyone else's.
+    /// </summary>
+    public class SharedMemoryTransportOptions
+    {
+        public const string SectionName = "SharedMemoryTransport";
+
+        /// <summary>
+        /// Wrap the process event bus in SharedMemoryEventBus
+        /// </summary>
+        public bool Enabled { get; set; }
+
+        /// <summary>
+        /// Processes only exchange events with processes of the same scope
+        /// </summary>
+        public string ScopeName { get; set; } = "default";
+
+        /// <summary>
+        /// Directory holding the ring files; defaults to /dev/shm/cx-events where it exists, otherwise the temp directory
+        /// </summary>
+        public string? Directory { get; set; }
+
+        /// <summary>
+        /// Slots per ring, rounded up to a power of two. A reader that falls this many slots behind loses the
+        /// oldest events rather than slowing the writer down.
+        /// </summary>
+        public int SlotCount { get; set; } = 4096;
+
+        /// <summary>
+        /// Bytes per slot including its 16-byte header; larger events span consecutive slots
+        /// </summary>
+        public int SlotSize { get; set; } = 1024;
+
+        /// <summary>
+        /// How long the reader keeps polling after the last event before it sleeps on its doorbell
+        /// </summary>
+        public int SpinMicroseconds { get; set; } = 50;
+
+        /// <summary>
+        /// Interval for scanning the directory for new and exited processes
+        /// </summary>
+        public int DiscoveryIntervalMs { get; set; } = 500;
+
+        /// <summary>
+        /// Only events whose names start with one of these prefixes are published; empty publishes every event
+        /// not excluded below
+        /// </summary>
+        public string[] IncludedEventPrefixes { get; set; } = Array.Empty<string>();
+
+        /// <summary>
+        /// Events kept in-process: console output and AI service requests are handled by the process that emitted them.
+        /// Configured entries are added to these defaults.
+        /// </summary>
+        public string[] ExcludedEventPrefixes { get; set; } = { "system.", "ai." };
+    }
+}
@@ -1,10 +1,14 @@
 using System;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Linq;
+using System.Threading;
 using System.Threading.Tasks;
 using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
 using CxLanguage.Core.Events;
+using CxLanguage.Core.Telemetry;
 
 namespace CxLanguage.Runtime
 {
@@ -102,17 +106,84 @@ namespace CxLanguage.Runtime
         private readonly ConcurrentDictionary<string, List<CxEventHandler>> _icxHandlers = new(); // For ICxEventBus compatibility
         private readonly ConcurrentDictionary<string, HashSet<string>> _channelMembers = new();
         private readonly ConcurrentDictionary<string, HashSet<string>> _roleMembers = new();
+        private readonly EventRoutingIndex _routingIndex = new();
         private readonly ILogger<UnifiedEventBus>? _logger;
         private readonly object _lock = new object();
+        private EventDispatchQueue<QueuedEmit>? _dispatchQueue;
+
+        /// <summary>
+        /// Fire-and-forget emit waiting in the dispatch queue; TraceParent links the dispatch span to the emitter
+        /// </summary>
+        private readonly record struct QueuedEmit(string EventName, object? Data, string Source, UnifiedEventScope? Scope,
+            ActivityContext TraceParent);
+
+        private static readonly CxObjectPool<EventPayload> _payloadPool = new(
+            () => new EventPayload(),
+            payload =>
+            {
+                payload.EventName = string.Empty;
+                payload.Data = null;
+                payload.Source = "Unknown";
+                payload.TargetScope = string.Empty;
+            });
+
+        #endregion
+
+        #region Properties
+
+        /// <summary>
+        /// Low-allocation dispatch mode: payloads and handler envelopes are pooled and no task list is built
+        /// when handlers complete synchronously. Handlers must not keep a reference to the EventPayload
+        /// (or the CxEvent passed to compiled instance handlers) after their returned task completes.
+        /// </summary>
+        public bool LowAllocationDispatch { get; set; }
+
+        /// <summary>
+        /// True when synchronous Emit goes through the bounded dispatch queue instead of one task per event
+        /// </summary>
+        public bool QueuedDispatch => _dispatchQueue != null;
 
         #endregion
 
         #region Constructors
 
-        public UnifiedEventBus(ILogger<UnifiedEventBus>? logger = null)
+        public UnifiedEventBus(ILogger<UnifiedEventBus>? logger = null, IOptions<EventDispatchOptions>? dispatchOptions = null)
         {
             _logger = logger;
             _logger?.LogInformation("Unified Event Bus initialized");
+
+            if (dispatchOptions?.Value is { Enabled: true } options)
+            {
+                ConfigureQueuedDispatch(options);
+            }
+        }
+
+        /// <summary>
+        /// Switch synchronous Emit to bounded, partition-ordered queued dispatch, or back to one task per
+        /// event when options is null. Events already queued on a replaced queue are still delivered.
+        /// </summary>
+        public void ConfigureQueuedDispatch(EventDispatchOptions? options)
+        {
+            EventDispatchQueue<QueuedEmit>? queue = null;
+            if (options != null)
+            {
+                Func<QueuedEmit, string> partitionKey = options.PartitionBy == EventPartitionKey.Source
+                    ? e => e.Source
+                    : e => e.EventName;
+                queue = new EventDispatchQueue<QueuedEmit>(options, partitionKey, DispatchQueuedAsync, _logger,
+                    nameof(UnifiedEventBus));
+            }
+
+            Interlocked.Exchange(ref _dispatchQueue, queue)?.Dispose();
+        }
+
+        /// <summary>
+        /// Wait until every event accepted by the dispatch queue has been delivered, and stop queued dispatch
+        /// </summary>
+        public Task CompleteQueuedDispatchAsync()
+        {
+            var queue = Interlocked.Exchange(ref _dispatchQueue, null);
+            return queue?.CompleteAsync() ?? Task.CompletedTask;
         }
 
         #endregion
@@ -199,6 +270,12 @@ namespace CxLanguage.Runtime
         public void Emit(string eventName, object payload)
         {
             // Emit through unified event system
+            if (_dispatchQueue?.Enqueue(new QueuedEmit(eventName, payload, "ICxEventBus", UnifiedEventScope.Global,
+                    Activity.Current?.Context ?? default)) == true)
+            {
+                return;
+            }
+
             Task.Run(async () => await EmitUnifiedAsync(eventName, payload, "ICxEventBus", UnifiedEventScope.Global));
         }
 
@@ -214,6 +291,12 @@ namespace CxLanguage.Runtime
             if (_icxHandlers.TryGetValue(eventName, out var handlers))
             {
                 var eventPayload = new CxEventPayload(eventName, payload ?? new Dictionary<string, object>());
+                if (LowAllocationDispatch)
+                {
+                    await InvokeCxHandlersAsync(handlers, eventPayload);
+                    return;
+                }
+
                 var tasks = handlers.Select(h => h(eventPayload));
                 await Task.WhenAll(tasks);
             }
@@ -348,6 +431,7 @@ namespace CxLanguage.Runtime
             }
 
             subscriptionHandlers[eventPattern].Add(handler);
+            _routingIndex.Add(subscription, eventPattern, handler);
 
             _logger?.LogDebug("Subscription {Name} subscribed to: {Pattern}", subscription.Name, eventPattern);
             return true;
@@ -356,9 +440,70 @@ namespace CxLanguage.Runtime
         /// <summary>
         /// Emit an event through the unified event system with intelligent scoping
         /// </summary>
-        public async Task EmitUnifiedAsync(string eventName, object? data = null, string source = "System",
+        public Task EmitUnifiedAsync(string eventName, object? data = null, string source = "System",
             UnifiedEventScope? forcedScope = null, string? targetChannel = null, string? targetRole = null)
         {
+            if (!InstrumentationEnabled)
+            {
+                return DispatchAsync(eventName, data, source, forcedScope, targetChannel, targetRole);
+            }
+
+            return DispatchInstrumentedAsync(eventName, data, source, forcedScope, targetChannel, targetRole,
+                ActivityKind.Producer, default);
+        }
+
+        private static bool InstrumentationEnabled =>
+            CxDiagnostics.EventsEmitted.Enabled || CxDiagnostics.EventDispatchDuration.Enabled || CxDiagnostics.ActivitySource.HasListeners();
+
+        /// <summary>
+        /// Dispatch of a queued emit, traced as a consumer of the span that was current when Emit was called
+        /// </summary>
+        private Task DispatchQueuedAsync(QueuedEmit e)
+        {
+            if (!InstrumentationEnabled)
+            {
+                return DispatchAsync(e.EventName, e.Data, e.Source, e.Scope, null, null);
+            }
+
+            return DispatchInstrumentedAsync(e.EventName, e.Data, e.Source, e.Scope, null, null, ActivityKind.Consumer, e.TraceParent);
+        }
+
+        /// <summary>
+        /// Dispatch inside a "cx.event.emit" span and record emit count and end-to-end dispatch latency.
+        /// Handler spans started by the standard dispatch path become children of the emit span.
+        /// </summary>
+        private async Task DispatchInstrumentedAsync(string eventName, object? data, string source,
+            UnifiedEventScope? forcedScope, string? targetChannel, string? targetRole, ActivityKind kind, ActivityContext parent)
+        {
+            var eventTag = CxDiagnostics.Tag(CxDiagnostics.EventNameTag, eventName);
+            CxDiagnostics.EventsEmitted.Add(1, eventTag);
+            var start = CxDiagnostics.StartTimestamp(CxDiagnostics.EventDispatchDuration);
+
+            using var activity = CxDiagnostics.ActivitySource.StartActivity("cx.event.emit", kind, parent);
+            activity?.SetTag(CxDiagnostics.EventNameTag, eventName);
+            activity?.SetTag("cx.event.source", source);
+
+            try
+            {
+                await DispatchAsync(eventName, data, source, forcedScope, targetChannel, targetRole);
+            }
+            finally
+            {
+                CxDiagnostics.RecordDuration(CxDiagnostics.EventDispatchDuration, start, eventTag);
+            }
+        }
+
+        private async Task DispatchAsync(string eventName, object? data, string source,
+            UnifiedEventScope? forcedScope, string? targetChannel, string? targetRole)
+        {
+            var routes = _routingIndex.GetRoutes(eventName);
+
+            if (LowAllocationDispatch)
+            {
+                await DispatchPooledAsync(routes, eventName, data, source, forcedScope, targetChannel, targetRole);
+                return;
+            }
+
             var payload = new EventPayload
             {
                 EventName = eventName,
@@ -372,21 +517,18 @@ namespace CxLanguage.Runtime
             var tasks = new List<Task>();
             var handlerCount = 0;
 
-            foreach (var subscriptionKvp in _subscriptions.Where(s => s.Value.IsActive))
+            // Pattern matching is resolved once per event name by the routing index; only scoping is evaluated per emit
+            foreach (var route in routes)
             {
-                var subscriptionId = subscriptionKvp.Key;
-                var subscription = subscriptionKvp.Value;
+                var subscription = route.Subscription;
 
                 // Apply scoping logic
-                if (!ShouldReceiveEvent(subscription, eventName, forcedScope, targetChannel, targetRole))
+                if (!subscription.IsActive || !ShouldReceiveEvent(subscription, eventName, forcedScope, targetChannel, targetRole))
                 {
                     continue;
                 }
 
-                // Get matching handlers for this subscription
-                var matchingHandlers = GetMatchingHandlers(subscriptionId, eventName, subscription);
-
-                foreach (var handler in matchingHandlers)
+                foreach (var handler in route.Handlers)
                 {
                     try
                     {
@@ -420,235 +562,232 @@ namespace CxLanguage.Runtime
         }
 
         /// <summary>
-        /// Synchronous emit for compiled CX compatibility
+        /// Low-allocation dispatch: one pooled payload per receiving subscription, and a pending-task list
+        /// only when at least one handler completes asynchronously
         /// </summary>
-        public void Emit(string eventName, object? data = null, string source = "System")
+        private ValueTask DispatchPooledAsync(EventRoute[] routes, string eventName, object? data, string source,
+            UnifiedEventScope? forcedScope, string? targetChannel, string? targetRole)
         {
-            Task.Run(async () => await EmitUnifiedAsync(eventName, data, source));
-        }
+            var timestamp = DateTime.UtcNow;
+            List<Task>? pending = null;
+            List<EventPayload>? pendingPayloads = null;
 
-        /// <summary>
-        /// Unregister a subscription from the event bus
-        /// </summary>
-        public bool UnregisterSubscription(string subscriptionId)
-        {
-            if (!_subscriptions.TryRemove(subscriptionId, out var subscription))
+            foreach (var route in routes)
             {
-                return false;
-            }
-
-            // Clean up handlers
-            _handlers.TryRemove(subscriptionId, out _);
+                var subscription = route.Subscription;
 
-            // Clean up membership tracking
-            CleanupMembership(subscriptionId, subscription);
-
-            _logger?.LogInformation("Unregistered subscription: {Name} ({Id})", subscription.Name, subscriptionId);
-            return true;
-        }
-
-        #endregion
+                if (!subscription.IsActive || !ShouldReceiveEvent(subscription, eventName, forcedScope, targetChannel, targetRole))
+                {
+                    continue;
+                }
 
-        #region Event Matching and Scoping Logic
+                var payload = _payloadPool.Rent();
+                payload.EventName = eventName;
+                payload.Data = data;
+                payload.Timestamp = timestamp;
+                payload.Source = route.GetContextualSource(source);
+                payload.TargetScope = route.TargetScope;
 
-        /// <summary>
-        /// Determine if a subscription should receive an event based on scoping rules
-        /// </summary>
-        private bool ShouldReceiveEvent(EventSubscription subscription, string eventName,
-            UnifiedEventScope? forcedScope = null, string? targetChannel = null, string? targetRole = null)
-        {
-            var effectiveScope = forcedScope ?? subscription.Scope;
+                var payloadInUse = false;
+                foreach (var handler in route.Handlers)
+                {
+                    var task = InvokePooledHandler(handler, payload, subscription);
+                    if (!task.IsCompletedSuccessfully)
+                    {
+                        (pending ??= new List<Task>()).Add(task);
+                        payloadInUse = true;
+                    }
+                }
 
-            // Apply event filters if configured
-            if (subscription.EventFilters.Count > 0 && !subscription.EventFilters.Contains(eventName))
-            {
-                return false;
+                if (payloadInUse)
+                {
+                    (pendingPayloads ??= new List<EventPayload>()).Add(payload);
+                }
+                else
+                {
+                    _payloadPool.Return(payload);
+                }
             }
 
-            return effectiveScope switch
+            if (pending == null)
             {
-                UnifiedEventScope.Global => true,
-
-                UnifiedEventScope.Agent => true, // Agent events should receive events
-
-                UnifiedEventScope.Channel => targetChannel == null || subscription.Channels.Contains(targetChannel),
-
-                UnifiedEventScope.Role => targetRole == null || subscription.Role == targetRole,
-
-                UnifiedEventScope.Namespace => IsNamespaceMatch(eventName, subscription.NamespacePrefix),
+                return default;
+            }
 
-                _ => true
-            };
+            return new ValueTask(AwaitPendingHandlersAsync(pending, pendingPayloads!, eventName));
         }
 
-        /// <summary>
-        /// Get handlers that match the event name for a specific subscription
-        /// </summary>
-        private List<EventHandler> GetMatchingHandlers(string subscriptionId, string eventName, EventSubscription subscription)
+        private Task InvokePooledHandler(EventHandler handler, EventPayload payload, EventSubscription subscription)
         {
-            var matchingHandlers = new List<EventHandler>();
-
-            if (!_handlers.TryGetValue(subscriptionId, out var subscriptionHandlers))
+            CxDiagnostics.EventHandlerInvocations.Add(1);
+            if (CxDiagnostics.EventHandlerDuration.Enabled || CxDiagnostics.ActivitySource.HasListeners())
             {
-                return matchingHandlers;
+                return InvokePooledHandlerInstrumentedAsync(handler, payload, subscription);
             }
 
-            foreach (var handlerEntry in subscriptionHandlers)
+            try
             {
-                var pattern = handlerEntry.Key;
-                var handlers = handlerEntry.Value;
-
-                if (IsEventMatch(eventName, pattern, subscription))
-                {
-                    matchingHandlers.AddRange(handlers);
-                    _logger?.LogTrace("Pattern {Pattern} matches event {EventName} for subscription {Name}",
-                        pattern, eventName, subscription.Name);
-                }
+                return handler(payload);
+            }
+            catch (Exception ex)
+            {
+                // Counted with the other faulted tasks once the pending handlers are awaited
+                _logger?.LogError(ex, "Handler execution failed for subscription {Name}: {EventName}",
+                    subscription.Name, payload.EventName);
+                return Task.FromException(ex);
             }
-
-            return matchingHandlers;
         }
 
         /// <summary>
-        /// Check if an event matches a pattern for a specific subscription
+        /// Pooled handler invocation inside a "cx.event.handle" span, recording its duration. Only taken while a
+        /// listener is attached, so the uninstrumented path stays allocation-free.
         /// </summary>
-        private bool IsEventMatch(string eventName, string pattern, EventSubscription subscription)
+        private async Task InvokePooledHandlerInstrumentedAsync(EventHandler handler, EventPayload payload, EventSubscription subscription)
         {
-            // Exact match
-            if (eventName == pattern)
-            {
-                return true;
-            }
+            // The payload goes back to the pool once the handler completes; read what the finally needs up front
+            var eventName = payload.EventName;
+            var start = CxDiagnostics.StartTimestamp(CxDiagnostics.EventHandlerDuration);
+            using var activity = CxDiagnostics.ActivitySource.StartActivity("cx.event.handle");
+            activity?.SetTag(CxDiagnostics.EventNameTag, eventName);
+            activity?.SetTag(CxDiagnostics.HandlerTag, subscription.Name);
 
-            // Handle .any. wildcard patterns for ALL scopes (not just namespace scope)
-            if (pattern.Contains(".any."))
+            try
             {
-                return IsNamespacePatternMatch(eventName, pattern);
+                await handler(payload);
             }
-
-            // Handle namespace-scoped patterns
-            if (subscription.Scope == UnifiedEventScope.Namespace)
+            catch (Exception ex)
             {
-                return IsNamespacePatternMatch(eventName, pattern);
+                // Counted with the other faulted tasks once the pending handlers are awaited
+                activity?.SetStatus(ActivityStatusCode.Error, ex.Message);
+                _logger?.LogError(ex, "Handler execution failed for subscription {Name}: {EventName}",
+                    subscription.Name, eventName);
+                throw;
             }
-
-            // Handle wildcard patterns
-            if (pattern.Contains("*"))
+            finally
             {
-                return IsWildcardMatch(eventName, pattern);
+                CxDiagnostics.RecordDuration(CxDiagnostics.EventHandlerDuration, start,
+                    CxDiagnostics.Tag(CxDiagnostics.EventNameTag, eventName), CxDiagnostics.Tag(CxDiagnostics.HandlerTag, subscription.Name));
             }
-
-            return false;
         }
 
-        /// <summary>
-        /// Check namespace pattern matching (e.g., "global.*", "agent.alice.*")
-        /// </summary>
-        private bool IsNamespacePatternMatch(string eventName, string pattern)
+        private async Task AwaitPendingHandlersAsync(List<Task> pending, List<EventPayload> payloads, string eventName)
         {
-            if (pattern.EndsWith("*"))
+            try
             {
-                var prefix = pattern[..^1]; // Remove trailing *
-                return eventName.StartsWith(prefix);
+                await Task.WhenAll(pending);
             }
-
-            if (pattern.Contains(".any."))
+            catch (Exception ex)
             {
-                var parts = eventName.Split('.');
-                var patternParts = pattern.Split('.');
-
-                if (parts.Length != patternParts.Length)
+                CxDiagnostics.EventHandlerFailures.Add(pending.Count(t => t.IsFaulted));
+                _logger?.LogError(ex, "Error executing handlers for event: {EventName}", eventName);
+            }
+            finally
+            {
+                foreach (var payload in payloads)
                 {
-                    return false;
+                    _payloadPool.Return(payload);
                 }
+            }
+        }
 
-                for (int i = 0; i < parts.Length; i++)
-                {
-                    if (patternParts[i] == "any")
-                    {
-                        continue;
-                    }
+        /// <summary>
+        /// Invoke ICxEventBus handlers without materializing a task list when they complete synchronously
+        /// </summary>
+        private static ValueTask InvokeCxHandlersAsync(List<CxEventHandler> handlers, CxEventPayload eventPayload)
+        {
+            List<Task>? pending = null;
 
-                    if (parts[i] != patternParts[i])
-                    {
-                        return false;
-                    }
+            for (int i = 0; i < handlers.Count; i++)
+            {
+                var task = handlers[i](eventPayload);
+                if (!task.IsCompletedSuccessfully)
+                {
+                    (pending ??= new List<Task>()).Add(task);
                 }
-
-                return true;
             }
 
-            return false;
+            return pending == null ? default : new ValueTask(Task.WhenAll(pending));
         }
 
         /// <summary>
-        /// Check if event matches namespace prefix
+        /// Synchronous emit for compiled CX compatibility
         /// </summary>
-        private bool IsNamespaceMatch(string eventName, string namespacePrefix)
+        public void Emit(string eventName, object? data = null, string source = "System")
         {
-            if (string.IsNullOrEmpty(namespacePrefix))
+            if (_dispatchQueue?.Enqueue(new QueuedEmit(eventName, data, source, null, Activity.Current?.Context ?? default)) == true)
             {
-                return true;
+                return;
             }
 
-            return eventName.StartsWith(namespacePrefix);
+            Task.Run(async () => await EmitUnifiedAsync(eventName, data, source));
         }
 
         /// <summary>
-        /// Basic wildcard matching - handles both * and .any. patterns
+        /// Unregister a subscription from the event bus
         /// </summary>
-        private bool IsWildcardMatch(string eventName, string pattern)
+        public bool UnregisterSubscription(string subscriptionId)
         {
-            if (pattern == "any")
-            {
-                return true;
-            }
-
-            // Handle CX .any. wildcard patterns
-            if (pattern.Contains(".any."))
+            if (!_subscriptions.TryRemove(subscriptionId, out var subscription))
             {
-                return IsCxAnyPatternMatch(eventName, pattern);
+                return false;
             }
 
-            if (pattern.EndsWith("*"))
-            {
-                var prefix = pattern[..^1];
-                return eventName.StartsWith(prefix);
-            }
+            // Clean up handlers
+            _handlers.TryRemove(subscriptionId, out _);
+            _routingIndex.RemoveSubscription(subscriptionId);
 
-            if (pattern.StartsWith("*"))
-            {
-                var suffix = pattern[1..];
-                return eventName.EndsWith(suffix);
-            }
+            // Clean up membership tracking
+            CleanupMembership(subscriptionId, subscription);
 
-            return false;
+            _logger?.LogInformation("Unregistered subscription: {Name} ({Id})", subscription.Name, subscriptionId);
+            return true;
         }
 
+        #endregion
+
+        #region Event Matching and Scoping Logic
+
         /// <summary>
-        /// Match CX .any. wildcard patterns like user.any.action, any.any.alert
+        /// Determine if a subscription should receive an event based on scoping rules
         /// </summary>
-        private bool IsCxAnyPatternMatch(string eventName, string pattern)
+        private bool ShouldReceiveEvent(EventSubscription subscription, string eventName,
+            UnifiedEventScope? forcedScope = null, string? targetChannel = null, string? targetRole = null)
         {
-            var eventParts = eventName.Split('.');
-            var patternParts = pattern.Split('.');
+            var effectiveScope = forcedScope ?? subscription.Scope;
 
-            // Must have same number of parts to match
-            if (eventParts.Length != patternParts.Length)
+            // Apply event filters if configured
+            if (subscription.EventFilters.Count > 0 && !subscription.EventFilters.Contains(eventName))
             {
                 return false;
             }
 
-            // Check each part - 'any' matches anything
-            for (int i = 0; i < patternParts.Length; i++)
+            return effectiveScope switch
             {
-                if (patternParts[i] != "any" && patternParts[i] != eventParts[i])
-                {
-                    return false;
-                }
+                UnifiedEventScope.Global => true,
+
+                UnifiedEventScope.Agent => true, // Agent events should receive events
+
+                UnifiedEventScope.Channel => targetChannel == null || subscription.Channels.Contains(targetChannel),
+
+                UnifiedEventScope.Role => targetRole == null || subscription.Role == targetRole,
+
+                UnifiedEventScope.Namespace => IsNamespaceMatch(eventName, subscription.NamespacePrefix),
+
+                _ => true
+            };
+        }
+
+        /// <summary>
+        /// Check if event matches namespace prefix
+        /// </summary>
+        private bool IsNamespaceMatch(string eventName, string namespacePrefix)
+        {
+            if (string.IsNullOrEmpty(namespacePrefix))
+            {
+                return true;
             }
 
-            return true;
+            return eventName.StartsWith(namespacePrefix);
         }
 
         /// <summary>
@@ -656,6 +795,12 @@ namespace CxLanguage.Runtime
         /// </summary>
         private async Task ExecuteHandlerWithContext(EventHandler handler, EventPayload payload, EventSubscription subscription)
         {
+            CxDiagnostics.EventHandlerInvocations.Add(1);
+            var start = CxDiagnostics.StartTimestamp(CxDiagnostics.EventHandlerDuration);
+            using var activity = CxDiagnostics.ActivitySource.StartActivity("cx.event.handle");
+            activity?.SetTag(CxDiagnostics.EventNameTag, payload.EventName);
+            activity?.SetTag(CxDiagnostics.HandlerTag, subscription.Name);
+
             try
             {
                 // Add subscription context to payload
@@ -672,10 +817,17 @@ namespace CxLanguage.Runtime
             }
             catch (Exception ex)
             {
+                CxDiagnostics.EventHandlerFailures.Add(1);
+                activity?.SetStatus(ActivityStatusCode.Error, ex.Message);
                 _logger?.LogError(ex, "Handler execution failed for subscription {Name}: {EventName}",
                     subscription.Name, payload.EventName);
                 throw;
             }
+            finally
+            {
+                CxDiagnostics.RecordDuration(CxDiagnostics.EventHandlerDuration, start,
+                    CxDiagnostics.Tag(CxDiagnostics.EventNameTag, payload.EventName), CxDiagnostics.Tag(CxDiagnostics.HandlerTag, subscription.Name));
+            }
         }
 
         #endregion
@@ -759,9 +911,15 @@ namespace CxLanguage.Runtime
                     .Where(s => s.IsActive)
                     .GroupBy(s => s.Role)
                     .ToDictionary(g => g.Key, g => g.Count()),
+                ["CachedEventRoutes"] = _routingIndex.CachedEventNames,
                 ["LastStatisticsUpdate"] = DateTime.UtcNow
             };
 
+            if (_dispatchQueue is { } queue)
+            {
+                stats["QueuedDispatch"] = queue.GetStatistics();
+            }
+
             return stats;
         }
 
@@ -799,6 +957,7 @@ namespace CxLanguage.Runtime
             _icxHandlers.Clear();
             _channelMembers.Clear();
             _roleMembers.Clear();
+            _routingIndex.Clear();
             _logger?.LogInformation("Unified Event Bus cleared - all registrations removed");
         }
 
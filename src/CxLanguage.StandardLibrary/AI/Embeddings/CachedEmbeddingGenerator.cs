@@ -0,0 +1,101 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Microsoft.Extensions.AI;
+
+namespace CxLanguage.StandardLibrary.AI.Embeddings;
+
+/// <summary>
+/// Embedding generator that answers from a shared EmbeddingCache and only sends unseen texts to the inner
+/// generator, in one batch per call. Duplicate texts within a call are embedded once.
+/// GetService(typeof(EmbeddingCache)) returns the cache, e.g. for metrics.
+/// </summary>
+public sealed class CachedEmbeddingGenerator : DelegatingEmbeddingGenerator<string, Embedding<float>>
+{
+    private readonly EmbeddingCache _cache;
+
+    /// <param name="innerGenerator">Generator used for cache misses</param>
+    /// <param name="cache">Cache shared with other generators; not disposed by this wrapper</param>
+    /// <param name="modelId">Model identity for cache keys; defaults to the inner generator's model id or type</param>
+    public CachedEmbeddingGenerator(IEmbeddingGenerator<string, Embedding<float>> innerGenerator, EmbeddingCache cache, string? modelId = null)
+        : base(innerGenerator)
+    {
+        _cache = cache ?? throw new ArgumentNullException(nameof(cache));
+        ModelId = modelId
+            ?? (innerGenerator.GetService(typeof(EmbeddingGeneratorMetadata)) as EmbeddingGeneratorMetadata)?.DefaultModelId
+            ?? innerGenerator.GetType().FullName
+            ?? "embedding-model";
+    }
+
+    /// <summary>
+    /// Model identity used in cache keys unless a request names its own ModelId
+    /// </summary>
+    public string ModelId { get; }
+
+    public override async Task<GeneratedEmbeddings<Embedding<float>>> GenerateAsync(
+        IEnumerable<string> values,
+        EmbeddingGenerationOptions? options = null,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(values);
+
+        var inputs = values as IList<string> ?? values.ToList();
+        var modelId = options?.ModelId ?? ModelId;
+        var results = new Embedding<float>[inputs.Count];
+
+        // Each distinct missing text is generated once and fanned out to every position that asked for it
+        var pending = new Dictionary<EmbeddingCacheKey, List<int>>();
+        var missKeys = new List<EmbeddingCacheKey>();
+        var missTexts = new List<string>();
+
+        for (int i = 0; i < inputs.Count; i++)
+        {
+            var key = EmbeddingCache.ComputeKey(modelId, options?.Dimensions, inputs[i]);
+            if (_cache.TryGet(key, out var vector))
+            {
+                results[i] = new Embedding<float>(vector) { ModelId = modelId };
+            }
+            else if (pending.TryGetValue(key, out var positions))
+            {
+                positions.Add(i);
+            }
+            else
+            {
+                pending[key] = new List<int> { i };
+                missKeys.Add(key);
+                missTexts.Add(inputs[i]);
+            }
+        }
+
+        UsageDetails? usage = null;
+        if (missTexts.Count > 0)
+        {
+            var generated = await base.GenerateAsync(missTexts, options, cancellationToken);
+            if (generated.Count != missTexts.Count)
+            {
+                throw new InvalidOperationException(
+                    $"Embedding generator returned {generated.Count} embeddings for {missTexts.Count} inputs");
+            }
+
+            for (int j = 0; j < generated.Count; j++)
+            {
+                _cache.Set(missKeys[j], generated[j].Vector.ToArray());
+                foreach (var position in pending[missKeys[j]])
+                {
+                    results[position] = generated[j];
+                }
+            }
+            usage = generated.Usage;
+        }
+
+        return new GeneratedEmbeddings<Embedding<float>>(results) { Usage = usage };
+    }
+
+    public override object? GetService(Type serviceType, object? serviceKey = null)
+    {
+        ArgumentNullException.ThrowIfNull(serviceType);
+        return serviceKey == null && serviceType == typeof(EmbeddingCache) ? _cache : base.GetService(serviceType, serviceKey);
+    }
+}
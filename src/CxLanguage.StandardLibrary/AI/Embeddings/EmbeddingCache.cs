@@ -0,0 +1,214 @@
+using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.Security.Cryptography;
+using System.Text;
+using System.Threading;
+using CxLanguage.Core.Telemetry;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
+
+namespace CxLanguage.StandardLibrary.AI.Embeddings;
+
+/// <summary>
+/// 128-bit content address of an embedding: the leading half of SHA-256 over model id, requested dimensions and text
+/// </summary>
+public readonly record struct EmbeddingCacheKey(ulong High, ulong Low);
+
+/// <summary>
+/// Process-wide embedding cache shared by every CachedEmbeddingGenerator.
+/// Entries are content-addressed, so the same text embedded by the vector store, semantic search and document
+/// ingestion is computed once. Memory is bounded by a byte budget with least-recently-used eviction; when a
+/// persistence directory is configured, every entry is also appended to a memory-mapped store, which serves
+/// entries evicted from memory and survives restarts.
+/// </summary>
+public sealed class EmbeddingCache : IDisposable
+{
+    /// <summary>
+    /// Approximate per-entry bookkeeping (node, dictionary slot, array header) counted against the budget
+    /// </summary>
+    private const int EntryOverheadBytes = 96;
+
+    private static readonly KeyValuePair<string, object?> MemoryHitTag = CxDiagnostics.Tag(CxDiagnostics.CacheResultTag, "memory_hit");
+    private static readonly KeyValuePair<string, object?> DiskHitTag = CxDiagnostics.Tag(CxDiagnostics.CacheResultTag, "disk_hit");
+    private static readonly KeyValuePair<string, object?> MissTag = CxDiagnostics.Tag(CxDiagnostics.CacheResultTag, "miss");
+
+    private readonly ILogger<EmbeddingCache>? _logger;
+    private readonly EmbeddingCacheOptions _options;
+    private readonly object _lock = new();
+    private readonly Dictionary<EmbeddingCacheKey, LinkedListNode<(EmbeddingCacheKey Key, float[] Vector)>> _entries = new();
+    private readonly LinkedList<(EmbeddingCacheKey Key, float[] Vector)> _lru = new();
+    private readonly MappedEmbeddingStore? _store;
+    private long _memoryBytes;
+    private long _memoryHits;
+    private long _diskHits;
+    private long _misses;
+    private long _evictions;
+    private int _storeFullReported;
+    private bool _disposed;
+
+    public EmbeddingCache(IOptions<EmbeddingCacheOptions>? options = null, ILogger<EmbeddingCache>? logger = null)
+    {
+        _logger = logger;
+        _options = options?.Value ?? new EmbeddingCacheOptions();
+
+        if (!string.IsNullOrEmpty(_options.PersistenceDirectory))
+        {
+            try
+            {
+                _store = new MappedEmbeddingStore(_options.PersistenceDirectory, _options.PersistentCapacityBytes);
+                _logger?.LogDebug("💾 Embedding cache store opened at {Path} with {Count} embeddings", _store.FilePath, _store.Count);
+            }
+            catch (Exception ex)
+            {
+                // Another process may hold the store; caching still works in memory
+                _logger?.LogWarning(ex, "⚠️ Embedding cache store unavailable, caching in memory only: {Error}", ex.Message);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Content address of a text for a model and requested dimension count
+    /// </summary>
+    public static EmbeddingCacheKey ComputeKey(string modelId, int? dimensions, string text)
+    {
+        var prefix = $"{modelId}\n{dimensions?.ToString() ?? ""}\n";
+        var length = Encoding.UTF8.GetMaxByteCount(prefix.Length + text.Length);
+        var buffer = ArrayPool<byte>.Shared.Rent(length);
+        try
+        {
+            var written = Encoding.UTF8.GetBytes(prefix, buffer);
+            written += Encoding.UTF8.GetBytes(text, buffer.AsSpan(written));
+
+            Span<byte> hash = stackalloc byte[32];
+            SHA256.HashData(buffer.AsSpan(0, written), hash);
+            return new EmbeddingCacheKey(BinaryPrimitives.ReadUInt64LittleEndian(hash), BinaryPrimitives.ReadUInt64LittleEndian(hash.Slice(8)));
+        }
+        finally
+        {
+            ArrayPool<byte>.Shared.Return(buffer);
+        }
+    }
+
+    /// <summary>
+    /// Look an embedding up in memory, then in the persistent store. The returned array is shared; do not modify it.
+    /// </summary>
+    public bool TryGet(EmbeddingCacheKey key, out float[] vector)
+    {
+        lock (_lock)
+        {
+            if (_entries.TryGetValue(key, out var node))
+            {
+                _lru.Remove(node);
+                _lru.AddFirst(node);
+                vector = node.Value.Vector;
+                _memoryHits++;
+                CxDiagnostics.EmbeddingCacheLookups.Add(1, MemoryHitTag);
+                return true;
+            }
+        }
+
+        if (_store != null && _store.TryRead(key, out vector))
+        {
+            Interlocked.Increment(ref _diskHits);
+            CxDiagnostics.EmbeddingCacheLookups.Add(1, DiskHitTag);
+            AddToMemory(key, vector);
+            return true;
+        }
+
+        Interlocked.Increment(ref _misses);
+        CxDiagnostics.EmbeddingCacheLookups.Add(1, MissTag);
+        vector = Array.Empty<float>();
+        return false;
+    }
+
+    /// <summary>
+    /// Cache an embedding. The cache keeps the array; do not modify it afterwards.
+    /// </summary>
+    public void Set(EmbeddingCacheKey key, float[] vector)
+    {
+        AddToMemory(key, vector);
+
+        if (_store != null && !_store.TryAppend(key, vector) && Interlocked.Exchange(ref _storeFullReported, 1) == 0)
+        {
+            _logger?.LogWarning("⚠️ Embedding cache store {Path} is full ({Capacity} bytes); new embeddings are cached in memory only",
+                _store.FilePath, _store.CapacityBytes);
+        }
+    }
+
+    /// <summary>
+    /// Hit, miss, eviction and size counters
+    /// </summary>
+    public Dictionary<string, object> GetStatistics()
+    {
+        long memoryHits, memoryBytes, evictions;
+        int entries;
+        lock (_lock)
+        {
+            memoryHits = _memoryHits;
+            memoryBytes = _memoryBytes;
+            evictions = _evictions;
+            entries = _entries.Count;
+        }
+
+        var diskHits = Interlocked.Read(ref _diskHits);
+        var misses = Interlocked.Read(ref _misses);
+        var lookups = memoryHits + diskHits + misses;
+
+        return new Dictionary<string, object>
+        {
+            ["embedding_cache_lookups"] = lookups,
+            ["embedding_cache_memory_hits"] = memoryHits,
+            ["embedding_cache_disk_hits"] = diskHits,
+            ["embedding_cache_misses"] = misses,
+            ["embedding_cache_hit_rate"] = lookups == 0 ? 0.0 : (double)(memoryHits + diskHits) / lookups,
+            ["embedding_cache_entries"] = entries,
+            ["embedding_cache_memory_bytes"] = memoryBytes,
+            ["embedding_cache_memory_budget_bytes"] = _options.MemoryBudgetBytes,
+            ["embedding_cache_evictions"] = evictions,
+            ["embedding_cache_persistent"] = _store != null,
+            ["embedding_cache_disk_entries"] = _store?.Count ?? 0,
+            ["embedding_cache_disk_bytes"] = _store?.CommittedBytes ?? 0L,
+            ["embedding_cache_disk_capacity_bytes"] = _store?.CapacityBytes ?? 0L
+        };
+    }
+
+    public void Dispose()
+    {
+        if (_disposed) return;
+        _disposed = true;
+        _store?.Dispose();
+    }
+
+    private void AddToMemory(EmbeddingCacheKey key, float[] vector)
+    {
+        var size = EntrySize(vector);
+        if (size > _options.MemoryBudgetBytes)
+        {
+            return;
+        }
+
+        lock (_lock)
+        {
+            if (_entries.TryGetValue(key, out var existing))
+            {
+                _lru.Remove(existing);
+                _memoryBytes -= EntrySize(existing.Value.Vector);
+            }
+
+            _entries[key] = _lru.AddFirst((key, vector));
+            _memoryBytes += size;
+
+            while (_memoryBytes > _options.MemoryBudgetBytes && _lru.Last is { } oldest)
+            {
+                _lru.RemoveLast();
+                _entries.Remove(oldest.Value.Key);
+                _memoryBytes -= EntrySize(oldest.Value.Vector);
+                _evictions++;
+            }
+        }
+    }
+
+    private static long EntrySize(float[] vector) => (long)vector.Length * sizeof(float) + EntryOverheadBytes;
+}
@@ -0,0 +1,29 @@
+using System;
+using System.IO;
+
+namespace CxLanguage.StandardLibrary.AI.Embeddings;
+
+/// <summary>
+/// Configuration for the shared EmbeddingCache, bound from the "EmbeddingCache" configuration section
+/// </summary>
+public class EmbeddingCacheOptions
+{
+    public const string SectionName = "EmbeddingCache";
+
+    /// <summary>
+    /// Bytes of vectors kept in memory before least recently used entries are evicted
+    /// </summary>
+    public long MemoryBudgetBytes { get; set; } = 256L * 1024 * 1024;
+
+    /// <summary>
+    /// Directory of the memory-mapped store that keeps embeddings across restarts. Null or empty keeps the cache
+    /// in memory only.
+    /// </summary>
+    public string? PersistenceDirectory { get; set; } = Path.Combine(
+        Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData), "CxLanguage", "EmbeddingCache");
+
+    /// <summary>
+    /// Size of the persistent store file. Once it is full, new embeddings are cached in memory only.
+    /// </summary>
+    public long PersistentCapacityBytes { get; set; } = 512L * 1024 * 1024;
+}
@@ -0,0 +1,211 @@
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+
+namespace CxLanguage.StandardLibrary.AI.Embeddings;
+
+/// <summary>
+/// Append-only, memory-mapped file of embeddings keyed by EmbeddingCacheKey.
+///
+/// Layout (little-endian):
+///   [0, 64)           header: magic "CXEMBC01", version, committed length, record count
+///   [64, committed)   records: [uint64 key high][uint64 key low][int32 dimension][dimension x fp32]
+///
+/// The file is mapped at its full capacity up front. A record is written before the committed length that covers
+/// it, so a process that dies mid-append leaves the previous state intact. The key index is rebuilt by one
+/// sequential scan on open.
+/// </summary>
+internal sealed class MappedEmbeddingStore : IDisposable
+{
+    public const string FileName = "embeddings.cxemb";
+
+    private const int HeaderSize = 64;
+    private const int RecordHeaderSize = 20;
+    private const int FormatVersion = 1;
+    private static ReadOnlySpan<byte> Magic => "CXEMBC01"u8;
+
+    private readonly object _lock = new();
+    private readonly Dictionary<EmbeddingCacheKey, (long Offset, int Dimension)> _index = new();
+    private readonly MemoryMappedFile _file;
+    private readonly MemoryMappedViewAccessor _view;
+    private readonly long _capacity;
+    private long _committed;
+    private bool _disposed;
+
+    public MappedEmbeddingStore(string directory, long capacityBytes)
+    {
+        if (!BitConverter.IsLittleEndian)
+        {
+            throw new PlatformNotSupportedException("The embedding store is stored little-endian");
+        }
+
+        Directory.CreateDirectory(directory);
+        FilePath = Path.Combine(directory, FileName);
+
+        var existingLength = File.Exists(FilePath) ? new FileInfo(FilePath).Length : 0;
+        _capacity = Math.Max(Math.Max(existingLength, capacityBytes), HeaderSize);
+        _file = MemoryMappedFile.CreateFromFile(FilePath, FileMode.OpenOrCreate, null, _capacity, MemoryMappedFileAccess.ReadWrite);
+        _view = _file.CreateViewAccessor(0, _capacity, MemoryMappedFileAccess.ReadWrite);
+
+        try
+        {
+            OpenOrInitialize(existingLength);
+        }
+        catch
+        {
+            _view.Dispose();
+            _file.Dispose();
+            throw;
+        }
+    }
+
+    public string FilePath { get; }
+
+    public long CapacityBytes => _capacity;
+
+    public long CommittedBytes
+    {
+        get { lock (_lock) return _committed; }
+    }
+
+    public int Count
+    {
+        get { lock (_lock) return _index.Count; }
+    }
+
+    public bool TryRead(EmbeddingCacheKey key, out float[] vector)
+    {
+        (long Offset, int Dimension) location;
+        lock (_lock)
+        {
+            if (_disposed || !_index.TryGetValue(key, out location))
+            {
+                vector = Array.Empty<float>();
+                return false;
+            }
+        }
+
+        // Committed records are never rewritten, so they can be read outside the lock
+        vector = new float[location.Dimension];
+        _view.ReadArray(location.Offset + RecordHeaderSize, vector, 0, vector.Length);
+        return true;
+    }
+
+    /// <summary>
+    /// Append a vector unless the key is already stored. Returns false when the store is full.
+    /// </summary>
+    public bool TryAppend(EmbeddingCacheKey key, float[] vector)
+    {
+        var recordSize = RecordHeaderSize + (long)vector.Length * sizeof(float);
+
+        lock (_lock)
+        {
+            if (_disposed)
+            {
+                return false;
+            }
+
+            if (_index.ContainsKey(key))
+            {
+                return true;
+            }
+
+            if (_committed + recordSize > _capacity)
+            {
+                return false;
+            }
+
+            var offset = _committed;
+            _view.Write(offset, key.High);
+            _view.Write(offset + 8, key.Low);
+            _view.Write(offset + 16, vector.Length);
+            _view.WriteArray(offset + RecordHeaderSize, vector, 0, vector.Length);
+
+            _committed = offset + recordSize;
+            _index[key] = (offset, vector.Length);
+            WriteHeaderCounters();
+            return true;
+        }
+    }
+
+    public void Flush()
+    {
+        lock (_lock)
+        {
+            if (!_disposed)
+            {
+                _view.Flush();
+            }
+        }
+    }
+
+    public void Dispose()
+    {
+        lock (_lock)
+        {
+            if (_disposed) return;
+            _disposed = true;
+            _view.Flush();
+            _view.Dispose();
+            _file.Dispose();
+        }
+    }
+
+    private void OpenOrInitialize(long existingLength)
+    {
+        var header = new byte[HeaderSize];
+        _view.ReadArray(0, header, 0, HeaderSize);
+
+        if (existingLength == 0 || header.AsSpan().IndexOfAnyExcept((byte)0) < 0)
+        {
+            Magic.CopyTo(header);
+            BinaryPrimitives.WriteInt32LittleEndian(header.AsSpan(8), FormatVersion);
+            _view.WriteArray(0, header, 0, HeaderSize);
+            _committed = HeaderSize;
+            WriteHeaderCounters();
+            return;
+        }
+
+        if (!header.AsSpan(0, 8).SequenceEqual(Magic))
+        {
+            throw new InvalidDataException($"{FilePath} is not a CX embedding store");
+        }
+
+        var version = BinaryPrimitives.ReadInt32LittleEndian(header.AsSpan(8));
+        if (version != FormatVersion)
+        {
+            throw new InvalidDataException($"Unsupported embedding store version {version}");
+        }
+
+        var committed = BinaryPrimitives.ReadInt64LittleEndian(header.AsSpan(16));
+        if (committed < HeaderSize || committed > _capacity)
+        {
+            throw new InvalidDataException($"Embedding store {FilePath} has an inconsistent header");
+        }
+
+        var offset = (long)HeaderSize;
+        while (offset + RecordHeaderSize <= committed)
+        {
+            var key = new EmbeddingCacheKey(_view.ReadUInt64(offset), _view.ReadUInt64(offset + 8));
+            var dimension = _view.ReadInt32(offset + 16);
+            var recordSize = RecordHeaderSize + (long)dimension * sizeof(float);
+            if (dimension <= 0 || offset + recordSize > committed)
+            {
+                break;
+            }
+
+            _index[key] = (offset, dimension);
+            offset += recordSize;
+        }
+
+        _committed = offset;
+    }
+
+    private void WriteHeaderCounters()
+    {
+        _view.Write(16, _committed);
+        _view.Write(24, (long)_index.Count);
+    }
+}
@@ -178,25 +178,39 @@ public class LocalLLMEventBridge
                 {
                     try
                     {
+                        var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                        long timeToFirstTokenMs = -1;
+                        var chunkIndex = 0;
+
                         _ = _eventBus.EmitAsync("local.llm.stream.started", new Dictionary<string, object>
                         {
                             ["prompt"] = promptStr,
                             ["consciousness"] = "streamStarted"
                         });
                         
-                        await foreach (var token in _localLLMService.StreamAsync(promptStr))
+                        // Chunks arrive as they are decoded; awaiting each emit keeps them in order
+                        await foreach (var chunk in _localLLMService.StreamAsync(promptStr))
                         {
-                            _ = _eventBus.EmitAsync("local.llm.stream.token.received", new Dictionary<string, object>
+                            if (chunkIndex == 0)
+                            {
+                                timeToFirstTokenMs = stopwatch.ElapsedMilliseconds;
+                            }
+
+                            await _eventBus.EmitAsync("local.llm.stream.chunk", new Dictionary<string, object>
                             {
-                                ["token"] = token,
+                                ["chunk"] = chunk,
+                                ["index"] = chunkIndex++,
                                 ["prompt"] = promptStr,
-                                ["consciousness"] = "streamToken"
+                                ["consciousness"] = "streamChunk"
                             });
                         }
                         
                         _ = _eventBus.EmitAsync("local.llm.stream.completed", new Dictionary<string, object>
                         {
                             ["prompt"] = promptStr,
+                            ["chunkCount"] = chunkIndex,
+                            ["timeToFirstTokenMs"] = timeToFirstTokenMs,
+                            ["generationTimeMs"] = stopwatch.ElapsedMilliseconds,
                             ["consciousness"] = "streamCompleted"
                         });
                         
@@ -7,6 +7,7 @@ using System.Text;
 using System.Text.Json;
 using System.Net.Http;
 using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
 using CxLanguage.StandardLibrary.Core;
 using CxLanguage.Core.Events;
 using System.ComponentModel;
@@ -27,6 +28,11 @@ namespace CxLanguage.StandardLibrary
         public ExecuteService(IServiceProvider serviceProvider, ILogger<ExecuteService> logger)
             : base(serviceProvider, logger)
         {
+            if (serviceProvider.GetService(typeof(IOptions<PowerShellPoolOptions>)) is IOptions<PowerShellPoolOptions> poolOptions)
+            {
+                PowerShellPool.Configure(poolOptions.Value, logger);
+            }
+
             powershellExecutor = new PowerShellExecutor();
             searchEngine = new SearchEngine();
             localSearcher = new LocalFileSearcher();
@@ -974,10 +980,29 @@ namespace CxLanguage.StandardLibrary
     
     /// <summary>
     /// PowerShell command executor
+    /// Runs commands on the shared PowerShellPool; starts one pwsh process per command when pooling is disabled
     /// </summary>
     public class PowerShellExecutor
     {
-        public async Task<PowerShellResult> ExecuteAsync(string command, string? workingDirectory = null, int timeoutMs = 30000)
+        private readonly PowerShellPool? _pool;
+
+        public PowerShellExecutor(PowerShellPool? pool = null)
+        {
+            _pool = pool;
+        }
+
+        public Task<PowerShellResult> ExecuteAsync(string command, string? workingDirectory = null, int timeoutMs = 30000)
+        {
+            var pool = _pool ?? PowerShellPool.Shared;
+            return pool.IsEnabled
+                ? pool.ExecuteAsync(command, workingDirectory, timeoutMs)
+                : ExecuteInNewProcessAsync(command, workingDirectory, timeoutMs);
+        }
+
+        /// <summary>
+        /// Run a command in its own pwsh process
+        /// </summary>
+        public async Task<PowerShellResult> ExecuteInNewProcessAsync(string command, string? workingDirectory = null, int timeoutMs = 30000)
         {
             var processInfo = new ProcessStartInfo
             {
@@ -0,0 +1,591 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
+using Microsoft.Extensions.Logging;
+
+namespace CxLanguage.StandardLibrary
+{
+    /// <summary>
+    /// Pool of long-lived pwsh processes behind PowerShellExecutor.
+    /// Each worker runs a small host loop that reads one framed command per stdin line, runs it in a child scope
+    /// with all streams captured, and answers with one framed stdout line, so a command costs its own run time
+    /// instead of a process start. At most MaxWorkers commands run at once; a call's timeout covers the wait for
+    /// a worker as well as the command. A timed-out command cannot be interrupted over stdin, so its worker is
+    /// killed and replaced. Workers are also replaced after MaxCommandsPerWorker commands, above
+    /// MaxWorkerMemoryMb, after IdleTimeoutSeconds unused, and when a script ends the process with exit.
+    /// </summary>
+    public sealed class PowerShellPool : IDisposable
+    {
+        private static readonly object _sharedLock = new();
+        private static PowerShellPool? _shared;
+
+        private readonly PowerShellPoolOptions _options;
+        private readonly ILogger? _logger;
+        private readonly SemaphoreSlim _slots;
+        private readonly List<PowerShellWorker> _idle = new();
+        private long _executed;
+        private long _started;
+        private long _recycled;
+        private long _timedOut;
+        private volatile bool _disposed;
+
+        static PowerShellPool()
+        {
+            AppDomain.CurrentDomain.ProcessExit += (_, _) => Volatile.Read(ref _shared)?.Dispose();
+        }
+
+        public PowerShellPool(PowerShellPoolOptions? options = null, ILogger? logger = null)
+        {
+            _options = options ?? new PowerShellPoolOptions();
+            _logger = logger;
+            _slots = new SemaphoreSlim(Math.Max(1, _options.MaxWorkers));
+        }
+
+        /// <summary>
+        /// Process-wide pool used by PowerShellExecutor; created with default options on first use
+        /// </summary>
+        public static PowerShellPool Shared
+        {
+            get
+            {
+                var pool = Volatile.Read(ref _shared);
+                if (pool != null)
+                {
+                    return pool;
+                }
+
+                lock (_sharedLock)
+                {
+                    return _shared ??= new PowerShellPool();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Replace the shared pool unless it already uses these options; workers of the previous pool are stopped
+        /// once their current command finished
+        /// </summary>
+        public static void Configure(PowerShellPoolOptions options, ILogger? logger = null)
+        {
+            PowerShellPool? previous;
+            lock (_sharedLock)
+            {
+                if (ReferenceEquals(_shared?._options, options))
+                {
+                    return;
+                }
+
+                previous = _shared;
+                _shared = new PowerShellPool(options, logger);
+            }
+            previous?.Dispose();
+        }
+
+        public bool IsEnabled => _options.Enabled && !_disposed;
+
+        /// <summary>
+        /// Run a command on a pooled worker, starting one when none is idle
+        /// </summary>
+        public async Task<PowerShellExecutor.PowerShellResult> ExecuteAsync(string command, string? workingDirectory = null,
+            int timeoutMs = 30000, CancellationToken cancellationToken = default)
+        {
+            ObjectDisposedException.ThrowIf(_disposed, this);
+
+            using var timeout = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            timeout.CancelAfter(Math.Max(1, timeoutMs));
+
+            try
+            {
+                await _slots.WaitAsync(timeout.Token);
+            }
+            catch (OperationCanceledException) when (!cancellationToken.IsCancellationRequested)
+            {
+                Interlocked.Increment(ref _timedOut);
+                return TimedOut("Command timed out waiting for a PowerShell worker");
+            }
+
+            PowerShellWorker? worker = null;
+            try
+            {
+                worker = TakeIdleWorker();
+                if (worker == null)
+                {
+                    worker = await PowerShellWorker.StartAsync(_options, timeout.Token);
+                    var started = Interlocked.Increment(ref _started);
+                    _logger?.LogDebug("⚡ Started PowerShell worker {Worker} (pid {ProcessId})", started, worker.ProcessId);
+                }
+
+                var result = await worker.RunAsync(command, workingDirectory ?? Environment.CurrentDirectory, timeout.Token);
+                Interlocked.Increment(ref _executed);
+                return result;
+            }
+            catch (OperationCanceledException) when (!cancellationToken.IsCancellationRequested)
+            {
+                // The running pipeline cannot be stopped over stdin; the worker goes with it
+                Interlocked.Increment(ref _timedOut);
+                _logger?.LogWarning("⏰ PowerShell command timed out after {Timeout}ms, replacing its worker", timeoutMs);
+                worker?.Dispose();
+                worker = null;
+                return TimedOut("Command timed out");
+            }
+            catch (TimeoutException)
+            {
+                // StartAsync already stopped the worker that did not report ready
+                Interlocked.Increment(ref _timedOut);
+                _logger?.LogWarning("⏰ PowerShell worker did not start within {Timeout}ms", _options.StartupTimeoutMs);
+                return TimedOut("PowerShell worker did not start in time");
+            }
+            catch
+            {
+                worker?.Dispose();
+                worker = null;
+                throw;
+            }
+            finally
+            {
+                if (worker != null)
+                {
+                    ReturnWorker(worker);
+                }
+                _slots.Release();
+            }
+        }
+
+        public Dictionary<string, object> GetStatistics()
+        {
+            int idle;
+            lock (_idle)
+            {
+                idle = _idle.Count;
+            }
+
+            return new Dictionary<string, object>
+            {
+                ["Enabled"] = IsEnabled,
+                ["MaxWorkers"] = Math.Max(1, _options.MaxWorkers),
+                ["IdleWorkers"] = idle,
+                ["BusyWorkers"] = Math.Max(1, _options.MaxWorkers) - _slots.CurrentCount,
+                ["CommandsExecuted"] = Interlocked.Read(ref _executed),
+                ["WorkersStarted"] = Interlocked.Read(ref _started),
+                ["WorkersRecycled"] = Interlocked.Read(ref _recycled),
+                ["TimedOutCommands"] = Interlocked.Read(ref _timedOut)
+            };
+        }
+
+        /// <summary>
+        /// Stop idle workers; busy ones are stopped when their command returns
+        /// </summary>
+        public void Dispose()
+        {
+            _disposed = true;
+
+            List<PowerShellWorker> idle;
+            lock (_idle)
+            {
+                idle = new List<PowerShellWorker>(_idle);
+                _idle.Clear();
+            }
+
+            foreach (var worker in idle)
+            {
+                worker.Dispose();
+            }
+        }
+
+        private PowerShellWorker? TakeIdleWorker()
+        {
+            var idleTimeout = TimeSpan.FromSeconds(Math.Max(1, _options.IdleTimeoutSeconds));
+            List<PowerShellWorker>? expired = null;
+            PowerShellWorker? taken = null;
+
+            lock (_idle)
+            {
+                // Most recently used last: the warmest worker is reused, the oldest ones age out
+                for (int i = _idle.Count - 1; i >= 0; i--)
+                {
+                    var worker = _idle[i];
+                    if (worker.HasExited || Stopwatch.GetElapsedTime(worker.LastUsedTimestamp) > idleTimeout)
+                    {
+                        (expired ??= new List<PowerShellWorker>()).Add(worker);
+                        _idle.RemoveAt(i);
+                    }
+                    else if (taken == null)
+                    {
+                        taken = worker;
+                        _idle.RemoveAt(i);
+                    }
+                }
+            }
+
+            if (expired != null)
+            {
+                foreach (var worker in expired)
+                {
+                    Interlocked.Increment(ref _recycled);
+                    worker.Dispose();
+                }
+            }
+
+            return taken;
+        }
+
+        private void ReturnWorker(PowerShellWorker worker)
+        {
+            var recycle = _disposed
+                || worker.HasExited
+                || worker.CommandsRun >= Math.Max(1, _options.MaxCommandsPerWorker)
+                || worker.WorkingSetMb > _options.MaxWorkerMemoryMb;
+
+            if (!recycle)
+            {
+                lock (_idle)
+                {
+                    if (!_disposed)
+                    {
+                        _idle.Add(worker);
+                        return;
+                    }
+                }
+            }
+
+            Interlocked.Increment(ref _recycled);
+            _logger?.LogDebug("♻️ Recycling PowerShell worker (pid {ProcessId}) after {Commands} commands",
+                worker.ProcessId, worker.CommandsRun);
+            worker.Dispose();
+        }
+
+        private static PowerShellExecutor.PowerShellResult TimedOut(string error)
+        {
+            return new PowerShellExecutor.PowerShellResult
+            {
+                Output = string.Empty,
+                Error = error,
+                ExitCode = -1
+            };
+        }
+    }
+
+    /// <summary>
+    /// One pwsh process running the command host loop. Runs one command at a time; the pool guarantees that.
+    /// </summary>
+    internal sealed class PowerShellWorker : IDisposable
+    {
+        /// <summary>
+        /// Prefix of protocol lines on stdout; anything else a script writes to the console directly counts as output
+        /// </summary>
+        private const string Marker = "\u001eCX";
+
+        /// <summary>
+        /// Request line: "id base64(directory) base64(command)". Response line: Marker + " id exitCode base64(output)
+        /// base64(errors)". Commands run in a child scope so their variables do not outlive the call. The exit code is
+        /// LASTEXITCODE when a native command set one, otherwise 1 when the command wrote any error record.
+        /// </summary>
+        private const string HostScript = @"
+$ErrorActionPreference = 'Continue'
+$ProgressPreference = 'SilentlyContinue'
+$utf8 = [System.Text.UTF8Encoding]::new($false)
+[Console]::OutputEncoding = $utf8
+$marker = [string][char]0x1E + 'CX'
+$stdout = [Console]::Out
+$stdout.WriteLine($marker + 'READY')
+$stdout.Flush()
+while ($true) {
+    $line = [Console]::In.ReadLine()
+    if ($null -eq $line) { break }
+    $parts = $line.Split(' ')
+    $id = $parts[0]
+    $objects = [System.Collections.Generic.List[object]]::new()
+    $errors = [System.Text.StringBuilder]::new()
+    $exitCode = 0
+    $global:LASTEXITCODE = 0
+    try {
+        Set-Location -LiteralPath $utf8.GetString([Convert]::FromBase64String($parts[1])) -ErrorAction Stop
+        $script = [ScriptBlock]::Create($utf8.GetString([Convert]::FromBase64String($parts[2])))
+        & $script *>&1 | ForEach-Object {
+            if ($_ -is [System.Management.Automation.ErrorRecord]) { [void]$errors.AppendLine(($_ | Out-String).TrimEnd()) }
+            elseif ($_ -is [System.Management.Automation.WarningRecord]) { $objects.Add('WARNING: ' + $_.Message) }
+            elseif ($_ -is [System.Management.Automation.InformationRecord]) { $objects.Add([string]$_.MessageData) }
+            elseif ($_ -is [System.Management.Automation.VerboseRecord] -or $_ -is [System.Management.Automation.DebugRecord]) { }
+            else { $objects.Add($_) }
+        }
+        if ($global:LASTEXITCODE) { $exitCode = $global:LASTEXITCODE }
+        elseif ($errors.Length -gt 0) { $exitCode = 1 }
+    } catch {
+        [void]$errors.AppendLine(($_ | Out-String).TrimEnd())
+        $exitCode = 1
+    }
+    $output = if ($objects.Count -gt 0) { $objects | Out-String } else { '' }
+    $stdout.WriteLine($marker + ' ' + $id + ' ' + $exitCode + ' ' + [Convert]::ToBase64String($utf8.GetBytes($output)) + ' ' + [Convert]::ToBase64String($utf8.GetBytes($errors.ToString())))
+    $stdout.Flush()
+}
+";
+
+        private static readonly string EncodedHostScript = Convert.ToBase64String(Encoding.Unicode.GetBytes(HostScript));
+        private static readonly UTF8Encoding Utf8 = new(false);
+
+        private readonly Process _process;
+        private readonly object _lock = new();
+        private readonly StringBuilder _strayOutput = new();
+        private readonly StringBuilder _strayError = new();
+        private readonly TaskCompletionSource _ready = new(TaskCreationOptions.RunContinuationsAsynchronously);
+        private TaskCompletionSource<PowerShellExecutor.PowerShellResult>? _current;
+        private long _currentId;
+        private long _nextId;
+        private bool _terminated;
+        private int _disposed;
+
+        private PowerShellWorker(Process process)
+        {
+            _process = process;
+            LastUsedTimestamp = Stopwatch.GetTimestamp();
+        }
+
+        public int ProcessId { get; private set; }
+
+        public int CommandsRun { get; private set; }
+
+        public long LastUsedTimestamp { get; private set; }
+
+        public bool HasExited
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _terminated || Volatile.Read(ref _disposed) != 0;
+                }
+            }
+        }
+
+        public long WorkingSetMb
+        {
+            get
+            {
+                try
+                {
+                    _process.Refresh();
+                    return _process.WorkingSet64 / (1024 * 1024);
+                }
+                catch (InvalidOperationException)
+                {
+                    return 0;
+                }
+            }
+        }
+
+        public static async Task<PowerShellWorker> StartAsync(PowerShellPoolOptions options, CancellationToken cancellationToken)
+        {
+            var startInfo = new ProcessStartInfo
+            {
+                FileName = options.Executable,
+                UseShellExecute = false,
+                RedirectStandardInput = true,
+                RedirectStandardOutput = true,
+                RedirectStandardError = true,
+                CreateNoWindow = true,
+                StandardInputEncoding = Utf8,
+                StandardOutputEncoding = Utf8,
+                StandardErrorEncoding = Utf8
+            };
+            startInfo.ArgumentList.Add("-NoLogo");
+            if (!options.LoadProfile)
+            {
+                startInfo.ArgumentList.Add("-NoProfile");
+            }
+            startInfo.ArgumentList.Add("-NonInteractive");
+            startInfo.ArgumentList.Add("-EncodedCommand");
+            startInfo.ArgumentList.Add(EncodedHostScript);
+
+            var process = new Process { StartInfo = startInfo };
+            var worker = new PowerShellWorker(process);
+            process.OutputDataReceived += (_, e) => worker.OnOutput(e.Data);
+            process.ErrorDataReceived += (_, e) => worker.OnError(e.Data);
+
+            try
+            {
+                process.Start();
+                worker.ProcessId = process.Id;
+                process.BeginOutputReadLine();
+                process.BeginErrorReadLine();
+                await worker._ready.Task.WaitAsync(TimeSpan.FromMilliseconds(Math.Max(1, options.StartupTimeoutMs)), cancellationToken);
+                return worker;
+            }
+            catch
+            {
+                worker.Dispose();
+                throw;
+            }
+        }
+
+        public async Task<PowerShellExecutor.PowerShellResult> RunAsync(string command, string workingDirectory, CancellationToken cancellationToken)
+        {
+            var completion = new TaskCompletionSource<PowerShellExecutor.PowerShellResult>(TaskCreationOptions.RunContinuationsAsynchronously);
+            long id;
+            lock (_lock)
+            {
+                if (_terminated)
+                {
+                    throw new InvalidOperationException("PowerShell worker has exited");
+                }
+
+                _strayOutput.Clear();
+                _strayError.Clear();
+                id = ++_nextId;
+                _currentId = id;
+                _current = completion;
+            }
+
+            CommandsRun++;
+            try
+            {
+                using var registration = cancellationToken.Register(() => completion.TrySetCanceled(cancellationToken));
+                var request = $"{id} {Convert.ToBase64String(Utf8.GetBytes(workingDirectory))} {Convert.ToBase64String(Utf8.GetBytes(command))}";
+                await _process.StandardInput.WriteLineAsync(request.AsMemory(), cancellationToken);
+                await _process.StandardInput.FlushAsync(cancellationToken);
+                return await completion.Task;
+            }
+            finally
+            {
+                LastUsedTimestamp = Stopwatch.GetTimestamp();
+            }
+        }
+
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _disposed, 1) != 0)
+            {
+                return;
+            }
+
+            try
+            {
+                if (!_process.HasExited)
+                {
+                    _process.Kill(entireProcessTree: true);
+                }
+            }
+            catch (Exception)
+            {
+                // Already gone
+            }
+
+            _ready.TrySetException(new ObjectDisposedException(nameof(PowerShellWorker)));
+            lock (_lock)
+            {
+                _terminated = true;
+                _current?.TrySetCanceled();
+                _current = null;
+            }
+            _process.Dispose();
+        }
+
+        private void OnOutput(string? line)
+        {
+            if (line == null)
+            {
+                OnTerminated();
+                return;
+            }
+
+            if (!line.StartsWith(Marker, StringComparison.Ordinal))
+            {
+                lock (_lock)
+                {
+                    _strayOutput.AppendLine(line);
+                }
+                return;
+            }
+
+            if (line.Length == Marker.Length + 5 && line.EndsWith("READY", StringComparison.Ordinal))
+            {
+                _ready.TrySetResult();
+                return;
+            }
+
+            // Marker, id, exit code, output, errors
+            var parts = line.Split(' ');
+            if (parts.Length != 5 || !long.TryParse(parts[1], out var id) || !int.TryParse(parts[2], out var exitCode))
+            {
+                lock (_lock)
+                {
+                    _strayOutput.AppendLine(line);
+                }
+                return;
+            }
+
+            TaskCompletionSource<PowerShellExecutor.PowerShellResult>? completion;
+            PowerShellExecutor.PowerShellResult result;
+            lock (_lock)
+            {
+                if (_current == null || id != _currentId)
+                {
+                    return;
+                }
+
+                result = new PowerShellExecutor.PowerShellResult
+                {
+                    Output = _strayOutput.Append(Utf8.GetString(Convert.FromBase64String(parts[3]))).ToString(),
+                    Error = _strayError.Append(Utf8.GetString(Convert.FromBase64String(parts[4]))).ToString(),
+                    ExitCode = exitCode
+                };
+                completion = _current;
+                _current = null;
+            }
+            completion.TrySetResult(result);
+        }
+
+        private void OnError(string? line)
+        {
+            if (line == null)
+            {
+                return;
+            }
+
+            lock (_lock)
+            {
+                _strayError.AppendLine(line);
+            }
+        }
+
+        /// <summary>
+        /// Stdout closed: the process ended, during startup or because a script called exit
+        /// </summary>
+        private void OnTerminated()
+        {
+            var exitCode = -1;
+            try
+            {
+                if (_process.WaitForExit(1000))
+                {
+                    exitCode = _process.ExitCode;
+                }
+            }
+            catch (Exception)
+            {
+                // Disposed concurrently
+            }
+
+            TaskCompletionSource<PowerShellExecutor.PowerShellResult>? completion;
+            PowerShellExecutor.PowerShellResult result;
+            lock (_lock)
+            {
+                _terminated = true;
+                _ready.TrySetException(new InvalidOperationException(
+                    $"PowerShell worker exited during startup with code {exitCode}: {_strayError}"));
+
+                completion = _current;
+                _current = null;
+                result = new PowerShellExecutor.PowerShellResult
+                {
+                    Output = _strayOutput.ToString(),
+                    Error = _strayError.ToString(),
+                    ExitCode = exitCode
+                };
+            }
+            completion?.TrySetResult(result);
+        }
+    }
+}
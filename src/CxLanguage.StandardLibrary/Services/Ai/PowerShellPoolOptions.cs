@@ -0,0 +1,53 @@
+using System;
+
+namespace CxLanguage.StandardLibrary
+{
+    /// <summary>
+    /// Persistent PowerShell worker settings for ExecuteService, bound from the "PowerShellPool" configuration
+    /// section. When disabled every command starts its own pwsh process, as before.
+    /// </summary>
+    public class PowerShellPoolOptions
+    {
+        public const string SectionName = "PowerShellPool";
+
+        /// <summary>
+        /// Run commands on long-lived pwsh workers instead of one process per command
+        /// </summary>
+        public bool Enabled { get; set; } = true;
+
+        /// <summary>
+        /// PowerShell executable started for each worker
+        /// </summary>
+        public string Executable { get; set; } = OperatingSystem.IsWindows() ? "pwsh.exe" : "pwsh";
+
+        /// <summary>
+        /// Upper bound on workers, and therefore on commands running at the same time; further calls wait for a worker
+        /// </summary>
+        public int MaxWorkers { get; set; } = Math.Clamp(Environment.ProcessorCount / 2, 1, 4);
+
+        /// <summary>
+        /// Commands a worker runs before it is replaced, so state left behind by scripts does not accumulate
+        /// </summary>
+        public int MaxCommandsPerWorker { get; set; } = 200;
+
+        /// <summary>
+        /// Working set in MB above which a worker is replaced after its current command
+        /// </summary>
+        public int MaxWorkerMemoryMb { get; set; } = 512;
+
+        /// <summary>
+        /// Idle workers older than this are stopped instead of reused
+        /// </summary>
+        public int IdleTimeoutSeconds { get; set; } = 300;
+
+        /// <summary>
+        /// Time a new worker may take to start and report ready
+        /// </summary>
+        public int StartupTimeoutMs { get; set; } = 20000;
+
+        /// <summary>
+        /// Load the user's PowerShell profile in each worker
+        /// </summary>
+        public bool LoadProfile { get; set; }
+    }
+}
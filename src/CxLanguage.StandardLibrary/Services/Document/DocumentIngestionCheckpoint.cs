@@ -0,0 +1,144 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using System.Text.Json;
+
+namespace CxLanguage.StandardLibrary.Services.Document
+{
+    /// <summary>
+    /// Append-only JSON-lines log of ingestion progress per file, keyed by full path.
+    /// An entry records the file's fingerprint (length, last write time and chunking settings), how many leading
+    /// chunks are stored, and whether the file is complete; the last entry of a path wins on load. A changed
+    /// fingerprint invalidates the entry, so edited files are ingested again.
+    /// </summary>
+    internal sealed class DocumentIngestionCheckpoint : IDisposable
+    {
+        internal sealed class Entry
+        {
+            public string Path { get; set; } = "";
+            public string Fingerprint { get; set; } = "";
+            public int StoredThrough { get; set; }
+            public bool Complete { get; set; }
+            public int Chunks { get; set; }
+        }
+
+        private readonly object _lock = new();
+        private readonly Dictionary<string, Entry> _entries = new(StringComparer.Ordinal);
+        private readonly string _path;
+        private StreamWriter? _writer;
+        private bool _disposed;
+
+        public DocumentIngestionCheckpoint(string path)
+        {
+            _path = path;
+            var directory = System.IO.Path.GetDirectoryName(path);
+            if (!string.IsNullOrEmpty(directory))
+            {
+                Directory.CreateDirectory(directory);
+            }
+
+            var lines = Load();
+
+            // Rewrite the log when superseded entries dominate it
+            if (lines > 2 * _entries.Count + 64)
+            {
+                Compact();
+            }
+
+            _writer = OpenWriter(FileMode.Append);
+        }
+
+        public static string CreateFingerprint(FileInfo file, int chunkSize, int overlap) =>
+            $"{file.Length}:{file.LastWriteTimeUtc.Ticks}:{chunkSize}:{overlap}";
+
+        /// <summary>
+        /// Progress of a file, or null when it has no entry or was modified since
+        /// </summary>
+        public Entry? Get(string filePath, string fingerprint)
+        {
+            lock (_lock)
+            {
+                return _entries.TryGetValue(filePath, out var entry) && entry.Fingerprint == fingerprint ? entry : null;
+            }
+        }
+
+        public void RecordProgress(string filePath, string fingerprint, int storedThrough) =>
+            Append(new Entry { Path = filePath, Fingerprint = fingerprint, StoredThrough = storedThrough });
+
+        public void RecordComplete(string filePath, string fingerprint, int chunks) =>
+            Append(new Entry { Path = filePath, Fingerprint = fingerprint, StoredThrough = chunks, Complete = true, Chunks = chunks });
+
+        public void Dispose()
+        {
+            lock (_lock)
+            {
+                if (_disposed) return;
+                _disposed = true;
+                _writer?.Dispose();
+                _writer = null;
+            }
+        }
+
+        private void Append(Entry entry)
+        {
+            var line = JsonSerializer.Serialize(entry);
+            lock (_lock)
+            {
+                if (_disposed) return;
+                _entries[entry.Path] = entry;
+                _writer!.WriteLine(line);
+                _writer.Flush();
+            }
+        }
+
+        private int Load()
+        {
+            if (!File.Exists(_path))
+            {
+                return 0;
+            }
+
+            var lines = 0;
+            foreach (var line in File.ReadLines(_path, Encoding.UTF8))
+            {
+                lines++;
+                if (string.IsNullOrWhiteSpace(line))
+                {
+                    continue;
+                }
+
+                try
+                {
+                    var entry = JsonSerializer.Deserialize<Entry>(line);
+                    if (entry != null && entry.Path.Length > 0)
+                    {
+                        _entries[entry.Path] = entry;
+                    }
+                }
+                catch (JsonException)
+                {
+                    // A torn last line from an interrupted run
+                }
+            }
+
+            return lines;
+        }
+
+        private void Compact()
+        {
+            var temporaryPath = _path + ".tmp";
+            using (var writer = new StreamWriter(temporaryPath, append: false, new UTF8Encoding(false)))
+            {
+                foreach (var entry in _entries.Values)
+                {
+                    writer.WriteLine(JsonSerializer.Serialize(entry));
+                }
+            }
+            File.Move(temporaryPath, _path, overwrite: true);
+        }
+
+        private StreamWriter OpenWriter(FileMode mode) =>
+            new(new FileStream(_path, mode, FileAccess.Write, FileShare.Read), new UTF8Encoding(false));
+    }
+}
@@ -0,0 +1,62 @@
+using System;
+using System.IO;
+
+namespace CxLanguage.StandardLibrary.Services.Document
+{
+    /// <summary>
+    /// Configuration for DocumentIngestionService, bound from the "DocumentIngestion" configuration section.
+    /// Each pipeline stage (read/extract/chunk → embed → store) runs with its own parallelism and hands work on
+    /// through a bounded channel, so a slow stage throttles the ones before it instead of buffering without limit.
+    /// </summary>
+    public class DocumentIngestionOptions
+    {
+        public const string SectionName = "DocumentIngestion";
+
+        /// <summary>
+        /// Characters per chunk
+        /// </summary>
+        public int ChunkSize { get; set; } = 1000;
+
+        /// <summary>
+        /// Characters shared by consecutive chunks
+        /// </summary>
+        public int ChunkOverlap { get; set; } = 200;
+
+        /// <summary>
+        /// Files read, extracted and chunked concurrently
+        /// </summary>
+        public int ReadParallelism { get; set; } = 4;
+
+        /// <summary>
+        /// Concurrent embedding requests
+        /// </summary>
+        public int EmbeddingParallelism { get; set; } = 2;
+
+        /// <summary>
+        /// Chunks sent to the embedding generator per request
+        /// </summary>
+        public int EmbeddingBatchSize { get; set; } = 64;
+
+        /// <summary>
+        /// Concurrent vector store writers
+        /// </summary>
+        public int StoreParallelism { get; set; } = 2;
+
+        /// <summary>
+        /// Capacity of each inter-stage channel, in chunks
+        /// </summary>
+        public int ChannelCapacity { get; set; } = 256;
+
+        /// <summary>
+        /// Append-only log of ingested files and chunks, used to skip unchanged files and resume interrupted ones.
+        /// Null or empty disables checkpointing.
+        /// </summary>
+        public string? CheckpointPath { get; set; } = Path.Combine(
+            Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData), "CxLanguage", "DocumentIngestion", "checkpoint.jsonl");
+
+        /// <summary>
+        /// Stored chunks between two progress entries of a partially ingested file
+        /// </summary>
+        public int CheckpointInterval { get; set; } = 256;
+    }
+}
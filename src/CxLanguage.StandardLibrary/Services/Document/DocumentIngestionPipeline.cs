@@ -0,0 +1,598 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Security.Cryptography;
+using System.Text;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+using Microsoft.Extensions.AI;
+using Microsoft.Extensions.Logging;
+using CxLanguage.Core.Events;
+using CxLanguage.StandardLibrary.Services.VectorStore;
+
+namespace CxLanguage.StandardLibrary.Services.Document
+{
+    /// <summary>
+    /// Outcome of one pipeline run
+    /// </summary>
+    internal sealed class DocumentIngestionResult
+    {
+        private int _filesSeen;
+        private int _filesProcessed;
+        private int _filesSkipped;
+        private int _vectors;
+
+        public int FilesSeen => _filesSeen;
+        public int FilesProcessed => _filesProcessed;
+        public int FilesSkipped => _filesSkipped;
+        public int Vectors => _vectors;
+        public ConcurrentDictionary<string, Exception> Errors { get; } = new(StringComparer.Ordinal);
+
+        public void FileSeen() => Interlocked.Increment(ref _filesSeen);
+        public void FileSkipped() => Interlocked.Increment(ref _filesSkipped);
+
+        public void FileProcessed(int vectors)
+        {
+            Interlocked.Increment(ref _filesProcessed);
+            Interlocked.Add(ref _vectors, vectors);
+        }
+    }
+
+    /// <summary>
+    /// Staged ingestion: file paths → read/extract/chunk workers → embedding workers → vector store writers,
+    /// connected by bounded channels so every stage runs concurrently and a slow stage applies backpressure.
+    /// Reading, extraction and chunking are fused into one streaming pass per file, so a file is never held in
+    /// memory whole and its first chunks are embedded while the rest is still being read.
+    /// Failures are isolated per file; cancellation or an unexpected stage failure stops the whole run.
+    /// </summary>
+    internal sealed class DocumentIngestionPipeline
+    {
+        private readonly DocumentIngestionOptions _options;
+        private readonly ICxEventBus _eventBus;
+        private readonly IVectorStoreService _vectorStore;
+        private readonly IEmbeddingGenerator<string, Embedding<float>> _embeddingGenerator;
+        private readonly DocumentIngestionCheckpoint? _checkpoint;
+        private readonly Func<string, bool> _isFormatSupported;
+        private readonly ILogger _logger;
+
+        public DocumentIngestionPipeline(
+            DocumentIngestionOptions options,
+            ICxEventBus eventBus,
+            IVectorStoreService vectorStore,
+            IEmbeddingGenerator<string, Embedding<float>> embeddingGenerator,
+            DocumentIngestionCheckpoint? checkpoint,
+            Func<string, bool> isFormatSupported,
+            ILogger logger)
+        {
+            _options = options;
+            _eventBus = eventBus;
+            _vectorStore = vectorStore;
+            _embeddingGenerator = embeddingGenerator;
+            _checkpoint = checkpoint;
+            _isFormatSupported = isFormatSupported;
+            _logger = logger;
+        }
+
+        /// <summary>
+        /// Record id of a chunk. Stable across runs, so resumed and repeated ingestion overwrites instead of duplicating.
+        /// </summary>
+        public static string CreateRecordId(string filePath, int chunkIndex)
+        {
+            var fullPath = Path.GetFullPath(filePath);
+            var hash = SHA256.HashData(Encoding.UTF8.GetBytes(fullPath));
+            return $"{Path.GetFileNameWithoutExtension(filePath)}_chunk_{chunkIndex}_{Convert.ToHexString(hash, 0, 8).ToLowerInvariant()}";
+        }
+
+        public async Task<DocumentIngestionResult> RunAsync(IEnumerable<string> filePaths, Dictionary<string, object>? metadata, CancellationToken cancellationToken = default)
+        {
+            var result = new DocumentIngestionResult();
+            var capacity = Math.Max(1, _options.ChannelCapacity);
+
+            var files = Channel.CreateBounded<string>(new BoundedChannelOptions(Math.Max(1, _options.ReadParallelism) * 2)
+            {
+                SingleWriter = true
+            });
+            var chunks = Channel.CreateBounded<PendingChunk>(new BoundedChannelOptions(capacity));
+            var embedded = Channel.CreateBounded<EmbeddedChunk>(new BoundedChannelOptions(capacity));
+
+            // A failed stage cancels the others, so no stage stays blocked on a channel nobody drains
+            using var runCts = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            var token = runCts.Token;
+
+            var stages = new[]
+            {
+                RunStage(1, () => EnumerateFilesAsync(filePaths, files.Writer, result, token), e => files.Writer.TryComplete(e), runCts),
+                RunStage(_options.ReadParallelism, () => ChunkFilesAsync(files.Reader, chunks.Writer, metadata, result, token), e => chunks.Writer.TryComplete(e), runCts),
+                RunStage(_options.EmbeddingParallelism, () => EmbedChunksAsync(chunks.Reader, embedded.Writer, result, token), e => embedded.Writer.TryComplete(e), runCts),
+                RunStage(_options.StoreParallelism, () => StoreChunksAsync(embedded.Reader, result, token), null, runCts)
+            };
+
+            try
+            {
+                await Task.WhenAll(stages);
+            }
+            catch when (!cancellationToken.IsCancellationRequested)
+            {
+                // Surface the stage failure rather than the cancellation it caused downstream
+                var failure = stages.Where(s => s.IsFaulted).Select(s => s.Exception!.InnerException!)
+                    .FirstOrDefault(e => e is not OperationCanceledException);
+                if (failure != null)
+                {
+                    throw failure;
+                }
+                throw;
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Run a stage on parallel workers and complete its output channel once all of them finish
+        /// </summary>
+        private static async Task RunStage(int parallelism, Func<Task> worker, Action<Exception?>? completeOutput, CancellationTokenSource runCts)
+        {
+            Exception? failure = null;
+            try
+            {
+                await Task.WhenAll(Enumerable.Range(0, Math.Max(1, parallelism)).Select(_ => Task.Run(worker)));
+            }
+            catch (Exception ex)
+            {
+                failure = ex;
+                runCts.Cancel();
+                throw;
+            }
+            finally
+            {
+                completeOutput?.Invoke(failure);
+            }
+        }
+
+        #region Stages
+
+        private static async Task EnumerateFilesAsync(IEnumerable<string> filePaths, ChannelWriter<string> output, DocumentIngestionResult result, CancellationToken cancellationToken)
+        {
+            foreach (var filePath in filePaths)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+                result.FileSeen();
+                await output.WriteAsync(filePath, cancellationToken);
+            }
+        }
+
+        private async Task ChunkFilesAsync(ChannelReader<string> input, ChannelWriter<PendingChunk> output,
+            Dictionary<string, object>? metadata, DocumentIngestionResult result, CancellationToken cancellationToken)
+        {
+            var produced = new List<DocumentChunk>();
+
+            await foreach (var filePath in input.ReadAllAsync(cancellationToken))
+            {
+                var file = await OpenFileAsync(filePath, metadata, result);
+                if (file == null)
+                {
+                    continue;
+                }
+
+                _logger.LogInformation("🔄 Starting document ingestion: {FilePath}", filePath);
+                var chunker = new StreamingTextChunker(_options.ChunkSize, _options.ChunkOverlap);
+                var chunkIndex = 0;
+
+                try
+                {
+                    await foreach (var segment in DocumentTextReader.ReadAsync(filePath, _logger, cancellationToken))
+                    {
+                        chunker.Append(segment, produced);
+                        chunkIndex = await ForwardChunksAsync(file, produced, chunkIndex, output, cancellationToken);
+                        if (file.Failed)
+                        {
+                            break;
+                        }
+                    }
+
+                    if (!file.Failed)
+                    {
+                        if (chunker.HasContent)
+                        {
+                            chunker.Complete(produced);
+                            chunkIndex = await ForwardChunksAsync(file, produced, chunkIndex, output, cancellationToken);
+                        }
+                        else
+                        {
+                            _logger.LogWarning("⚠️ Document is empty: {FilePath}", filePath);
+                        }
+                    }
+                }
+                catch (Exception ex) when (!cancellationToken.IsCancellationRequested)
+                {
+                    file.Fail(ex);
+                }
+                finally
+                {
+                    produced.Clear();
+                }
+
+                if (!file.Failed && chunker.HasContent)
+                {
+                    _logger.LogInformation("📄 Created {ChunkCount} chunks from document: {FilePath}", chunkIndex, filePath);
+                    await _eventBus.EmitAsync("document.chunk.complete", new Dictionary<string, object>
+                    {
+                        { "filePath", filePath },
+                        { "chunkCount", chunkIndex },
+                        { "originalLength", chunker.Length }
+                    });
+                }
+
+                if (file.ChunkingDone(chunkIndex))
+                {
+                    await FinishFileAsync(file, result);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Hand chunks on to the embedding stage, skipping those a previous run already stored. Returns the next chunk index.
+        /// </summary>
+        private static async Task<int> ForwardChunksAsync(FileIngestion file, List<DocumentChunk> produced, int chunkIndex,
+            ChannelWriter<PendingChunk> output, CancellationToken cancellationToken)
+        {
+            foreach (var chunk in produced)
+            {
+                if (chunkIndex >= file.ResumeFrom)
+                {
+                    file.ChunkProduced();
+                    await output.WriteAsync(new PendingChunk(file, chunkIndex, chunk), cancellationToken);
+                }
+                chunkIndex++;
+            }
+            produced.Clear();
+            return chunkIndex;
+        }
+
+        private async Task EmbedChunksAsync(ChannelReader<PendingChunk> input, ChannelWriter<EmbeddedChunk> output,
+            DocumentIngestionResult result, CancellationToken cancellationToken)
+        {
+            var batchSize = Math.Max(1, _options.EmbeddingBatchSize);
+            var batch = new List<PendingChunk>(batchSize);
+
+            while (await input.WaitToReadAsync(cancellationToken))
+            {
+                // Take whatever is queued, up to one batch, so embedding never waits for a batch to fill
+                while (batch.Count < batchSize && input.TryRead(out var pending))
+                {
+                    if (pending.File.Failed)
+                    {
+                        await DropChunkAsync(pending.File, result);
+                    }
+                    else
+                    {
+                        batch.Add(pending);
+                    }
+                }
+
+                if (batch.Count == 0)
+                {
+                    continue;
+                }
+
+                GeneratedEmbeddings<Embedding<float>>? embeddings = null;
+                try
+                {
+                    embeddings = await _embeddingGenerator.GenerateAsync(batch.Select(c => c.Chunk.Content).ToList(), cancellationToken: cancellationToken);
+                    if (embeddings.Count != batch.Count)
+                    {
+                        throw new InvalidOperationException($"Embedding generator returned {embeddings.Count} embeddings for {batch.Count} chunks");
+                    }
+                }
+                catch (Exception ex) when (!cancellationToken.IsCancellationRequested)
+                {
+                    _logger.LogError(ex, "❌ Embedding generation failed for {ChunkCount} chunks", batch.Count);
+                    foreach (var pending in batch)
+                    {
+                        pending.File.Fail(ex);
+                        await DropChunkAsync(pending.File, result);
+                    }
+                    batch.Clear();
+                    continue;
+                }
+
+                for (int i = 0; i < batch.Count; i++)
+                {
+                    await output.WriteAsync(new EmbeddedChunk(batch[i], embeddings[i].Vector.ToArray()), cancellationToken);
+                }
+                batch.Clear();
+            }
+        }
+
+        private async Task StoreChunksAsync(ChannelReader<EmbeddedChunk> input, DocumentIngestionResult result, CancellationToken cancellationToken)
+        {
+            await foreach (var (pending, vector) in input.ReadAllAsync(cancellationToken))
+            {
+                var file = pending.File;
+                if (file.Failed)
+                {
+                    await DropChunkAsync(file, result);
+                    continue;
+                }
+
+                var chunkMetadata = new Dictionary<string, object>
+                {
+                    { "sourceFile", file.Path },
+                    { "chunkIndex", pending.Index },
+                    { "chunkStart", pending.Chunk.StartPosition },
+                    { "chunkEnd", pending.Chunk.EndPosition },
+                    { "fileFormat", System.IO.Path.GetExtension(file.Path) }
+                };
+
+                // Add custom metadata if provided
+                if (file.Metadata != null)
+                {
+                    foreach (var kvp in file.Metadata)
+                    {
+                        chunkMetadata[kvp.Key] = kvp.Value;
+                    }
+                }
+
+                try
+                {
+                    await _vectorStore.AddAsync(new VectorRecord
+                    {
+                        Id = CreateRecordId(file.Path, pending.Index),
+                        Vector = vector,
+                        Content = pending.Chunk.Content,
+                        Metadata = chunkMetadata,
+                        CreatedAt = DateTimeOffset.UtcNow
+                    });
+                }
+                catch (Exception ex) when (!cancellationToken.IsCancellationRequested)
+                {
+                    file.Fail(ex);
+                    await DropChunkAsync(file, result);
+                    continue;
+                }
+
+                if (file.ChunkStored(pending.Index, out var storedThrough) && _checkpoint != null)
+                {
+                    _checkpoint.RecordProgress(file.FullPath, file.Fingerprint, storedThrough);
+                }
+
+                if (file.ChunkAccounted())
+                {
+                    await FinishFileAsync(file, result);
+                }
+            }
+        }
+
+        #endregion
+
+        #region File State
+
+        /// <summary>
+        /// Validate a file and look up its checkpoint. Returns null when the file fails validation or is unchanged
+        /// since it was last ingested completely.
+        /// </summary>
+        private async Task<FileIngestion?> OpenFileAsync(string filePath, Dictionary<string, object>? metadata, DocumentIngestionResult result)
+        {
+            var info = new FileInfo(filePath);
+            Exception? invalid = !info.Exists
+                ? new FileNotFoundException($"Document not found: {filePath}")
+                : !_isFormatSupported(filePath)
+                    ? new NotSupportedException($"File format not supported: {info.Extension}")
+                    : null;
+
+            if (invalid != null)
+            {
+                await ReportErrorAsync(filePath, invalid, result);
+                return null;
+            }
+
+            var fullPath = info.FullName;
+            var fingerprint = DocumentIngestionCheckpoint.CreateFingerprint(info, _options.ChunkSize, _options.ChunkOverlap);
+            var progress = _checkpoint?.Get(fullPath, fingerprint);
+
+            if (progress is { Complete: true })
+            {
+                // Trust the checkpoint only while the store still holds the file's vectors
+                if (progress.Chunks == 0 || await _vectorStore.GetAsync(CreateRecordId(filePath, 0)) != null)
+                {
+                    _logger.LogInformation("⏭️ Document unchanged since last ingestion, skipping: {FilePath}", filePath);
+                    result.FileSkipped();
+                    return null;
+                }
+                progress = null;
+            }
+
+            if (progress is { StoredThrough: > 0 })
+            {
+                _logger.LogInformation("⏯️ Resuming document ingestion after {StoredChunks} stored chunks: {FilePath}", progress.StoredThrough, filePath);
+            }
+
+            return new FileIngestion(filePath, fullPath, fingerprint, progress?.StoredThrough ?? 0, metadata, _options.CheckpointInterval);
+        }
+
+        private async Task DropChunkAsync(FileIngestion file, DocumentIngestionResult result)
+        {
+            if (file.ChunkAccounted())
+            {
+                await FinishFileAsync(file, result);
+            }
+        }
+
+        private async Task FinishFileAsync(FileIngestion file, DocumentIngestionResult result)
+        {
+            if (file.Error != null)
+            {
+                // Keep the stored prefix so the next run resumes after it
+                if (_checkpoint != null && file.StoredThrough > file.ResumeFrom)
+                {
+                    _checkpoint.RecordProgress(file.FullPath, file.Fingerprint, file.StoredThrough);
+                }
+                await ReportErrorAsync(file.Path, file.Error, result);
+                return;
+            }
+
+            _checkpoint?.RecordComplete(file.FullPath, file.Fingerprint, file.ChunkCount);
+            result.FileProcessed(file.Stored);
+
+            if (file.ChunkCount == 0)
+            {
+                return;
+            }
+
+            await _eventBus.EmitAsync("document.vector.complete", new Dictionary<string, object>
+            {
+                { "filePath", file.Path },
+                { "vectorCount", file.Stored },
+                { "chunkCount", file.ChunkCount }
+            });
+
+            _logger.LogInformation("✅ Document ingestion completed: {FilePath}, {VectorCount} vectors created", file.Path, file.Stored);
+        }
+
+        private async Task ReportErrorAsync(string filePath, Exception error, DocumentIngestionResult result)
+        {
+            result.Errors[filePath] = error;
+            _logger.LogError(error, "❌ Error ingesting document: {FilePath}", filePath);
+
+            await _eventBus.EmitAsync("document.ingest.error", new Dictionary<string, object>
+            {
+                { "filePath", filePath },
+                { "error", error.Message },
+                { "timestamp", DateTimeOffset.UtcNow }
+            });
+        }
+
+        private readonly record struct PendingChunk(FileIngestion File, int Index, DocumentChunk Chunk);
+
+        private readonly record struct EmbeddedChunk(PendingChunk Chunk, float[] Vector);
+
+        /// <summary>
+        /// Progress of one file through the stages. A file finishes exactly once: when chunking is done and every
+        /// chunk it produced has been stored or dropped.
+        /// </summary>
+        private sealed class FileIngestion
+        {
+            private readonly object _lock = new();
+            private readonly SortedSet<int> _storedAhead = new();
+            private readonly int _checkpointInterval;
+            private int _produced;
+            private int _accounted;
+            private int _stored;
+            private int _storedThrough;
+            private int _lastCheckpoint;
+            private int _chunkCount = -1;
+            private bool _finished;
+            private volatile Exception? _error;
+
+            public FileIngestion(string path, string fullPath, string fingerprint, int resumeFrom, Dictionary<string, object>? metadata, int checkpointInterval)
+            {
+                Path = path;
+                FullPath = fullPath;
+                Fingerprint = fingerprint;
+                ResumeFrom = resumeFrom;
+                Metadata = metadata;
+                _checkpointInterval = Math.Max(1, checkpointInterval);
+                _storedThrough = resumeFrom;
+                _lastCheckpoint = resumeFrom;
+            }
+
+            public string Path { get; }
+            public string FullPath { get; }
+            public string Fingerprint { get; }
+            public int ResumeFrom { get; }
+            public Dictionary<string, object>? Metadata { get; }
+            public Exception? Error => _error;
+            public bool Failed => _error != null;
+            public int ChunkCount => _chunkCount;
+
+            public int Stored
+            {
+                get { lock (_lock) return _stored; }
+            }
+
+            /// <summary>
+            /// Number of leading chunks known to be stored, including those stored by earlier runs
+            /// </summary>
+            public int StoredThrough
+            {
+                get { lock (_lock) return _storedThrough; }
+            }
+
+            public void Fail(Exception error) => _error ??= error;
+
+            public void ChunkProduced()
+            {
+                lock (_lock) _produced++;
+            }
+
+            /// <summary>
+            /// Returns true when the file is finished and its caller must complete it
+            /// </summary>
+            public bool ChunkingDone(int chunkCount)
+            {
+                lock (_lock)
+                {
+                    _chunkCount = chunkCount;
+                    return TryFinish();
+                }
+            }
+
+            /// <summary>
+            /// Record a stored chunk and advance the contiguous watermark. Returns true when a checkpoint entry is due.
+            /// </summary>
+            public bool ChunkStored(int index, out int storedThrough)
+            {
+                lock (_lock)
+                {
+                    _stored++;
+                    if (index == _storedThrough)
+                    {
+                        _storedThrough++;
+                        while (_storedAhead.Remove(_storedThrough))
+                        {
+                            _storedThrough++;
+                        }
+                    }
+                    else
+                    {
+                        _storedAhead.Add(index);
+                    }
+
+                    storedThrough = _storedThrough;
+                    if (_storedThrough - _lastCheckpoint < _checkpointInterval)
+                    {
+                        return false;
+                    }
+                    _lastCheckpoint = _storedThrough;
+                    return true;
+                }
+            }
+
+            /// <summary>
+            /// Record a chunk as stored or dropped. Returns true when the file is finished and its caller must complete it.
+            /// </summary>
+            public bool ChunkAccounted()
+            {
+                lock (_lock)
+                {
+                    _accounted++;
+                    return TryFinish();
+                }
+            }
+
+            private bool TryFinish()
+            {
+                if (_finished || _chunkCount < 0 || _accounted < _produced)
+                {
+                    return false;
+                }
+                _finished = true;
+                return true;
+            }
+        }
+
+        #endregion
+    }
+}
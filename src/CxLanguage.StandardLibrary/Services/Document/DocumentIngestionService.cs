@@ -2,11 +2,11 @@ using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Linq;
-using System.Text;
-using System.Text.Json;
+using System.Runtime.ExceptionServices;
 using System.Threading.Tasks;
 using Microsoft.Extensions.AI;
 using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
 using CxLanguage.Core.Events;
 using CxLanguage.StandardLibrary.Services.VectorStore;
 
@@ -30,20 +30,23 @@ namespace CxLanguage.StandardLibrary.Services.Document
             ".txt", ".md", ".json"
         };
 
-        // Configuration for text chunking
-        private const int DefaultChunkSize = 1000;
-        private const int DefaultChunkOverlap = 200;
+        // Chunking, stage parallelism and checkpointing
+        private readonly DocumentIngestionOptions _options;
+        private readonly Lazy<DocumentIngestionCheckpoint?> _checkpoint;
         
         public DocumentIngestionService(
             ICxEventBus eventBus,
             IVectorStoreService vectorStore,
             IEmbeddingGenerator<string, Embedding<float>> embeddingGenerator,
-            ILogger<DocumentIngestionService> logger)
+            ILogger<DocumentIngestionService> logger,
+            IOptions<DocumentIngestionOptions>? options = null)
         {
             _eventBus = eventBus ?? throw new ArgumentNullException(nameof(eventBus));
             _vectorStore = vectorStore ?? throw new ArgumentNullException(nameof(vectorStore));
             _embeddingGenerator = embeddingGenerator ?? throw new ArgumentNullException(nameof(embeddingGenerator));
             _logger = logger ?? throw new ArgumentNullException(nameof(logger));
+            _options = options?.Value ?? new DocumentIngestionOptions();
+            _checkpoint = new Lazy<DocumentIngestionCheckpoint?>(OpenCheckpoint);
 
             // NO AUTO HANDLERS - All handlers must be explicitly declared in CX programs
             // However, we still need to register our service methods so they can be called when events are emitted
@@ -68,156 +71,41 @@ namespace CxLanguage.StandardLibrary.Services.Document
         /// </summary>
         public async Task<int> IngestDocumentAsync(string filePath, Dictionary<string, object>? metadata = null)
         {
-            try
-            {
-                _logger.LogInformation("🔄 Starting document ingestion: {FilePath}", filePath);
-
-                // Validate file existence and format
-                if (!File.Exists(filePath))
-                {
-                    throw new FileNotFoundException($"Document not found: {filePath}");
-                }
-
-                if (!IsFormatSupported(filePath))
-                {
-                    throw new NotSupportedException($"File format not supported: {Path.GetExtension(filePath)}");
-                }
-
-                // Read document content
-                var content = await File.ReadAllTextAsync(filePath, Encoding.UTF8);
-                if (string.IsNullOrWhiteSpace(content))
-                {
-                    _logger.LogWarning("⚠️ Document is empty: {FilePath}", filePath);
-                    return 0;
-                }
-
-                // Extract content based on file format
-                var extractedContent = await ExtractContentAsync(filePath, content);
-                
-                // Create text chunks
-                var chunks = CreateTextChunks(extractedContent, DefaultChunkSize, DefaultChunkOverlap);
-                _logger.LogInformation("📄 Created {ChunkCount} chunks from document: {FilePath}", chunks.Count, filePath);
-
-                // Emit chunking complete event
-                await _eventBus.EmitAsync("document.chunk.complete", new Dictionary<string, object>
-                {
-                    { "filePath", filePath },
-                    { "chunkCount", chunks.Count },
-                    { "originalLength", content.Length }
-                });
-
-                // Generate embeddings for each chunk
-                var chunkTexts = chunks.Select(chunk => chunk.Content).ToList();
-                var embeddingResult = await _embeddingGenerator.GenerateAsync(chunkTexts);
-                var embeddings = embeddingResult.ToList();
-                
-                // Store vector records
-                var vectorCount = 0;
-                for (int i = 0; i < chunks.Count; i++)
-                {
-                    var chunk = chunks[i];
-                    var embedding = i < embeddings.Count ? embeddings[i].Vector.ToArray() : Array.Empty<float>();
-                    
-                    // Prepare chunk metadata
-                    var chunkMetadata = new Dictionary<string, object>
-                    {
-                        { "sourceFile", filePath },
-                        { "chunkIndex", i },
-                        { "chunkStart", chunk.StartPosition },
-                        { "chunkEnd", chunk.EndPosition },
-                        { "fileFormat", Path.GetExtension(filePath) }
-                    };
-
-                    // Add custom metadata if provided
-                    if (metadata != null)
-                    {
-                        foreach (var kvp in metadata)
-                        {
-                            chunkMetadata[kvp.Key] = kvp.Value;
-                        }
-                    }
-
-                    // Create and store vector record
-                    var vectorRecord = new VectorRecord
-                    {
-                        Id = $"{Path.GetFileNameWithoutExtension(filePath)}_chunk_{i}_{Guid.NewGuid():N}",
-                        Vector = embedding,
-                        Content = chunk.Content,
-                        Metadata = chunkMetadata,
-                        CreatedAt = DateTimeOffset.UtcNow
-                    };
-
-                    await _vectorStore.AddAsync(vectorRecord);
-                    vectorCount++;
-                }
-
-                // Emit vectorization complete event
-                await _eventBus.EmitAsync("document.vector.complete", new Dictionary<string, object>
-                {
-                    { "filePath", filePath },
-                    { "vectorCount", vectorCount },
-                    { "chunkCount", chunks.Count }
-                });
+            var result = await CreatePipeline().RunAsync(new[] { filePath }, metadata);
 
-                _logger.LogInformation("✅ Document ingestion completed: {FilePath}, {VectorCount} vectors created", filePath, vectorCount);
-                return vectorCount;
-            }
-            catch (Exception ex)
+            // The pipeline already logged the failure and emitted document.ingest.error
+            if (result.Errors.TryGetValue(filePath, out var error))
             {
-                _logger.LogError(ex, "❌ Error ingesting document: {FilePath}", filePath);
-                
-                // Emit error event
-                await _eventBus.EmitAsync("document.ingest.error", new Dictionary<string, object>
-                {
-                    { "filePath", filePath },
-                    { "error", ex.Message },
-                    { "timestamp", DateTimeOffset.UtcNow }
-                });
-                
-                throw;
+                ExceptionDispatchInfo.Capture(error).Throw();
             }
+
+            return result.Vectors;
         }
 
         /// <summary>
         /// Processes multiple documents into vector chunks.
+        /// All files flow through one pipeline, so reading, embedding and storing of different files overlap.
         /// </summary>
         public async Task<int> IngestDocumentBatchAsync(IEnumerable<string> filePaths, Dictionary<string, object>? metadata = null)
         {
-            var totalVectors = 0;
-            var processedFiles = 0;
-            var errors = new List<string>();
-
-            foreach (var filePath in filePaths)
-            {
-                try
-                {
-                    var vectorCount = await IngestDocumentAsync(filePath, metadata);
-                    totalVectors += vectorCount;
-                    processedFiles++;
-                    
-                    _logger.LogInformation("📄 Processed file {ProcessedFiles}: {FilePath} ({VectorCount} vectors)", processedFiles, filePath, vectorCount);
-                }
-                catch (Exception ex)
-                {
-                    errors.Add($"{filePath}: {ex.Message}");
-                    _logger.LogError(ex, "❌ Failed to process file in batch: {FilePath}", filePath);
-                }
-            }
+            var result = await CreatePipeline().RunAsync(filePaths, metadata);
+            var errors = result.Errors.Select(e => $"{e.Key}: {e.Value.Message}").ToList();
 
             // Emit batch completion event
             await _eventBus.EmitAsync("document.batch.ingest.complete", new Dictionary<string, object>
             {
-                { "totalFiles", filePaths.Count() },
-                { "processedFiles", processedFiles },
-                { "totalVectors", totalVectors },
+                { "totalFiles", result.FilesSeen },
+                { "processedFiles", result.FilesProcessed },
+                { "skippedFiles", result.FilesSkipped },
+                { "totalVectors", result.Vectors },
                 { "errors", errors },
                 { "timestamp", DateTimeOffset.UtcNow }
             });
 
-            _logger.LogInformation("✅ Batch ingestion completed: {ProcessedFiles}/{TotalFiles} files, {TotalVectors} total vectors", 
-                processedFiles, filePaths.Count(), totalVectors);
+            _logger.LogInformation("✅ Batch ingestion completed: {ProcessedFiles}/{TotalFiles} files ({SkippedFiles} unchanged), {TotalVectors} total vectors", 
+                result.FilesProcessed, result.FilesSeen, result.FilesSkipped, result.Vectors);
 
-            return totalVectors;
+            return result.Vectors;
         }
 
         /// <summary>
@@ -232,23 +120,35 @@ namespace CxLanguage.StandardLibrary.Services.Document
 
             _logger.LogInformation("🔄 Starting directory ingestion: {DirectoryPath} (recursive: {Recursive})", directoryPath, recursive);
 
-            // Find all supported files
+            // Files are enumerated lazily, so ingestion starts before the directory walk finishes
             var searchOption = recursive ? SearchOption.AllDirectories : SearchOption.TopDirectoryOnly;
-            var allFiles = Directory.GetFiles(directoryPath, "*", searchOption);
-            var supportedFiles = allFiles.Where(IsFormatSupported).ToList();
-
-            _logger.LogInformation("📁 Found {SupportedFiles} supported files in directory: {DirectoryPath}", supportedFiles.Count, directoryPath);
+            var totalFiles = 0;
+            var supportedFiles = 0;
+            IEnumerable<string> EnumerateSupportedFiles()
+            {
+                foreach (var file in Directory.EnumerateFiles(directoryPath, "*", searchOption))
+                {
+                    totalFiles++;
+                    if (IsFormatSupported(file))
+                    {
+                        supportedFiles++;
+                        yield return file;
+                    }
+                }
+            }
 
             // Process all supported files
-            var totalVectors = await IngestDocumentBatchAsync(supportedFiles, metadata);
+            var totalVectors = await IngestDocumentBatchAsync(EnumerateSupportedFiles(), metadata);
+
+            _logger.LogInformation("📁 Found {SupportedFiles} supported files in directory: {DirectoryPath}", supportedFiles, directoryPath);
 
             // Emit directory completion event
             await _eventBus.EmitAsync("document.directory.ingest.complete", new Dictionary<string, object>
             {
                 { "directoryPath", directoryPath },
                 { "recursive", recursive },
-                { "supportedFiles", supportedFiles.Count },
-                { "totalFiles", allFiles.Length },
+                { "supportedFiles", supportedFiles },
+                { "totalFiles", totalFiles },
                 { "totalVectors", totalVectors },
                 { "timestamp", DateTimeOffset.UtcNow }
             });
@@ -273,112 +173,26 @@ namespace CxLanguage.StandardLibrary.Services.Document
             return _supportedFormats.Contains(extension);
         }
 
-        /// <summary>
-        /// Extracts content from different document formats.
-        /// </summary>
-        private async Task<string> ExtractContentAsync(string filePath, string rawContent)
-        {
-            var extension = Path.GetExtension(filePath).ToLowerInvariant();
-            
-            return extension switch
-            {
-                ".txt" => rawContent,
-                ".md" => rawContent, // For now, treat markdown as plain text
-                ".json" => await ExtractJsonContentAsync(rawContent),
-                _ => rawContent
-            };
-        }
+        private DocumentIngestionPipeline CreatePipeline() =>
+            new(_options, _eventBus, _vectorStore, _embeddingGenerator, _checkpoint.Value, IsFormatSupported, _logger);
 
-        /// <summary>
-        /// Extracts meaningful content from JSON documents.
-        /// </summary>
-        private Task<string> ExtractJsonContentAsync(string jsonContent)
+        private DocumentIngestionCheckpoint? OpenCheckpoint()
         {
-            try
-            {
-                // Parse JSON and extract text values
-                var document = JsonDocument.Parse(jsonContent);
-                var textBuilder = new StringBuilder();
-                
-                ExtractTextFromJsonElement(document.RootElement, textBuilder);
-                
-                return Task.FromResult(textBuilder.ToString());
-            }
-            catch (JsonException ex)
+            if (string.IsNullOrEmpty(_options.CheckpointPath))
             {
-                _logger.LogWarning(ex, "⚠️ Failed to parse JSON, using raw content");
-                return Task.FromResult(jsonContent);
+                return null;
             }
-        }
 
-        /// <summary>
-        /// Recursively extracts text from JSON elements.
-        /// </summary>
-        private void ExtractTextFromJsonElement(JsonElement element, StringBuilder textBuilder)
-        {
-            switch (element.ValueKind)
-            {
-                case JsonValueKind.String:
-                    textBuilder.AppendLine(element.GetString());
-                    break;
-                case JsonValueKind.Object:
-                    foreach (var property in element.EnumerateObject())
-                    {
-                        ExtractTextFromJsonElement(property.Value, textBuilder);
-                    }
-                    break;
-                case JsonValueKind.Array:
-                    foreach (var item in element.EnumerateArray())
-                    {
-                        ExtractTextFromJsonElement(item, textBuilder);
-                    }
-                    break;
-            }
-        }
-
-        /// <summary>
-        /// Creates text chunks from content with overlapping for better search results.
-        /// </summary>
-        private List<DocumentChunk> CreateTextChunks(string content, int chunkSize, int overlap)
-        {
-            var chunks = new List<DocumentChunk>();
-            
-            if (content.Length <= chunkSize)
+            try
             {
-                chunks.Add(new DocumentChunk
-                {
-                    Content = content,
-                    StartPosition = 0,
-                    EndPosition = content.Length
-                });
-                return chunks;
+                return new DocumentIngestionCheckpoint(_options.CheckpointPath);
             }
-
-            var position = 0;
-            var chunkIndex = 0;
-
-            while (position < content.Length)
+            catch (Exception ex)
             {
-                var endPosition = Math.Min(position + chunkSize, content.Length);
-                var chunkContent = content.Substring(position, endPosition - position);
-
-                chunks.Add(new DocumentChunk
-                {
-                    Content = chunkContent.Trim(),
-                    StartPosition = position,
-                    EndPosition = endPosition
-                });
-
-                // Move position with overlap
-                position = Math.Max(position + chunkSize - overlap, position + 1);
-                chunkIndex++;
-                
-                // Prevent infinite loop
-                if (position >= content.Length)
-                    break;
+                // Another process may hold the log; ingestion still works, only without skipping and resuming
+                _logger.LogWarning(ex, "⚠️ Document ingestion checkpoint unavailable: {CheckpointPath}", _options.CheckpointPath);
+                return null;
             }
-
-            return chunks;
         }
 
         #region Event Handlers
@@ -0,0 +1,279 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.CompilerServices;
+using System.Text;
+using System.Text.Json;
+using System.Threading;
+using Microsoft.Extensions.Logging;
+
+namespace CxLanguage.StandardLibrary.Services.Document
+{
+    /// <summary>
+    /// Reads a document as a stream of extracted text segments, so files are never held in memory whole.
+    /// Plain text and markdown pass through unchanged; JSON yields its string values one per line.
+    /// </summary>
+    internal static class DocumentTextReader
+    {
+        private const int BufferSize = 64 * 1024;
+
+        public static IAsyncEnumerable<string> ReadAsync(string filePath, ILogger logger, CancellationToken cancellationToken)
+        {
+            return Path.GetExtension(filePath).ToLowerInvariant() switch
+            {
+                ".json" => ReadJsonStringsAsync(filePath, logger, cancellationToken),
+                _ => ReadPlainTextAsync(filePath, cancellationToken) // For now, treat markdown as plain text
+            };
+        }
+
+        private static async IAsyncEnumerable<string> ReadPlainTextAsync(string filePath, [EnumeratorCancellation] CancellationToken cancellationToken)
+        {
+            using var reader = new StreamReader(OpenSequential(filePath), Encoding.UTF8, detectEncodingFromByteOrderMarks: true, BufferSize);
+            var buffer = new char[BufferSize];
+            int read;
+            while ((read = await reader.ReadAsync(buffer.AsMemory(), cancellationToken)) > 0)
+            {
+                yield return new string(buffer, 0, read);
+            }
+        }
+
+        /// <summary>
+        /// Streams the string values of a JSON document with Utf8JsonReader across buffer refills.
+        /// If the document turns out to be malformed, the rest of the file from the failing position is passed
+        /// through as plain text, which for a file that is not JSON at all is the whole file.
+        /// </summary>
+        private static async IAsyncEnumerable<string> ReadJsonStringsAsync(string filePath, ILogger logger,
+            [EnumeratorCancellation] CancellationToken cancellationToken)
+        {
+            using var stream = OpenSequential(filePath);
+            var buffer = ArrayPool<byte>.Shared.Rent(BufferSize);
+            var strings = new List<string>();
+            var state = new JsonReaderState(new JsonReaderOptions { AllowTrailingCommas = true, CommentHandling = JsonCommentHandling.Skip });
+            var length = 0;
+            var isFinalBlock = false;
+            var malformed = false;
+
+            try
+            {
+                // Skip a UTF-8 byte order mark
+                length = await stream.ReadAtLeastAsync(buffer.AsMemory(0, 3), 3, throwOnEndOfStream: false, cancellationToken);
+                if (length == 3 && buffer[0] == 0xEF && buffer[1] == 0xBB && buffer[2] == 0xBF)
+                {
+                    length = 0;
+                }
+
+                while (!isFinalBlock)
+                {
+                    if (length == buffer.Length)
+                    {
+                        // A single token is larger than the buffer
+                        var larger = ArrayPool<byte>.Shared.Rent(buffer.Length * 2);
+                        buffer.AsSpan(0, length).CopyTo(larger);
+                        ArrayPool<byte>.Shared.Return(buffer);
+                        buffer = larger;
+                    }
+
+                    var read = await stream.ReadAsync(buffer.AsMemory(length), cancellationToken);
+                    length += read;
+                    isFinalBlock = read == 0;
+
+                    int consumed;
+                    try
+                    {
+                        consumed = ReadStrings(buffer.AsSpan(0, length), isFinalBlock, ref state, strings);
+                    }
+                    catch (JsonException ex)
+                    {
+                        logger.LogWarning(ex, "⚠️ Failed to parse JSON, using raw content: {FilePath}", filePath);
+                        malformed = true;
+                        consumed = 0;
+
+                        // Values of the failing block are part of the raw text passed through below
+                        strings.Clear();
+                    }
+
+                    foreach (var value in strings)
+                    {
+                        yield return value;
+                    }
+                    strings.Clear();
+
+                    if (malformed)
+                    {
+                        break;
+                    }
+
+                    buffer.AsSpan(consumed, length - consumed).CopyTo(buffer);
+                    length -= consumed;
+                }
+
+                if (malformed)
+                {
+                    var decoder = Encoding.UTF8.GetDecoder();
+                    var chars = ArrayPool<char>.Shared.Rent(Encoding.UTF8.GetMaxCharCount(buffer.Length));
+                    try
+                    {
+                        while (length > 0)
+                        {
+                            var charCount = decoder.GetChars(buffer, 0, length, chars, 0, flush: false);
+                            yield return new string(chars, 0, charCount);
+                            length = await stream.ReadAsync(buffer.AsMemory(), cancellationToken);
+                        }
+
+                        var tail = decoder.GetChars(Array.Empty<byte>(), 0, 0, chars, 0, flush: true);
+                        if (tail > 0)
+                        {
+                            yield return new string(chars, 0, tail);
+                        }
+                    }
+                    finally
+                    {
+                        ArrayPool<char>.Shared.Return(chars);
+                    }
+                }
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+        }
+
+        /// <summary>
+        /// Collect the string values (not property names) of the complete tokens in data. Returns the bytes consumed.
+        /// </summary>
+        private static int ReadStrings(ReadOnlySpan<byte> data, bool isFinalBlock, ref JsonReaderState state, List<string> strings)
+        {
+            var reader = new Utf8JsonReader(data, isFinalBlock, state);
+            while (reader.Read())
+            {
+                if (reader.TokenType == JsonTokenType.String)
+                {
+                    strings.Add(reader.GetString() + Environment.NewLine);
+                }
+            }
+
+            state = reader.CurrentState;
+            return (int)reader.BytesConsumed;
+        }
+
+        private static FileStream OpenSequential(string filePath) =>
+            new(filePath, FileMode.Open, FileAccess.Read, FileShare.Read, BufferSize, FileOptions.Asynchronous | FileOptions.SequentialScan);
+    }
+
+    /// <summary>
+    /// Cuts a stream of text segments into overlapping fixed-size chunks while it is read, holding only the text
+    /// not yet covered by a chunk. Produces the same chunks as slicing the whole text at multiples of
+    /// (size - overlap): chunks are trimmed, except that a text no longer than one chunk becomes a single untrimmed chunk.
+    /// </summary>
+    internal sealed class StreamingTextChunker
+    {
+        private readonly int _chunkSize;
+        private readonly int _step;
+        private char[] _buffer;
+        private int _start;
+        private int _end;
+        private long _windowStart;
+        private bool _emitted;
+        private bool _hasContent;
+
+        public StreamingTextChunker(int chunkSize, int overlap)
+        {
+            _chunkSize = Math.Max(1, chunkSize);
+            _step = Math.Max(_chunkSize - Math.Max(0, overlap), 1);
+            _buffer = new char[_chunkSize * 2];
+        }
+
+        /// <summary>
+        /// Characters appended so far
+        /// </summary>
+        public long Length => _windowStart + WindowLength;
+
+        /// <summary>
+        /// True once any non-whitespace character has been appended
+        /// </summary>
+        public bool HasContent => _hasContent;
+
+        private int WindowLength => _end - _start;
+
+        public void Append(string segment, List<DocumentChunk> output)
+        {
+            if (!_hasContent && !string.IsNullOrWhiteSpace(segment))
+            {
+                _hasContent = true;
+            }
+
+            var offset = 0;
+            while (offset < segment.Length)
+            {
+                // Copy at most what can complete the next chunk, so the buffer stays within two chunks
+                EnsureCapacity();
+                var count = Math.Min(segment.Length - offset, _buffer.Length - _end);
+                segment.CopyTo(offset, _buffer, _end, count);
+                _end += count;
+                offset += count;
+
+                // The first chunk is only known to be a regular (trimmed) chunk once the text is longer than it
+                while (WindowLength > _chunkSize || (_emitted && WindowLength >= _chunkSize))
+                {
+                    Emit(output, _chunkSize, trim: true);
+                    Advance();
+                }
+            }
+        }
+
+        public void Complete(List<DocumentChunk> output)
+        {
+            if (!_emitted)
+            {
+                if (WindowLength > 0)
+                {
+                    Emit(output, WindowLength, trim: false);
+                }
+                return;
+            }
+
+            // Tail chunks start at every further step, exactly as the whole-text slicing would place them
+            while (WindowLength > 0)
+            {
+                Emit(output, Math.Min(_chunkSize, WindowLength), trim: true);
+                if (WindowLength <= _step)
+                {
+                    break;
+                }
+                Advance();
+            }
+        }
+
+        private void Emit(List<DocumentChunk> output, int length, bool trim)
+        {
+            var content = new string(_buffer, _start, length);
+            output.Add(new DocumentChunk
+            {
+                Content = trim ? content.Trim() : content,
+                StartPosition = (int)Math.Min(_windowStart, int.MaxValue),
+                EndPosition = (int)Math.Min(_windowStart + length, int.MaxValue)
+            });
+            _emitted = true;
+        }
+
+        private void Advance()
+        {
+            _start += _step;
+            _windowStart += _step;
+        }
+
+        private void EnsureCapacity()
+        {
+            if (_end < _buffer.Length)
+            {
+                return;
+            }
+
+            // The window never exceeds one chunk between appends, so compacting always frees room
+            Array.Copy(_buffer, _start, _buffer, 0, WindowLength);
+            _end -= _start;
+            _start = 0;
+        }
+    }
+}
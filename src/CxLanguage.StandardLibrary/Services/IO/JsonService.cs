@@ -1,11 +1,16 @@
 using System;
+using System.Buffers;
+using System.Collections;
 using System.Collections.Generic;
 using System.IO;
 using System.Text.Json;
 using System.Text.Json.Serialization;
+using System.Linq;
+using System.Text;
 using System.Threading.Tasks;
 using Microsoft.Extensions.Logging;
 using CxLanguage.Core.Events;
+using CxLanguage.Core.Serialization;
 using CxLanguage.StandardLibrary.Core;
 
 namespace CxLanguage.StandardLibrary.Services.IO
@@ -31,7 +36,8 @@ namespace CxLanguage.StandardLibrary.Services.IO
                 PropertyNamingPolicy = JsonNamingPolicy.CamelCase,
                 WriteIndented = true,
                 DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull,
-                PropertyNameCaseInsensitive = true
+                PropertyNameCaseInsensitive = true,
+                TypeInfoResolver = CxJsonSerializerContext.WithReflectionFallback()
             };
             
             // NO AUTO HANDLERS - All handlers must be explicitly declared in CX programs
@@ -72,6 +78,13 @@ namespace CxLanguage.StandardLibrary.Services.IO
                     return;
                 }
 
+                var selectPaths = GetSelectPaths(data?.GetValueOrDefault("select"));
+                if (selectPaths.Count > 0)
+                {
+                    await ReadProjectedJsonFile(path, selectPaths, requestId);
+                    return;
+                }
+
                 var jsonContent = await File.ReadAllTextAsync(path);
                 var parsedData = JsonSerializer.Deserialize<object>(jsonContent, _jsonOptions);
                 
@@ -87,6 +100,20 @@ namespace CxLanguage.StandardLibrary.Services.IO
                     ["timestamp"] = DateTime.UtcNow
                 });
             }
+            catch (FormatException pathEx)
+            {
+                _logger.LogError($"❌ Invalid JSON path: {pathEx.Message}");
+                var data = eventPayload.Data as Dictionary<string, object>;
+                var requestId = data?.GetValueOrDefault("requestId")?.ToString() ?? Guid.NewGuid().ToString();
+
+                await _eventBus.EmitAsync("json.read.error", new Dictionary<string, object>
+                {
+                    ["error"] = $"Invalid JSON path: {pathEx.Message}",
+                    ["type"] = "json_path_error",
+                    ["requestId"] = requestId,
+                    ["timestamp"] = DateTime.UtcNow
+                });
+            }
             catch (JsonException jsonEx)
             {
                 _logger.LogError($"❌ JSON parsing error: {jsonEx.Message}");
@@ -116,6 +143,180 @@ namespace CxLanguage.StandardLibrary.Services.IO
             }
         }
 
+        /// <summary>
+        /// json.read with "select": stream the file through CxJsonStreamReader and materialize only the selected
+        /// paths. No "content" is returned, so the file is never held in memory.
+        /// </summary>
+        private async Task ReadProjectedJsonFile(string path, IReadOnlyList<string> selectPaths, string requestId)
+        {
+            var reader = new CxJsonStreamReader(selectPaths.Select(CxJsonPath.Parse));
+            var size = new FileInfo(path).Length;
+
+            Dictionary<string, object> projection;
+            using (var stream = OpenSequential(path))
+            {
+                projection = await reader.ReadProjectionAsync(stream);
+            }
+
+            _logger.LogInformation($"✅ Streamed {projection.Count} of {selectPaths.Count} selected paths from JSON file: {path}");
+
+            await _eventBus.EmitAsync("json.read.completed", new Dictionary<string, object>
+            {
+                ["path"] = path,
+                ["data"] = projection,
+                ["select"] = selectPaths.ToArray(),
+                ["projected"] = true,
+                ["size"] = size,
+                ["requestId"] = requestId,
+                ["timestamp"] = DateTime.UtcNow
+            });
+        }
+
+        /// <summary>
+        /// Stream the elements matched by "items" (default "$[*]", the elements of a root array) out of a JSON
+        /// file as one json.stream.item event each, in document order, without loading the file
+        /// </summary>
+        private async Task HandleJsonStreamRequest(CxEventPayload eventPayload)
+        {
+            var data = eventPayload.Data as Dictionary<string, object>;
+            var requestId = data?.GetValueOrDefault("requestId")?.ToString() ?? Guid.NewGuid().ToString();
+
+            try
+            {
+                var path = data?.GetValueOrDefault("path")?.ToString();
+                var itemsPath = data?.GetValueOrDefault("items")?.ToString() ?? "$[*]";
+
+                _logger.LogInformation($"🌊 Streaming JSON items {itemsPath} from file: {path}");
+
+                if (string.IsNullOrEmpty(path) || !File.Exists(path))
+                {
+                    var error = string.IsNullOrEmpty(path) ? "File path is required" : $"JSON file not found: {path}";
+                    _logger.LogError($"❌ {error}");
+                    await _eventBus.EmitAsync("json.stream.error", new Dictionary<string, object>
+                    {
+                        ["error"] = error,
+                        ["requestId"] = requestId,
+                        ["timestamp"] = DateTime.UtcNow
+                    });
+                    return;
+                }
+
+                var reader = new CxJsonStreamReader(itemsPath);
+                var count = 0;
+                using (var stream = OpenSequential(path))
+                {
+                    await foreach (var match in reader.ReadMatchesAsync(stream))
+                    {
+                        if (match.Value == null)
+                        {
+                            continue;
+                        }
+
+                        await _eventBus.EmitAsync("json.stream.item", new Dictionary<string, object>
+                        {
+                            ["path"] = path,
+                            ["item"] = match.Value,
+                            ["index"] = count++,
+                            ["requestId"] = requestId
+                        });
+                    }
+                }
+
+                _logger.LogInformation($"✅ Streamed {count} JSON items from file: {path}");
+
+                await _eventBus.EmitAsync("json.stream.completed", new Dictionary<string, object>
+                {
+                    ["path"] = path,
+                    ["items"] = itemsPath,
+                    ["count"] = count,
+                    ["requestId"] = requestId,
+                    ["timestamp"] = DateTime.UtcNow
+                });
+            }
+            catch (Exception ex) when (ex is JsonException or FormatException)
+            {
+                _logger.LogError($"❌ JSON streaming error: {ex.Message}");
+                await _eventBus.EmitAsync("json.stream.error", new Dictionary<string, object>
+                {
+                    ["error"] = $"JSON streaming error: {ex.Message}",
+                    ["type"] = ex is FormatException ? "json_path_error" : "json_parse_error",
+                    ["requestId"] = requestId,
+                    ["timestamp"] = DateTime.UtcNow
+                });
+            }
+            catch (Exception ex)
+            {
+                _logger.LogError($"❌ Error streaming JSON file: {ex.Message}");
+                await _eventBus.EmitAsync("json.stream.error", new Dictionary<string, object>
+                {
+                    ["error"] = ex.Message,
+                    ["requestId"] = requestId,
+                    ["timestamp"] = DateTime.UtcNow
+                });
+            }
+        }
+
+        /// <summary>
+        /// Check that the content is one well-formed JSON value and return its kind, with a single
+        /// Utf8JsonReader pass instead of building a JsonDocument. Content without any value throws JsonException.
+        /// </summary>
+        private static JsonValueKind ValidateJson(string jsonContent)
+        {
+            var buffer = ArrayPool<byte>.Shared.Rent(Encoding.UTF8.GetMaxByteCount(jsonContent.Length));
+            try
+            {
+                var length = Encoding.UTF8.GetBytes(jsonContent, buffer);
+                var reader = new Utf8JsonReader(buffer.AsSpan(0, length));
+                if (!reader.Read())
+                {
+                    // Whitespace only: invalid, as JsonDocument.Parse reports it
+                    throw new JsonException("The input does not contain any JSON tokens");
+                }
+
+                var kind = reader.TokenType switch
+                {
+                    JsonTokenType.StartObject => JsonValueKind.Object,
+                    JsonTokenType.StartArray => JsonValueKind.Array,
+                    JsonTokenType.String => JsonValueKind.String,
+                    JsonTokenType.Number => JsonValueKind.Number,
+                    JsonTokenType.True => JsonValueKind.True,
+                    JsonTokenType.False => JsonValueKind.False,
+                    _ => JsonValueKind.Null
+                };
+
+                reader.Skip();
+                reader.Read();
+                return kind;
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+        }
+
+        private static FileStream OpenSequential(string path) =>
+            new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read, bufferSize: 1, FileOptions.Asynchronous | FileOptions.SequentialScan);
+
+        /// <summary>
+        /// "select" may be one JSONPath string or an array of them
+        /// </summary>
+        private static IReadOnlyList<string> GetSelectPaths(object? select)
+        {
+            switch (select)
+            {
+                case null:
+                    return Array.Empty<string>();
+                case string single:
+                    return string.IsNullOrWhiteSpace(single) ? Array.Empty<string>() : new[] { single };
+                case JsonElement { ValueKind: JsonValueKind.Array } array:
+                    return array.EnumerateArray().Select(e => e.ToString()).Where(p => !string.IsNullOrWhiteSpace(p)).ToArray();
+                case IEnumerable items:
+                    return items.Cast<object?>().Select(p => p?.ToString()).Where(p => !string.IsNullOrWhiteSpace(p)).Select(p => p!).ToArray();
+                default:
+                    return new[] { select.ToString()! };
+            }
+        }
+
         private async Task HandleJsonWriteRequest(CxEventPayload eventPayload)
         {
             try
@@ -233,22 +434,19 @@ namespace CxLanguage.StandardLibrary.Services.IO
 
                 try
                 {
-                    using (var doc = JsonDocument.Parse(jsonContent))
-                    {
-                        var isValid = true;
-                        var jsonType = doc.RootElement.ValueKind.ToString();
-                        
-                        _logger.LogInformation($"✅ JSON is valid (type: {jsonType})");
+                    var isValid = true;
+                    var jsonType = ValidateJson(jsonContent).ToString();
+                    
+                    _logger.LogInformation($"✅ JSON is valid (type: {jsonType})");
 
-                        await _eventBus.EmitAsync("json.validate.completed", new Dictionary<string, object>
-                        {
-                            ["valid"] = isValid,
-                            ["type"] = jsonType,
-                            ["size"] = jsonContent.Length,
-                            ["requestId"] = requestId,
-                            ["timestamp"] = DateTime.UtcNow
-                        });
-                    }
+                    await _eventBus.EmitAsync("json.validate.completed", new Dictionary<string, object>
+                    {
+                        ["valid"] = isValid,
+                        ["type"] = jsonType,
+                        ["size"] = jsonContent.Length,
+                        ["requestId"] = requestId,
+                        ["timestamp"] = DateTime.UtcNow
+                    });
                 }
                 catch (JsonException jsonEx)
                 {
@@ -0,0 +1,257 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Incremental BM25 inverted index over record content.
+    /// Each posting keeps the character offsets of the term in the record, so keyword scoring reads only the
+    /// postings of the query terms and snippet placement is a lookup rather than a rescan of the content.
+    /// Upsert and Remove keep the collection statistics (document count, average length) current.
+    /// </summary>
+    internal sealed class Bm25KeywordIndex
+    {
+        private const double K1 = 1.2;
+        private const double B = 0.75;
+
+        private readonly ReaderWriterLockSlim _lock = new(LockRecursionPolicy.NoRecursion);
+        private readonly Dictionary<string, Dictionary<string, int[]>> _postings = new(StringComparer.Ordinal);
+        private readonly Dictionary<string, Document> _documents = new(StringComparer.Ordinal);
+        private long _totalLength;
+
+        private sealed class Document
+        {
+            public Document(int length, Dictionary<string, int[]> offsets)
+            {
+                Length = length;
+                Offsets = offsets;
+            }
+
+            public int Length { get; }
+            public Dictionary<string, int[]> Offsets { get; }
+        }
+
+        public int DocumentCount
+        {
+            get
+            {
+                _lock.EnterReadLock();
+                try { return _documents.Count; }
+                finally { _lock.ExitReadLock(); }
+            }
+        }
+
+        public int TermCount
+        {
+            get
+            {
+                _lock.EnterReadLock();
+                try { return _postings.Count; }
+                finally { _lock.ExitReadLock(); }
+            }
+        }
+
+        /// <summary>
+        /// Lower-cased runs of letters and digits with their character offsets
+        /// </summary>
+        public static IEnumerable<(string Term, int Offset)> Tokenize(string text)
+        {
+            var start = -1;
+            for (int i = 0; i <= text.Length; i++)
+            {
+                if (i < text.Length && char.IsLetterOrDigit(text[i]))
+                {
+                    if (start < 0) start = i;
+                }
+                else if (start >= 0)
+                {
+                    yield return (text.Substring(start, i - start).ToLowerInvariant(), start);
+                    start = -1;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Index or re-index the content of a record
+        /// </summary>
+        public void Upsert(string id, string content)
+        {
+            // Tokenize outside the lock; only the posting updates are serialized
+            var positions = new Dictionary<string, List<int>>(StringComparer.Ordinal);
+            var length = 0;
+            foreach (var (term, offset) in Tokenize(content ?? string.Empty))
+            {
+                if (!positions.TryGetValue(term, out var list))
+                {
+                    positions[term] = list = new List<int>(1);
+                }
+                list.Add(offset);
+                length++;
+            }
+
+            var offsets = new Dictionary<string, int[]>(positions.Count, StringComparer.Ordinal);
+            foreach (var (term, list) in positions)
+            {
+                offsets[term] = list.ToArray();
+            }
+
+            _lock.EnterWriteLock();
+            try
+            {
+                RemoveLocked(id);
+                foreach (var (term, termOffsets) in offsets)
+                {
+                    if (!_postings.TryGetValue(term, out var posting))
+                    {
+                        _postings[term] = posting = new Dictionary<string, int[]>(StringComparer.Ordinal);
+                    }
+                    posting[id] = termOffsets;
+                }
+                _documents[id] = new Document(length, offsets);
+                _totalLength += length;
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public bool Remove(string id)
+        {
+            _lock.EnterWriteLock();
+            try { return RemoveLocked(id); }
+            finally { _lock.ExitWriteLock(); }
+        }
+
+        public void Clear()
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                _postings.Clear();
+                _documents.Clear();
+                _totalLength = 0;
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        /// <summary>
+        /// Top records by BM25 score for the given (lower-cased) query terms, best first.
+        /// When include is given, only the records it accepts are scored.
+        /// </summary>
+        public List<(string Id, double Score)> Search(IReadOnlyCollection<string> terms, int topK, Func<string, bool>? include = null)
+        {
+            var scores = new Dictionary<string, double>(StringComparer.Ordinal);
+
+            _lock.EnterReadLock();
+            try
+            {
+                var documentCount = _documents.Count;
+                if (documentCount == 0 || topK <= 0)
+                {
+                    return new List<(string, double)>();
+                }
+
+                var averageLength = Math.Max(1.0, (double)_totalLength / documentCount);
+                foreach (var term in terms)
+                {
+                    if (!_postings.TryGetValue(term, out var posting))
+                    {
+                        continue;
+                    }
+
+                    var idf = Math.Log(1.0 + (documentCount - posting.Count + 0.5) / (posting.Count + 0.5));
+                    foreach (var (id, termOffsets) in posting)
+                    {
+                        if (include != null && !include(id)) continue;
+
+                        var tf = termOffsets.Length;
+                        var norm = K1 * (1 - B + B * _documents[id].Length / averageLength);
+                        scores[id] = scores.GetValueOrDefault(id) + idf * tf * (K1 + 1) / (tf + norm);
+                    }
+                }
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+
+            // Bounded min-heap top-K selection, as in the vector indexes
+            var heap = new PriorityQueue<string, double>(topK + 1);
+            foreach (var (id, score) in scores)
+            {
+                heap.Enqueue(id, score);
+                if (heap.Count > topK)
+                {
+                    heap.Dequeue();
+                }
+            }
+
+            var results = new List<(string Id, double Score)>(heap.Count);
+            while (heap.TryDequeue(out var id, out var score))
+            {
+                results.Add((id, score));
+            }
+            results.Reverse();
+            return results;
+        }
+
+        /// <summary>
+        /// Sorted character offsets of the query terms in a record, each paired with the index of the term it belongs to.
+        /// Returns false when the record is not indexed.
+        /// </summary>
+        public bool TryGetTermOffsets(string id, IReadOnlyList<string> terms, out List<(int Offset, int TermIndex)> offsets)
+        {
+            offsets = new List<(int, int)>();
+
+            _lock.EnterReadLock();
+            try
+            {
+                if (!_documents.TryGetValue(id, out var document))
+                {
+                    return false;
+                }
+
+                for (int t = 0; t < terms.Count; t++)
+                {
+                    if (document.Offsets.TryGetValue(terms[t], out var termOffsets))
+                    {
+                        foreach (var offset in termOffsets)
+                        {
+                            offsets.Add((offset, t));
+                        }
+                    }
+                }
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+
+            offsets.Sort((a, b) => a.Offset.CompareTo(b.Offset));
+            return true;
+        }
+
+        private bool RemoveLocked(string id)
+        {
+            if (!_documents.Remove(id, out var document))
+            {
+                return false;
+            }
+
+            foreach (var term in document.Offsets.Keys)
+            {
+                if (_postings.TryGetValue(term, out var posting) && posting.Remove(id) && posting.Count == 0)
+                {
+                    _postings.Remove(term);
+                }
+            }
+            _totalLength -= document.Length;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,313 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Exact (brute-force) cosine similarity index.
+    /// Vectors are normalized on insert and kept in one contiguous row-major buffer, so a query is a single
+    /// streaming pass of SIMD dot products with top-K selection through a bounded heap. Large stores are split
+    /// into contiguous row ranges scored on separate cores and merged at the end.
+    /// Deleting a record moves the last row into the freed slot, keeping the buffer dense.
+    /// The buffer is a single array, so the index holds at most Array.MaxLength / dimension rows (about 1.4M at
+    /// 1536 dimensions); inserting beyond that throws instead of overflowing the row offsets.
+    /// </summary>
+    internal sealed class FlatVectorIndex : IVectorIndex
+    {
+        /// <summary>
+        /// Below this many rows the work is too small to be worth partitioning across threads
+        /// </summary>
+        private const int ParallelRowThreshold = 16_384;
+        private const int InitialCapacity = 64;
+
+        private readonly ReaderWriterLockSlim _lock = new(LockRecursionPolicy.NoRecursion);
+        private readonly Dictionary<string, int> _slotsById = new(StringComparer.Ordinal);
+        private float[] _vectors = Array.Empty<float>();
+        private string[] _ids = Array.Empty<string>();
+        private int _dimension;
+        private int _count;
+
+        public string Kind => "flat";
+
+        public bool IsApproximate => false;
+
+        /// <summary>
+        /// Dimension of the indexed vectors, or 0 while the index is empty
+        /// </summary>
+        public int Dimension
+        {
+            get
+            {
+                _lock.EnterReadLock();
+                try { return _count == 0 ? 0 : _dimension; }
+                finally { _lock.ExitReadLock(); }
+            }
+        }
+
+        public int Count
+        {
+            get
+            {
+                _lock.EnterReadLock();
+                try { return _count; }
+                finally { _lock.ExitReadLock(); }
+            }
+        }
+
+        /// <summary>
+        /// Insert or replace the vector stored for an id
+        /// </summary>
+        public void Upsert(string id, ReadOnlySpan<float> vector)
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                if (_count == 0)
+                {
+                    if (vector.Length != _dimension)
+                    {
+                        // First vector after the store emptied out: the row width changes, so drop the old buffers
+                        _vectors = Array.Empty<float>();
+                        _ids = Array.Empty<string>();
+                        _dimension = vector.Length;
+                    }
+                }
+                else if (vector.Length != _dimension)
+                {
+                    throw new ArgumentException($"Vector dimension ({vector.Length}) does not match stored vector dimension ({_dimension})");
+                }
+
+                if (!_slotsById.TryGetValue(id, out var slot))
+                {
+                    EnsureCapacity(_count + 1);
+                    slot = _count++;
+                    _slotsById[id] = slot;
+                    _ids[slot] = id;
+                }
+
+                VectorKernels.Normalize(vector, _vectors.AsSpan(slot * _dimension, _dimension));
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public bool Remove(string id)
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                if (!_slotsById.Remove(id, out var slot))
+                {
+                    return false;
+                }
+
+                var last = --_count;
+                if (slot != last)
+                {
+                    // Move the last row into the hole
+                    _vectors.AsSpan(last * _dimension, _dimension).CopyTo(_vectors.AsSpan(slot * _dimension, _dimension));
+                    _ids[slot] = _ids[last];
+                    _slotsById[_ids[slot]] = slot;
+                }
+                _ids[last] = null!;
+                return true;
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public void Clear()
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                _slotsById.Clear();
+                _vectors = Array.Empty<float>();
+                _ids = Array.Empty<string>();
+                _dimension = 0;
+                _count = 0;
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        /// <summary>
+        /// Return the ids and cosine similarities of the topK closest vectors, highest first
+        /// </summary>
+        public List<(string Id, float Score)> Search(ReadOnlySpan<float> query, int topK)
+        {
+            var results = new List<(string Id, float Score)>();
+            if (topK <= 0)
+            {
+                return results;
+            }
+
+            _lock.EnterReadLock();
+            try
+            {
+                if (_count == 0)
+                {
+                    return results;
+                }
+
+                if (query.Length != _dimension)
+                {
+                    throw new ArgumentException($"Query vector dimension ({query.Length}) does not match stored vector dimension ({_dimension})");
+                }
+
+                var normalizedQuery = new float[_dimension];
+                VectorKernels.Normalize(query, normalizedQuery);
+
+                var k = Math.Min(topK, _count);
+                var heap = _count < ParallelRowThreshold
+                    ? ScoreRange(normalizedQuery, 0, _count, k)
+                    : ScoreParallel(normalizedQuery, k);
+
+                foreach (var (slot, score) in heap.ToSortedArray())
+                {
+                    results.Add((_ids[slot], score));
+                }
+                return results;
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        /// <summary>
+        /// Score only the candidates' rows, so a filter matching 1% of the store costs about 1% of a full scan
+        /// </summary>
+        public List<(string Id, float Score)> Search(ReadOnlySpan<float> query, int topK, IReadOnlyCollection<string> candidates)
+        {
+            var results = new List<(string Id, float Score)>();
+            if (topK <= 0 || candidates.Count == 0)
+            {
+                return results;
+            }
+
+            _lock.EnterReadLock();
+            try
+            {
+                if (_count == 0)
+                {
+                    return results;
+                }
+
+                if (query.Length != _dimension)
+                {
+                    throw new ArgumentException($"Query vector dimension ({query.Length}) does not match stored vector dimension ({_dimension})");
+                }
+
+                var normalizedQuery = new float[_dimension];
+                VectorKernels.Normalize(query, normalizedQuery);
+
+                var heap = new TopKHeap(Math.Min(topK, Math.Min(candidates.Count, _count)));
+                foreach (var id in candidates)
+                {
+                    if (!_slotsById.TryGetValue(id, out var slot)) continue;
+
+                    var score = VectorKernels.Dot(_vectors.AsSpan(slot * _dimension, _dimension), normalizedQuery);
+                    if (score > heap.Threshold)
+                    {
+                        heap.Add(score, slot);
+                    }
+                }
+
+                foreach (var (slot, score) in heap.ToSortedArray())
+                {
+                    results.Add((_ids[slot], score));
+                }
+                return results;
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        public List<(string Id, float Score)> SearchExact(ReadOnlySpan<float> query, int topK) => Search(query, topK);
+
+        public void AddMetrics(Dictionary<string, object> metrics)
+        {
+            metrics["index_capacity"] = _ids.Length;
+        }
+
+        private TopKHeap ScoreParallel(float[] query, int k)
+        {
+            var partitions = Math.Min(Environment.ProcessorCount, _count / (ParallelRowThreshold / 4));
+            if (partitions <= 1)
+            {
+                return ScoreRange(query, 0, _count, k);
+            }
+
+            var rowsPerPartition = (_count + partitions - 1) / partitions;
+            var partials = new TopKHeap[partitions];
+
+            // Worker threads only read the buffers; the caller's read lock keeps writers out until they finish
+            Parallel.For(0, partitions, partition =>
+            {
+                var start = partition * rowsPerPartition;
+                var end = Math.Min(start + rowsPerPartition, _count);
+                partials[partition] = ScoreRange(query, start, end, k);
+            });
+
+            var merged = new TopKHeap(k);
+            foreach (var partial in partials)
+            {
+                merged.AddRange(partial);
+            }
+            return merged;
+        }
+
+        private TopKHeap ScoreRange(float[] query, int start, int end, int k)
+        {
+            var heap = new TopKHeap(k);
+            var vectors = _vectors;
+            var dimension = _dimension;
+
+            for (int slot = start; slot < end; slot++)
+            {
+                var score = VectorKernels.Dot(vectors.AsSpan(slot * dimension, dimension), query);
+                if (score > heap.Threshold)
+                {
+                    heap.Add(score, slot);
+                }
+            }
+            return heap;
+        }
+
+        private void EnsureCapacity(int rows)
+        {
+            if (rows <= _ids.Length)
+            {
+                return;
+            }
+
+            var maxRows = Array.MaxLength / Math.Max(1, _dimension);
+            if (rows > maxRows)
+            {
+                throw new InvalidOperationException(
+                    $"The flat vector index holds at most {maxRows} vectors of dimension {_dimension}");
+            }
+
+            long capacity = Math.Max(InitialCapacity, _ids.Length * 2L);
+            while (capacity < rows)
+            {
+                capacity *= 2;
+            }
+            capacity = Math.Min(capacity, maxRows);
+
+            Array.Resize(ref _ids, (int)capacity);
+            Array.Resize(ref _vectors, (int)capacity * _dimension);
+        }
+    }
+}
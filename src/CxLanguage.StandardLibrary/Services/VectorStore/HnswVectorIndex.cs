@@ -0,0 +1,658 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Hierarchical Navigable Small World index (Malkov and Yashunin) over unit-normalized vectors.
+    /// Search descends greedily through the sparse upper layers and then runs a beam search of width efSearch
+    /// on layer 0, so query cost grows roughly logarithmically with the store size instead of linearly.
+    ///
+    /// Inserts are incremental. Deletes leave a tombstone: the node keeps routing queries through the graph but is
+    /// never returned or chosen as a new neighbour. Once tombstones outnumber live nodes, or an insert reaches only
+    /// tombstones and cannot be linked, the graph is rebuilt from the live vectors. Writes take an exclusive lock; searches run concurrently.
+    /// </summary>
+    internal sealed class HnswVectorIndex : IVectorIndex
+    {
+        private const int InitialCapacity = 64;
+        private const int MaxLevel = 16;
+
+        /// <summary>
+        /// Tombstones below this count never trigger a rebuild
+        /// </summary>
+        private const int CompactionMinimumTombstones = 1024;
+
+        /// <summary>
+        /// Filtered searches with at most this many candidates, or at most 1/FilteredGraphFraction of the live
+        /// nodes, score the candidates directly instead of walking the graph
+        /// </summary>
+        private const int FilteredExactScanMinimum = 4096;
+        private const int FilteredGraphFraction = 20;
+
+        private readonly ReaderWriterLockSlim _lock = new(LockRecursionPolicy.NoRecursion);
+        private readonly Dictionary<string, int> _nodesById = new(StringComparer.Ordinal);
+        private readonly Random _random = new(42);
+        private readonly int _m;
+        private readonly int _maxNeighborsLayer0;
+        private readonly int _efConstruction;
+        private readonly double _levelMultiplier;
+        private int _efSearch;
+
+        private float[] _vectors = Array.Empty<float>();
+        private string[] _ids = Array.Empty<string>();
+        private bool[] _deleted = Array.Empty<bool>();
+        private int[][][] _links = Array.Empty<int[][]>();
+        private int _nodeCount;
+        private int _liveCount;
+        private int _dimension;
+        private int _entryPoint = -1;
+        private int _topLevel = -1;
+
+        public HnswVectorIndex(int m, int efConstruction, int efSearch)
+        {
+            if (m < 2) throw new ArgumentOutOfRangeException(nameof(m), "HNSW M must be at least 2");
+
+            _m = m;
+            _maxNeighborsLayer0 = 2 * m;
+            _efConstruction = Math.Max(efConstruction, m);
+            _efSearch = Math.Max(1, efSearch);
+            _levelMultiplier = 1.0 / Math.Log(m);
+        }
+
+        public string Kind => "hnsw";
+
+        public bool IsApproximate => true;
+
+        public int M => _m;
+
+        public int EfConstruction => _efConstruction;
+
+        /// <summary>
+        /// Beam width for queries; can be changed at any time to trade latency for recall
+        /// </summary>
+        public int EfSearch
+        {
+            get => Volatile.Read(ref _efSearch);
+            set => Volatile.Write(ref _efSearch, Math.Max(1, value));
+        }
+
+        public int Dimension
+        {
+            get
+            {
+                _lock.EnterReadLock();
+                try { return _liveCount == 0 ? 0 : _dimension; }
+                finally { _lock.ExitReadLock(); }
+            }
+        }
+
+        public int Count
+        {
+            get
+            {
+                _lock.EnterReadLock();
+                try { return _liveCount; }
+                finally { _lock.ExitReadLock(); }
+            }
+        }
+
+        public void Upsert(string id, ReadOnlySpan<float> vector)
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                var replacing = _nodesById.TryGetValue(id, out var existing);
+                if (_liveCount - (replacing ? 1 : 0) > 0 && vector.Length != _dimension)
+                {
+                    throw new ArgumentException($"Vector dimension ({vector.Length}) does not match stored vector dimension ({_dimension})");
+                }
+
+                // An update replaces the node: the old position in the graph was chosen for the old vector.
+                // It is tombstoned first so it is neither counted as live nor picked as a neighbour below.
+                if (replacing)
+                {
+                    _nodesById.Remove(id);
+                    _deleted[existing] = true;
+                    _liveCount--;
+                }
+
+                if (_liveCount == 0)
+                {
+                    // Only tombstones (or nothing) left: start a fresh graph, possibly with a new dimension
+                    ResetGraph();
+                    _dimension = vector.Length;
+                }
+
+                var normalized = new float[_dimension];
+                VectorKernels.Normalize(vector, normalized);
+                if (!Insert(id, normalized))
+                {
+                    // Every node the search reached was a tombstone, so the new node got no links and the live
+                    // nodes may not be reachable from the entry point any more: rebuild from the live vectors
+                    Rebuild();
+                }
+                else
+                {
+                    CompactIfNeeded();
+                }
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public bool Remove(string id)
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                if (!_nodesById.Remove(id, out var node))
+                {
+                    return false;
+                }
+
+                _deleted[node] = true;
+                _liveCount--;
+
+                if (_liveCount == 0)
+                {
+                    ResetGraph();
+                }
+                else
+                {
+                    CompactIfNeeded();
+                }
+                return true;
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public void Clear()
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                ResetGraph();
+                _dimension = 0;
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public List<(string Id, float Score)> Search(ReadOnlySpan<float> query, int topK)
+        {
+            var results = new List<(string Id, float Score)>();
+            if (topK <= 0)
+            {
+                return results;
+            }
+
+            _lock.EnterReadLock();
+            try
+            {
+                if (_liveCount == 0)
+                {
+                    return results;
+                }
+
+                var normalizedQuery = NormalizeQuery(query);
+                var wanted = Math.Min(topK, _liveCount);
+                var ef = Math.Max(EfSearch, topK);
+
+                var entry = _entryPoint;
+                for (var level = _topLevel; level > 0; level--)
+                {
+                    entry = SearchLayer(normalizedQuery, entry, 1, level)[0].Node;
+                }
+
+                // Tombstones take room in the beam; widen it while too few live nodes come back
+                while (true)
+                {
+                    results.Clear();
+                    foreach (var (node, score) in SearchLayer(normalizedQuery, entry, ef, 0))
+                    {
+                        if (!_deleted[node])
+                        {
+                            results.Add((_ids[node], score));
+                            if (results.Count == topK) break;
+                        }
+                    }
+
+                    if (results.Count >= wanted || ef >= _nodeCount)
+                    {
+                        return results;
+                    }
+                    ef *= 2;
+                }
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        /// <summary>
+        /// Search restricted to the candidate ids. A selective filter scores its candidates directly, which costs
+        /// about as much as the number of matches; a broad one walks the graph as usual, keeping only allowed nodes
+        /// in the results and widening the beam until enough of them are found.
+        /// </summary>
+        public List<(string Id, float Score)> Search(ReadOnlySpan<float> query, int topK, IReadOnlyCollection<string> candidates)
+        {
+            var results = new List<(string Id, float Score)>();
+            if (topK <= 0 || candidates.Count == 0)
+            {
+                return results;
+            }
+
+            _lock.EnterReadLock();
+            try
+            {
+                if (_liveCount == 0)
+                {
+                    return results;
+                }
+
+                var normalizedQuery = NormalizeQuery(query);
+                var allowed = new HashSet<int>();
+                foreach (var id in candidates)
+                {
+                    if (_nodesById.TryGetValue(id, out var node))
+                    {
+                        allowed.Add(node);
+                    }
+                }
+
+                if (allowed.Count == 0)
+                {
+                    return results;
+                }
+
+                var wanted = Math.Min(topK, allowed.Count);
+                if (allowed.Count <= Math.Max(FilteredExactScanMinimum, _liveCount / FilteredGraphFraction))
+                {
+                    var heap = new TopKHeap(wanted);
+                    foreach (var node in allowed)
+                    {
+                        var score = Similarity(normalizedQuery, node);
+                        if (score > heap.Threshold)
+                        {
+                            heap.Add(score, node);
+                        }
+                    }
+
+                    foreach (var (node, score) in heap.ToSortedArray())
+                    {
+                        results.Add((_ids[node], score));
+                    }
+                    return results;
+                }
+
+                // Roughly topK / selectivity nodes have to pass through the beam for topK of them to be allowed
+                var ef = Math.Max(EfSearch, (int)Math.Min(_nodeCount, (long)topK * _liveCount / allowed.Count));
+
+                var entry = _entryPoint;
+                for (var level = _topLevel; level > 0; level--)
+                {
+                    entry = SearchLayer(normalizedQuery, entry, 1, level)[0].Node;
+                }
+
+                while (true)
+                {
+                    results.Clear();
+                    foreach (var (node, score) in SearchLayer(normalizedQuery, entry, ef, 0))
+                    {
+                        if (allowed.Contains(node))
+                        {
+                            results.Add((_ids[node], score));
+                            if (results.Count == topK) break;
+                        }
+                    }
+
+                    if (results.Count >= wanted || ef >= _nodeCount)
+                    {
+                        return results;
+                    }
+                    ef *= 2;
+                }
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        public List<(string Id, float Score)> SearchExact(ReadOnlySpan<float> query, int topK)
+        {
+            var results = new List<(string Id, float Score)>();
+            if (topK <= 0)
+            {
+                return results;
+            }
+
+            _lock.EnterReadLock();
+            try
+            {
+                if (_liveCount == 0)
+                {
+                    return results;
+                }
+
+                var normalizedQuery = NormalizeQuery(query);
+                var heap = new TopKHeap(Math.Min(topK, _liveCount));
+                for (int node = 0; node < _nodeCount; node++)
+                {
+                    if (_deleted[node]) continue;
+
+                    var score = Similarity(normalizedQuery, node);
+                    if (score > heap.Threshold)
+                    {
+                        heap.Add(score, node);
+                    }
+                }
+
+                foreach (var (node, score) in heap.ToSortedArray())
+                {
+                    results.Add((_ids[node], score));
+                }
+                return results;
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        public void AddMetrics(Dictionary<string, object> metrics)
+        {
+            _lock.EnterReadLock();
+            try
+            {
+                metrics["hnsw_m"] = _m;
+                metrics["hnsw_ef_construction"] = _efConstruction;
+                metrics["hnsw_ef_search"] = EfSearch;
+                metrics["hnsw_levels"] = _topLevel + 1;
+                metrics["hnsw_nodes"] = _nodeCount;
+                metrics["hnsw_tombstones"] = _nodeCount - _liveCount;
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        #region Graph Construction
+
+        /// <summary>
+        /// Insert a node; returns false when it could not be linked to any live node although others exist
+        /// </summary>
+        private bool Insert(string id, float[] normalized)
+        {
+            var level = DrawLevel();
+            var node = AllocateNode(id, normalized, level);
+
+            if (_entryPoint < 0)
+            {
+                _entryPoint = node;
+                _topLevel = level;
+                return true;
+            }
+
+            var entry = _entryPoint;
+            for (var layer = _topLevel; layer > level; layer--)
+            {
+                entry = SearchLayer(normalized, entry, 1, layer)[0].Node;
+            }
+
+            for (var layer = Math.Min(level, _topLevel); layer >= 0; layer--)
+            {
+                var candidates = SearchLayer(normalized, entry, _efConstruction, layer);
+                var maxNeighbors = layer == 0 ? _maxNeighborsLayer0 : _m;
+
+                var neighbors = SelectNeighbors(candidates, _m);
+                _links[node][layer] = neighbors;
+                foreach (var neighbor in neighbors)
+                {
+                    Connect(neighbor, node, layer, maxNeighbors);
+                }
+
+                entry = candidates[0].Node;
+            }
+
+            if (level > _topLevel)
+            {
+                _topLevel = level;
+                _entryPoint = node;
+            }
+
+            return _links[node][0].Length > 0 || _liveCount == 1;
+        }
+
+        /// <summary>
+        /// Add a back link from neighbor to node, shrinking the neighbour list with the selection heuristic when full
+        /// </summary>
+        private void Connect(int neighbor, int node, int layer, int maxNeighbors)
+        {
+            var links = _links[neighbor][layer];
+            if (links.Length < maxNeighbors)
+            {
+                var grown = new int[links.Length + 1];
+                links.CopyTo(grown, 0);
+                grown[links.Length] = node;
+                _links[neighbor][layer] = grown;
+                return;
+            }
+
+            var neighborVector = _vectors.AsSpan(neighbor * _dimension, _dimension);
+            var candidates = new List<(int Node, float Score)>(links.Length + 1) { (node, Similarity(neighborVector, node)) };
+            foreach (var link in links)
+            {
+                candidates.Add((link, Similarity(neighborVector, link)));
+            }
+            candidates.Sort(static (a, b) => b.Score.CompareTo(a.Score));
+
+            _links[neighbor][layer] = SelectNeighbors(candidates, maxNeighbors);
+        }
+
+        /// <summary>
+        /// Neighbour selection heuristic: take a candidate only if it is closer to the base than to any neighbour
+        /// already taken, which keeps links spread in different directions. Remaining slots are filled with the
+        /// closest pruned candidates. Tombstoned nodes are never selected.
+        /// </summary>
+        private int[] SelectNeighbors(List<(int Node, float Score)> candidatesByScore, int count)
+        {
+            var selected = new List<int>(count);
+            var pruned = new List<int>();
+
+            foreach (var (candidate, score) in candidatesByScore)
+            {
+                if (_deleted[candidate]) continue;
+                if (selected.Count == count) break;
+
+                var candidateVector = _vectors.AsSpan(candidate * _dimension, _dimension);
+                var diverse = true;
+                foreach (var chosen in selected)
+                {
+                    if (Similarity(candidateVector, chosen) > score)
+                    {
+                        diverse = false;
+                        break;
+                    }
+                }
+
+                if (diverse) selected.Add(candidate);
+                else pruned.Add(candidate);
+            }
+
+            for (int i = 0; i < pruned.Count && selected.Count < count; i++)
+            {
+                selected.Add(pruned[i]);
+            }
+
+            return selected.ToArray();
+        }
+
+        private int DrawLevel()
+        {
+            var level = (int)(-Math.Log(1.0 - _random.NextDouble()) * _levelMultiplier);
+            return Math.Min(level, MaxLevel);
+        }
+
+        private int AllocateNode(string id, float[] normalized, int level)
+        {
+            if (_nodeCount == _ids.Length)
+            {
+                var capacity = Math.Max(InitialCapacity, _ids.Length * 2);
+                Array.Resize(ref _ids, capacity);
+                Array.Resize(ref _deleted, capacity);
+                Array.Resize(ref _links, capacity);
+                Array.Resize(ref _vectors, capacity * _dimension);
+            }
+
+            var node = _nodeCount++;
+            _ids[node] = id;
+            _deleted[node] = false;
+            normalized.CopyTo(_vectors, node * _dimension);
+
+            var layers = new int[level + 1][];
+            for (int i = 0; i <= level; i++)
+            {
+                layers[i] = Array.Empty<int>();
+            }
+            _links[node] = layers;
+
+            _nodesById[id] = node;
+            _liveCount++;
+            return node;
+        }
+
+        private void CompactIfNeeded()
+        {
+            var tombstones = _nodeCount - _liveCount;
+            if (tombstones < CompactionMinimumTombstones || tombstones <= _liveCount)
+            {
+                return;
+            }
+
+            Rebuild();
+        }
+
+        /// <summary>
+        /// Rebuild the graph from the live vectors, dropping every tombstone
+        /// </summary>
+        private void Rebuild()
+        {
+            var live = new List<(string Id, float[] Vector)>(_liveCount);
+            for (int node = 0; node < _nodeCount; node++)
+            {
+                if (!_deleted[node])
+                {
+                    live.Add((_ids[node], _vectors.AsSpan(node * _dimension, _dimension).ToArray()));
+                }
+            }
+
+            var dimension = _dimension;
+            ResetGraph();
+            _dimension = dimension;
+            foreach (var (id, vector) in live)
+            {
+                Insert(id, vector);
+            }
+        }
+
+        private void ResetGraph()
+        {
+            _nodesById.Clear();
+            _vectors = Array.Empty<float>();
+            _ids = Array.Empty<string>();
+            _deleted = Array.Empty<bool>();
+            _links = Array.Empty<int[][]>();
+            _nodeCount = 0;
+            _liveCount = 0;
+            _entryPoint = -1;
+            _topLevel = -1;
+        }
+
+        #endregion
+
+        #region Search
+
+        /// <summary>
+        /// Beam search of width ef on one layer; returns the best nodes found, highest similarity first
+        /// </summary>
+        private List<(int Node, float Score)> SearchLayer(ReadOnlySpan<float> query, int entry, int ef, int layer)
+        {
+            var visited = new HashSet<int> { entry };
+            var entryScore = Similarity(query, entry);
+
+            // PriorityQueue is a min-heap: candidates use negated scores to pop the best first,
+            // results keep the worst of the current beam at the top
+            var candidates = new PriorityQueue<int, float>();
+            var results = new PriorityQueue<int, float>();
+            candidates.Enqueue(entry, -entryScore);
+            results.Enqueue(entry, entryScore);
+            var worst = entryScore;
+
+            while (candidates.TryDequeue(out var current, out var negatedScore))
+            {
+                if (-negatedScore < worst && results.Count >= ef)
+                {
+                    break;
+                }
+
+                var layers = _links[current];
+                if (layer >= layers.Length) continue;
+
+                foreach (var neighbor in layers[layer])
+                {
+                    if (!visited.Add(neighbor)) continue;
+
+                    var score = Similarity(query, neighbor);
+                    if (results.Count < ef || score > worst)
+                    {
+                        candidates.Enqueue(neighbor, -score);
+                        results.Enqueue(neighbor, score);
+                        if (results.Count > ef)
+                        {
+                            results.Dequeue();
+                        }
+                        results.TryPeek(out _, out worst);
+                    }
+                }
+            }
+
+            var ordered = new List<(int Node, float Score)>(results.Count);
+            while (results.TryDequeue(out var node, out var score))
+            {
+                ordered.Add((node, score));
+            }
+            ordered.Reverse();
+            return ordered;
+        }
+
+        private float Similarity(ReadOnlySpan<float> query, int node)
+        {
+            return VectorKernels.Dot(query, _vectors.AsSpan(node * _dimension, _dimension));
+        }
+
+        private float[] NormalizeQuery(ReadOnlySpan<float> query)
+        {
+            if (query.Length != _dimension)
+            {
+                throw new ArgumentException($"Query vector dimension ({query.Length}) does not match stored vector dimension ({_dimension})");
+            }
+
+            var normalized = new float[_dimension];
+            VectorKernels.Normalize(query, normalized);
+            return normalized;
+        }
+
+        #endregion
+    }
+}
@@ -157,9 +157,41 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         public IEnumerable<string>? Collections { get; set; }
 
         /// <summary>
-        /// Additional search filters
+        /// Metadata filter applied by the vector store before the similarity search, in the dictionary form
+        /// parsed by MetadataFilter.Parse (e.g. { "tenantId": "acme", "fileFormat": [".md", ".txt"] })
         /// </summary>
         public Dictionary<string, object> Filters { get; set; } = new Dictionary<string, object>();
+
+        /// <summary>
+        /// Ranking strategy (default: Vector). SimilarityThreshold applies to Vector mode only.
+        /// </summary>
+        public SemanticSearchMode Mode { get; set; } = SemanticSearchMode.Vector;
+
+        /// <summary>
+        /// Reciprocal-rank fusion constant: a result at rank r contributes 1 / (RrfK + r) (default: 60)
+        /// </summary>
+        public int RrfK { get; set; } = 60;
+    }
+
+    /// <summary>
+    /// How semantic search ranks candidate records.
+    /// </summary>
+    public enum SemanticSearchMode
+    {
+        /// <summary>
+        /// Embedding similarity, filtered by query term relevance
+        /// </summary>
+        Vector,
+
+        /// <summary>
+        /// BM25 over the keyword index only
+        /// </summary>
+        Keyword,
+
+        /// <summary>
+        /// Vector and BM25 rankings fused with reciprocal-rank fusion
+        /// </summary>
+        Hybrid
     }
 
     /// <summary>
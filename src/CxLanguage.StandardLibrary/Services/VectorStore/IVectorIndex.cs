@@ -0,0 +1,58 @@
+using System;
+using System.Collections.Generic;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Cosine similarity index over record ids, used by InMemoryVectorStoreService for SearchAsync.
+    /// Implementations are thread-safe.
+    /// </summary>
+    internal interface IVectorIndex
+    {
+        /// <summary>
+        /// Short index name reported in metrics ("flat", "hnsw")
+        /// </summary>
+        string Kind { get; }
+
+        /// <summary>
+        /// True when Search may miss some of the true nearest neighbours
+        /// </summary>
+        bool IsApproximate { get; }
+
+        /// <summary>
+        /// Dimension of the indexed vectors, or 0 while the index is empty
+        /// </summary>
+        int Dimension { get; }
+
+        int Count { get; }
+
+        /// <summary>
+        /// Insert or replace the vector stored for an id
+        /// </summary>
+        void Upsert(string id, ReadOnlySpan<float> vector);
+
+        bool Remove(string id);
+
+        void Clear();
+
+        /// <summary>
+        /// Return the ids and cosine similarities of the topK closest vectors, highest first
+        /// </summary>
+        List<(string Id, float Score)> Search(ReadOnlySpan<float> query, int topK);
+
+        /// <summary>
+        /// Search restricted to the given candidate ids (a metadata filter's matches); ids not in the index are ignored
+        /// </summary>
+        List<(string Id, float Score)> Search(ReadOnlySpan<float> query, int topK, IReadOnlyCollection<string> candidates);
+
+        /// <summary>
+        /// Exhaustive search used as ground truth when measuring recall
+        /// </summary>
+        List<(string Id, float Score)> SearchExact(ReadOnlySpan<float> query, int topK);
+
+        /// <summary>
+        /// Add index parameters and structure statistics to a metrics dictionary
+        /// </summary>
+        void AddMetrics(Dictionary<string, object> metrics);
+    }
+}
@@ -37,6 +37,16 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <returns>A collection of similar vector records.</returns>
         Task<IEnumerable<VectorRecord>> SearchAsync(float[] vector, int topK);
 
+        /// <summary>
+        /// Searches for similar vectors among the records whose metadata matches the filter.
+        /// The filter is applied before the similarity search, so a selective filter makes the search cheaper.
+        /// </summary>
+        /// <param name="vector">The vector to search for.</param>
+        /// <param name="topK">The number of similar records to return.</param>
+        /// <param name="filter">Metadata conditions; null or empty searches every record.</param>
+        /// <returns>A collection of similar vector records.</returns>
+        Task<IEnumerable<VectorRecord>> SearchAsync(float[] vector, int topK, MetadataFilter? filter);
+
         /// <summary>
         /// Enhanced for Issue #252: Search using text query with automatic embedding generation.
         /// Supports consciousness-aware text-based queries.
@@ -46,6 +56,15 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <returns>Most similar vector records</returns>
         Task<IEnumerable<VectorRecord>> SearchTextAsync(string query, int topK = 5);
 
+        /// <summary>
+        /// Text search among the records whose metadata matches the filter
+        /// </summary>
+        /// <param name="query">Text query to search for</param>
+        /// <param name="topK">Number of results to return</param>
+        /// <param name="filter">Metadata conditions; null or empty searches every record</param>
+        /// <returns>Most similar matching vector records</returns>
+        Task<IEnumerable<VectorRecord>> SearchTextAsync(string query, int topK, MetadataFilter? filter);
+
         /// <summary>
         /// Retrieves a vector record by its ID.
         /// </summary>
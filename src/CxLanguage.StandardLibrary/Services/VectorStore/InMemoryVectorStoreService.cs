@@ -8,8 +8,12 @@ using System.Text.Json;
 using System.Threading;
 using System.Threading.Tasks;
 using CxLanguage.Core.Events;
+using CxLanguage.Core.Serialization;
+using CxLanguage.Core.Telemetry;
+using CxLanguage.StandardLibrary.AI.Embeddings;
 using Microsoft.Extensions.AI;
 using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
 
 namespace CxLanguage.StandardLibrary.Services.VectorStore
 {
@@ -42,9 +46,15 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         private readonly ConcurrentDictionary<string, VectorRecord> _vectorStore = new();
 
         /// <summary>
-        /// Performance cache for repeated similar queries (consciousness optimization)
+        /// Similarity index over the stored vectors (exact or quantized SIMD scan, or HNSW, per VectorStoreOptions).
+        /// Kept in step with _vectorStore by every add, update, delete, clear and load.
         /// </summary>
-        private readonly ConcurrentDictionary<string, (float[] Vector, DateTime CachedAt)> _embeddingCache = new();
+        private readonly IVectorIndex _vectorIndex;
+        private readonly KeyValuePair<string, object?> _indexTag;
+        private readonly MetadataIndex _metadataIndex;
+        private readonly VectorStoreOptions _options;
+        private readonly VectorSearchStatistics _searchStatistics = new();
+        private long _searchCount;
 
         /// <summary>
         /// Issue #255: Persistence-related fields for file-based storage
@@ -54,16 +64,39 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         private bool _autoPersistenceEnabled = false;
         private int _autoPersistenceIntervalSeconds = 30;
         private readonly SemaphoreSlim _persistenceLock = new(1, 1);
+        private VectorWriteAheadLog? _writeAheadLog;
+        /// <summary>
+        /// Serializes writes so the store, both indexes and the write-ahead log always change together
+        /// </summary>
+        private readonly object _writeLock = new();
+        private volatile bool _baselineCheckpointPending;
+
+        /// <summary>
+        /// Segments whose rows back the vectors of quantized-index records, guarded by _persistenceLock.
+        /// The quantized index only re-ranks against fp32 vectors, so those are read from the mapping instead of
+        /// being copied onto the heap.
+        /// </summary>
+        private readonly List<MappedVectorSegment> _mappedSegments = new();
 
         #endregion
 
         #region Constructor and Initialization
 
-        public InMemoryVectorStoreService(ILogger<InMemoryVectorStoreService> logger, ICxEventBus eventBus, IEmbeddingGenerator<string, Embedding<float>>? embeddingGenerator = null)
+        public InMemoryVectorStoreService(
+            ILogger<InMemoryVectorStoreService> logger,
+            ICxEventBus eventBus,
+            IEmbeddingGenerator<string, Embedding<float>>? embeddingGenerator = null,
+            IOptions<VectorStoreOptions>? options = null)
         {
             _logger = logger;
             _eventBus = eventBus;
             _embeddingGenerator = embeddingGenerator;
+            _options = options?.Value ?? new VectorStoreOptions();
+            _vectorIndex = CreateVectorIndex(_options);
+            _indexTag = CxDiagnostics.Tag(CxDiagnostics.IndexTag, _options.IndexType == VectorIndexType.Flat && _options.Quantization != VectorQuantization.None
+                ? $"{_options.IndexType}-{_options.Quantization}"
+                : _options.IndexType.ToString());
+            _metadataIndex = new MetadataIndex(_options.IndexedMetadataFields);
             
             // Initialize storage directory for persistence (Issue #255)
             _defaultStorageDirectory = Path.Combine(Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData), 
@@ -92,6 +125,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             _eventBus.EmitAsync("vectorstore.initialized", new Dictionary<string, object> 
             { 
                 ["service"] = nameof(InMemoryVectorStoreService),
+                ["indexType"] = _vectorIndex.Kind,
                 ["embeddingEnabled"] = _embeddingGenerator != null,
                 ["consciousnessAware"] = true,
                 ["persistenceEnabled"] = true,
@@ -99,7 +133,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             });
             
             // Attempt to load existing data on startup (Issue #255)
-            _ = Task.Run(async () =>
+            StartupLoad = Task.Run(async () =>
             {
                 try
                 {
@@ -112,6 +146,36 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             });
         }
 
+        /// <summary>
+        /// The load of the default storage directory started by the constructor; it never faults
+        /// </summary>
+        internal Task StartupLoad { get; }
+
+        private IVectorIndex CreateVectorIndex(VectorStoreOptions options)
+        {
+            if (options.IndexType == VectorIndexType.Hnsw)
+            {
+                if (options.Quantization != VectorQuantization.None)
+                {
+                    _logger.LogWarning("Vector quantization {Quantization} is not supported by the HNSW index and will be ignored", options.Quantization);
+                }
+                return new HnswVectorIndex(options.HnswM, options.HnswEfConstruction, options.HnswEfSearch);
+            }
+
+            if (options.Quantization != VectorQuantization.None)
+            {
+                // Re-ranking copies the exact vectors out of the stored records, or their mapped segment rows
+                return new QuantizedVectorIndex(
+                    options.Quantization,
+                    options.PqSubvectors,
+                    options.QuantizationTrainingSize,
+                    options.RerankFactor,
+                    (id, destination) => _vectorStore.TryGetValue(id, out var record) && record.TryCopyVector(destination));
+            }
+
+            return new FlatVectorIndex();
+        }
+
         #endregion
 
         #region Core Vector Operations
@@ -137,7 +201,8 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                 record.Metadata["consciousness_aware"] = true;
             }
 
-            _vectorStore[record.Id] = record;
+            CommitUpsert(record, mustExist: false);
+            CxDiagnostics.VectorRecordsAdded.Add(1, _indexTag);
             _logger.LogDebug("Vector record added with ID: {RecordId}, consciousness context preserved", record.Id);
             
             await _eventBus.EmitAsync("vectorstore.record.added", new Dictionary<string, object> 
@@ -165,25 +230,10 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                 throw new InvalidOperationException("Embedding generator not available. Cannot generate embeddings for text content.");
             }
 
-            // Check cache first for performance optimization
-            var cacheKey = $"embed:{content.GetHashCode()}";
-            float[] vector;
-            
-            if (_embeddingCache.TryGetValue(cacheKey, out var cached) && 
-                (DateTime.UtcNow - cached.CachedAt).TotalMinutes < 30) // 30-minute cache
-            {
-                vector = cached.Vector;
-                _logger.LogDebug("Using cached embedding for content hash: {Hash}", content.GetHashCode());
-            }
-            else
-            {
-                // Generate embedding with consciousness context
-                var embeddingResult = await _embeddingGenerator.GenerateAsync(new[] { content });
-                vector = embeddingResult.First().Vector.ToArray();
-                
-                // Cache for future use
-                _embeddingCache[cacheKey] = (vector, DateTime.UtcNow);
-            }
+            // Generate embedding with consciousness context; repeated content is answered by the shared
+            // EmbeddingCache when the generator is a CachedEmbeddingGenerator
+            var embeddingResult = await _embeddingGenerator.GenerateAsync(new[] { content });
+            var vector = embeddingResult.First().Vector.ToArray();
 
             // Create vector record with consciousness metadata
             var record = new VectorRecord
@@ -227,7 +277,19 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <param name="query">Text query to search for</param>
         /// <param name="topK">Number of results to return</param>
         /// <returns>Most similar vector records</returns>
-        public async Task<IEnumerable<VectorRecord>> SearchTextAsync(string query, int topK = 5)
+        public Task<IEnumerable<VectorRecord>> SearchTextAsync(string query, int topK = 5)
+        {
+            return SearchTextAsync(query, topK, null);
+        }
+
+        /// <summary>
+        /// Text search among the records whose metadata matches the filter
+        /// </summary>
+        /// <param name="query">Text query to search for</param>
+        /// <param name="topK">Number of results to return</param>
+        /// <param name="filter">Metadata conditions applied before the similarity search; null searches every record</param>
+        /// <returns>Most similar matching vector records</returns>
+        public async Task<IEnumerable<VectorRecord>> SearchTextAsync(string query, int topK, MetadataFilter? filter)
         {
             var stopwatch = Stopwatch.StartNew();
 
@@ -240,7 +302,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             var queryEmbedding = await _embeddingGenerator.GenerateAsync(new[] { query });
             var queryVector = queryEmbedding.First().Vector.ToArray();
 
-            var results = await SearchAsync(queryVector, topK);
+            var results = await SearchAsync(queryVector, topK, filter);
 
             stopwatch.Stop();
             _logger.LogInformation("🔍 Text search completed in {ElapsedMs}ms (target: <100ms)", stopwatch.ElapsedMilliseconds);
@@ -279,6 +341,20 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <param name="topK">The number of top results to return.</param>
         /// <returns>A collection of the most similar vector records.</returns>
         public Task<IEnumerable<VectorRecord>> SearchAsync(float[] queryVector, int topK = 5)
+        {
+            return SearchAsync(queryVector, topK, null);
+        }
+
+        /// <summary>
+        /// Searches for the most similar vector records among those whose metadata matches the filter.
+        /// Conditions on indexed metadata fields resolve to candidate ids through the bitmap indexes, and only those
+        /// candidates are scored, so the cost follows the filter's selectivity rather than the store size.
+        /// </summary>
+        /// <param name="queryVector">The vector to compare against.</param>
+        /// <param name="topK">The number of top results to return.</param>
+        /// <param name="filter">Metadata conditions; null or empty searches every record.</param>
+        /// <returns>A collection of the most similar matching vector records.</returns>
+        public Task<IEnumerable<VectorRecord>> SearchAsync(float[] queryVector, int topK, MetadataFilter? filter)
         {
             var stopwatch = Stopwatch.StartNew();
 
@@ -289,24 +365,42 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             }
 
             // Validate vector dimensions before search
-            var firstRecord = _vectorStore.Values.FirstOrDefault();
-            if (firstRecord != null && firstRecord.Vector.Length != queryVector.Length)
+            var dimension = _vectorIndex.Dimension;
+            if (dimension != 0 && dimension != queryVector.Length)
             {
-                var errorMessage = $"Query vector dimension ({queryVector.Length}) does not match stored vector dimension ({firstRecord.Vector.Length})";
+                var errorMessage = $"Query vector dimension ({queryVector.Length}) does not match stored vector dimension ({dimension})";
                 _logger.LogError("❌ Vector dimension mismatch: {ErrorMessage}", errorMessage);
                 throw new ArgumentException(errorMessage);
             }
 
-            // Enhanced parallel processing for performance optimization
-            var results = _vectorStore.Values
-                .AsParallel()
-                .Select(record => new { Record = record, Similarity = CosineSimilarity(record.Vector, queryVector) })
-                .OrderByDescending(x => x.Similarity)
-                .Take(topK)
-                .Select(x => x.Record)
-                .ToList(); // Materialize for consistent enumeration
+            var candidates = ResolveCandidateIds(filter);
+            List<(string Id, float Score)> matches;
+            if (candidates == null)
+            {
+                matches = _vectorIndex.Search(queryVector, topK);
+                _searchStatistics.RecordLatency(stopwatch.Elapsed.TotalMilliseconds);
+                SampleRecall(queryVector, topK, matches);
+            }
+            else
+            {
+                // Recall sampling compares against an unfiltered exact search, so filtered queries are not sampled
+                matches = _vectorIndex.Search(queryVector, topK, candidates);
+                _searchStatistics.RecordLatency(stopwatch.Elapsed.TotalMilliseconds);
+            }
+
+            var results = new List<VectorRecord>(matches.Count);
+            foreach (var (id, _) in matches)
+            {
+                // Skip records deleted between the index scan and this lookup
+                if (_vectorStore.TryGetValue(id, out var record))
+                {
+                    results.Add(record);
+                }
+            }
 
             stopwatch.Stop();
+            CxDiagnostics.VectorSearchDuration.Record(stopwatch.Elapsed.TotalMilliseconds, _indexTag,
+                CxDiagnostics.Tag("cx.vector.filtered", candidates != null));
             _logger.LogInformation("🔍 Vector search completed in {ElapsedMs}ms. Found {ResultCount} results (target: <100ms).", 
                 stopwatch.ElapsedMilliseconds, results.Count);
 
@@ -317,46 +411,80 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                 ["ResultCount"] = results.Count,
                 ["ProcessingTimeMs"] = stopwatch.ElapsedMilliseconds,
                 ["PerformanceTarget"] = "100ms",
-                ["ConsciousnessProcessed"] = results.Count(r => r.Metadata.ContainsKey("consciousness_aware"))
+                ["ConsciousnessProcessed"] = results.Count(r => r.Metadata.ContainsKey("consciousness_aware")),
+                ["Filtered"] = candidates != null,
+                ["CandidateCount"] = candidates?.Count ?? _vectorStore.Count
             });
 
             return Task.FromResult<IEnumerable<VectorRecord>>(results);
         }
 
         /// <summary>
-        /// Calculates the cosine similarity between two vectors.
-        /// This is the core of the semantic search capability.
+        /// Ids of the records matching a metadata filter, or null when the filter is empty.
+        /// Indexed conditions are answered by the bitmap indexes; any other conditions are checked against the
+        /// metadata of those candidates, or of every record when no condition is on an indexed field.
         /// </summary>
-        /// <param name="vecA">The first vector.</param>
-        /// <param name="vecB">The second vector.</param>
-        /// <returns>The cosine similarity score (from -1 to 1).</returns>
-        private double CosineSimilarity(float[] vecA, float[] vecB)
+        internal IReadOnlyCollection<string>? ResolveCandidateIds(MetadataFilter? filter)
         {
-            if (vecA.Length != vecB.Length)
+            if (filter == null || filter.IsEmpty)
             {
-                throw new ArgumentException("Vectors must have the same dimension for cosine similarity calculation.");
+                return null;
             }
 
-            double dotProduct = 0.0;
-            double magnitudeA = 0.0;
-            double magnitudeB = 0.0;
-
-            for (int i = 0; i < vecA.Length; i++)
+            var indexed = _metadataIndex.Resolve(filter);
+            var residual = filter.Conditions.Where(c => !_metadataIndex.IsIndexed(c.Field)).ToList();
+            if (residual.Count == 0)
             {
-                dotProduct += vecA[i] * vecB[i];
-                magnitudeA += vecA[i] * vecA[i];
-                magnitudeB += vecB[i] * vecB[i];
+                return indexed!;
             }
 
-            magnitudeA = Math.Sqrt(magnitudeA);
-            magnitudeB = Math.Sqrt(magnitudeB);
+            var residualFilter = new MetadataFilter(residual);
+            var candidates = new List<string>();
+            if (indexed != null)
+            {
+                foreach (var id in indexed)
+                {
+                    if (_vectorStore.TryGetValue(id, out var record) && residualFilter.Matches(record.Metadata))
+                    {
+                        candidates.Add(id);
+                    }
+                }
+            }
+            else
+            {
+                foreach (var (id, record) in _vectorStore)
+                {
+                    if (residualFilter.Matches(record.Metadata))
+                    {
+                        candidates.Add(id);
+                    }
+                }
+            }
+            return candidates;
+        }
 
-            if (magnitudeA == 0 || magnitudeB == 0)
+        /// <summary>
+        /// Periodically repeat an approximate search exhaustively, off the query path, to track recall@K
+        /// </summary>
+        private void SampleRecall(float[] queryVector, int topK, List<(string Id, float Score)> matches)
+        {
+            var interval = _options.RecallSampleInterval;
+            if (!_vectorIndex.IsApproximate || interval <= 0 || Interlocked.Increment(ref _searchCount) % interval != 0)
             {
-                return 0; // Or handle as an error/special case
+                return;
             }
 
-            return dotProduct / (magnitudeA * magnitudeB);
+            _ = Task.Run(() =>
+            {
+                try
+                {
+                    _searchStatistics.RecordRecall(matches, _vectorIndex.SearchExact(queryVector, topK));
+                }
+                catch (ArgumentException)
+                {
+                    // The store was cleared and refilled with another dimension in the meantime
+                }
+            });
         }
 
         /// <summary>
@@ -499,14 +627,29 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             {
                 ["total_records"] = _vectorStore.Count,
                 ["consciousness_records"] = _vectorStore.Values.Count(r => r.Metadata.ContainsKey("consciousness_aware")),
-                ["cache_size"] = _embeddingCache.Count,
+                ["cache_size"] = 0,
                 ["embedding_generator_available"] = _embeddingGenerator != null,
                 ["memory_usage_mb"] = GC.GetTotalMemory(false) / (1024.0 * 1024.0),
                 ["service_type"] = "Enhanced InMemoryVectorStoreService v1.0",
                 ["performance_optimized"] = true,
                 ["file_integration_supported"] = true,
-                ["consciousness_context_preserved"] = true
+                ["consciousness_context_preserved"] = true,
+                ["index_type"] = _vectorIndex.Kind,
+                ["index_approximate"] = _vectorIndex.IsApproximate,
+                ["index_dimension"] = _vectorIndex.Dimension
             };
+            _vectorIndex.AddMetrics(metrics);
+            _metadataIndex.AddMetrics(metrics);
+            _searchStatistics.AddMetrics(metrics);
+            if (_embeddingGenerator?.GetService(typeof(EmbeddingCache)) is EmbeddingCache embeddingCache)
+            {
+                var cacheStatistics = embeddingCache.GetStatistics();
+                foreach (var (key, value) in cacheStatistics)
+                {
+                    metrics[key] = value;
+                }
+                metrics["cache_size"] = cacheStatistics["embedding_cache_entries"];
+            }
 
             _logger.LogInformation("📊 Vector store metrics: {RecordCount} total records, {ConsciousnessCount} consciousness-aware", 
                 metrics["total_records"], metrics["consciousness_records"]);
@@ -602,10 +745,11 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     var query = payload.TryGetValue("query", out var queryObj) ? queryObj?.ToString() : "";
                     var topK = payload.TryGetValue("topK", out var topKObj) && int.TryParse(topKObj?.ToString(), out var k) ? k : 5;
                     var includeMetadata = payload.TryGetValue("includeMetadata", out var includeObj) && bool.TryParse(includeObj?.ToString(), out var include) && include;
+                    var filter = payload.TryGetValue("filter", out var filterObj) ? MetadataFilter.Parse(filterObj) : null;
 
                     if (!string.IsNullOrEmpty(query))
                     {
-                        var results = await SearchTextAsync(query, topK);
+                        var results = await SearchTextAsync(query, topK, filter);
                         var duration = (DateTime.UtcNow - startTime).TotalMilliseconds;
 
                         var responsePayload = new Dictionary<string, object>
@@ -667,7 +811,11 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
 
         /// <summary>
         /// Enhanced for Issue #255: Save vector store to persistent storage.
-        /// Implements file-based persistence with consciousness context preservation.
+        /// Writes a single memory-mappable segment file (vectors.cxseg) holding every vector in one contiguous block,
+        /// replacing the previous snapshot atomically. When automatic persistence logs to this directory, the
+        /// write-ahead log is rotated first and the rotated part is dropped once the snapshot covers it; any other log
+        /// files in the directory predate the snapshot and are deleted, so a later load does not replay them over it.
+        /// With a quantized index the saved records then read their vectors from the new segment's mapping.
         /// </summary>
         /// <param name="baseDirectory">Base directory for storage (optional, uses default if null)</param>
         /// <returns>Success status and saved file information</returns>
@@ -681,63 +829,28 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                 var storageDir = baseDirectory ?? _defaultStorageDirectory;
                 Directory.CreateDirectory(storageDir);
 
-                // Create storage subdirectories
-                var vectorsDir = Path.Combine(storageDir, "vectors");
-                var metadataDir = Path.Combine(storageDir, "metadata");
-                var indicesDir = Path.Combine(storageDir, "indices");
-                
-                Directory.CreateDirectory(vectorsDir);
-                Directory.CreateDirectory(metadataDir);
-                Directory.CreateDirectory(indicesDir);
+                var writeAheadLog = IsWriteAheadLogDirectory(storageDir) ? _writeAheadLog : null;
+                writeAheadLog?.Rotate();
 
-                var savedRecords = 0;
-                var totalSize = 0L;
+                var records = _vectorStore.Values.ToArray();
+                var segmentPath = Path.Combine(storageDir, VectorSegmentFile.FileName);
+                var (savedRecords, skippedRecords, totalSize) = await Task.Run(() => _vectorIndex is QuantizedVectorIndex
+                    ? WriteMappedSegment(segmentPath, records)
+                    : VectorSegmentFile.Write(segmentPath, records));
 
-                // Save each vector record
-                foreach (var kvp in _vectorStore)
+                if (writeAheadLog != null)
                 {
-                    var record = kvp.Value;
-                    
-                    // Save metadata as JSON (human-readable)
-                    var metadataFile = Path.Combine(metadataDir, $"{record.Id}.json");
-                    var metadata = new
-                    {
-                        Id = record.Id,
-                        Content = record.Content,
-                        CreatedAt = record.CreatedAt,
-                        Metadata = record.Metadata,
-                        VectorDimensions = record.Vector.Length,
-                        ConsciousnessProcessed = record.Metadata.ContainsKey("consciousness_aware"),
-                        SavedAt = DateTimeOffset.UtcNow
-                    };
-
-                    var metadataJson = JsonSerializer.Serialize(metadata, new JsonSerializerOptions { WriteIndented = true });
-                    await File.WriteAllTextAsync(metadataFile, metadataJson);
-
-                    // Save vector as binary (performance-critical)
-                    var vectorFile = Path.Combine(vectorsDir, $"{record.Id}.bin");
-                    var vectorBytes = new byte[record.Vector.Length * 4]; // float = 4 bytes
-                    Buffer.BlockCopy(record.Vector, 0, vectorBytes, 0, vectorBytes.Length);
-                    await File.WriteAllBytesAsync(vectorFile, vectorBytes);
-
-                    savedRecords++;
-                    totalSize += vectorBytes.Length + metadataJson.Length;
+                    writeAheadLog.CompleteRotation();
                 }
-
-                // Save index information
-                var indexFile = Path.Combine(indicesDir, "vector_index.json");
-                var indexData = new
+                else
                 {
-                    TotalRecords = savedRecords,
-                    SavedAt = DateTimeOffset.UtcNow,
-                    StorageDirectory = storageDir,
-                    Records = _vectorStore.Keys.ToList(),
-                    ConsciousnessRecords = _vectorStore.Values.Count(r => r.Metadata.ContainsKey("consciousness_aware")),
-                    Version = "1.0.0"
-                };
+                    VectorWriteAheadLog.DeleteFiles(storageDir);
+                }
 
-                var indexJson = JsonSerializer.Serialize(indexData, new JsonSerializerOptions { WriteIndented = true });
-                await File.WriteAllTextAsync(indexFile, indexJson);
+                if (skippedRecords > 0)
+                {
+                    _logger.LogWarning("⚠️ Skipped {SkippedCount} vector records whose dimension differs from the rest of the store", skippedRecords);
+                }
 
                 stopwatch.Stop();
 
@@ -747,8 +860,9 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     ["recordsSaved"] = savedRecords,
                     ["totalSizeBytes"] = totalSize,
                     ["storageDirectory"] = storageDir,
+                    ["storageFormat"] = "cxseg",
                     ["processingTimeMs"] = stopwatch.ElapsedMilliseconds,
-                    ["consciousnessRecordsPreserved"] = indexData.ConsciousnessRecords
+                    ["consciousnessRecordsPreserved"] = records.Count(r => r.Metadata.ContainsKey("consciousness_aware"))
                 };
 
                 _logger.LogInformation("✅ Successfully saved {RecordCount} vector records to persistent storage in {ElapsedMs}ms", 
@@ -779,9 +893,53 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             }
         }
 
+        /// <summary>
+        /// Write a segment and move the saved records onto its mapping before it replaces the previous one, releasing
+        /// the segments they read from until now. A record whose vector changed while the snapshot was written keeps
+        /// the new vector on the heap.
+        /// </summary>
+        private (int Written, int Skipped, long Bytes) WriteMappedSegment(string segmentPath, VectorRecord[] records)
+        {
+            var sources = new Dictionary<VectorRecord, object>(records.Length, ReferenceEqualityComparer.Instance);
+            foreach (var record in records)
+            {
+                sources[record] = record.VectorSource;
+            }
+
+            return VectorSegmentFile.Write(segmentPath, records, (temporaryPath, written) =>
+            {
+                var segment = MappedVectorSegment.Open(temporaryPath, segmentPath);
+                for (int row = 0; row < written.Count; row++)
+                {
+                    var record = written[row];
+                    if (_vectorStore.TryGetValue(record.Id, out var current) && ReferenceEquals(current, record))
+                    {
+                        segment.TryMapRecord(record, row, sources[record]);
+                    }
+                }
+
+                ReleaseMappedSegments();
+                _mappedSegments.Add(segment);
+            });
+        }
+
+        /// <summary>
+        /// Unmap every segment, copying vectors still read from one back onto their records
+        /// </summary>
+        private void ReleaseMappedSegments()
+        {
+            foreach (var segment in _mappedSegments)
+            {
+                segment.Release();
+            }
+            _mappedSegments.Clear();
+        }
+
         /// <summary>
         /// Enhanced for Issue #255: Load vector store from persistent storage.
-        /// Implements automatic recovery with consciousness context restoration.
+        /// Maps the segment file and replays any write-ahead log on top of it. With a quantized index the file stays
+        /// mapped and the loaded records read their vectors from it. Directories written by the earlier
+        /// per-record layout (metadata/*.json plus vectors/*.bin) are still read.
         /// </summary>
         /// <param name="baseDirectory">Base directory for storage (optional, uses default if null)</param>
         /// <returns>Success status and loaded record information</returns>
@@ -804,116 +962,59 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     };
                 }
 
-                var vectorsDir = Path.Combine(storageDir, "vectors");
-                var metadataDir = Path.Combine(storageDir, "metadata");
-                var indicesDir = Path.Combine(storageDir, "indices");
+                var segmentPath = Path.Combine(storageDir, VectorSegmentFile.FileName);
+                var replayFiles = VectorWriteAheadLog.GetReplayFiles(storageDir).ToList();
+                string storageFormat;
+                var walEntriesReplayed = 0;
 
-                if (!Directory.Exists(vectorsDir) || !Directory.Exists(metadataDir))
+                if (File.Exists(segmentPath) || replayFiles.Count > 0)
                 {
-                    return new Dictionary<string, object>
-                    {
-                        ["success"] = false,
-                        ["error"] = "Required storage subdirectories not found"
-                    };
-                }
+                    storageFormat = "cxseg";
+                    _vectorStore.Clear();
+                    _vectorIndex.Clear();
+                    _metadataIndex.Clear();
 
-                // Load index file
-                var indexFile = Path.Combine(indicesDir, "vector_index.json");
-                if (!File.Exists(indexFile))
-                {
-                    return new Dictionary<string, object>
+                    if (File.Exists(segmentPath) && _vectorIndex is QuantizedVectorIndex)
                     {
-                        ["success"] = false,
-                        ["error"] = "Vector index file not found"
-                    };
-                }
-
-                var indexJson = await File.ReadAllTextAsync(indexFile);
-                var indexData = JsonSerializer.Deserialize<JsonElement>(indexJson);
-
-                var recordIds = indexData.GetProperty("Records").EnumerateArray()
-                    .Select(e => e.GetString()).Where(s => !string.IsNullOrEmpty(s)).ToList();
-
-                var loadedRecords = 0;
-                var consciousnessRecordsRestored = 0;
-
-                // Clear existing store
-                _vectorStore.Clear();
-
-                // Load each record
-                foreach (var recordId in recordIds)
-                {
-                    try
+                        await Task.Run(() => LoadMappedSegment(segmentPath));
+                    }
+                    else if (File.Exists(segmentPath))
                     {
-                        var metadataFile = Path.Combine(metadataDir, $"{recordId}.json");
-                        var vectorFile = Path.Combine(vectorsDir, $"{recordId}.bin");
-
-                        if (!File.Exists(metadataFile) || !File.Exists(vectorFile))
+                        await Task.Run(() => VectorSegmentFile.Read(segmentPath, record =>
                         {
-                            _logger.LogWarning("⚠️ Missing files for record {RecordId}, skipping", recordId);
-                            continue;
-                        }
-
-                        // Load metadata
-                        var metadataJson = await File.ReadAllTextAsync(metadataFile);
-                        var metadata = JsonSerializer.Deserialize<JsonElement>(metadataJson);
-
-                        // Load vector binary
-                        var vectorBytes = await File.ReadAllBytesAsync(vectorFile);
-                        var vectorDimensions = metadata.GetProperty("VectorDimensions").GetInt32();
-                        var vector = new float[vectorDimensions];
-                        Buffer.BlockCopy(vectorBytes, 0, vector, 0, vectorBytes.Length);
+                            _vectorIndex.Upsert(record.Id, record.ReadVector(Span<float>.Empty));
+                            _metadataIndex.Upsert(record);
+                            _vectorStore[record.Id] = record;
+                        }));
+                    }
 
-                        // Recreate VectorRecord
-                        var recordIdValue = metadata.GetProperty("Id").GetString() ?? recordId ?? Guid.NewGuid().ToString();
-                        var record = new VectorRecord
+                    walEntriesReplayed = await Task.Run(() => ReplayWriteAheadLog(replayFiles));
+                }
+                else
+                {
+                    storageFormat = "legacy";
+                    var legacyError = await LoadLegacyRecordsAsync(storageDir);
+                    if (legacyError != null)
+                    {
+                        return new Dictionary<string, object>
                         {
-                            Id = recordIdValue,
-                            Content = metadata.GetProperty("Content").GetString() ?? "",
-                            Vector = vector,
-                            CreatedAt = metadata.GetProperty("CreatedAt").GetDateTimeOffset(),
-                            Metadata = new Dictionary<string, object>()
+                            ["success"] = false,
+                            ["error"] = legacyError
                         };
-
-                        // Restore metadata dictionary
-                        if (metadata.TryGetProperty("Metadata", out var metadataProperty))
-                        {
-                            foreach (var prop in metadataProperty.EnumerateObject())
-                            {
-                                var value = prop.Value.ValueKind switch
-                                {
-                                    JsonValueKind.String => (object)(prop.Value.GetString() ?? ""),
-                                    JsonValueKind.Number => (object)prop.Value.GetDouble(),
-                                    JsonValueKind.True => (object)true,
-                                    JsonValueKind.False => (object)false,
-                                    _ => (object)(prop.Value.ToString() ?? "")
-                                };
-                                record.Metadata[prop.Name] = value;
-                            }
-                        }
-
-                        _vectorStore[recordIdValue] = record;
-                        loadedRecords++;
-
-                        if (record.Metadata.ContainsKey("consciousness_aware"))
-                        {
-                            consciousnessRecordsRestored++;
-                        }
-                    }
-                    catch (Exception ex)
-                    {
-                        _logger.LogWarning(ex, "⚠️ Failed to load record {RecordId}", recordId);
                     }
                 }
 
                 stopwatch.Stop();
 
+                var loadedRecords = _vectorStore.Count;
                 var result = new Dictionary<string, object>
                 {
                     ["success"] = true,
                     ["recordsLoaded"] = loadedRecords,
-                    ["consciousnessRecordsRestored"] = consciousnessRecordsRestored,
+                    ["consciousnessRecordsRestored"] = _vectorStore.Values.Count(r => r.Metadata.ContainsKey("consciousness_aware")),
                     ["storageDirectory"] = storageDir,
+                    ["storageFormat"] = storageFormat,
+                    ["walEntriesReplayed"] = walEntriesReplayed,
                     ["processingTimeMs"] = stopwatch.ElapsedMilliseconds
                 };
 
@@ -945,9 +1046,165 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             }
         }
 
+        private void LoadMappedSegment(string segmentPath)
+        {
+            ReleaseMappedSegments();
+
+            var segment = MappedVectorSegment.Open(segmentPath);
+            _mappedSegments.Add(segment);
+
+            var vector = new float[segment.Dimension];
+            for (int row = 0; row < segment.Count; row++)
+            {
+                var record = segment.ReadRecord(row, mapVector: true);
+                segment.ReadVector(row, vector);
+                _vectorIndex.Upsert(record.Id, vector);
+                _metadataIndex.Upsert(record);
+                _vectorStore[record.Id] = record;
+            }
+        }
+
+        /// <summary>
+        /// Apply logged mutations in order. Returns the number of entries replayed.
+        /// </summary>
+        private int ReplayWriteAheadLog(IEnumerable<string> logFiles)
+        {
+            var replayed = 0;
+            foreach (var logFile in logFiles)
+            {
+                foreach (var entry in VectorWriteAheadLog.ReadEntries(logFile))
+                {
+                    try
+                    {
+                        switch (entry.Operation)
+                        {
+                            case VectorWalOperation.Upsert:
+                                _vectorIndex.Upsert(entry.Record!.Id, entry.Record.ReadVector(Span<float>.Empty));
+                                _metadataIndex.Upsert(entry.Record);
+                                _vectorStore[entry.Record.Id] = entry.Record;
+                                break;
+                            case VectorWalOperation.Delete:
+                                _vectorStore.TryRemove(entry.Id!, out _);
+                                _vectorIndex.Remove(entry.Id!);
+                                _metadataIndex.Remove(entry.Id!);
+                                break;
+                            case VectorWalOperation.Clear:
+                                _vectorStore.Clear();
+                                _vectorIndex.Clear();
+                                _metadataIndex.Clear();
+                                break;
+                        }
+                        replayed++;
+                    }
+                    catch (Exception ex)
+                    {
+                        _logger.LogWarning(ex, "⚠️ Failed to replay {Operation} entry from {LogFile}", entry.Operation, logFile);
+                    }
+                }
+            }
+            return replayed;
+        }
+
+        /// <summary>
+        /// Read the per-record layout written before the segment format. Returns an error message, or null on success.
+        /// </summary>
+        private async Task<string?> LoadLegacyRecordsAsync(string storageDir)
+        {
+            var vectorsDir = Path.Combine(storageDir, "vectors");
+            var metadataDir = Path.Combine(storageDir, "metadata");
+            var indicesDir = Path.Combine(storageDir, "indices");
+
+            if (!Directory.Exists(vectorsDir) || !Directory.Exists(metadataDir))
+            {
+                return "Required storage subdirectories not found";
+            }
+
+            // Load index file
+            var indexFile = Path.Combine(indicesDir, "vector_index.json");
+            if (!File.Exists(indexFile))
+            {
+                return "Vector index file not found";
+            }
+
+            JsonElement indexData;
+            using (var indexStream = File.OpenRead(indexFile))
+            {
+                indexData = await JsonSerializer.DeserializeAsync(indexStream, CxJsonSerializerContext.Default.JsonElement);
+            }
+
+            var recordIds = indexData.GetProperty("Records").EnumerateArray()
+                .Select(e => e.GetString()).Where(s => !string.IsNullOrEmpty(s)).ToList();
+
+            // Clear existing store
+            _vectorStore.Clear();
+            _vectorIndex.Clear();
+            _metadataIndex.Clear();
+
+            // Load each record
+            foreach (var recordId in recordIds)
+            {
+                try
+                {
+                    var metadataFile = Path.Combine(metadataDir, $"{recordId}.json");
+                    var vectorFile = Path.Combine(vectorsDir, $"{recordId}.bin");
+
+                    if (!File.Exists(metadataFile) || !File.Exists(vectorFile))
+                    {
+                        _logger.LogWarning("⚠️ Missing files for record {RecordId}, skipping", recordId);
+                        continue;
+                    }
+
+                    // Load metadata
+                    JsonElement metadata;
+                    using (var metadataStream = File.OpenRead(metadataFile))
+                    {
+                        metadata = await JsonSerializer.DeserializeAsync(metadataStream, CxJsonSerializerContext.Default.JsonElement);
+                    }
+
+                    // Load vector binary
+                    var vectorBytes = await File.ReadAllBytesAsync(vectorFile);
+                    var vectorDimensions = metadata.GetProperty("VectorDimensions").GetInt32();
+                    var vector = new float[vectorDimensions];
+                    Buffer.BlockCopy(vectorBytes, 0, vector, 0, vectorBytes.Length);
+
+                    // Recreate VectorRecord
+                    var recordIdValue = metadata.GetProperty("Id").GetString() ?? recordId ?? Guid.NewGuid().ToString();
+                    var record = new VectorRecord
+                    {
+                        Id = recordIdValue,
+                        Content = metadata.GetProperty("Content").GetString() ?? "",
+                        Vector = vector,
+                        CreatedAt = metadata.GetProperty("CreatedAt").GetDateTimeOffset(),
+                        Metadata = new Dictionary<string, object>()
+                    };
+
+                    // Restore metadata dictionary
+                    if (metadata.TryGetProperty("Metadata", out var metadataProperty))
+                    {
+                        foreach (var prop in metadataProperty.EnumerateObject())
+                        {
+                            record.Metadata[prop.Name] = VectorRecordSerializer.ConvertMetadataValue(prop.Value);
+                        }
+                    }
+
+                    _vectorIndex.Upsert(recordIdValue, record.ReadVector(Span<float>.Empty));
+                    _metadataIndex.Upsert(record);
+                    _vectorStore[recordIdValue] = record;
+                }
+                catch (Exception ex)
+                {
+                    _logger.LogWarning(ex, "⚠️ Failed to load record {RecordId}", recordId);
+                }
+            }
+
+            return null;
+        }
+
         /// <summary>
         /// Enhanced for Issue #255: Enable/disable automatic persistence.
-        /// Background persistence for real-time consciousness memory retention.
+        /// While enabled every add, update, delete and clear is appended to a write-ahead log in the default storage
+        /// directory; the timer flushes it to disk and folds it into a fresh segment once it outgrows
+        /// VectorStoreOptions.WalCheckpointBytes, instead of rewriting the whole store every interval.
         /// </summary>
         /// <param name="enabled">Whether to enable automatic persistence</param>
         /// <param name="intervalSeconds">Persistence interval in seconds (default: 30)</param>
@@ -965,18 +1222,17 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                 if (enabled)
                 {
                     _logger.LogInformation("🔄 Enabling automatic persistence every {IntervalSeconds} seconds", intervalSeconds);
+
+                    var writeAheadLog = _writeAheadLog ??= new VectorWriteAheadLog(_defaultStorageDirectory);
+
+                    // Records added before the log was opened only reach disk through a snapshot
+                    _baselineCheckpointPending = true;
                     
                     _autoPersistenceTimer = new Timer(async _ =>
                     {
                         try
                         {
-                            _logger.LogDebug("🔄 Running automatic persistence...");
-                            var result = await SaveToPersistentStorageAsync();
-                            
-                            if (result.TryGetValue("success", out var success) && success.Equals(true))
-                            {
-                                _logger.LogDebug("✅ Automatic persistence completed successfully");
-                            }
+                            await RunAutoPersistenceCheckpointAsync();
                         }
                         catch (Exception ex)
                         {
@@ -987,12 +1243,18 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     await _eventBus.EmitAsync("vectorstore.autopersistence.enabled", new Dictionary<string, object>
                     {
                         ["intervalSeconds"] = intervalSeconds,
+                        ["writeAheadLog"] = writeAheadLog.FilePath,
                         ["enabledAt"] = DateTimeOffset.UtcNow
                     });
                 }
                 else
                 {
                     _logger.LogInformation("⏹️ Disabling automatic persistence");
+
+                    // The log stays on disk and is replayed by the next load
+                    var writeAheadLog = _writeAheadLog;
+                    _writeAheadLog = null;
+                    writeAheadLog?.Dispose();
                     
                     await _eventBus.EmitAsync("vectorstore.autopersistence.disabled", new Dictionary<string, object>
                     {
@@ -1009,6 +1271,113 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             }
         }
 
+        private async Task RunAutoPersistenceCheckpointAsync()
+        {
+            var writeAheadLog = _writeAheadLog;
+            if (writeAheadLog == null)
+            {
+                return;
+            }
+
+            writeAheadLog.Flush(durable: true);
+
+            if (!_baselineCheckpointPending && writeAheadLog.Length < _options.WalCheckpointBytes)
+            {
+                return;
+            }
+
+            _logger.LogDebug("🔄 Running automatic persistence checkpoint...");
+            var result = await SaveToPersistentStorageAsync();
+
+            if (result.TryGetValue("success", out var success) && success.Equals(true))
+            {
+                _baselineCheckpointPending = false;
+                _logger.LogDebug("✅ Automatic persistence checkpoint completed successfully");
+            }
+        }
+
+        private bool IsWriteAheadLogDirectory(string storageDir) =>
+            _writeAheadLog != null
+            && string.Equals(Path.GetFullPath(storageDir).TrimEnd(Path.DirectorySeparatorChar),
+                Path.GetFullPath(_defaultStorageDirectory).TrimEnd(Path.DirectorySeparatorChar),
+                StringComparison.Ordinal);
+
+        /// <summary>
+        /// Index, store and log a record (logging only while automatic persistence is on) under the write lock, so
+        /// concurrent writes reach the indexes and the log in store order. The vector index goes first: a dimension
+        /// mismatch rejects the record before it becomes visible. With mustExist, returns false without changes
+        /// when the id is not stored.
+        /// </summary>
+        private bool CommitUpsert(VectorRecord record, bool mustExist)
+        {
+            lock (_writeLock)
+            {
+                if (mustExist && !_vectorStore.ContainsKey(record.Id))
+                {
+                    return false;
+                }
+
+                _vectorIndex.Upsert(record.Id, record.ReadVector(Span<float>.Empty));
+                _metadataIndex.Upsert(record);
+                _vectorStore[record.Id] = record;
+                var writeAheadLog = _writeAheadLog;
+                if (writeAheadLog != null)
+                {
+                    AppendToWriteAheadLog(writeAheadLog, log => log.AppendUpsert(record));
+                }
+                return true;
+            }
+        }
+
+        private bool CommitDelete(string id, out VectorRecord? removedRecord)
+        {
+            lock (_writeLock)
+            {
+                var removed = _vectorStore.TryRemove(id, out removedRecord);
+                _vectorIndex.Remove(id);
+                _metadataIndex.Remove(id);
+                var writeAheadLog = _writeAheadLog;
+                if (removed && writeAheadLog != null)
+                {
+                    AppendToWriteAheadLog(writeAheadLog, log => log.AppendDelete(id));
+                }
+                return removed;
+            }
+        }
+
+        private int CommitClear()
+        {
+            lock (_writeLock)
+            {
+                var count = _vectorStore.Count;
+                _vectorStore.Clear();
+                _vectorIndex.Clear();
+                _metadataIndex.Clear();
+                var writeAheadLog = _writeAheadLog;
+                if (writeAheadLog != null)
+                {
+                    AppendToWriteAheadLog(writeAheadLog, log => log.AppendClear());
+                }
+                return count;
+            }
+        }
+
+        private void AppendToWriteAheadLog(VectorWriteAheadLog writeAheadLog, Action<VectorWriteAheadLog> append)
+        {
+            try
+            {
+                append(writeAheadLog);
+            }
+            catch (ObjectDisposedException)
+            {
+                // Automatic persistence was switched off concurrently
+            }
+            catch (Exception ex)
+            {
+                _logger.LogWarning(ex, "⚠️ Failed to append to the vector store write-ahead log");
+            }
+        }
+
         /// <summary>
         /// Handle vector.persistence.save event requests from CX language runtime
         /// </summary>
@@ -1213,7 +1582,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                             {
                                 ["id"] = result.Id,
                                 ["content"] = result.Content,
-                                ["vector"] = result.Vector,
+                                ["vector"] = result.CopyVector(),
                                 ["metadata"] = result.Metadata
                             };
                         }
@@ -1359,12 +1728,13 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     var vectorArray = payload.TryGetValue("vector", out var vectorObj) && vectorObj is object[] vecArray
                         ? vecArray.Select(v => Convert.ToSingle(v)).ToArray() : null;
                     var topK = payload.TryGetValue("topK", out var topKObj) ? Convert.ToInt32(topKObj) : 5;
+                    var filter = payload.TryGetValue("filter", out var filterObj) ? MetadataFilter.Parse(filterObj) : null;
 
                     if (vectorArray != null)
                     {
                         _logger.LogInformation("🔍 Starting vector search with {VectorLength}D query vector", vectorArray.Length);
                         
-                        var results = await SearchVectorAsync(vectorArray, topK);
+                        var results = await SearchVectorAsync(vectorArray, topK, filter);
                         var duration = (DateTime.UtcNow - startTime).TotalMilliseconds;
 
                         var responsePayload = new Dictionary<string, object>
@@ -1374,7 +1744,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                                 ["id"] = r.Id,
                                 ["content"] = r.Content,
                                 ["metadata"] = r.Metadata,
-                                ["vector"] = r.Vector
+                                ["vector"] = r.CopyVector()
                             }).ToArray(),
                             ["duration"] = duration,
                             ["query_vector_length"] = vectorArray.Length,
@@ -1927,10 +2297,11 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// </summary>
         /// <param name="queryVector">The vector to search with</param>
         /// <param name="topK">Number of results to return</param>
+        /// <param name="filter">Optional metadata conditions applied before the similarity search</param>
         /// <returns>Search results</returns>
-        public Task<IEnumerable<VectorRecord>> SearchVectorAsync(float[] queryVector, int topK = 5)
+        public Task<IEnumerable<VectorRecord>> SearchVectorAsync(float[] queryVector, int topK = 5, MetadataFilter? filter = null)
         {
-            return SearchAsync(queryVector, topK);
+            return SearchAsync(queryVector, topK, filter);
         }
 
         /// <summary>
@@ -1940,7 +2311,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <returns>True if deleted successfully, false if not found</returns>
         public Task<bool> DeleteAsync(string id)
         {
-            var removed = _vectorStore.TryRemove(id, out var removedRecord);
+            var removed = CommitDelete(id, out var removedRecord);
             if (removed && removedRecord != null)
             {
                 _logger.LogInformation("🗑️ Vector record deleted with ID: {RecordId}", id);
@@ -1970,16 +2341,15 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                 throw new ArgumentException("Record ID is required for update operation");
             }
 
-            if (_vectorStore.ContainsKey(record.Id))
+            // Preserve consciousness context in metadata
+            if (_vectorStore.ContainsKey(record.Id) && !record.Metadata.ContainsKey("consciousness_updated_at"))
             {
-                // Preserve consciousness context in metadata
-                if (!record.Metadata.ContainsKey("consciousness_updated_at"))
-                {
-                    record.Metadata["consciousness_updated_at"] = DateTimeOffset.UtcNow;
-                    record.Metadata["consciousness_aware"] = true;
-                }
+                record.Metadata["consciousness_updated_at"] = DateTimeOffset.UtcNow;
+                record.Metadata["consciousness_aware"] = true;
+            }
 
-                _vectorStore[record.Id] = record;
+            if (CommitUpsert(record, mustExist: true))
+            {
                 _logger.LogInformation("🔄 Vector record updated with ID: {RecordId}", record.Id);
                 
                 await _eventBus.EmitAsync("vectorstore.record.updated", new Dictionary<string, object> 
@@ -2003,9 +2373,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <returns>Number of records cleared</returns>
         public async Task<int> ClearAsync()
         {
-            var count = _vectorStore.Count;
-            _vectorStore.Clear();
-            _embeddingCache.Clear();
+            var count = CommitClear();
             
             _logger.LogInformation("🧹 Vector store cleared, removed {RecordCount} records", count);
             
@@ -2041,13 +2409,15 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         }
 
         /// <summary>
-        /// Enhanced for Issue #255: Dispose of resources including persistence timer and semaphore.
+        /// Enhanced for Issue #255: Dispose of resources including persistence timer, semaphore and mapped segments.
         /// </summary>
         public void Dispose()
         {
             try
             {
                 _autoPersistenceTimer?.Dispose();
+                _writeAheadLog?.Dispose();
+                ReleaseMappedSegments();
                 _persistenceLock?.Dispose();
                 _logger.LogDebug("🧹 InMemoryVectorStoreService disposed successfully");
             }
@@ -0,0 +1,207 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Linq;
+using System.Text.Json;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Operator of a metadata filter condition
+    /// </summary>
+    public enum MetadataFilterOperator
+    {
+        Equal,
+        NotEqual,
+        In,
+        NotIn,
+        Exists,
+        NotExists
+    }
+
+    /// <summary>
+    /// One condition on a VectorRecord metadata field. Values compare by their invariant string form,
+    /// and a multi-valued field (an array or list) matches when any of its elements does.
+    /// </summary>
+    public sealed class MetadataFilterCondition
+    {
+        public MetadataFilterCondition(string field, MetadataFilterOperator op, IEnumerable<string>? values = null)
+        {
+            Field = field ?? throw new ArgumentNullException(nameof(field));
+            Operator = op;
+            Values = values?.ToArray() ?? Array.Empty<string>();
+        }
+
+        public string Field { get; }
+        public MetadataFilterOperator Operator { get; }
+        public IReadOnlyList<string> Values { get; }
+
+        public bool Matches(IDictionary<string, object>? metadata)
+        {
+            var present = metadata != null && metadata.TryGetValue(Field, out var value) && value != null;
+            if (Operator == MetadataFilterOperator.Exists) return present;
+            if (Operator == MetadataFilterOperator.NotExists) return !present;
+
+            var any = present && MetadataFilter.ValueKeys(metadata![Field]).Any(key => Values.Contains(key, StringComparer.Ordinal));
+            return Operator is MetadataFilterOperator.Equal or MetadataFilterOperator.In ? any : !any;
+        }
+    }
+
+    /// <summary>
+    /// Conjunction of metadata conditions, applied by the vector store before the similarity scan.
+    /// Parsed from a dictionary where each key names a field:
+    /// <code>
+    /// { "tenantId": "acme" }                          equals
+    /// { "fileFormat": [".md", ".txt"] }               any of
+    /// { "agentId": { "$ne": "a1" } }                  also $eq, $in, $nin, $exists
+    /// </code>
+    /// </summary>
+    public sealed class MetadataFilter
+    {
+        public static readonly MetadataFilter Empty = new(Array.Empty<MetadataFilterCondition>());
+
+        public MetadataFilter(IEnumerable<MetadataFilterCondition> conditions)
+        {
+            Conditions = conditions.ToArray();
+        }
+
+        public IReadOnlyList<MetadataFilterCondition> Conditions { get; }
+
+        public bool IsEmpty => Conditions.Count == 0;
+
+        public bool Matches(IDictionary<string, object>? metadata)
+        {
+            foreach (var condition in Conditions)
+            {
+                if (!condition.Matches(metadata))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Parse the dictionary form; null or empty gives Empty
+        /// </summary>
+        public static MetadataFilter Parse(IDictionary<string, object>? filter)
+        {
+            if (filter == null || filter.Count == 0)
+            {
+                return Empty;
+            }
+
+            var conditions = new List<MetadataFilterCondition>();
+            foreach (var (field, spec) in filter)
+            {
+                if (AsDictionary(spec) is { } operators)
+                {
+                    foreach (var (op, operand) in operators)
+                    {
+                        conditions.Add(op switch
+                        {
+                            "$eq" => new MetadataFilterCondition(field, MetadataFilterOperator.Equal, ValueKeys(operand)),
+                            "$ne" => new MetadataFilterCondition(field, MetadataFilterOperator.NotEqual, ValueKeys(operand)),
+                            "$in" => new MetadataFilterCondition(field, MetadataFilterOperator.In, ValueKeys(operand)),
+                            "$nin" => new MetadataFilterCondition(field, MetadataFilterOperator.NotIn, ValueKeys(operand)),
+                            "$exists" => new MetadataFilterCondition(field,
+                                IsFalse(operand) ? MetadataFilterOperator.NotExists : MetadataFilterOperator.Exists),
+                            _ => throw new ArgumentException($"Unknown metadata filter operator '{op}' for field '{field}'")
+                        });
+                    }
+                }
+                else
+                {
+                    var values = ValueKeys(spec).ToArray();
+                    conditions.Add(new MetadataFilterCondition(field,
+                        values.Length == 1 ? MetadataFilterOperator.Equal : MetadataFilterOperator.In, values));
+                }
+            }
+            return new MetadataFilter(conditions);
+        }
+
+        /// <summary>
+        /// Parse a filter from an event payload entry, which may be a dictionary or a JSON object
+        /// </summary>
+        public static MetadataFilter Parse(object? filter) => AsDictionary(filter) is { } dictionary ? Parse(dictionary) : Empty;
+
+        /// <summary>
+        /// Comparison keys of a metadata value: its invariant string form, or one per element of a collection
+        /// </summary>
+        internal static IEnumerable<string> ValueKeys(object? value)
+        {
+            switch (value)
+            {
+                case null:
+                    yield break;
+                case string text:
+                    yield return text;
+                    yield break;
+                case JsonElement { ValueKind: JsonValueKind.Array } array:
+                    foreach (var element in array.EnumerateArray())
+                    {
+                        yield return ElementKey(element);
+                    }
+                    yield break;
+                case JsonElement element:
+                    yield return ElementKey(element);
+                    yield break;
+                case IEnumerable items:
+                    foreach (var item in items)
+                    {
+                        if (item != null)
+                        {
+                            yield return ScalarKey(item);
+                        }
+                    }
+                    yield break;
+                default:
+                    yield return ScalarKey(value);
+                    yield break;
+            }
+        }
+
+        private static string ScalarKey(object value) => value switch
+        {
+            bool flag => flag ? "true" : "false",
+            JsonElement element => ElementKey(element),
+            IFormattable formattable => formattable.ToString(null, CultureInfo.InvariantCulture),
+            _ => value.ToString() ?? string.Empty
+        };
+
+        private static string ElementKey(JsonElement element) => element.ValueKind switch
+        {
+            JsonValueKind.String => element.GetString() ?? string.Empty,
+            JsonValueKind.True => "true",
+            JsonValueKind.False => "false",
+            _ => element.GetRawText()
+        };
+
+        private static bool IsFalse(object? value) => value switch
+        {
+            bool flag => !flag,
+            JsonElement { ValueKind: JsonValueKind.False } => true,
+            string text => bool.TryParse(text, out var flag) && !flag,
+            _ => false
+        };
+
+        private static IDictionary<string, object>? AsDictionary(object? value)
+        {
+            switch (value)
+            {
+                case IDictionary<string, object> dictionary:
+                    return dictionary;
+                case JsonElement { ValueKind: JsonValueKind.Object } element:
+                    var result = new Dictionary<string, object>(StringComparer.Ordinal);
+                    foreach (var property in element.EnumerateObject())
+                    {
+                        result[property.Name] = property.Value;
+                    }
+                    return result;
+                default:
+                    return null;
+            }
+        }
+    }
+}
@@ -0,0 +1,267 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Secondary indexes on chosen metadata fields: one roaring bitmap of record ordinals per (field, value), plus
+    /// one per field of the records that have it. A filter on indexed fields resolves to its candidate ids with
+    /// bitmap algebra, at a cost that follows the number of matches rather than the size of the store.
+    /// Records are indexed with the metadata they carry when stored.
+    /// </summary>
+    internal sealed class MetadataIndex
+    {
+        private readonly ReaderWriterLockSlim _lock = new(LockRecursionPolicy.NoRecursion);
+        private readonly HashSet<string> _fields;
+        private readonly Dictionary<string, Dictionary<string, RoaringBitmap>> _valueBitmaps = new(StringComparer.Ordinal);
+        private readonly Dictionary<string, RoaringBitmap> _presentBitmaps = new(StringComparer.Ordinal);
+        private readonly Dictionary<string, int> _ordinalsById = new(StringComparer.Ordinal);
+        private readonly List<string?> _idsByOrdinal = new();
+        // Indexed (field, value key) pairs per ordinal; a null key marks a field that is present with no values
+        private readonly List<(string Field, string? Value)[]?> _valuesByOrdinal = new();
+        private readonly Stack<int> _freeOrdinals = new();
+        private RoaringBitmap _all = new();
+
+        public MetadataIndex(IEnumerable<string>? fields)
+        {
+            _fields = new HashSet<string>(fields ?? Array.Empty<string>(), StringComparer.Ordinal);
+            foreach (var field in _fields)
+            {
+                _valueBitmaps[field] = new Dictionary<string, RoaringBitmap>(StringComparer.Ordinal);
+                _presentBitmaps[field] = new RoaringBitmap();
+            }
+        }
+
+        public IReadOnlyCollection<string> Fields => _fields;
+
+        public void Upsert(VectorRecord record)
+        {
+            if (_fields.Count == 0)
+            {
+                return;
+            }
+
+            var values = new List<(string Field, string? Value)>();
+            foreach (var field in _fields)
+            {
+                if (record.Metadata.TryGetValue(field, out var value) && value != null)
+                {
+                    var count = values.Count;
+                    foreach (var key in MetadataFilter.ValueKeys(value).Distinct(StringComparer.Ordinal))
+                    {
+                        values.Add((field, key));
+                    }
+
+                    // An empty collection still counts as present, as it does for MetadataFilter.Matches
+                    if (values.Count == count)
+                    {
+                        values.Add((field, null));
+                    }
+                }
+            }
+
+            _lock.EnterWriteLock();
+            try
+            {
+                if (_ordinalsById.TryGetValue(record.Id, out var ordinal))
+                {
+                    UnindexLocked(ordinal);
+                }
+                else
+                {
+                    ordinal = _freeOrdinals.Count > 0 ? _freeOrdinals.Pop() : _idsByOrdinal.Count;
+                    if (ordinal == _idsByOrdinal.Count)
+                    {
+                        _idsByOrdinal.Add(null);
+                        _valuesByOrdinal.Add(null);
+                    }
+                    _ordinalsById[record.Id] = ordinal;
+                    _idsByOrdinal[ordinal] = record.Id;
+                    _all.Add(ordinal);
+                }
+
+                foreach (var (field, key) in values)
+                {
+                    _presentBitmaps[field].Add(ordinal);
+                    if (key == null)
+                    {
+                        continue;
+                    }
+
+                    var byValue = _valueBitmaps[field];
+                    if (!byValue.TryGetValue(key, out var bitmap))
+                    {
+                        byValue[key] = bitmap = new RoaringBitmap();
+                    }
+                    bitmap.Add(ordinal);
+                }
+                _valuesByOrdinal[ordinal] = values.ToArray();
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public void Remove(string id)
+        {
+            if (_fields.Count == 0)
+            {
+                return;
+            }
+
+            _lock.EnterWriteLock();
+            try
+            {
+                if (!_ordinalsById.Remove(id, out var ordinal))
+                {
+                    return;
+                }
+
+                UnindexLocked(ordinal);
+                _all.Remove(ordinal);
+                _idsByOrdinal[ordinal] = null;
+                _freeOrdinals.Push(ordinal);
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public void Clear()
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                foreach (var field in _fields)
+                {
+                    _valueBitmaps[field].Clear();
+                    _presentBitmaps[field] = new RoaringBitmap();
+                }
+                _ordinalsById.Clear();
+                _idsByOrdinal.Clear();
+                _valuesByOrdinal.Clear();
+                _freeOrdinals.Clear();
+                _all = new RoaringBitmap();
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public bool IsIndexed(string field) => _fields.Contains(field);
+
+        /// <summary>
+        /// Ids of the records that satisfy the filter's conditions on indexed fields, or null when none of its
+        /// conditions is on an indexed field. Conditions on other fields are left to the caller.
+        /// </summary>
+        public List<string>? Resolve(MetadataFilter filter)
+        {
+            _lock.EnterReadLock();
+            try
+            {
+                RoaringBitmap? result = null;
+                foreach (var condition in filter.Conditions)
+                {
+                    if (!_fields.Contains(condition.Field))
+                    {
+                        continue;
+                    }
+
+                    var matched = ResolveLocked(condition);
+                    result = result == null ? matched : RoaringBitmap.And(result, matched);
+                    if (result.IsEmpty)
+                    {
+                        break;
+                    }
+                }
+
+                if (result == null)
+                {
+                    return null;
+                }
+
+                var ids = new List<string>(result.Cardinality);
+                foreach (var ordinal in result.Enumerate())
+                {
+                    ids.Add(_idsByOrdinal[ordinal]!);
+                }
+                return ids;
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        public void AddMetrics(Dictionary<string, object> metrics)
+        {
+            _lock.EnterReadLock();
+            try
+            {
+                metrics["metadata_indexed_fields"] = _fields.ToArray();
+                metrics["metadata_indexed_records"] = _ordinalsById.Count;
+                metrics["metadata_index_values"] = _valueBitmaps.Values.Sum(byValue => byValue.Count);
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        private RoaringBitmap ResolveLocked(MetadataFilterCondition condition)
+        {
+            var present = _presentBitmaps[condition.Field];
+            switch (condition.Operator)
+            {
+                case MetadataFilterOperator.Exists:
+                    return present;
+                case MetadataFilterOperator.NotExists:
+                    return RoaringBitmap.AndNot(_all, present);
+            }
+
+            var byValue = _valueBitmaps[condition.Field];
+            var matched = new RoaringBitmap();
+            foreach (var value in condition.Values)
+            {
+                if (byValue.TryGetValue(value, out var bitmap))
+                {
+                    matched = matched.IsEmpty ? bitmap : RoaringBitmap.Or(matched, bitmap);
+                }
+            }
+
+            return condition.Operator is MetadataFilterOperator.Equal or MetadataFilterOperator.In
+                ? matched
+                : RoaringBitmap.AndNot(_all, matched);
+        }
+
+        private void UnindexLocked(int ordinal)
+        {
+            var values = _valuesByOrdinal[ordinal];
+            if (values == null)
+            {
+                return;
+            }
+
+            foreach (var (field, key) in values)
+            {
+                _presentBitmaps[field].Remove(ordinal);
+                if (key == null)
+                {
+                    continue;
+                }
+
+                var byValue = _valueBitmaps[field];
+                if (byValue.TryGetValue(key, out var bitmap) && bitmap.Remove(ordinal) && bitmap.IsEmpty)
+                {
+                    byValue.Remove(key);
+                }
+            }
+            _valuesByOrdinal[ordinal] = null;
+        }
+    }
+}
@@ -0,0 +1,504 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Copies the full-precision vector of a record into destination; false when the record is gone or its
+    /// dimension differs
+    /// </summary>
+    internal delegate bool ExactVectorReader(string id, Span<float> destination);
+
+    /// <summary>
+    /// Brute-force index over quantized vector codes (int8 or product quantization).
+    /// A query scores every code with asymmetric distance, keeps RerankFactor x topK candidates, and re-ranks those
+    /// with exact cosine similarity against full-precision vectors copied in through the exact vector reader, so the
+    /// index itself holds only the compact codes. The store serves those vectors from its memory-mapped segment once
+    /// it has been saved or loaded, which keeps fp32 vectors off the managed heap; records added since the last save
+    /// keep theirs on the heap until the next one.
+    ///
+    /// Product quantization has to learn its codebooks first: until TrainingSize vectors have arrived they are
+    /// kept as normalized fp32 and searched exactly, then the codebooks are trained on them and everything is encoded.
+    /// </summary>
+    internal sealed class QuantizedVectorIndex : IVectorIndex
+    {
+        private const int ParallelRowThreshold = 16_384;
+        private const int InitialCapacity = 64;
+
+        private readonly ReaderWriterLockSlim _lock = new(LockRecursionPolicy.NoRecursion);
+        private readonly Dictionary<string, int> _slotsById = new(StringComparer.Ordinal);
+        private readonly VectorQuantization _quantization;
+        private readonly int _productSubvectors;
+        private readonly int _trainingSize;
+        private readonly int _rerankFactor;
+        private readonly ExactVectorReader _exactVectorReader;
+
+        private IVectorCodec? _codec;
+        private byte[] _codes = Array.Empty<byte>();
+        private float[]?[] _pending = Array.Empty<float[]?>();
+        private string[] _ids = Array.Empty<string>();
+        private int _dimension;
+        private int _count;
+
+        public QuantizedVectorIndex(
+            VectorQuantization quantization,
+            int productSubvectors,
+            int trainingSize,
+            int rerankFactor,
+            ExactVectorReader exactVectorReader)
+        {
+            if (quantization == VectorQuantization.None)
+            {
+                throw new ArgumentException("QuantizedVectorIndex needs a quantization codec", nameof(quantization));
+            }
+
+            _quantization = quantization;
+            _productSubvectors = productSubvectors;
+            _trainingSize = Math.Max(1, trainingSize);
+            _rerankFactor = Math.Max(1, rerankFactor);
+            _exactVectorReader = exactVectorReader;
+        }
+
+        public string Kind => _quantization == VectorQuantization.Product ? "flat-pq" : "flat-int8";
+
+        public bool IsApproximate => true;
+
+        public int Dimension
+        {
+            get
+            {
+                _lock.EnterReadLock();
+                try { return _count == 0 ? 0 : _dimension; }
+                finally { _lock.ExitReadLock(); }
+            }
+        }
+
+        public int Count
+        {
+            get
+            {
+                _lock.EnterReadLock();
+                try { return _count; }
+                finally { _lock.ExitReadLock(); }
+            }
+        }
+
+        public void Upsert(string id, ReadOnlySpan<float> vector)
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                if (_count == 0)
+                {
+                    if (vector.Length != _dimension || _codec == null)
+                    {
+                        Reset(vector.Length);
+                    }
+                }
+                else if (vector.Length != _dimension)
+                {
+                    throw new ArgumentException($"Vector dimension ({vector.Length}) does not match stored vector dimension ({_dimension})");
+                }
+
+                if (!_slotsById.TryGetValue(id, out var slot))
+                {
+                    EnsureCapacity(_count + 1);
+                    slot = _count++;
+                    _slotsById[id] = slot;
+                    _ids[slot] = id;
+                }
+
+                var normalized = new float[_dimension];
+                VectorKernels.Normalize(vector, normalized);
+
+                var codec = _codec!;
+                if (codec.IsTrained)
+                {
+                    codec.Encode(normalized, _codes.AsSpan(slot * codec.CodeSize, codec.CodeSize));
+                    _pending[slot] = null;
+                }
+                else
+                {
+                    _pending[slot] = normalized;
+                    if (_count >= _trainingSize)
+                    {
+                        TrainAndEncode();
+                    }
+                }
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public bool Remove(string id)
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                if (!_slotsById.Remove(id, out var slot))
+                {
+                    return false;
+                }
+
+                var last = --_count;
+                if (slot != last)
+                {
+                    if (_codec!.IsTrained)
+                    {
+                        var codeSize = _codec.CodeSize;
+                        _codes.AsSpan(last * codeSize, codeSize).CopyTo(_codes.AsSpan(slot * codeSize, codeSize));
+                    }
+                    _pending[slot] = _pending[last];
+                    _ids[slot] = _ids[last];
+                    _slotsById[_ids[slot]] = slot;
+                }
+                _pending[last] = null;
+                _ids[last] = null!;
+                return true;
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public void Clear()
+        {
+            _lock.EnterWriteLock();
+            try
+            {
+                Reset(0);
+                _codec = null;
+            }
+            finally
+            {
+                _lock.ExitWriteLock();
+            }
+        }
+
+        public List<(string Id, float Score)> Search(ReadOnlySpan<float> query, int topK)
+        {
+            if (topK <= 0)
+            {
+                return new List<(string Id, float Score)>();
+            }
+
+            _lock.EnterReadLock();
+            try
+            {
+                if (_count == 0)
+                {
+                    return new List<(string Id, float Score)>();
+                }
+
+                var normalizedQuery = NormalizeQuery(query);
+                var codec = _codec!;
+                if (!codec.IsTrained)
+                {
+                    return ScorePending(normalizedQuery, topK);
+                }
+
+                // Asymmetric distance over the codes, then exact re-ranking of the short list
+                var candidates = Math.Min(_count, topK * _rerankFactor);
+                var scorer = codec.CreateScorer(normalizedQuery);
+                var heap = _count < ParallelRowThreshold
+                    ? ScoreCodes(scorer, codec.CodeSize, 0, _count, candidates)
+                    : ScoreCodesParallel(scorer, codec.CodeSize, candidates);
+
+                return Rerank(normalizedQuery, heap.ToSortedArray(), topK);
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        /// <summary>
+        /// Score only the candidates' codes (or pending vectors), then re-rank as in the unfiltered search
+        /// </summary>
+        public List<(string Id, float Score)> Search(ReadOnlySpan<float> query, int topK, IReadOnlyCollection<string> candidates)
+        {
+            if (topK <= 0 || candidates.Count == 0)
+            {
+                return new List<(string Id, float Score)>();
+            }
+
+            _lock.EnterReadLock();
+            try
+            {
+                if (_count == 0)
+                {
+                    return new List<(string Id, float Score)>();
+                }
+
+                var normalizedQuery = NormalizeQuery(query);
+                var codec = _codec!;
+                var trained = codec.IsTrained;
+                var scorer = trained ? codec.CreateScorer(normalizedQuery) : null;
+                var codeSize = codec.CodeSize;
+
+                var heap = new TopKHeap(Math.Min(Math.Min(_count, candidates.Count), trained ? topK * _rerankFactor : topK));
+                foreach (var id in candidates)
+                {
+                    if (!_slotsById.TryGetValue(id, out var slot)) continue;
+
+                    var score = trained
+                        ? scorer!.Score(_codes.AsSpan(slot * codeSize, codeSize))
+                        : VectorKernels.Dot(normalizedQuery, _pending[slot]!);
+                    if (score > heap.Threshold)
+                    {
+                        heap.Add(score, slot);
+                    }
+                }
+
+                if (trained)
+                {
+                    return Rerank(normalizedQuery, heap.ToSortedArray(), topK);
+                }
+
+                var results = new List<(string Id, float Score)>(heap.Count);
+                foreach (var (slot, score) in heap.ToSortedArray())
+                {
+                    results.Add((_ids[slot], score));
+                }
+                return results;
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        public List<(string Id, float Score)> SearchExact(ReadOnlySpan<float> query, int topK)
+        {
+            var results = new List<(string Id, float Score)>();
+            if (topK <= 0)
+            {
+                return results;
+            }
+
+            string[] ids;
+            int count;
+            float[] normalizedQuery;
+            _lock.EnterReadLock();
+            try
+            {
+                if (_count == 0)
+                {
+                    return results;
+                }
+
+                normalizedQuery = NormalizeQuery(query);
+                count = _count;
+                ids = new string[count];
+                Array.Copy(_ids, ids, count);
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+
+            // Ground truth comes from the full-precision vectors, which live outside the index
+            var heap = new TopKHeap(Math.Min(topK, count));
+            var buffer = new float[normalizedQuery.Length];
+            for (int slot = 0; slot < count; slot++)
+            {
+                var score = ExactScore(normalizedQuery, ids[slot], buffer);
+                if (score.HasValue && score.Value > heap.Threshold)
+                {
+                    heap.Add(score.Value, slot);
+                }
+            }
+
+            foreach (var (slot, score) in heap.ToSortedArray())
+            {
+                results.Add((ids[slot], score));
+            }
+            return results;
+        }
+
+        public void AddMetrics(Dictionary<string, object> metrics)
+        {
+            _lock.EnterReadLock();
+            try
+            {
+                metrics["quantization"] = _quantization.ToString();
+                metrics["quantization_trained"] = _codec?.IsTrained ?? false;
+                metrics["quantization_code_bytes"] = _codec?.CodeSize ?? 0;
+                metrics["quantization_compression_ratio"] = _codec == null || _codec.CodeSize == 0
+                    ? 1.0
+                    : (double)(_dimension * sizeof(float)) / _codec.CodeSize;
+                metrics["quantization_rerank_factor"] = _rerankFactor;
+                if (_codec is ProductQuantizationCodec productCodec)
+                {
+                    metrics["pq_subvectors"] = productCodec.Subvectors;
+                }
+            }
+            finally
+            {
+                _lock.ExitReadLock();
+            }
+        }
+
+        private List<(string Id, float Score)> Rerank(float[] normalizedQuery, (int Slot, float Score)[] candidates, int topK)
+        {
+            var rescored = new List<(string Id, float Score)>(candidates.Length);
+            var buffer = new float[normalizedQuery.Length];
+            foreach (var (slot, approximateScore) in candidates)
+            {
+                var id = _ids[slot];
+                rescored.Add((id, ExactScore(normalizedQuery, id, buffer) ?? approximateScore));
+            }
+
+            rescored.Sort(static (a, b) => b.Score.CompareTo(a.Score));
+            if (rescored.Count > topK)
+            {
+                rescored.RemoveRange(topK, rescored.Count - topK);
+            }
+            return rescored;
+        }
+
+        /// <summary>
+        /// Cosine similarity against the stored full-precision vector, or null when it is unavailable.
+        /// buffer receives the vector and must have the query's dimension.
+        /// </summary>
+        private float? ExactScore(float[] normalizedQuery, string id, float[] buffer)
+        {
+            if (!_exactVectorReader(id, buffer))
+            {
+                return null;
+            }
+
+            var magnitude = MathF.Sqrt(VectorKernels.Dot(buffer, buffer));
+            return magnitude == 0f ? 0f : VectorKernels.Dot(normalizedQuery, buffer) / magnitude;
+        }
+
+        private List<(string Id, float Score)> ScorePending(float[] normalizedQuery, int topK)
+        {
+            var heap = new TopKHeap(Math.Min(topK, _count));
+            for (int slot = 0; slot < _count; slot++)
+            {
+                var score = VectorKernels.Dot(normalizedQuery, _pending[slot]!);
+                if (score > heap.Threshold)
+                {
+                    heap.Add(score, slot);
+                }
+            }
+
+            var results = new List<(string Id, float Score)>(heap.Count);
+            foreach (var (slot, score) in heap.ToSortedArray())
+            {
+                results.Add((_ids[slot], score));
+            }
+            return results;
+        }
+
+        private TopKHeap ScoreCodesParallel(IVectorCodeScorer scorer, int codeSize, int k)
+        {
+            var partitions = Math.Min(Environment.ProcessorCount, _count / (ParallelRowThreshold / 4));
+            if (partitions <= 1)
+            {
+                return ScoreCodes(scorer, codeSize, 0, _count, k);
+            }
+
+            var rowsPerPartition = (_count + partitions - 1) / partitions;
+            var partials = new TopKHeap[partitions];
+            Parallel.For(0, partitions, partition =>
+            {
+                var start = partition * rowsPerPartition;
+                partials[partition] = ScoreCodes(scorer, codeSize, start, Math.Min(start + rowsPerPartition, _count), k);
+            });
+
+            var merged = new TopKHeap(k);
+            foreach (var partial in partials)
+            {
+                merged.AddRange(partial);
+            }
+            return merged;
+        }
+
+        private TopKHeap ScoreCodes(IVectorCodeScorer scorer, int codeSize, int start, int end, int k)
+        {
+            var heap = new TopKHeap(k);
+            var codes = _codes;
+            for (int slot = start; slot < end; slot++)
+            {
+                var score = scorer.Score(codes.AsSpan(slot * codeSize, codeSize));
+                if (score > heap.Threshold)
+                {
+                    heap.Add(score, slot);
+                }
+            }
+            return heap;
+        }
+
+        private void TrainAndEncode()
+        {
+            var codec = _codec!;
+            var sample = new List<float[]>(_count);
+            for (int slot = 0; slot < _count; slot++)
+            {
+                sample.Add(_pending[slot]!);
+            }
+
+            codec.Train(sample);
+
+            _codes = new byte[_ids.Length * codec.CodeSize];
+            for (int slot = 0; slot < _count; slot++)
+            {
+                codec.Encode(_pending[slot]!, _codes.AsSpan(slot * codec.CodeSize, codec.CodeSize));
+                _pending[slot] = null;
+            }
+        }
+
+        private void Reset(int dimension)
+        {
+            _slotsById.Clear();
+            _codes = Array.Empty<byte>();
+            _pending = Array.Empty<float[]?>();
+            _ids = Array.Empty<string>();
+            _count = 0;
+            _dimension = dimension;
+            _codec = _quantization == VectorQuantization.Product
+                ? new ProductQuantizationCodec(dimension, _productSubvectors > 0 ? _productSubvectors : Math.Max(1, dimension / 4))
+                : new ScalarInt8Codec(dimension);
+        }
+
+        private void EnsureCapacity(int rows)
+        {
+            if (rows <= _ids.Length)
+            {
+                return;
+            }
+
+            var capacity = Math.Max(InitialCapacity, _ids.Length * 2);
+            while (capacity < rows)
+            {
+                capacity *= 2;
+            }
+
+            Array.Resize(ref _ids, capacity);
+            Array.Resize(ref _pending, capacity);
+            if (_codec!.IsTrained)
+            {
+                Array.Resize(ref _codes, capacity * _codec.CodeSize);
+            }
+        }
+
+        private float[] NormalizeQuery(ReadOnlySpan<float> query)
+        {
+            if (query.Length != _dimension)
+            {
+                throw new ArgumentException($"Query vector dimension ({query.Length}) does not match stored vector dimension ({_dimension})");
+            }
+
+            var normalized = new float[_dimension];
+            VectorKernels.Normalize(query, normalized);
+            return normalized;
+        }
+    }
+}
@@ -0,0 +1,411 @@
+using System;
+using System.Collections.Generic;
+using System.Numerics;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Compressed set of non-negative ints in the roaring layout: values are grouped by their high 16 bits into
+    /// containers that hold the low 16 bits either as a sorted ushort array (sparse, up to 4096 values) or as a
+    /// 65536-bit bitmap (dense). Intersections and unions work container by container, so their cost follows the
+    /// smaller operand rather than the value range. Not thread-safe; MetadataIndex guards its bitmaps.
+    /// </summary>
+    internal sealed class RoaringBitmap
+    {
+        private const int ArrayContainerMax = 4096;
+        private const int BitmapWords = 65536 / 64;
+
+        private readonly List<ushort> _keys = new();
+        private readonly List<Container> _containers = new();
+
+        public int Cardinality
+        {
+            get
+            {
+                var total = 0;
+                foreach (var container in _containers)
+                {
+                    total += container.Count;
+                }
+                return total;
+            }
+        }
+
+        public bool IsEmpty => _containers.Count == 0;
+
+        public bool Add(int value)
+        {
+            var key = (ushort)(value >> 16);
+            var index = _keys.BinarySearch(key);
+            if (index < 0)
+            {
+                index = ~index;
+                _keys.Insert(index, key);
+                _containers.Insert(index, new Container());
+            }
+            return _containers[index].Add((ushort)value);
+        }
+
+        public bool Remove(int value)
+        {
+            var index = _keys.BinarySearch((ushort)(value >> 16));
+            if (index < 0 || !_containers[index].Remove((ushort)value))
+            {
+                return false;
+            }
+
+            if (_containers[index].Count == 0)
+            {
+                _keys.RemoveAt(index);
+                _containers.RemoveAt(index);
+            }
+            return true;
+        }
+
+        public bool Contains(int value)
+        {
+            var index = _keys.BinarySearch((ushort)(value >> 16));
+            return index >= 0 && _containers[index].Contains((ushort)value);
+        }
+
+        public RoaringBitmap Clone()
+        {
+            var clone = new RoaringBitmap();
+            for (int i = 0; i < _keys.Count; i++)
+            {
+                clone._keys.Add(_keys[i]);
+                clone._containers.Add(_containers[i].Clone());
+            }
+            return clone;
+        }
+
+        public static RoaringBitmap And(RoaringBitmap left, RoaringBitmap right)
+        {
+            var result = new RoaringBitmap();
+            int i = 0, j = 0;
+            while (i < left._keys.Count && j < right._keys.Count)
+            {
+                var comparison = left._keys[i].CompareTo(right._keys[j]);
+                if (comparison < 0) i++;
+                else if (comparison > 0) j++;
+                else
+                {
+                    var container = Container.And(left._containers[i], right._containers[j]);
+                    if (container.Count > 0)
+                    {
+                        result._keys.Add(left._keys[i]);
+                        result._containers.Add(container);
+                    }
+                    i++;
+                    j++;
+                }
+            }
+            return result;
+        }
+
+        public static RoaringBitmap Or(RoaringBitmap left, RoaringBitmap right)
+        {
+            var result = new RoaringBitmap();
+            int i = 0, j = 0;
+            while (i < left._keys.Count || j < right._keys.Count)
+            {
+                var comparison = i == left._keys.Count ? 1 : j == right._keys.Count ? -1 : left._keys[i].CompareTo(right._keys[j]);
+                if (comparison < 0)
+                {
+                    result._keys.Add(left._keys[i]);
+                    result._containers.Add(left._containers[i++].Clone());
+                }
+                else if (comparison > 0)
+                {
+                    result._keys.Add(right._keys[j]);
+                    result._containers.Add(right._containers[j++].Clone());
+                }
+                else
+                {
+                    result._keys.Add(left._keys[i]);
+                    result._containers.Add(Container.Or(left._containers[i++], right._containers[j++]));
+                }
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Values of left that are not in right
+        /// </summary>
+        public static RoaringBitmap AndNot(RoaringBitmap left, RoaringBitmap right)
+        {
+            var result = new RoaringBitmap();
+            var j = 0;
+            for (int i = 0; i < left._keys.Count; i++)
+            {
+                while (j < right._keys.Count && right._keys[j] < left._keys[i]) j++;
+
+                var container = j < right._keys.Count && right._keys[j] == left._keys[i]
+                    ? Container.AndNot(left._containers[i], right._containers[j])
+                    : left._containers[i].Clone();
+                if (container.Count > 0)
+                {
+                    result._keys.Add(left._keys[i]);
+                    result._containers.Add(container);
+                }
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Values in ascending order
+        /// </summary>
+        public IEnumerable<int> Enumerate()
+        {
+            for (int i = 0; i < _keys.Count; i++)
+            {
+                var high = _keys[i] << 16;
+                foreach (var low in _containers[i].Enumerate())
+                {
+                    yield return high | low;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Low 16 bits of one high-bits group, as a sorted array until it grows past 4096 values and as a bitmap after
+        /// </summary>
+        private sealed class Container
+        {
+            private ushort[]? _array = new ushort[4];
+            private ulong[]? _bitmap;
+            private int _count;
+
+            public int Count => _count;
+
+            public bool Add(ushort value)
+            {
+                if (_bitmap != null)
+                {
+                    return SetBit(_bitmap, value, ref _count);
+                }
+
+                var index = Array.BinarySearch(_array!, 0, _count, value);
+                if (index >= 0)
+                {
+                    return false;
+                }
+
+                if (_count == ArrayContainerMax)
+                {
+                    ConvertToBitmap();
+                    return SetBit(_bitmap!, value, ref _count);
+                }
+
+                index = ~index;
+                if (_count == _array!.Length)
+                {
+                    Array.Resize(ref _array, Math.Min(ArrayContainerMax, _array.Length * 2));
+                }
+                Array.Copy(_array, index, _array, index + 1, _count - index);
+                _array[index] = value;
+                _count++;
+                return true;
+            }
+
+            public bool Remove(ushort value)
+            {
+                if (_bitmap != null)
+                {
+                    var word = value >> 6;
+                    var mask = 1UL << (value & 63);
+                    if ((_bitmap[word] & mask) == 0)
+                    {
+                        return false;
+                    }
+                    _bitmap[word] &= ~mask;
+                    _count--;
+                    if (_count <= ArrayContainerMax / 2)
+                    {
+                        ConvertToArray();
+                    }
+                    return true;
+                }
+
+                var index = Array.BinarySearch(_array!, 0, _count, value);
+                if (index < 0)
+                {
+                    return false;
+                }
+                Array.Copy(_array!, index + 1, _array!, index, _count - index - 1);
+                _count--;
+                return true;
+            }
+
+            public bool Contains(ushort value) => _bitmap != null
+                ? (_bitmap[value >> 6] & (1UL << (value & 63))) != 0
+                : Array.BinarySearch(_array!, 0, _count, value) >= 0;
+
+            public Container Clone()
+            {
+                var clone = new Container { _count = _count };
+                if (_bitmap != null)
+                {
+                    clone._array = null;
+                    clone._bitmap = (ulong[])_bitmap.Clone();
+                }
+                else
+                {
+                    clone._array = _array!.AsSpan(0, Math.Max(1, _count)).ToArray();
+                }
+                return clone;
+            }
+
+            public IEnumerable<int> Enumerate()
+            {
+                if (_bitmap == null)
+                {
+                    for (int i = 0; i < _count; i++)
+                    {
+                        yield return _array![i];
+                    }
+                    yield break;
+                }
+
+                for (int word = 0; word < BitmapWords; word++)
+                {
+                    var bits = _bitmap[word];
+                    while (bits != 0)
+                    {
+                        yield return (word << 6) | BitOperations.TrailingZeroCount(bits);
+                        bits &= bits - 1;
+                    }
+                }
+            }
+
+            public static Container And(Container left, Container right)
+            {
+                if (left._bitmap != null && right._bitmap != null)
+                {
+                    return FromWords(left._bitmap, right._bitmap, static (a, b) => a & b);
+                }
+
+                // Probe the smaller side's values; an array container holds at most 4096
+                var (small, large) = left._count <= right._count ? (left, right) : (right, left);
+                var result = new Container();
+                foreach (var value in small.Enumerate())
+                {
+                    if (large.Contains((ushort)value))
+                    {
+                        result.AppendSorted((ushort)value);
+                    }
+                }
+                return result;
+            }
+
+            public static Container Or(Container left, Container right)
+            {
+                if (left._bitmap != null && right._bitmap != null)
+                {
+                    return FromWords(left._bitmap, right._bitmap, static (a, b) => a | b);
+                }
+
+                // Start from the bitmap side, or the larger array, and add the other side's values
+                var (into, from) = left._bitmap != null || (right._bitmap == null && left._count >= right._count)
+                    ? (left, right)
+                    : (right, left);
+                var result = into.Clone();
+                foreach (var value in from.Enumerate())
+                {
+                    result.Add((ushort)value);
+                }
+                return result;
+            }
+
+            public static Container AndNot(Container left, Container right)
+            {
+                if (left._bitmap != null && right._bitmap != null)
+                {
+                    return FromWords(left._bitmap, right._bitmap, static (a, b) => a & ~b);
+                }
+
+                var result = new Container();
+                foreach (var value in left.Enumerate())
+                {
+                    if (!right.Contains((ushort)value))
+                    {
+                        result.AppendSorted((ushort)value);
+                    }
+                }
+                return result;
+            }
+
+            private static Container FromWords(ulong[] left, ulong[] right, Func<ulong, ulong, ulong> combine)
+            {
+                var words = new ulong[BitmapWords];
+                var count = 0;
+                for (int i = 0; i < BitmapWords; i++)
+                {
+                    words[i] = combine(left[i], right[i]);
+                    count += BitOperations.PopCount(words[i]);
+                }
+
+                var result = new Container { _array = null, _bitmap = words, _count = count };
+                if (count <= ArrayContainerMax / 2)
+                {
+                    result.ConvertToArray();
+                }
+                return result;
+            }
+
+            /// <summary>
+            /// Add a value greater than every value already held
+            /// </summary>
+            private void AppendSorted(ushort value)
+            {
+                if (_bitmap != null || _count == ArrayContainerMax)
+                {
+                    Add(value);
+                    return;
+                }
+
+                if (_count == _array!.Length)
+                {
+                    Array.Resize(ref _array, Math.Min(ArrayContainerMax, _array.Length * 2));
+                }
+                _array[_count++] = value;
+            }
+
+            private static bool SetBit(ulong[] bitmap, ushort value, ref int count)
+            {
+                var word = value >> 6;
+                var mask = 1UL << (value & 63);
+                if ((bitmap[word] & mask) != 0)
+                {
+                    return false;
+                }
+                bitmap[word] |= mask;
+                count++;
+                return true;
+            }
+
+            private void ConvertToBitmap()
+            {
+                var bitmap = new ulong[BitmapWords];
+                for (int i = 0; i < _count; i++)
+                {
+                    bitmap[_array![i] >> 6] |= 1UL << (_array[i] & 63);
+                }
+                _bitmap = bitmap;
+                _array = null;
+            }
+
+            private void ConvertToArray()
+            {
+                var array = new ushort[Math.Max(4, _count)];
+                var index = 0;
+                foreach (var value in Enumerate())
+                {
+                    array[index++] = (ushort)value;
+                }
+                _array = array;
+                _bitmap = null;
+            }
+        }
+    }
+}
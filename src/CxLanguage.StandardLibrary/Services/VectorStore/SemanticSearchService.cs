@@ -3,6 +3,7 @@ using System.Collections.Generic;
 using System.Diagnostics;
 using System.Linq;
 using System.Text.RegularExpressions;
+using System.Threading;
 using System.Threading.Tasks;
 using CxLanguage.Core.Events;
 using Microsoft.Extensions.AI;
@@ -30,6 +31,11 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         private readonly IVectorStoreService _vectorStore;
         private readonly IEmbeddingGenerator<string, Embedding<float>>? _embeddingGenerator;
 
+        // Keyword index, kept current through vector store record events
+        private readonly Bm25KeywordIndex _keywordIndex = new();
+        private readonly object _keywordIndexLock = new object();
+        private Task? _keywordIndexBuild;
+
         // Performance tracking
         private long _totalSearches = 0;
         private double _averageSearchTimeMs = 0;
@@ -73,15 +79,29 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     ["timestamp"] = DateTimeOffset.UtcNow
                 });
 
-                // Perform vector search using existing vector store capabilities
-                var vectorResults = await _vectorStore.SearchTextAsync(query, searchOptions.TopK * 2); // Get more results for filtering
+                await EnsureKeywordIndexAsync();
+                var queryTerms = ExtractQueryTerms(query);
+                var filter = MetadataFilter.Parse(searchOptions.Filters);
 
-                // Apply similarity threshold filtering
-                var filteredResults = vectorResults
-                    .Select((record, index) => new { Record = record, Index = index })
-                    .Where(x => CalculateRelevanceScore(x.Record, query) >= searchOptions.SimilarityThreshold)
-                    .Take(searchOptions.TopK)
-                    .ToList();
+                List<ScoredCandidate> filteredResults;
+                int recordsSearched;
+                if (searchOptions.Mode == SemanticSearchMode.Vector)
+                {
+                    // Perform vector search using existing vector store capabilities
+                    var vectorResults = (await _vectorStore.SearchTextAsync(query, searchOptions.TopK * 2, filter)).ToList(); // Get more results for filtering
+                    recordsSearched = vectorResults.Count;
+
+                    // Apply similarity threshold filtering
+                    filteredResults = vectorResults
+                        .Select(record => new ScoredCandidate(record, CalculateRelevanceScore(record, queryTerms), null))
+                        .Where(x => x.Score >= searchOptions.SimilarityThreshold)
+                        .Take(searchOptions.TopK)
+                        .ToList();
+                }
+                else
+                {
+                    (filteredResults, recordsSearched) = await RankWithKeywordIndexAsync(query, searchOptions, filter);
+                }
 
                 // Generate ranked results with snippets
                 var rankedResults = new List<RankedVectorRecord>();
@@ -92,7 +112,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     var rankedRecord = new RankedVectorRecord
                     {
                         Record = result.Record,
-                        SimilarityScore = CalculateRelevanceScore(result.Record, query),
+                        SimilarityScore = result.Score,
                         Rank = i + 1,
                         SearchMetadata = new Dictionary<string, object>
                         {
@@ -102,10 +122,18 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                         }
                     };
 
+                    if (result.Ranking != null)
+                    {
+                        foreach (var kvp in result.Ranking)
+                        {
+                            rankedRecord.SearchMetadata[kvp.Key] = kvp.Value;
+                        }
+                    }
+
                     // Generate snippet if requested
                     if (searchOptions.GenerateSnippets)
                     {
-                        rankedRecord.Snippet = await GenerateSnippetAsync(result.Record, query, searchOptions.SnippetLength);
+                        rankedRecord.Snippet = GenerateSnippet(result.Record, queryTerms, searchOptions.SnippetLength);
                     }
 
                     rankedResults.Add(rankedRecord);
@@ -119,11 +147,12 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     Results = rankedResults,
                     Query = query,
                     ProcessingTimeMs = stopwatch.ElapsedMilliseconds,
-                    TotalRecordsSearched = vectorResults.Count(),
+                    TotalRecordsSearched = recordsSearched,
                     ResultCount = rankedResults.Count,
                     SearchMetadata = new Dictionary<string, object>
                     {
                         ["search_type"] = "semantic_search",
+                        ["search_mode"] = searchOptions.Mode.ToString().ToLowerInvariant(),
                         ["consciousness_results"] = rankedResults.Count(r => r.SearchMetadata.GetValueOrDefault("consciousness_aware", false).Equals(true)),
                         ["performance_target"] = "200ms",
                         ["similarity_threshold"] = searchOptions.SimilarityThreshold
@@ -270,16 +299,18 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             {
                 var queryTerms = ExtractQueryTerms(query);
 
+                await EnsureKeywordIndexAsync();
+
                 foreach (var result in results)
                 {
-                    var snippet = await GenerateSnippetAsync(result, query, snippetLength);
+                    var snippet = GenerateSnippet(result, queryTerms, snippetLength);
                     var highlightedTerms = FindHighlightedTerms(snippet, queryTerms);
 
                     snippets.Add(new SearchSnippet
                     {
                         Text = snippet,
                         SourceRecordId = result.Id,
-                        RelevanceScore = CalculateSnippetRelevance(snippet, query),
+                        RelevanceScore = CalculateSnippetRelevance(snippet, queryTerms),
                         HighlightedTerms = highlightedTerms,
                         StartPosition = FindSnippetStartPosition(result.Content, snippet),
                         Length = snippet.Length
@@ -316,7 +347,10 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     ["natural_language_processing"] = true,
                     ["snippet_generation"] = true,
                     ["agent_context_support"] = true,
-                    ["embedding_generator_available"] = _embeddingGenerator != null
+                    ["embedding_generator_available"] = _embeddingGenerator != null,
+                    ["hybrid_search"] = true,
+                    ["keyword_index_documents"] = _keywordIndex.DocumentCount,
+                    ["keyword_index_terms"] = _keywordIndex.TermCount
                 };
 
                 _logger.LogInformation("📊 Semantic search metrics: {TotalSearches} searches, {AvgTime}ms average", 
@@ -362,6 +396,14 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                                 options.SnippetLength = snippetLength;
                             if (optionsDict.TryGetValue("includeMetadata", out var metadataObj) && metadataObj is bool includeMetadata)
                                 options.IncludeMetadata = includeMetadata;
+                            if (optionsDict.TryGetValue("mode", out var modeObj) && modeObj is string mode
+                                && Enum.TryParse<SemanticSearchMode>(mode, ignoreCase: true, out var searchMode))
+                                options.Mode = searchMode;
+                            if (optionsDict.TryGetValue("rrfK", out var rrfKObj) && rrfKObj is int rrfK)
+                                options.RrfK = rrfK;
+                            if ((optionsDict.TryGetValue("filters", out var filtersObj) || optionsDict.TryGetValue("filter", out filtersObj))
+                                && filtersObj is Dictionary<string, object> filters)
+                                options.Filters = filters;
                         }
 
                         // Perform search
@@ -444,6 +486,9 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                                 options.SimilarityThreshold = threshold;
                             if (optionsDict.TryGetValue("generateSnippets", out var snippetsObj) && snippetsObj is bool generateSnippets)
                                 options.GenerateSnippets = generateSnippets;
+                            if (optionsDict.TryGetValue("mode", out var modeObj) && modeObj is string mode
+                                && Enum.TryParse<SemanticSearchMode>(mode, ignoreCase: true, out var searchMode))
+                                options.Mode = searchMode;
                         }
 
                         // Extract agent context if provided
@@ -535,16 +580,158 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                 return true;
             });
 
+            // Keep the keyword index in step with the vector store
+            _eventBus.Subscribe("vectorstore.record.added", HandleRecordUpsertedAsync);
+            _eventBus.Subscribe("vectorstore.record.updated", HandleRecordUpsertedAsync);
+            _eventBus.Subscribe("vectorstore.record.deleted", (sender, eventName, payload) =>
+            {
+                if (payload?.TryGetValue("Id", out var idObj) == true && idObj is string id)
+                {
+                    _keywordIndex.Remove(id);
+                }
+                return Task.FromResult(true);
+            });
+            _eventBus.Subscribe("vectorstore.cleared", (sender, eventName, payload) =>
+            {
+                _keywordIndex.Clear();
+                return Task.FromResult(true);
+            });
+            _eventBus.Subscribe("vectorstore.persistence.loaded", (sender, eventName, payload) =>
+            {
+                // Loaded records arrive without per-record events; rebuild on the next search
+                lock (_keywordIndexLock)
+                {
+                    _keywordIndexBuild = null;
+                }
+                return Task.FromResult(true);
+            });
+
             _logger.LogInformation("✅ Semantic search event handlers registered successfully");
         }
 
+        /// <summary>
+        /// A candidate record with its score and, for keyword and hybrid ranking, the per-ranker details
+        /// </summary>
+        private readonly record struct ScoredCandidate(VectorRecord Record, double Score, Dictionary<string, object>? Ranking);
+
+        private Task<bool> HandleRecordUpsertedAsync(object? sender, string eventName, IDictionary<string, object>? payload)
+        {
+            if (payload?.TryGetValue("Id", out var idObj) == true && idObj is string id)
+            {
+                _keywordIndex.Upsert(id, payload.TryGetValue("Content", out var contentObj) ? contentObj as string ?? string.Empty : string.Empty);
+            }
+            return Task.FromResult(true);
+        }
+
+        /// <summary>
+        /// Index records that were in the store before this service observed its events.
+        /// Runs once, and again after the store loads persisted records.
+        /// </summary>
+        private Task EnsureKeywordIndexAsync()
+        {
+            lock (_keywordIndexLock)
+            {
+                return _keywordIndexBuild ??= BuildKeywordIndexAsync();
+            }
+        }
+
+        private async Task BuildKeywordIndexAsync()
+        {
+            // Only the in-memory store can enumerate its records; other stores are indexed from events alone
+            if (_vectorStore is not InMemoryVectorStoreService store)
+            {
+                return;
+            }
+
+            var stopwatch = Stopwatch.StartNew();
+            foreach (var id in await store.ListIdsAsync())
+            {
+                var record = await store.GetAsync(id);
+                if (record != null)
+                {
+                    _keywordIndex.Upsert(record.Id, record.Content);
+                }
+            }
+
+            _logger.LogDebug("🔤 Keyword index built with {DocumentCount} records and {TermCount} terms in {ElapsedMs}ms",
+                _keywordIndex.DocumentCount, _keywordIndex.TermCount, stopwatch.ElapsedMilliseconds);
+        }
+
+        /// <summary>
+        /// Keyword and hybrid ranking. Hybrid fuses the vector and BM25 rankings with reciprocal-rank fusion, which
+        /// needs no score calibration between the two; the fused score is normalized so a record ranked first by
+        /// every ranker scores 1.0.
+        /// </summary>
+        private async Task<(List<ScoredCandidate> Results, int Candidates)> RankWithKeywordIndexAsync(
+            string query, SemanticSearchOptions options, MetadataFilter filter)
+        {
+            var depth = Math.Max(1, options.TopK * 2);
+            var rrfK = Math.Max(0, options.RrfK);
+            var keywordTerms = Bm25KeywordIndex.Tokenize(query).Select(t => t.Term).Distinct().ToList();
+            var fused = new Dictionary<string, (VectorRecord? Record, double Fused, Dictionary<string, object> Ranking)>(StringComparer.Ordinal);
+            var rankers = 1;
+
+            if (options.Mode == SemanticSearchMode.Hybrid)
+            {
+                rankers = 2;
+                var vectorRank = 0;
+                foreach (var record in await _vectorStore.SearchTextAsync(query, depth, filter))
+                {
+                    vectorRank++;
+                    fused[record.Id] = (record, 1.0 / (rrfK + vectorRank), new Dictionary<string, object> { ["vector_rank"] = vectorRank });
+                }
+            }
+
+            // Restrict keyword scoring to the filter's candidates when the store can resolve them from its indexes
+            Func<string, bool>? include = null;
+            if (!filter.IsEmpty && _vectorStore is InMemoryVectorStoreService inMemoryStore
+                && inMemoryStore.ResolveCandidateIds(filter) is { } candidateIds)
+            {
+                var allowed = candidateIds as ISet<string> ?? new HashSet<string>(candidateIds, StringComparer.Ordinal);
+                include = allowed.Contains;
+            }
+
+            var keywordRank = 0;
+            foreach (var (id, bm25) in _keywordIndex.Search(keywordTerms, depth, include))
+            {
+                keywordRank++;
+                var entry = fused.TryGetValue(id, out var existing)
+                    ? existing
+                    : (Record: null, Fused: 0.0, Ranking: new Dictionary<string, object>());
+                entry.Ranking["keyword_rank"] = keywordRank;
+                entry.Ranking["bm25_score"] = bm25;
+                fused[id] = (entry.Record, entry.Fused + 1.0 / (rrfK + keywordRank), entry.Ranking);
+            }
+
+            var best = 1.0 / (rrfK + 1) * rankers;
+            var results = new List<ScoredCandidate>(options.TopK);
+            foreach (var (id, entry) in fused.OrderByDescending(kvp => kvp.Value.Fused))
+            {
+                if (results.Count >= options.TopK)
+                {
+                    break;
+                }
+
+                // Keyword-only hits are resolved from the store; ids removed since indexing are skipped
+                var record = entry.Record ?? await _vectorStore.GetAsync(id);
+                if (record == null || (include == null && !filter.Matches(record.Metadata)))
+                {
+                    continue;
+                }
+
+                entry.Ranking["rrf_score"] = entry.Fused;
+                results.Add(new ScoredCandidate(record, Math.Min(1.0, entry.Fused / best), entry.Ranking));
+            }
+
+            return (results, fused.Count);
+        }
+
         /// <summary>
         /// Calculate relevance score for a vector record
         /// </summary>
-        private double CalculateRelevanceScore(VectorRecord record, string query)
+        private double CalculateRelevanceScore(VectorRecord record, List<string> queryTerms)
         {
             // Basic relevance calculation - can be enhanced with more sophisticated scoring
-            var queryTerms = ExtractQueryTerms(query);
             var contentLower = record.Content.ToLowerInvariant();
             
             var termMatches = queryTerms.Count(term => contentLower.Contains(term.ToLowerInvariant()));
@@ -573,7 +760,7 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <summary>
         /// Generate a relevant snippet from content
         /// </summary>
-        private async Task<string> GenerateSnippetAsync(VectorRecord record, string query, int maxLength)
+        private string GenerateSnippet(VectorRecord record, List<string> queryTerms, int maxLength)
         {
             try
             {
@@ -583,21 +770,24 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
                     return content;
                 }
 
-                var queryTerms = ExtractQueryTerms(query);
-                
-                // Find the best position to extract snippet
-                var bestPosition = FindBestSnippetPosition(content, queryTerms, maxLength);
-                
-                // Extract snippet around best position
-                var start = Math.Max(0, bestPosition - maxLength / 2);
+                // Indexed records place the snippet from their stored term offsets; others fall back to a scan
+                int start;
+                if (_keywordIndex.TryGetTermOffsets(record.Id, queryTerms, out var offsets))
+                {
+                    start = FindBestSnippetStart(offsets, queryTerms, content.Length, maxLength);
+                }
+                else
+                {
+                    var bestPosition = FindBestSnippetPosition(content, queryTerms, maxLength);
+                    start = Math.Max(0, bestPosition - maxLength / 2);
+                }
+
                 var length = Math.Min(maxLength, content.Length - start);
                 
                 var snippet = content.Substring(start, length);
                 
                 // Clean up snippet boundaries
-                snippet = CleanSnippetBoundaries(snippet);
-                
-                return await Task.FromResult(snippet);
+                return CleanSnippetBoundaries(snippet);
             }
             catch (Exception ex)
             {
@@ -613,15 +803,59 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// </summary>
         private List<string> ExtractQueryTerms(string query)
         {
-            var terms = query.Split(new[] { ' ', ',', '.', '!', '?' }, StringSplitOptions.RemoveEmptyEntries)
+            // Same tokenization as the keyword index, so terms can be looked up in it directly
+            var terms = Bm25KeywordIndex.Tokenize(query)
+                .Select(token => token.Term)
                 .Where(term => term.Length > 2) // Filter out short words
-                .Select(term => term.Trim().ToLowerInvariant())
                 .Distinct()
                 .ToList();
 
             return terms;
         }
 
+        /// <summary>
+        /// Start of the snippet window covering the most distinct query terms, centered on the matched span.
+        /// Offsets are sorted; a two-pointer sweep keeps a count per term for the window.
+        /// </summary>
+        private static int FindBestSnippetStart(List<(int Offset, int TermIndex)> offsets, List<string> queryTerms, int contentLength, int maxLength)
+        {
+            if (offsets.Count == 0)
+            {
+                return 0;
+            }
+
+            var counts = new int[queryTerms.Count];
+            var distinct = 0;
+            var bestDistinct = 0;
+            var bestFirst = 0;
+            var bestLast = 0;
+            var right = 0;
+
+            for (int left = 0; left < offsets.Count; left++)
+            {
+                // A term longer than the window never enters it
+                right = Math.Max(right, left);
+                while (right < offsets.Count
+                    && offsets[right].Offset + queryTerms[offsets[right].TermIndex].Length <= offsets[left].Offset + maxLength)
+                {
+                    if (counts[offsets[right].TermIndex]++ == 0) distinct++;
+                    right++;
+                }
+
+                if (distinct > bestDistinct)
+                {
+                    bestDistinct = distinct;
+                    bestFirst = offsets[left].Offset;
+                    bestLast = offsets[right - 1].Offset + queryTerms[offsets[right - 1].TermIndex].Length;
+                }
+
+                if (right > left && --counts[offsets[left].TermIndex] == 0) distinct--;
+            }
+
+            var start = bestFirst - (maxLength - (bestLast - bestFirst)) / 2;
+            return Math.Clamp(start, 0, Math.Max(0, contentLength - maxLength));
+        }
+
         /// <summary>
         /// Find best position for snippet extraction
         /// </summary>
@@ -655,12 +889,11 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
             if (string.IsNullOrEmpty(snippet))
                 return snippet;
 
-            // Find word boundaries
-            var sentences = snippet.Split('.', StringSplitOptions.RemoveEmptyEntries);
-            if (sentences.Length > 1)
+            // Return complete sentences
+            var lastPeriod = snippet.LastIndexOf('.');
+            if (lastPeriod > 0)
             {
-                // Return complete sentences
-                return string.Join(". ", sentences.Take(sentences.Length - 1)) + ".";
+                return snippet.Substring(0, lastPeriod + 1);
             }
 
             // If no sentences, try to break at word boundaries
@@ -772,9 +1005,8 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <summary>
         /// Calculate snippet relevance score
         /// </summary>
-        private double CalculateSnippetRelevance(string snippet, string query)
+        private double CalculateSnippetRelevance(string snippet, List<string> queryTerms)
         {
-            var queryTerms = ExtractQueryTerms(query);
             var snippetLower = snippet.ToLowerInvariant();
             
             var termMatches = queryTerms.Count(term => snippetLower.Contains(term.ToLowerInvariant()));
@@ -0,0 +1,198 @@
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Runtime.Intrinsics;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// SIMD kernels for vector search. Uses 512-bit vectors when AVX-512 is available, then 256-bit (AVX2/NEON pairs),
+    /// then 128-bit, with a scalar tail for the remaining elements.
+    /// </summary>
+    internal static class VectorKernels
+    {
+        /// <summary>
+        /// Dot product of two equally sized spans
+        /// </summary>
+        public static float Dot(ReadOnlySpan<float> left, ReadOnlySpan<float> right)
+        {
+            if (left.Length != right.Length)
+            {
+                throw new ArgumentException("Vectors must have the same dimension.");
+            }
+
+            ref var leftRef = ref MemoryMarshal.GetReference(left);
+            ref var rightRef = ref MemoryMarshal.GetReference(right);
+            var length = (nuint)left.Length;
+            nuint i = 0;
+            float sum = 0f;
+
+            if (Vector512.IsHardwareAccelerated && length >= (nuint)Vector512<float>.Count)
+            {
+                var accumulator = Vector512<float>.Zero;
+                var last = length - (nuint)Vector512<float>.Count;
+                for (; i <= last; i += (nuint)Vector512<float>.Count)
+                {
+                    accumulator += Vector512.LoadUnsafe(ref leftRef, i) * Vector512.LoadUnsafe(ref rightRef, i);
+                }
+                sum = Vector512.Sum(accumulator);
+            }
+            else if (Vector256.IsHardwareAccelerated && length >= (nuint)Vector256<float>.Count)
+            {
+                // Two accumulators hide the add latency on the common 384/768/1536 dimensions
+                var accumulator0 = Vector256<float>.Zero;
+                var accumulator1 = Vector256<float>.Zero;
+                var step = (nuint)Vector256<float>.Count;
+                for (; i + 2 * step <= length; i += 2 * step)
+                {
+                    accumulator0 += Vector256.LoadUnsafe(ref leftRef, i) * Vector256.LoadUnsafe(ref rightRef, i);
+                    accumulator1 += Vector256.LoadUnsafe(ref leftRef, i + step) * Vector256.LoadUnsafe(ref rightRef, i + step);
+                }
+                if (i + step <= length)
+                {
+                    accumulator0 += Vector256.LoadUnsafe(ref leftRef, i) * Vector256.LoadUnsafe(ref rightRef, i);
+                    i += step;
+                }
+                sum = Vector256.Sum(accumulator0 + accumulator1);
+            }
+            else if (Vector128.IsHardwareAccelerated && length >= (nuint)Vector128<float>.Count)
+            {
+                var accumulator = Vector128<float>.Zero;
+                var last = length - (nuint)Vector128<float>.Count;
+                for (; i <= last; i += (nuint)Vector128<float>.Count)
+                {
+                    accumulator += Vector128.LoadUnsafe(ref leftRef, i) * Vector128.LoadUnsafe(ref rightRef, i);
+                }
+                sum = Vector128.Sum(accumulator);
+            }
+
+            for (; i < length; i++)
+            {
+                sum += Unsafe.Add(ref leftRef, i) * Unsafe.Add(ref rightRef, i);
+            }
+
+            return sum;
+        }
+
+        /// <summary>
+        /// Write the unit-length version of source into destination. Zero vectors stay zero, so they score 0 against
+        /// every query, matching the previous cosine similarity behaviour.
+        /// </summary>
+        public static void Normalize(ReadOnlySpan<float> source, Span<float> destination)
+        {
+            var magnitude = MathF.Sqrt(Dot(source, source));
+            if (magnitude == 0f || float.IsNaN(magnitude))
+            {
+                destination.Slice(0, source.Length).Clear();
+                return;
+            }
+
+            var scale = 1f / magnitude;
+            for (int i = 0; i < source.Length; i++)
+            {
+                destination[i] = source[i] * scale;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Bounded min-heap that keeps the K highest scoring slots seen so far.
+    /// Each insert is O(log K) and rejected candidates cost a single comparison against the root.
+    /// </summary>
+    internal sealed class TopKHeap
+    {
+        private readonly float[] _scores;
+        private readonly int[] _slots;
+        private int _count;
+
+        public TopKHeap(int capacity)
+        {
+            _scores = new float[capacity];
+            _slots = new int[capacity];
+        }
+
+        public int Count => _count;
+
+        /// <summary>
+        /// Lowest score currently kept; candidates at or below it are rejected once the heap is full
+        /// </summary>
+        public float Threshold => _count < _scores.Length ? float.NegativeInfinity : _scores[0];
+
+        public void Add(float score, int slot)
+        {
+            if (_count < _scores.Length)
+            {
+                // Sift up
+                var index = _count++;
+                while (index > 0)
+                {
+                    var parent = (index - 1) >> 1;
+                    if (_scores[parent] <= score)
+                    {
+                        break;
+                    }
+                    _scores[index] = _scores[parent];
+                    _slots[index] = _slots[parent];
+                    index = parent;
+                }
+                _scores[index] = score;
+                _slots[index] = slot;
+                return;
+            }
+
+            if (_scores.Length == 0 || score <= _scores[0])
+            {
+                return;
+            }
+
+            // Replace the root and sift down
+            var position = 0;
+            while (true)
+            {
+                var child = 2 * position + 1;
+                if (child >= _count)
+                {
+                    break;
+                }
+                if (child + 1 < _count && _scores[child + 1] < _scores[child])
+                {
+                    child++;
+                }
+                if (_scores[child] >= score)
+                {
+                    break;
+                }
+                _scores[position] = _scores[child];
+                _slots[position] = _slots[child];
+                position = child;
+            }
+            _scores[position] = score;
+            _slots[position] = slot;
+        }
+
+        /// <summary>
+        /// Merge another heap's entries into this one
+        /// </summary>
+        public void AddRange(TopKHeap other)
+        {
+            for (int i = 0; i < other._count; i++)
+            {
+                Add(other._scores[i], other._slots[i]);
+            }
+        }
+
+        /// <summary>
+        /// Entries ordered from highest to lowest score
+        /// </summary>
+        public (int Slot, float Score)[] ToSortedArray()
+        {
+            var results = new (int Slot, float Score)[_count];
+            for (int i = 0; i < _count; i++)
+            {
+                results[i] = (_slots[i], _scores[i]);
+            }
+            Array.Sort(results, static (a, b) => b.Score.CompareTo(a.Score));
+            return results;
+        }
+    }
+}
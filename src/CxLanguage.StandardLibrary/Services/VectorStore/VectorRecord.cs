@@ -1,5 +1,6 @@
 using System;
 using System.Collections.Generic;
+using System.Threading;
 
 namespace CxLanguage.StandardLibrary.Services.VectorStore
 {
@@ -9,6 +10,9 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
     /// </summary>
     public class VectorRecord
     {
+        // The vector itself, or the MappedVectorRow it is read from when the store keeps it in a mapped segment
+        private object _vector = Array.Empty<float>();
+
         /// <summary>
         /// A unique identifier for the vector record.
         /// </summary>
@@ -17,7 +21,32 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// <summary>
         /// The vector embedding.
         /// </summary>
-        public float[] Vector { get; set; } = Array.Empty<float>();
+        public float[] Vector
+        {
+            get
+            {
+                while (true)
+                {
+                    var source = Volatile.Read(ref _vector);
+                    if (source is not MappedVectorRow mapped)
+                    {
+                        return (float[])source;
+                    }
+
+                    // Move a mapped vector onto the heap once, so every read returns the same array and writes
+                    // into it are kept
+                    try
+                    {
+                        TryReplaceVectorSource(mapped, mapped.Segment.ReadVector(mapped.Row));
+                    }
+                    catch (ObjectDisposedException) when (!ReferenceEquals(source, Volatile.Read(ref _vector)))
+                    {
+                        // The segment was released after moving this record elsewhere; read it from there
+                    }
+                }
+            }
+            set => Volatile.Write(ref _vector, value);
+        }
 
         /// <summary>
         /// The original content that was vectorized.
@@ -33,6 +62,98 @@ namespace CxLanguage.StandardLibrary.Services.VectorStore
         /// The timestamp when the record was created.
         /// </summary>
         public DateTimeOffset CreatedAt { get; set; } = DateTimeOffset.UtcNow;
+
+        /// <summary>
+        /// The float[] or MappedVectorRow currently backing Vector
+        /// </summary>
+        internal object VectorSource => Volatile.Read(ref _vector);
+
+        internal bool TryReplaceVectorSource(object expected, object replacement) =>
+            ReferenceEquals(Interlocked.CompareExchange(ref _vector, replacement, expected), expected);
+
+        /// <summary>
+        /// Number of elements in the vector, without reading a mapped row
+        /// </summary>
+        internal int VectorLength => Volatile.Read(ref _vector) switch
+        {
+            MappedVectorRow mapped => mapped.Segment.Dimension,
+            float[] vector => vector.Length,
+            _ => 0
+        };
+
+        /// <summary>
+        /// The vector without moving a mapped record onto the heap: the record's own array, or the mapped row
+        /// copied into scratch (or into a new array when scratch is too small)
+        /// </summary>
+        internal ReadOnlySpan<float> ReadVector(Span<float> scratch)
+        {
+            while (true)
+            {
+                var source = Volatile.Read(ref _vector);
+                if (source is not MappedVectorRow mapped)
+                {
+                    return (float[])source;
+                }
+
+                try
+                {
+                    if (scratch.Length < mapped.Segment.Dimension)
+                    {
+                        return mapped.Segment.ReadVector(mapped.Row);
+                    }
+                    mapped.Segment.ReadVector(mapped.Row, scratch);
+                    return scratch.Slice(0, mapped.Segment.Dimension);
+                }
+                catch (ObjectDisposedException) when (!ReferenceEquals(source, Volatile.Read(ref _vector)))
+                {
+                    // Released concurrently; retry from the record's new source
+                }
+            }
+        }
+
+        /// <summary>
+        /// A copy of the vector that leaves a mapped record reading from its segment
+        /// </summary>
+        internal float[] CopyVector()
+        {
+            var copy = new float[VectorLength];
+            return TryCopyVector(copy) ? copy : ReadVector(Span<float>.Empty).ToArray();
+        }
+
+        /// <summary>
+        /// Copy the vector into destination without allocating; false when its dimension differs
+        /// </summary>
+        internal bool TryCopyVector(Span<float> destination)
+        {
+            while (true)
+            {
+                var source = Volatile.Read(ref _vector);
+                if (source is not MappedVectorRow mapped)
+                {
+                    var vector = (float[])source;
+                    if (vector == null || vector.Length != destination.Length)
+                    {
+                        return false;
+                    }
+                    vector.CopyTo(destination);
+                    return true;
+                }
+
+                if (mapped.Segment.Dimension != destination.Length)
+                {
+                    return false;
+                }
+
+                try
+                {
+                    mapped.Segment.ReadVector(mapped.Row, destination);
+                    return true;
+                }
+                catch (ObjectDisposedException) when (!ReferenceEquals(source, Volatile.Read(ref _vector)))
+                {
+                    // Released concurrently; retry from the record's new source
+                }
+            }
+        }
     }
 }
-
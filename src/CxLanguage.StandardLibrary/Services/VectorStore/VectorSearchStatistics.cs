@@ -0,0 +1,91 @@
+using System;
+using System.Collections.Generic;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Search latency percentiles over a sliding window of recent queries, plus sampled recall@K for
+    /// approximate indexes
+    /// </summary>
+    internal sealed class VectorSearchStatistics
+    {
+        private const int LatencyWindow = 1024;
+
+        private readonly object _lock = new();
+        private readonly double[] _latenciesMs = new double[LatencyWindow];
+        private int _latencyCount;
+        private int _latencyNext;
+        private long _totalSearches;
+        private double _recallSum;
+        private long _recallSamples;
+
+        public void RecordLatency(double milliseconds)
+        {
+            lock (_lock)
+            {
+                _latenciesMs[_latencyNext] = milliseconds;
+                _latencyNext = (_latencyNext + 1) % LatencyWindow;
+                _latencyCount = Math.Min(_latencyCount + 1, LatencyWindow);
+                _totalSearches++;
+            }
+        }
+
+        /// <summary>
+        /// Record the overlap between an approximate result and the exact top-K for the same query
+        /// </summary>
+        public void RecordRecall(IReadOnlyList<(string Id, float Score)> approximate, IReadOnlyList<(string Id, float Score)> exact)
+        {
+            if (exact.Count == 0)
+            {
+                return;
+            }
+
+            var expected = new HashSet<string>(StringComparer.Ordinal);
+            foreach (var (id, _) in exact)
+            {
+                expected.Add(id);
+            }
+
+            var hits = 0;
+            foreach (var (id, _) in approximate)
+            {
+                if (expected.Contains(id)) hits++;
+            }
+
+            lock (_lock)
+            {
+                _recallSum += (double)hits / exact.Count;
+                _recallSamples++;
+            }
+        }
+
+        public void AddMetrics(Dictionary<string, object> metrics)
+        {
+            double[] window;
+            lock (_lock)
+            {
+                window = new double[_latencyCount];
+                Array.Copy(_latenciesMs, window, _latencyCount);
+                metrics["search_count"] = _totalSearches;
+                metrics["recall_samples"] = _recallSamples;
+                metrics["recall_at_k"] = _recallSamples == 0 ? 1.0 : _recallSum / _recallSamples;
+            }
+
+            Array.Sort(window);
+            metrics["search_latency_p50_ms"] = Percentile(window, 0.50);
+            metrics["search_latency_p99_ms"] = Percentile(window, 0.99);
+            metrics["search_latency_max_ms"] = window.Length == 0 ? 0.0 : window[^1];
+        }
+
+        private static double Percentile(double[] sorted, double percentile)
+        {
+            if (sorted.Length == 0)
+            {
+                return 0.0;
+            }
+
+            var index = (int)Math.Ceiling(percentile * sorted.Length) - 1;
+            return sorted[Math.Clamp(index, 0, sorted.Length - 1)];
+        }
+    }
+}
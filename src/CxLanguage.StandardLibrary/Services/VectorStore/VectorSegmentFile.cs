@@ -0,0 +1,475 @@
+using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using System.Threading;
+using CxLanguage.Core.Serialization;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Single-file columnar snapshot of a vector store.
+    ///
+    /// Layout (little-endian):
+    ///   [0, 64)            header: magic "CXVSEG01", version, dimension, record count, block offsets
+    ///   [vectorOffset, …)  record count x dimension fp32 values, row-major, 64-byte aligned
+    ///   [metadataOffset, …) compact UTF-8 JSON per record (id, content, createdAt, metadata)
+    ///   [indexOffset, …)   record count + 1 int64 offsets of each JSON entry relative to metadataOffset
+    ///
+    /// Readers map the file with MemoryMappedFile, so loading is a sequential read of the mapped pages instead of
+    /// two file opens per record, and the page cache serves repeated loads.
+    /// </summary>
+    internal static class VectorSegmentFile
+    {
+        public const string FileName = "vectors.cxseg";
+
+        internal const int HeaderSize = 64;
+        private const int Alignment = 64;
+        internal const int FormatVersion = 1;
+        internal static ReadOnlySpan<byte> Magic => "CXVSEG01"u8;
+
+        /// <summary>
+        /// Write a snapshot to path atomically (temporary file plus rename). Records whose vector dimension differs
+        /// from the first record's are skipped and counted in the result.
+        /// </summary>
+        public static (int Written, int Skipped, long Bytes) Write(string path, IReadOnlyList<VectorRecord> records) =>
+            Write(path, records, beforeReplace: null);
+
+        /// <summary>
+        /// Write a snapshot as above. beforeReplace runs once the snapshot is complete under its temporary name and
+        /// before it replaces path, with that temporary path and the records written in row order.
+        /// </summary>
+        public static (int Written, int Skipped, long Bytes) Write(
+            string path,
+            IReadOnlyList<VectorRecord> records,
+            Action<string, IReadOnlyList<VectorRecord>>? beforeReplace)
+        {
+            var dimension = records.Count == 0 ? 0 : records[0].VectorLength;
+            var accepted = new List<VectorRecord>(records.Count);
+            foreach (var record in records)
+            {
+                if (record.VectorLength == dimension)
+                {
+                    accepted.Add(record);
+                }
+            }
+
+            // A temporary file left by a failed save may still be mapped; unlink it rather than truncate it
+            var temporaryPath = path + ".tmp";
+            File.Delete(temporaryPath);
+
+            long length;
+            using (var stream = new FileStream(temporaryPath, FileMode.CreateNew, FileAccess.Write, FileShare.None, 1 << 20))
+            {
+                // Header is written last, once the block offsets are known
+                stream.Write(new byte[HeaderSize]);
+
+                // Records still reading from a mapped segment are copied through one scratch row
+                var vectorOffset = stream.Position;
+                var scratch = new float[dimension];
+                foreach (var record in accepted)
+                {
+                    stream.Write(MemoryMarshal.AsBytes(record.ReadVector(scratch)));
+                }
+
+                WritePadding(stream);
+                var metadataOffset = stream.Position;
+                var entryOffsets = new long[accepted.Count + 1];
+                var buffer = new ArrayBufferWriter<byte>(4096);
+                using (var writer = new Utf8JsonWriter(buffer))
+                {
+                    for (int i = 0; i < accepted.Count; i++)
+                    {
+                        entryOffsets[i] = stream.Position - metadataOffset;
+                        buffer.Clear();
+                        writer.Reset(buffer);
+                        VectorRecordSerializer.WriteRecord(writer, accepted[i]);
+                        writer.Flush();
+                        stream.Write(buffer.WrittenSpan);
+                    }
+                }
+                entryOffsets[accepted.Count] = stream.Position - metadataOffset;
+
+                WritePadding(stream);
+                var indexOffset = stream.Position;
+                stream.Write(MemoryMarshal.AsBytes(entryOffsets.AsSpan()));
+
+                var header = new byte[HeaderSize];
+                Magic.CopyTo(header);
+                BinaryPrimitives.WriteInt32LittleEndian(header.AsSpan(8), FormatVersion);
+                BinaryPrimitives.WriteInt32LittleEndian(header.AsSpan(12), dimension);
+                BinaryPrimitives.WriteInt64LittleEndian(header.AsSpan(16), accepted.Count);
+                BinaryPrimitives.WriteInt64LittleEndian(header.AsSpan(24), vectorOffset);
+                BinaryPrimitives.WriteInt64LittleEndian(header.AsSpan(32), metadataOffset);
+                BinaryPrimitives.WriteInt64LittleEndian(header.AsSpan(40), indexOffset);
+                stream.Position = 0;
+                stream.Write(header);
+
+                length = stream.Length;
+                stream.Flush(flushToDisk: true);
+            }
+
+            beforeReplace?.Invoke(temporaryPath, accepted);
+            File.Move(temporaryPath, path, overwrite: true);
+            return (accepted.Count, records.Count - accepted.Count, length);
+        }
+
+        /// <summary>
+        /// Read every record of a segment, copying each vector onto the heap. Returns the number of records read.
+        /// </summary>
+        public static int Read(string path, Action<VectorRecord> onRecord)
+        {
+            using var segment = MappedVectorSegment.Open(path);
+            for (int row = 0; row < segment.Count; row++)
+            {
+                onRecord(segment.ReadRecord(row, mapVector: false));
+            }
+            return segment.Count;
+        }
+
+        private static void WritePadding(Stream stream)
+        {
+            var padding = (int)((Alignment - stream.Position % Alignment) % Alignment);
+            if (padding > 0)
+            {
+                stream.Write(new byte[padding]);
+            }
+        }
+    }
+
+    /// <summary>
+    /// A segment file kept mapped so its records can leave their vectors in the mapping: such a record's Vector
+    /// reads a fresh copy of its row, and exact scoring reads the row in place.
+    ///
+    /// The segment remembers the records it maps. Release copies the vector of each one still reading from it
+    /// back onto the heap before unmapping the file, so a segment can be released before its file is replaced
+    /// without invalidating records that callers still hold.
+    /// </summary>
+    internal sealed class MappedVectorSegment : IDisposable
+    {
+        private readonly MemoryMappedFile _file;
+        private readonly MemoryMappedViewAccessor _view;
+        private readonly long _vectorOffset;
+        private readonly long _metadataOffset;
+        private readonly long[] _entryOffsets;
+        private readonly VectorRecord?[] _mappedRecords;
+
+        private MappedVectorSegment(string path, MemoryMappedFile file, MemoryMappedViewAccessor view,
+            int dimension, int count, long vectorOffset, long metadataOffset, long[] entryOffsets)
+        {
+            Path = path;
+            _file = file;
+            _view = view;
+            Dimension = dimension;
+            Count = count;
+            _vectorOffset = vectorOffset;
+            _metadataOffset = metadataOffset;
+            _entryOffsets = entryOffsets;
+            _mappedRecords = new VectorRecord?[count];
+        }
+
+        /// <summary>
+        /// Path the segment was saved to, which can differ from the file mapped while a save is completing
+        /// </summary>
+        public string Path { get; }
+
+        public int Dimension { get; }
+
+        public int Count { get; }
+
+        /// <summary>
+        /// Map a segment file. The file stays open for reading and deletion by others, so it can be replaced
+        /// while mapped on platforms that allow it.
+        /// </summary>
+        public static MappedVectorSegment Open(string path, string? savedPath = null)
+        {
+            if (!BitConverter.IsLittleEndian)
+            {
+                throw new PlatformNotSupportedException("Vector segments are stored little-endian");
+            }
+
+            var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read | FileShare.Delete);
+            MemoryMappedFile? file = null;
+            MemoryMappedViewAccessor? view = null;
+            try
+            {
+                var fileLength = stream.Length;
+                if (fileLength < VectorSegmentFile.HeaderSize)
+                {
+                    throw new InvalidDataException($"Vector segment {path} is truncated");
+                }
+
+                file = MemoryMappedFile.CreateFromFile(stream, null, 0, MemoryMappedFileAccess.Read, HandleInheritability.None, leaveOpen: false);
+                view = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+
+                var header = new byte[VectorSegmentFile.HeaderSize];
+                view.ReadArray(0, header, 0, header.Length);
+                if (!header.AsSpan(0, 8).SequenceEqual(VectorSegmentFile.Magic))
+                {
+                    throw new InvalidDataException($"{path} is not a CX vector segment");
+                }
+
+                var version = BinaryPrimitives.ReadInt32LittleEndian(header.AsSpan(8));
+                if (version != VectorSegmentFile.FormatVersion)
+                {
+                    throw new InvalidDataException($"Unsupported vector segment version {version}");
+                }
+
+                var dimension = BinaryPrimitives.ReadInt32LittleEndian(header.AsSpan(12));
+                var count = checked((int)BinaryPrimitives.ReadInt64LittleEndian(header.AsSpan(16)));
+                var vectorOffset = BinaryPrimitives.ReadInt64LittleEndian(header.AsSpan(24));
+                var metadataOffset = BinaryPrimitives.ReadInt64LittleEndian(header.AsSpan(32));
+                var indexOffset = BinaryPrimitives.ReadInt64LittleEndian(header.AsSpan(40));
+
+                if (dimension < 0 || count < 0
+                    || vectorOffset + (long)count * dimension * sizeof(float) > metadataOffset
+                    || indexOffset + (count + 1L) * sizeof(long) > fileLength)
+                {
+                    throw new InvalidDataException($"Vector segment {path} has an inconsistent header");
+                }
+
+                var entryOffsets = new long[count + 1];
+                view.ReadArray(indexOffset, entryOffsets, 0, entryOffsets.Length);
+
+                return new MappedVectorSegment(savedPath ?? path, file, view, dimension, count, vectorOffset, metadataOffset, entryOffsets);
+            }
+            catch
+            {
+                view?.Dispose();
+                if (file != null) file.Dispose(); else stream.Dispose();
+                throw;
+            }
+        }
+
+        /// <summary>
+        /// Decode the record in a row. With mapVector the record reads its vector from this segment instead of
+        /// holding a copy.
+        /// </summary>
+        public VectorRecord ReadRecord(int row, bool mapVector)
+        {
+            var entryLength = checked((int)(_entryOffsets[row + 1] - _entryOffsets[row]));
+            var jsonBuffer = ArrayPool<byte>.Shared.Rent(entryLength);
+            try
+            {
+                _view.ReadArray(_metadataOffset + _entryOffsets[row], jsonBuffer, 0, entryLength);
+                var vector = mapVector ? Array.Empty<float>() : ReadVector(row);
+                var record = VectorRecordSerializer.ReadRecord(jsonBuffer.AsSpan(0, entryLength), vector);
+                if (mapVector)
+                {
+                    MapRecord(record, row);
+                }
+                return record;
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(jsonBuffer);
+            }
+        }
+
+        /// <summary>
+        /// Point a record at one of this segment's rows, unless its vector changed since expectedSource was read
+        /// </summary>
+        public bool TryMapRecord(VectorRecord record, int row, object expectedSource)
+        {
+            var mappedRow = new MappedVectorRow(this, row);
+            if (!record.TryReplaceVectorSource(expectedSource, mappedRow))
+            {
+                return false;
+            }
+
+            Volatile.Write(ref _mappedRecords[row], record);
+            return true;
+        }
+
+        public float[] ReadVector(int row)
+        {
+            var vector = new float[Dimension];
+            ReadVector(row, vector);
+            return vector;
+        }
+
+        public void ReadVector(int row, Span<float> destination)
+        {
+            if ((uint)row >= (uint)Count)
+            {
+                throw new ArgumentOutOfRangeException(nameof(row));
+            }
+
+            var offset = _view.PointerOffset + _vectorOffset + (long)row * Dimension * sizeof(float);
+            _view.SafeMemoryMappedViewHandle.ReadSpan((ulong)offset, destination.Slice(0, Dimension));
+        }
+
+        /// <summary>
+        /// Copy the vector of every record still reading from this segment back onto the heap, then unmap the file.
+        /// Records the store keeps are moved to the replacing segment with TryMapRecord beforehand.
+        /// </summary>
+        public void Release()
+        {
+            for (int row = 0; row < _mappedRecords.Length; row++)
+            {
+                var record = _mappedRecords[row];
+                if (record?.VectorSource is MappedVectorRow mapped && mapped.Segment == this)
+                {
+                    record.TryReplaceVectorSource(mapped, ReadVector(mapped.Row));
+                }
+            }
+
+            Array.Clear(_mappedRecords);
+            Dispose();
+        }
+
+        public void Dispose()
+        {
+            _view.Dispose();
+            _file.Dispose();
+        }
+
+        private void MapRecord(VectorRecord record, int row)
+        {
+            record.TryReplaceVectorSource(record.VectorSource, new MappedVectorRow(this, row));
+            _mappedRecords[row] = record;
+        }
+    }
+
+    /// <summary>
+    /// Location of a record's vector inside a mapped segment
+    /// </summary>
+    internal sealed record MappedVectorRow(MappedVectorSegment Segment, int Row);
+
+    /// <summary>
+    /// Compact JSON form of a record's non-vector fields, shared by the segment file and the write-ahead log
+    /// </summary>
+    internal static class VectorRecordSerializer
+    {
+        // Metadata values are CX primitives, maps and arrays, which have generated metadata; other types use reflection
+        private static readonly JsonSerializerOptions MetadataOptions = new()
+        {
+            TypeInfoResolver = CxJsonSerializerContext.WithReflectionFallback()
+        };
+
+        public static void WriteRecord(Utf8JsonWriter writer, VectorRecord record)
+        {
+            writer.WriteStartObject();
+            writer.WriteString("Id", record.Id);
+            writer.WriteString("Content", record.Content);
+            writer.WriteString("CreatedAt", record.CreatedAt);
+            writer.WritePropertyName("Metadata");
+            JsonSerializer.Serialize(writer, record.Metadata, MetadataOptions);
+            writer.WriteEndObject();
+        }
+
+        public static byte[] SerializeRecord(VectorRecord record)
+        {
+            var buffer = new ArrayBufferWriter<byte>(256);
+            using (var writer = new Utf8JsonWriter(buffer))
+            {
+                WriteRecord(writer, record);
+            }
+            return buffer.WrittenSpan.ToArray();
+        }
+
+        /// <summary>
+        /// Decode a record with a single forward pass of Utf8JsonReader; only nested metadata values build a
+        /// JsonDocument
+        /// </summary>
+        public static VectorRecord ReadRecord(ReadOnlySpan<byte> json, float[] vector)
+        {
+            var record = new VectorRecord
+            {
+                Id = "",
+                Content = "",
+                Vector = vector,
+                Metadata = new Dictionary<string, object>()
+            };
+
+            var reader = new Utf8JsonReader(json);
+            reader.Read();
+            while (reader.Read() && reader.TokenType == JsonTokenType.PropertyName)
+            {
+                if (reader.ValueTextEquals("Metadata"u8))
+                {
+                    reader.Read();
+                    if (reader.TokenType == JsonTokenType.StartObject)
+                    {
+                        ReadMetadata(ref reader, record.Metadata);
+                    }
+                    else
+                    {
+                        reader.Skip();
+                    }
+                    continue;
+                }
+
+                if (reader.ValueTextEquals("Id"u8))
+                {
+                    reader.Read();
+                    record.Id = reader.GetString() ?? "";
+                }
+                else if (reader.ValueTextEquals("Content"u8))
+                {
+                    reader.Read();
+                    record.Content = reader.GetString() ?? "";
+                }
+                else if (reader.ValueTextEquals("CreatedAt"u8))
+                {
+                    reader.Read();
+                    record.CreatedAt = reader.GetDateTimeOffset();
+                }
+                else
+                {
+                    reader.Read();
+                    reader.Skip();
+                }
+            }
+
+            if (string.IsNullOrEmpty(record.Id))
+            {
+                record.Id = Guid.NewGuid().ToString();
+            }
+
+            return record;
+        }
+
+        private static void ReadMetadata(ref Utf8JsonReader reader, Dictionary<string, object> metadata)
+        {
+            while (reader.Read() && reader.TokenType == JsonTokenType.PropertyName)
+            {
+                var name = reader.GetString()!;
+                reader.Read();
+                metadata[name] = reader.TokenType switch
+                {
+                    JsonTokenType.String => reader.GetString() ?? "",
+                    JsonTokenType.Number => reader.GetDouble(),
+                    JsonTokenType.True => true,
+                    JsonTokenType.False => false,
+                    _ => ReadNestedValue(ref reader)
+                };
+            }
+        }
+
+        private static object ReadNestedValue(ref Utf8JsonReader reader)
+        {
+            using var document = JsonDocument.ParseValue(ref reader);
+            return ConvertMetadataValue(document.RootElement);
+        }
+
+        /// <summary>
+        /// Metadata values come back as string, double or bool; anything else as its JSON text
+        /// </summary>
+        public static object ConvertMetadataValue(JsonElement value)
+        {
+            return value.ValueKind switch
+            {
+                JsonValueKind.String => value.GetString() ?? "",
+                JsonValueKind.Number => value.GetDouble(),
+                JsonValueKind.True => true,
+                JsonValueKind.False => false,
+                _ => value.ToString() ?? ""
+            };
+        }
+    }
+}
@@ -0,0 +1,101 @@
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    /// <summary>
+    /// Similarity index used by InMemoryVectorStoreService
+    /// </summary>
+    public enum VectorIndexType
+    {
+        /// <summary>
+        /// Exact brute-force SIMD scan. Best below a few hundred thousand records.
+        /// </summary>
+        Flat,
+
+        /// <summary>
+        /// Hierarchical Navigable Small World graph. Approximate, sub-linear search for large corpora.
+        /// </summary>
+        Hnsw
+    }
+
+    /// <summary>
+    /// Compression applied to vectors held by the flat index
+    /// </summary>
+    public enum VectorQuantization
+    {
+        /// <summary>
+        /// Full fp32 vectors
+        /// </summary>
+        None,
+
+        /// <summary>
+        /// int8 scalar quantization with a per-vector scale (about 4x smaller)
+        /// </summary>
+        Int8,
+
+        /// <summary>
+        /// Product quantization, one byte per subvector (16x or more smaller)
+        /// </summary>
+        Product
+    }
+
+    /// <summary>
+    /// Configuration for InMemoryVectorStoreService, bound from the "VectorStore" configuration section
+    /// </summary>
+    public class VectorStoreOptions
+    {
+        public const string SectionName = "VectorStore";
+
+        public VectorIndexType IndexType { get; set; } = VectorIndexType.Flat;
+
+        /// <summary>
+        /// HNSW: neighbours kept per node on the upper layers (twice this on layer 0)
+        /// </summary>
+        public int HnswM { get; set; } = 16;
+
+        /// <summary>
+        /// HNSW: candidate list size while inserting; higher builds a better graph more slowly
+        /// </summary>
+        public int HnswEfConstruction { get; set; } = 200;
+
+        /// <summary>
+        /// HNSW: candidate list size while searching; higher trades latency for recall
+        /// </summary>
+        public int HnswEfSearch { get; set; } = 64;
+
+        /// <summary>
+        /// Codec for the flat index. Quantized searches re-rank their candidates with the records' exact vectors.
+        /// Ignored by the HNSW index, which navigates on full-precision vectors.
+        /// </summary>
+        public VectorQuantization Quantization { get; set; } = VectorQuantization.None;
+
+        /// <summary>
+        /// Product quantization: number of subvectors (bytes per code). 0 picks dimension / 4, a 16x reduction from fp32.
+        /// </summary>
+        public int PqSubvectors { get; set; } = 0;
+
+        /// <summary>
+        /// Product quantization: vectors collected (and searched exactly) before the codebooks are trained
+        /// </summary>
+        public int QuantizationTrainingSize { get; set; } = 10_000;
+
+        /// <summary>
+        /// Quantized search keeps RerankFactor x topK candidates for exact re-ranking
+        /// </summary>
+        public int RerankFactor { get; set; } = 4;
+
+        /// <summary>
+        /// Every Nth search of an approximate index is repeated exactly to measure recall@K. 0 disables sampling.
+        /// </summary>
+        public int RecallSampleInterval { get; set; } = 100;
+
+        /// <summary>
+        /// Automatic persistence folds the write-ahead log into a new segment file once the log reaches this size
+        /// </summary>
+        public long WalCheckpointBytes { get; set; } = 64L * 1024 * 1024;
+
+        /// <summary>
+        /// Metadata fields with bitmap indexes, so filters on them select their candidates before the similarity
+        /// search. Filters on other fields are evaluated against each record's metadata instead.
+        /// </summary>
+        public string[] IndexedMetadataFields { get; set; } = { "sourceFile", "source_file", "fileFormat", "agentId", "tenantId" };
+    }
+}
@@ -0,0 +1,281 @@
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace CxLanguage.StandardLibrary.Services.VectorStore
+{
+    internal enum VectorWalOperation : byte
+    {
+        Upsert = 1,
+        Delete = 2,
+        Clear = 3
+    }
+
+    /// <summary>
+    /// One replayed log entry. Record is set for Upsert, Id for Delete.
+    /// </summary>
+    internal readonly record struct VectorWalEntry(VectorWalOperation Operation, VectorRecord? Record, string? Id);
+
+    /// <summary>
+    /// Append-only log of vector store mutations between segment snapshots.
+    ///
+    /// Frame: [int32 body length][uint32 CRC-32 of body][body], body = [byte operation][operation payload].
+    ///   Upsert: [int32 json length][record json][int32 dimension][dimension x fp32]
+    ///   Delete: [utf-8 id]
+    ///   Clear:  (empty)
+    ///
+    /// Every operation is a last-writer-wins set operation, so replaying a log on top of a snapshot that already
+    /// contains some of its entries yields the same state; this lets a snapshot run without blocking appends.
+    /// A torn or corrupt tail frame ends replay.
+    /// </summary>
+    internal sealed class VectorWriteAheadLog : IDisposable
+    {
+        public const string FileName = "vectors.wal";
+        public const string RotatedFileName = "vectors.wal.1";
+
+        private static readonly uint[] Crc32Table = CreateCrc32Table();
+
+        private readonly object _lock = new();
+        private readonly string _path;
+        private readonly string _rotatedPath;
+        private FileStream _stream;
+        private bool _disposed;
+
+        public VectorWriteAheadLog(string directory)
+        {
+            Directory.CreateDirectory(directory);
+            _path = Path.Combine(directory, FileName);
+            _rotatedPath = Path.Combine(directory, RotatedFileName);
+            _stream = OpenForAppend(_path);
+        }
+
+        public string FilePath => _path;
+
+        public long Length
+        {
+            get { lock (_lock) return _stream.Length; }
+        }
+
+        public void AppendUpsert(VectorRecord record)
+        {
+            var json = VectorRecordSerializer.SerializeRecord(record);
+            var vector = record.ReadVector(Span<float>.Empty);
+            var vectorBytes = MemoryMarshal.AsBytes(vector);
+
+            var body = new byte[1 + sizeof(int) + json.Length + sizeof(int) + vectorBytes.Length];
+            body[0] = (byte)VectorWalOperation.Upsert;
+            BinaryPrimitives.WriteInt32LittleEndian(body.AsSpan(1), json.Length);
+            json.CopyTo(body.AsSpan(1 + sizeof(int)));
+            var vectorStart = 1 + sizeof(int) + json.Length;
+            BinaryPrimitives.WriteInt32LittleEndian(body.AsSpan(vectorStart), vector.Length);
+            vectorBytes.CopyTo(body.AsSpan(vectorStart + sizeof(int)));
+
+            AppendFrame(body);
+        }
+
+        public void AppendDelete(string id)
+        {
+            var body = new byte[1 + Encoding.UTF8.GetByteCount(id)];
+            body[0] = (byte)VectorWalOperation.Delete;
+            Encoding.UTF8.GetBytes(id, body.AsSpan(1));
+            AppendFrame(body);
+        }
+
+        public void AppendClear()
+        {
+            AppendFrame(new[] { (byte)VectorWalOperation.Clear });
+        }
+
+        /// <summary>
+        /// Push buffered frames to the OS, and to the device when durable is set
+        /// </summary>
+        public void Flush(bool durable)
+        {
+            lock (_lock)
+            {
+                if (_disposed) return;
+                _stream.Flush(durable);
+            }
+        }
+
+        /// <summary>
+        /// Move the current log aside before a snapshot and start a new one. Entries in the rotated log are covered
+        /// by the snapshot once it is written, after which CompleteRotation deletes it. A rotated log left behind by
+        /// a failed snapshot is kept and appended to rather than overwritten.
+        /// </summary>
+        public void Rotate()
+        {
+            lock (_lock)
+            {
+                _stream.Flush(true);
+                _stream.Dispose();
+
+                if (File.Exists(_rotatedPath))
+                {
+                    using var rotated = OpenForAppend(_rotatedPath);
+                    using (var current = new FileStream(_path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite))
+                    {
+                        current.CopyTo(rotated);
+                    }
+                    rotated.Flush(true);
+                    File.Delete(_path);
+                }
+                else
+                {
+                    File.Move(_path, _rotatedPath);
+                }
+
+                _stream = OpenForAppend(_path);
+            }
+        }
+
+        public void CompleteRotation()
+        {
+            lock (_lock)
+            {
+                if (File.Exists(_rotatedPath))
+                {
+                    File.Delete(_rotatedPath);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Delete the log files of a storage directory whose segment now covers them. Only for directories no open
+        /// log writes to; an open log drops its entries through Rotate and CompleteRotation instead.
+        /// </summary>
+        public static void DeleteFiles(string directory)
+        {
+            File.Delete(Path.Combine(directory, RotatedFileName));
+            File.Delete(Path.Combine(directory, FileName));
+        }
+
+        /// <summary>
+        /// Log files in a storage directory in replay order (rotated log first)
+        /// </summary>
+        public static IEnumerable<string> GetReplayFiles(string directory)
+        {
+            var rotated = Path.Combine(directory, RotatedFileName);
+            if (File.Exists(rotated)) yield return rotated;
+
+            var current = Path.Combine(directory, FileName);
+            if (File.Exists(current)) yield return current;
+        }
+
+        /// <summary>
+        /// Read the intact entries of a log file, stopping at the first torn or corrupt frame
+        /// </summary>
+        public static IEnumerable<VectorWalEntry> ReadEntries(string path)
+        {
+            using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite | FileShare.Delete, 1 << 16);
+            var header = new byte[8];
+
+            while (true)
+            {
+                if (stream.ReadAtLeast(header, header.Length, throwOnEndOfStream: false) < header.Length)
+                {
+                    yield break;
+                }
+
+                var length = BinaryPrimitives.ReadInt32LittleEndian(header);
+                var checksum = BinaryPrimitives.ReadUInt32LittleEndian(header.AsSpan(4));
+                if (length <= 0 || length > stream.Length - stream.Position)
+                {
+                    yield break;
+                }
+
+                var body = new byte[length];
+                if (stream.ReadAtLeast(body, length, throwOnEndOfStream: false) < length || ComputeCrc32(body) != checksum)
+                {
+                    yield break;
+                }
+
+                var entry = DecodeEntry(body);
+                if (entry is null)
+                {
+                    yield break;
+                }
+                yield return entry.Value;
+            }
+        }
+
+        public void Dispose()
+        {
+            lock (_lock)
+            {
+                if (_disposed) return;
+                _disposed = true;
+                _stream.Flush(true);
+                _stream.Dispose();
+            }
+        }
+
+        private void AppendFrame(byte[] body)
+        {
+            Span<byte> header = stackalloc byte[8];
+            BinaryPrimitives.WriteInt32LittleEndian(header, body.Length);
+            BinaryPrimitives.WriteUInt32LittleEndian(header.Slice(4), ComputeCrc32(body));
+
+            lock (_lock)
+            {
+                ObjectDisposedException.ThrowIf(_disposed, this);
+                _stream.Write(header);
+                _stream.Write(body);
+            }
+        }
+
+        private static VectorWalEntry? DecodeEntry(byte[] body)
+        {
+            var payload = body.AsSpan(1);
+            switch ((VectorWalOperation)body[0])
+            {
+                case VectorWalOperation.Upsert:
+                    {
+                        var jsonLength = BinaryPrimitives.ReadInt32LittleEndian(payload);
+                        var json = payload.Slice(sizeof(int), jsonLength);
+                        var vectorPart = payload.Slice(sizeof(int) + jsonLength);
+                        var dimension = BinaryPrimitives.ReadInt32LittleEndian(vectorPart);
+                        var vector = MemoryMarshal.Cast<byte, float>(vectorPart.Slice(sizeof(int), dimension * sizeof(float))).ToArray();
+                        return new VectorWalEntry(VectorWalOperation.Upsert, VectorRecordSerializer.ReadRecord(json, vector), null);
+                    }
+                case VectorWalOperation.Delete:
+                    return new VectorWalEntry(VectorWalOperation.Delete, null, Encoding.UTF8.GetString(payload));
+                case VectorWalOperation.Clear:
+                    return new VectorWalEntry(VectorWalOperation.Clear, null, null);
+                default:
+                    return null;
+            }
+        }
+
+        private static FileStream OpenForAppend(string path) =>
+            new(path, FileMode.Append, FileAccess.Write, FileShare.Read | FileShare.Delete, 1 << 16);
+
+        private static uint ComputeCrc32(ReadOnlySpan<byte> data)
+        {
+            var crc = 0xFFFFFFFFu;
+            foreach (var b in data)
+            {
+                crc = Crc32Table[(crc ^ b) & 0xFF] ^ (crc >> 8);
+            }
+            return ~crc;
+        }
+
+        private static uint[] CreateCrc32Table()
+        {
+            var table = new uint[256];
+            for (uint i = 0; i < table.Length; i++)
+            {
+                var value = i;
+                for (int bit = 0; bit < 8; bit++)
+                {
+                    value = (value & 1) != 0 ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+                }
+                table[i] = value;
+            }
+            return table;
+        }
+    }
+}
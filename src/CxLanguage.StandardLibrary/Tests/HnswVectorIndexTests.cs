@@ -0,0 +1,137 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using CxLanguage.StandardLibrary.Services.VectorStore;
+
+namespace CxLanguage.StandardLibrary.Tests
+{
+    /// <summary>
+    /// Upsert, delete and search invariants of the HNSW vector index
+    /// </summary>
+    public class HnswVectorIndexTests
+    {
+        private const int Dimension = 16;
+
+        /// <summary>
+        /// Updating the only live node must leave a searchable graph
+        /// </summary>
+        public static void TestUpsertSameIdTwice()
+        {
+            var index = new HnswVectorIndex(m: 8, efConstruction: 64, efSearch: 32);
+            index.Upsert("a", RandomVector(new Random(1)));
+            var updated = RandomVector(new Random(2));
+            index.Upsert("a", updated);
+
+            TestAssert.Equal(1, index.Count, "count after updating the only record");
+            var results = index.Search(updated, 5);
+            TestAssert.Equal(1, results.Count, "results after updating the only record");
+            TestAssert.Equal("a", results[0].Id, "updated record is found");
+            TestAssert.True(results[0].Score > 0.999f, "updated record is scored with its new vector");
+        }
+
+        /// <summary>
+        /// Updating a record whose neighbours are all tombstones must keep every live record reachable
+        /// </summary>
+        public static void TestUpsertAmongTombstones()
+        {
+            var random = new Random(3);
+            var index = new HnswVectorIndex(m: 4, efConstruction: 16, efSearch: 16);
+            var vectors = new Dictionary<string, float[]>();
+            for (int i = 0; i < 40; i++)
+            {
+                vectors[$"r{i}"] = RandomVector(random);
+                index.Upsert($"r{i}", vectors[$"r{i}"]);
+            }
+
+            for (int i = 1; i < 39; i++)
+            {
+                index.Remove($"r{i}");
+                vectors.Remove($"r{i}");
+            }
+            for (int update = 0; update < 3; update++)
+            {
+                vectors["r0"] = RandomVector(random);
+                index.Upsert("r0", vectors["r0"]);
+            }
+
+            TestAssert.Equal(2, index.Count, "live count");
+            foreach (var (id, vector) in vectors)
+            {
+                var results = index.Search(vector, 2);
+                TestAssert.Equal(2, results.Count, $"both live records are reachable from {id}");
+                TestAssert.Equal(id, results[0].Id, $"{id} is its own nearest neighbour");
+            }
+        }
+
+        /// <summary>
+        /// Deleted records are never returned; every live record finds itself; counts track live records
+        /// </summary>
+        public static void TestDeleteAndSearchInvariants()
+        {
+            var random = new Random(4);
+            var index = new HnswVectorIndex(m: 8, efConstruction: 100, efSearch: 64);
+            var vectors = new Dictionary<string, float[]>();
+            for (int i = 0; i < 500; i++)
+            {
+                vectors[$"r{i}"] = RandomVector(random);
+                index.Upsert($"r{i}", vectors[$"r{i}"]);
+            }
+
+            var deleted = new HashSet<string>();
+            for (int i = 0; i < 500; i += 3)
+            {
+                TestAssert.True(index.Remove($"r{i}"), $"r{i} is removed");
+                deleted.Add($"r{i}");
+                vectors.Remove($"r{i}");
+            }
+            TestAssert.True(!index.Remove("r0"), "a removed record cannot be removed twice");
+
+            // Updates in place must not duplicate records
+            for (int i = 1; i < 500; i += 7)
+            {
+                if (vectors.ContainsKey($"r{i}"))
+                {
+                    vectors[$"r{i}"] = RandomVector(random);
+                    index.Upsert($"r{i}", vectors[$"r{i}"]);
+                }
+            }
+
+            TestAssert.Equal(vectors.Count, index.Count, "live count after deletes and updates");
+
+            var selfHits = 0;
+            foreach (var (id, vector) in vectors)
+            {
+                var results = index.Search(vector, 10);
+                TestAssert.True(results.All(r => !deleted.Contains(r.Id)), "deleted records are never returned");
+                TestAssert.Equal(results.Count, results.Select(r => r.Id).Distinct().Count(), "results have no duplicates");
+                if (results.Count > 0 && results[0].Id == id)
+                {
+                    selfHits++;
+                }
+            }
+            TestAssert.True(selfHits >= vectors.Count * 0.98, $"records find themselves ({selfHits}/{vectors.Count})");
+
+            var exact = index.SearchExact(vectors.First().Value, 10);
+            TestAssert.True(exact.All(r => !deleted.Contains(r.Id)), "exact search skips deleted records");
+        }
+
+        public static void RunAll()
+        {
+            Console.WriteLine("🧪 Running HNSW vector index tests...");
+            TestUpsertSameIdTwice();
+            TestUpsertAmongTombstones();
+            TestDeleteAndSearchInvariants();
+            Console.WriteLine("✅ HNSW vector index tests passed");
+        }
+
+        internal static float[] RandomVector(Random random, int dimension = Dimension)
+        {
+            var vector = new float[dimension];
+            for (int i = 0; i < vector.Length; i++)
+            {
+                vector[i] = (float)(random.NextDouble() * 2 - 1);
+            }
+            return vector;
+        }
+    }
+}
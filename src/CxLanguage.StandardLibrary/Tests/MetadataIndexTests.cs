@@ -0,0 +1,158 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text.Json;
+using CxLanguage.StandardLibrary.Services.VectorStore;
+
+namespace CxLanguage.StandardLibrary.Tests
+{
+    /// <summary>
+    /// MetadataIndex pre-filtering checked against MetadataFilter.Matches on every record
+    /// </summary>
+    public class MetadataIndexTests
+    {
+        private static readonly string[] IndexedFields = { "tenant", "tags", "priority" };
+        private static readonly string[] Tenants = { "acme", "globex", "initech" };
+        private static readonly string[] Tags = { "red", "green", "blue", "gold" };
+
+        /// <summary>
+        /// For every operator, the ids resolved from the bitmaps are exactly the records whose metadata matches
+        /// </summary>
+        public static void TestResolveMatchesFilter()
+        {
+            var random = new Random(1);
+            var index = new MetadataIndex(IndexedFields);
+            var records = new Dictionary<string, VectorRecord>();
+            for (int i = 0; i < 3_000; i++)
+            {
+                var record = CreateRecord($"r{i}", random);
+                records[record.Id] = record;
+                index.Upsert(record);
+            }
+
+            var filters = new[]
+            {
+                Filter(("tenant", "acme")),
+                Filter(("tags", new[] { "red", "gold" })),
+                Filter(("tenant", Operator("$ne", "globex"))),
+                Filter(("tags", Operator("$nin", new[] { "blue" }))),
+                Filter(("priority", Operator("$exists", false))),
+                Filter(("tags", Operator("$exists", true))),
+                Filter(("priority", 3)),
+                Filter(("tenant", "acme"), ("tags", "green"), ("priority", Operator("$in", new object[] { 1, 2 }))),
+                Filter(("tenant", "nobody"))
+            };
+
+            foreach (var filter in filters)
+            {
+                AssertResolves(index, records, filter);
+            }
+        }
+
+        /// <summary>
+        /// Re-indexing a record replaces its old values; removed records disappear and their ordinals are reused
+        /// </summary>
+        public static void TestUpsertRemoveAndReuse()
+        {
+            var random = new Random(2);
+            var index = new MetadataIndex(IndexedFields);
+            var records = new Dictionary<string, VectorRecord>();
+            for (int i = 0; i < 500; i++)
+            {
+                var record = CreateRecord($"r{i}", random);
+                records[record.Id] = record;
+                index.Upsert(record);
+            }
+
+            for (int i = 0; i < 500; i += 2)
+            {
+                index.Remove($"r{i}");
+                records.Remove($"r{i}");
+            }
+            for (int i = 1; i < 500; i += 3)
+            {
+                var replaced = CreateRecord($"r{i}", random);
+                records[replaced.Id] = replaced;
+                index.Upsert(replaced);
+            }
+            for (int i = 500; i < 700; i++)
+            {
+                var record = CreateRecord($"r{i}", random);
+                records[record.Id] = record;
+                index.Upsert(record);
+            }
+
+            AssertResolves(index, records, Filter(("tenant", "initech")));
+            AssertResolves(index, records, Filter(("tags", Operator("$ne", "red"))));
+            AssertResolves(index, records, Filter(("priority", Operator("$exists", true))));
+
+            var metrics = new Dictionary<string, object>();
+            index.AddMetrics(metrics);
+            TestAssert.Equal(records.Count, metrics["metadata_indexed_records"], "indexed record count");
+
+            index.Clear();
+            TestAssert.Equal(0, index.Resolve(Filter(("tenant", Operator("$exists", true))))!.Count, "nothing resolves after Clear");
+        }
+
+        /// <summary>
+        /// Filters on fields without an index return null so the caller scans, and parsing accepts JSON payloads
+        /// </summary>
+        public static void TestUnindexedFieldsAndJsonFilters()
+        {
+            var index = new MetadataIndex(IndexedFields);
+            var record = new VectorRecord
+            {
+                Id = "only",
+                Metadata = new Dictionary<string, object> { ["tenant"] = "acme", ["owner"] = "ann", ["tags"] = new List<string> { "red" } }
+            };
+            index.Upsert(record);
+
+            TestAssert.True(index.Resolve(Filter(("owner", "ann"))) == null, "a filter on unindexed fields is not resolved");
+
+            using var json = JsonDocument.Parse("""{ "tenant": { "$in": ["acme", "globex"] }, "owner": "ann", "tags": "red" }""");
+            var filter = MetadataFilter.Parse(json.RootElement.Clone());
+            TestAssert.Equal(3, filter.Conditions.Count, "conditions parsed from JSON");
+            TestAssert.Equal("only", index.Resolve(filter)!.Single(), "indexed conditions of a JSON filter resolve");
+            TestAssert.True(filter.Matches(record.Metadata), "the full JSON filter matches the record");
+            TestAssert.True(!MetadataFilter.Parse(new Dictionary<string, object> { ["owner"] = "bob" }).Matches(record.Metadata),
+                "an unindexed condition still filters through Matches");
+        }
+
+        public static void RunAll()
+        {
+            Console.WriteLine("🧪 Running metadata index tests...");
+            TestResolveMatchesFilter();
+            TestUpsertRemoveAndReuse();
+            TestUnindexedFieldsAndJsonFilters();
+            Console.WriteLine("✅ Metadata index tests passed");
+        }
+
+        private static void AssertResolves(MetadataIndex index, Dictionary<string, VectorRecord> records, MetadataFilter filter)
+        {
+            var name = string.Join(" and ", filter.Conditions.Select(c => $"{c.Field} {c.Operator} [{string.Join(",", c.Values)}]"));
+            var expected = records.Values.Where(r => filter.Matches(r.Metadata)).Select(r => r.Id).OrderBy(id => id, StringComparer.Ordinal);
+            var resolved = index.Resolve(filter);
+            TestAssert.True(resolved != null, $"{name} is resolved from the index");
+            TestAssert.True(expected.SequenceEqual(resolved!.OrderBy(id => id, StringComparer.Ordinal)), $"{name} resolves the matching records");
+        }
+
+        private static VectorRecord CreateRecord(string id, Random random)
+        {
+            var metadata = new Dictionary<string, object>
+            {
+                ["tenant"] = Tenants[random.Next(Tenants.Length)],
+                ["tags"] = Tags.Where(_ => random.Next(3) == 0).ToList()
+            };
+            if (random.Next(4) != 0)
+            {
+                metadata["priority"] = random.Next(1, 5);
+            }
+            return new VectorRecord { Id = id, Metadata = metadata };
+        }
+
+        private static MetadataFilter Filter(params (string Field, object Spec)[] conditions) =>
+            MetadataFilter.Parse(conditions.ToDictionary(c => c.Field, c => c.Spec));
+
+        private static Dictionary<string, object> Operator(string op, object operand) => new() { [op] = operand };
+    }
+}
@@ -0,0 +1,138 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using CxLanguage.StandardLibrary.Services.VectorStore;
+
+namespace CxLanguage.StandardLibrary.Tests
+{
+    /// <summary>
+    /// Recall of the quantized indices measured against the exact flat index, with vectors read from the heap
+    /// and from a mapped segment
+    /// </summary>
+    public class QuantizedVectorIndexTests
+    {
+        private const int Dimension = 32;
+        private const int RecordCount = 2_000;
+        private const int QueryCount = 50;
+        private const int TopK = 10;
+
+        /// <summary>
+        /// int8 codes plus exact re-ranking should return nearly the same top 10 as the flat index
+        /// </summary>
+        public static void TestInt8RecallAgainstFlat()
+        {
+            var recall = MeasureRecall(VectorQuantization.Int8, CreateRecords(out var reader), reader);
+            TestAssert.True(recall >= 0.95, $"int8 recall@{TopK} is {recall:F3}");
+        }
+
+        /// <summary>
+        /// Product quantization is coarser; re-ranking the short list recovers most of the exact top 10
+        /// </summary>
+        public static void TestProductRecallAgainstFlat()
+        {
+            var recall = MeasureRecall(VectorQuantization.Product, CreateRecords(out var reader), reader);
+            TestAssert.True(recall >= 0.8, $"product quantization recall@{TopK} is {recall:F3}");
+        }
+
+        /// <summary>
+        /// Re-ranking from mapped segment rows ranks exactly as re-ranking from heap vectors, and the records
+        /// keep no fp32 copy of their own
+        /// </summary>
+        public static void TestRerankFromMappedSegment()
+        {
+            var directory = Path.Combine(Path.GetTempPath(), "cx-quantized-" + Guid.NewGuid().ToString("N"));
+            Directory.CreateDirectory(directory);
+            try
+            {
+                var heapRecords = CreateRecords(out var heapReader);
+                var path = Path.Combine(directory, VectorSegmentFile.FileName);
+                VectorSegmentFile.Write(path, heapRecords.Values.ToList());
+
+                using var segment = MappedVectorSegment.Open(path);
+                var mappedRecords = new Dictionary<string, VectorRecord>();
+                for (int row = 0; row < segment.Count; row++)
+                {
+                    var record = segment.ReadRecord(row, mapVector: true);
+                    TestAssert.True(record.VectorSource is MappedVectorRow, $"{record.Id} reads its vector from the mapping");
+                    mappedRecords[record.Id] = record;
+                }
+                ExactVectorReader mappedReader = (id, destination) =>
+                    mappedRecords.TryGetValue(id, out var record) && record.TryCopyVector(destination);
+
+                var heapIndex = CreateIndex(VectorQuantization.Int8, heapRecords, heapReader);
+                var mappedIndex = CreateIndex(VectorQuantization.Int8, mappedRecords, mappedReader);
+                var random = new Random(11);
+                for (int q = 0; q < QueryCount; q++)
+                {
+                    var query = HnswVectorIndexTests.RandomVector(random, Dimension);
+                    var fromHeap = heapIndex.Search(query, TopK);
+                    var fromMapping = mappedIndex.Search(query, TopK);
+                    TestAssert.Equal(string.Join(",", fromHeap.Select(r => r.Id)), string.Join(",", fromMapping.Select(r => r.Id)),
+                        $"query {q} ranks the same from the mapping");
+                }
+
+                var first = mappedRecords.Values.First();
+                TestAssert.True(first.Vector.SequenceEqual(heapRecords[first.Id].Vector), "Vector reads the mapped row");
+                TestAssert.True(first.VectorSource is float[] && ReferenceEquals(first.Vector, first.Vector),
+                    "reading Vector moves the row onto the heap once, so writes into it are kept");
+            }
+            finally
+            {
+                Directory.Delete(directory, recursive: true);
+            }
+        }
+
+        public static void RunAll()
+        {
+            Console.WriteLine("🧪 Running quantized vector index tests...");
+            TestInt8RecallAgainstFlat();
+            TestProductRecallAgainstFlat();
+            TestRerankFromMappedSegment();
+            Console.WriteLine("✅ Quantized vector index tests passed");
+        }
+
+        private static double MeasureRecall(VectorQuantization quantization, Dictionary<string, VectorRecord> records, ExactVectorReader reader)
+        {
+            var flat = new FlatVectorIndex();
+            foreach (var record in records.Values)
+            {
+                flat.Upsert(record.Id, record.Vector);
+            }
+            var quantized = CreateIndex(quantization, records, reader);
+
+            var random = new Random(7);
+            var hits = 0;
+            for (int q = 0; q < QueryCount; q++)
+            {
+                var query = HnswVectorIndexTests.RandomVector(random, Dimension);
+                var expected = flat.Search(query, TopK).Select(r => r.Id).ToHashSet();
+                hits += quantized.Search(query, TopK).Count(r => expected.Contains(r.Id));
+            }
+            return (double)hits / (QueryCount * TopK);
+        }
+
+        private static QuantizedVectorIndex CreateIndex(VectorQuantization quantization, Dictionary<string, VectorRecord> records, ExactVectorReader reader)
+        {
+            var index = new QuantizedVectorIndex(quantization, productSubvectors: 8, trainingSize: 500, rerankFactor: 4, reader);
+            foreach (var record in records.Values)
+            {
+                index.Upsert(record.Id, record.Vector);
+            }
+            return index;
+        }
+
+        private static Dictionary<string, VectorRecord> CreateRecords(out ExactVectorReader reader)
+        {
+            var random = new Random(5);
+            var records = new Dictionary<string, VectorRecord>();
+            for (int i = 0; i < RecordCount; i++)
+            {
+                records[$"r{i}"] = new VectorRecord { Id = $"r{i}", Vector = HnswVectorIndexTests.RandomVector(random, Dimension) };
+            }
+
+            reader = (id, destination) => records.TryGetValue(id, out var record) && record.TryCopyVector(destination);
+            return records;
+        }
+    }
+}
@@ -0,0 +1,138 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using CxLanguage.StandardLibrary.Services.VectorStore;
+
+namespace CxLanguage.StandardLibrary.Tests
+{
+    /// <summary>
+    /// RoaringBitmap checked against a SortedSet model, across sparse (array) and dense (bitmap) containers
+    /// </summary>
+    public class RoaringBitmapTests
+    {
+        /// <summary>
+        /// Add, Remove, Contains, Cardinality and ordered enumeration agree with the model as containers
+        /// convert between the array and bitmap forms
+        /// </summary>
+        public static void TestMutationsMatchModel()
+        {
+            var random = new Random(1);
+            var bitmap = new RoaringBitmap();
+            var model = new SortedSet<int>();
+
+            // Dense in the first container (past the 4096-value array limit), sparse across later ones
+            for (int i = 0; i < 20_000; i++)
+            {
+                var value = i % 2 == 0 ? random.Next(0, 10_000) : random.Next(0, 400_000);
+                TestAssert.Equal(model.Add(value), bitmap.Add(value), $"Add({value}) reports whether it was new");
+            }
+            AssertSame(model, bitmap, "after adds");
+
+            // Remove most values so the dense container converts back to an array
+            foreach (var value in model.Where(v => v % 5 != 0).ToList())
+            {
+                TestAssert.True(bitmap.Remove(value), $"Remove({value}) finds the value");
+                model.Remove(value);
+            }
+            TestAssert.True(!bitmap.Remove(500_000), "removing an absent value reports false");
+            AssertSame(model, bitmap, "after removes");
+
+            foreach (var value in model.ToList())
+            {
+                bitmap.Remove(value);
+            }
+            TestAssert.True(bitmap.IsEmpty, "removing every value empties the bitmap");
+            TestAssert.Equal(0, bitmap.Cardinality, "cardinality of the emptied bitmap");
+        }
+
+        /// <summary>
+        /// And, Or and AndNot agree with the model for every pairing of sparse and dense operands
+        /// </summary>
+        public static void TestSetAlgebraMatchesModel()
+        {
+            var random = new Random(2);
+            var shapes = new (int Count, int Range)[]
+            {
+                (200, 70_000),      // sparse, two containers
+                (6_000, 8_000),     // dense, one container
+                (30_000, 200_000),  // dense and sparse containers mixed
+                (0, 1)              // empty
+            };
+
+            foreach (var left in shapes)
+            {
+                foreach (var right in shapes)
+                {
+                    var (leftBitmap, leftModel) = Create(random, left.Count, left.Range);
+                    var (rightBitmap, rightModel) = Create(random, right.Count, right.Range);
+                    var name = $"{left.Count}/{left.Range} with {right.Count}/{right.Range}";
+
+                    var and = new SortedSet<int>(leftModel);
+                    and.IntersectWith(rightModel);
+                    AssertSame(and, RoaringBitmap.And(leftBitmap, rightBitmap), $"And of {name}");
+
+                    var or = new SortedSet<int>(leftModel);
+                    or.UnionWith(rightModel);
+                    AssertSame(or, RoaringBitmap.Or(leftBitmap, rightBitmap), $"Or of {name}");
+
+                    var andNot = new SortedSet<int>(leftModel);
+                    andNot.ExceptWith(rightModel);
+                    AssertSame(andNot, RoaringBitmap.AndNot(leftBitmap, rightBitmap), $"AndNot of {name}");
+
+                    AssertSame(leftModel, leftBitmap, $"operands are unchanged by {name}");
+                }
+            }
+        }
+
+        /// <summary>
+        /// A clone is independent of the bitmap it was taken from
+        /// </summary>
+        public static void TestCloneIsIndependent()
+        {
+            var (bitmap, model) = Create(new Random(3), 5_000, 6_000);
+            var clone = bitmap.Clone();
+            clone.Add(1_000_000);
+            foreach (var value in model.Take(100))
+            {
+                clone.Remove(value);
+            }
+
+            AssertSame(model, bitmap, "original after mutating the clone");
+            TestAssert.Equal(model.Count - 100 + 1, clone.Cardinality, "clone cardinality");
+        }
+
+        public static void RunAll()
+        {
+            Console.WriteLine("🧪 Running roaring bitmap tests...");
+            TestMutationsMatchModel();
+            TestSetAlgebraMatchesModel();
+            TestCloneIsIndependent();
+            Console.WriteLine("✅ Roaring bitmap tests passed");
+        }
+
+        private static (RoaringBitmap Bitmap, SortedSet<int> Model) Create(Random random, int count, int range)
+        {
+            var bitmap = new RoaringBitmap();
+            var model = new SortedSet<int>();
+            for (int i = 0; i < count; i++)
+            {
+                var value = random.Next(0, range);
+                bitmap.Add(value);
+                model.Add(value);
+            }
+            return (bitmap, model);
+        }
+
+        private static void AssertSame(SortedSet<int> model, RoaringBitmap bitmap, string context)
+        {
+            TestAssert.Equal(model.Count, bitmap.Cardinality, $"cardinality {context}");
+            TestAssert.Equal(model.Count == 0, bitmap.IsEmpty, $"IsEmpty {context}");
+            TestAssert.True(model.SequenceEqual(bitmap.Enumerate()), $"values in ascending order {context}");
+            foreach (var value in model.Take(50))
+            {
+                TestAssert.True(bitmap.Contains(value), $"Contains({value}) {context}");
+            }
+            TestAssert.True(!bitmap.Contains(int.MaxValue), $"a value never added is absent {context}");
+        }
+    }
+}
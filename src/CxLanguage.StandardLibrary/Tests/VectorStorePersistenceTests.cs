@@ -0,0 +1,149 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Threading.Tasks;
+using CxLanguage.Runtime;
+using CxLanguage.StandardLibrary.Services.VectorStore;
+using Microsoft.Extensions.Logging.Abstractions;
+using Microsoft.Extensions.Options;
+
+namespace CxLanguage.StandardLibrary.Tests
+{
+    /// <summary>
+    /// Segment snapshots and write-ahead log replay of InMemoryVectorStoreService
+    /// </summary>
+    public class VectorStorePersistenceTests
+    {
+        private const int Dimension = 16;
+
+        /// <summary>
+        /// A manual save covers every log entry already in the directory, so a later load must not replay them
+        /// </summary>
+        public static async Task TestSaveDeleteSaveLoadIgnoresStaleLog()
+        {
+            await WithStorageDirectory(async directory =>
+            {
+                // A log left behind by an earlier automatic-persistence session
+                using (var staleLog = new VectorWriteAheadLog(directory))
+                {
+                    staleLog.AppendUpsert(CreateRecord("b", new Random(99)));
+                    staleLog.AppendDelete("c");
+                    staleLog.AppendClear();
+                }
+
+                using var store = await CreateStoreAsync(new VectorStoreOptions());
+                var random = new Random(1);
+                foreach (var id in new[] { "a", "b", "c" })
+                {
+                    await store.AddAsync(CreateRecord(id, random));
+                }
+
+                await AssertSucceeded(store.SaveToPersistentStorageAsync(directory), "first save");
+                TestAssert.True(await store.DeleteAsync("b"), "b is deleted");
+                await AssertSucceeded(store.SaveToPersistentStorageAsync(directory), "second save");
+
+                TestAssert.True(!File.Exists(Path.Combine(directory, VectorWriteAheadLog.FileName)), "the stale log is removed");
+                TestAssert.True(!File.Exists(Path.Combine(directory, VectorWriteAheadLog.RotatedFileName)), "the stale rotated log is removed");
+
+                var loaded = await AssertSucceeded(store.LoadFromPersistentStorageAsync(directory), "load");
+                TestAssert.Equal(0, loaded["walEntriesReplayed"], "no stale entries are replayed");
+                TestAssert.Equal("a,c", string.Join(",", (await store.ListIdsAsync()).OrderBy(id => id)), "ids after load");
+            });
+        }
+
+        /// <summary>
+        /// The same round trip with a quantized index, whose records read their vectors from the mapped segment
+        /// </summary>
+        public static async Task TestQuantizedStoreRoundTrip()
+        {
+            await WithStorageDirectory(async directory =>
+            {
+                using var store = await CreateStoreAsync(new VectorStoreOptions { Quantization = VectorQuantization.Int8 });
+                var random = new Random(2);
+                var vectors = new Dictionary<string, float[]>();
+                for (int i = 0; i < 50; i++)
+                {
+                    var record = CreateRecord($"r{i}", random);
+                    vectors[record.Id] = record.Vector;
+                    await store.AddAsync(record);
+                }
+
+                await AssertSucceeded(store.SaveToPersistentStorageAsync(directory), "first save");
+                TestAssert.True(await store.DeleteAsync("r0"), "r0 is deleted");
+                vectors.Remove("r0");
+                await AssertSucceeded(store.SaveToPersistentStorageAsync(directory), "second save");
+                await AssertSucceeded(store.LoadFromPersistentStorageAsync(directory), "load");
+
+                TestAssert.Equal(vectors.Count, await store.GetCountAsync(), "count after load");
+                foreach (var (id, vector) in vectors)
+                {
+                    var record = await store.GetAsync(id);
+                    TestAssert.True(record != null && record.VectorSource is MappedVectorRow, $"{id} reads its vector from the segment");
+                    TestAssert.True(record!.CopyVector().SequenceEqual(vector), $"{id} keeps its vector");
+
+                    var nearest = (await store.SearchVectorAsync(vector, 1)).Single();
+                    TestAssert.Equal(id, nearest.Id, $"{id} is its own nearest neighbour");
+                }
+
+                // Saving again releases the previous mapping; a deleted record still held gets its vector back
+                var held = await store.GetAsync("r1");
+                TestAssert.True(held!.VectorSource is MappedVectorRow, "reading a copy leaves the record mapped");
+                TestAssert.True(await store.DeleteAsync("r1"), "r1 is deleted");
+                await AssertSucceeded(store.SaveToPersistentStorageAsync(directory), "third save");
+                TestAssert.True(held.VectorSource is float[], "the held record no longer reads the released segment");
+                TestAssert.True(held.Vector.SequenceEqual(vectors["r1"]), "the held record keeps its vector");
+            });
+        }
+
+        public static void RunAll()
+        {
+            Console.WriteLine("🧪 Running vector store persistence tests...");
+            TestSaveDeleteSaveLoadIgnoresStaleLog().GetAwaiter().GetResult();
+            TestQuantizedStoreRoundTrip().GetAwaiter().GetResult();
+            Console.WriteLine("✅ Vector store persistence tests passed");
+        }
+
+        private static async Task<InMemoryVectorStoreService> CreateStoreAsync(VectorStoreOptions options)
+        {
+            var store = new InMemoryVectorStoreService(
+                NullLogger<InMemoryVectorStoreService>.Instance,
+                new UnifiedEventBus(),
+                options: Options.Create(options));
+
+            // The constructor loads the default storage directory in the background; start from an empty store
+            await store.StartupLoad;
+            await store.ClearAsync();
+            return store;
+        }
+
+        private static async Task WithStorageDirectory(Func<string, Task> test)
+        {
+            var directory = Path.Combine(Path.GetTempPath(), "cx-vectorstore-" + Guid.NewGuid().ToString("N"));
+            Directory.CreateDirectory(directory);
+            try
+            {
+                await test(directory);
+            }
+            finally
+            {
+                Directory.Delete(directory, recursive: true);
+            }
+        }
+
+        private static async Task<Dictionary<string, object>> AssertSucceeded(Task<Dictionary<string, object>> operation, string name)
+        {
+            var result = await operation;
+            TestAssert.True(result.TryGetValue("success", out var success) && success.Equals(true),
+                $"{name} succeeds ({(result.TryGetValue("error", out var error) ? error : "no error")})");
+            return result;
+        }
+
+        private static VectorRecord CreateRecord(string id, Random random) => new()
+        {
+            Id = id,
+            Content = $"content {id}",
+            Vector = HnswVectorIndexTests.RandomVector(random, Dimension)
+        };
+    }
+}